@@ -0,0 +1,51 @@
+function( COMPILE_SPIRV_SHADERS target source_dir output_dir )
+    message( CHECK_START "compiling SPIR-V shaders of ${target}" )
+
+    list( APPEND CMAKE_MESSAGE_INDENT "  " )
+
+        # glslangValidator is part of Vulkan SDK,
+        # without it the target loads GLSL sources in runtime
+        find_program( GLSLANG_VALIDATOR
+            NAMES glslangValidator
+            HINTS "$ENV{VULKAN_SDK}/bin" "$ENV{VULKAN_SDK}/Bin"
+        )
+
+        file( GLOB shaders
+            "${source_dir}/*.vert"
+            "${source_dir}/*.frag"
+            "${source_dir}/*.comp"
+        )
+
+        set( spirv_files "" )
+        if( GLSLANG_VALIDATOR )
+            foreach( shader ${shaders} )
+                get_filename_component( shader_name ${shader} NAME )
+                set( spirv "${output_dir}/${shader_name}.spv" )
+
+                # -G - SPIR-V for OpenGL (GL_ARB_gl_spirv), not for Vulkan
+                add_custom_command(
+                    OUTPUT  ${spirv}
+                    COMMAND ${CMAKE_COMMAND} -E make_directory ${output_dir}
+                    COMMAND ${GLSLANG_VALIDATOR} -G -o ${spirv} ${shader}
+                    DEPENDS ${shader}
+                    COMMENT "Compiling ${shader_name} to SPIR-V"
+                    VERBATIM
+                )
+                list( APPEND spirv_files ${spirv} )
+            endforeach()
+
+            target_sources( ${target}
+                PRIVATE
+                    ${spirv_files}
+            )
+        endif()
+
+    list( POP_BACK CMAKE_MESSAGE_INDENT )
+
+    if( GLSLANG_VALIDATOR )
+        message( CHECK_PASS "done" )
+    else()
+        message( CHECK_FAIL "glslangValidator is not found, GLSL shaders will be used" )
+    endif()
+
+endfunction()
@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+#
+# Generates src/glad_lazy.c from the Glad sources of this directory:
+# the prototypes are taken from include/glad/glad.h and the list of the
+# functions of every core version from the load_GL_VERSION_* functions
+# of src/glad.c, so the lazy loader always matches the generated Glad.
+#
+# Run it after every regeneration of Glad:
+#
+#     python3 gen_glad_lazy.py
+#
+
+import os
+import re
+import sys
+
+root = os.path.dirname( os.path.abspath( __file__ ) )
+
+header_path = os.path.join( root, 'include', 'glad', 'glad.h' )
+source_path = os.path.join( root, 'src', 'glad.c' )
+output_path = os.path.join( root, 'src', 'glad_lazy.c' )
+
+prologue = '''/*
+
+    Lazy OpenGL loader for glad {version}.
+
+    Specification: gl
+    APIs: gl={api}
+    Profile: {profile}
+
+    Every function pointer of the supported core versions starts as a trampoline,
+    which resolves the real entry point on the first call and patches the pointer,
+    so following calls go directly to the driver.
+
+    Generated by gen_glad_lazy.py from include/glad/glad.h and the
+    load_GL_VERSION_* functions of src/glad.c, don't edit it by hand.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glad/glad_lazy.h>
+
+static GLADloadproc lazy_load = NULL;
+
+static void* resolve(const char *name) {{
+    void *proc = lazy_load(name);
+    if(proc == NULL) {{
+        fprintf(stderr, "glad: cannot resolve %s\\n", name);
+        abort();
+    }}
+    return proc;
+}}
+
+'''
+
+find_core_head = '''static void lazy_find_coreGL(void) {
+    int i, major = 0, minor = 0;
+
+    const char* version;
+    const char* prefixes[] = {
+        "OpenGL ES-CM ",
+        "OpenGL ES-CL ",
+        "OpenGL ES ",
+        NULL
+    };
+
+    version = (const char*) glGetString(GL_VERSION);
+    if (!version) return;
+
+    for (i = 0;  prefixes[i];  i++) {
+        const size_t length = strlen(prefixes[i]);
+        if (strncmp(version, prefixes[i], length) == 0) {
+            version += length;
+            break;
+        }
+    }
+
+#ifdef _MSC_VER
+    sscanf_s(version, "%d.%d", &major, &minor);
+#else
+    sscanf(version, "%d.%d", &major, &minor);
+#endif
+
+    GLVersion.major = major; GLVersion.minor = minor;
+'''
+
+loader = '''
+int gladLoadGLLoaderLazy(GLADloadproc load) {{
+	PFNGLGETSTRINGPROC get_string;
+
+	GLVersion.major = 0; GLVersion.minor = 0;
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	lazy_find_coreGL();
+
+	/* glGetString is already resolved, it doesn't need a trampoline */
+	get_string = glad_glGetString;
+	lazy_load = load;
+{install}	glad_glGetString = get_string;
+
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}}
+'''
+
+def read( path ):
+    with open( path, 'r' ) as f:
+        return f.read()
+
+def argument_names( args ):
+    if args.strip() == 'void':
+        return []
+    names = []
+    for arg in args.split( ',' ):
+        name = re.search( r'(\w+)\s*(\[[^\]]*\])?\s*$', arg.strip() )
+        if not name:
+            sys.exit( 'cannot parse argument "%s"' % arg )
+        names.append( name.group( 1 ) )
+    return names
+
+def main():
+    header = read( header_path )
+    source = read( source_path )
+
+    version = re.search( r'generated by glad (\S+)', source )
+    api = re.search( r'APIs: gl=([\d.]+)', source )
+    profile = re.search( r'Profile: (\w+)', source )
+    if not version or not api or not profile:
+        sys.exit( 'src/glad.c does not look like a Glad 0.1 source' )
+
+    prototypes = {}
+    for match in re.finditer( r'^typedef (.+?) \(APIENTRYP (PFNGL\w+PROC)\)\((.*)\);$', header, re.M ):
+        prototypes[ match.group( 2 ) ] = ( match.group( 1 ), match.group( 3 ) )
+
+    versions = []
+    for match in re.finditer( r'^static void load_(GL_VERSION_(\d+)_(\d+))\(GLADloadproc load\) \{\n(.*?)^\}', source, re.M | re.S ):
+        functions = re.findall( r'glad_(\w+) = \((PFNGL\w+PROC)\)load\("(\w+)"\);', match.group( 4 ) )
+        versions.append( ( match.group( 1 ), int( match.group( 2 ) ), int( match.group( 3 ) ), functions ) )
+    if not versions:
+        sys.exit( 'no load_GL_VERSION_* functions in src/glad.c' )
+
+    out = [ prologue.format( version = version.group( 1 ), api = api.group( 1 ), profile = profile.group( 1 ) ) ]
+
+    # trampolines, one per function, the same function might be listed by several versions
+    emitted = set()
+    for _, _, _, functions in versions:
+        for pointer, pfn, name in functions:
+            if name in emitted:
+                continue
+            emitted.add( name )
+            if pfn not in prototypes:
+                sys.exit( 'no prototype for %s' % name )
+            result, args = prototypes[ pfn ]
+            call = '%s(%s)' % ( 'glad_' + pointer, ', '.join( argument_names( args ) ) )
+            out.append( 'static %s APIENTRY lazy_%s(%s) {\n' % ( result, name, args ) )
+            out.append( '\tglad_%s = (%s)resolve("%s");\n' % ( pointer, pfn, name ) )
+            out.append( '\t%s%s;\n' % ( '' if result == 'void' else 'return ', call ) )
+            out.append( '}\n' )
+
+    for flag, _, _, functions in versions:
+        out.append( 'static void lazy_%s(void) {\n' % flag )
+        out.append( '\tif(!GLAD_%s) return;\n' % flag )
+        for pointer, _, name in functions:
+            out.append( '\tglad_%s = lazy_%s;\n' % ( pointer, name ) )
+        out.append( '}\n' )
+
+    out.append( '\n' )
+    out.append( find_core_head )
+    for flag, major, minor, _ in versions:
+        out.append( '\tGLAD_%s = (major == %d && minor >= %d) || major > %d;\n' % ( flag, major, minor, major ) )
+    out.append( '}\n' )
+
+    install = ''.join( '\tlazy_%s();\n' % flag for flag, _, _, _ in versions )
+    out.append( loader.format( install = install ) )
+
+    with open( output_path, 'w', newline = '\n' ) as f:
+        f.write( ''.join( out ) )
+
+if __name__ == '__main__':
+    main()
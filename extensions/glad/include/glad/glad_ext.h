@@ -0,0 +1,30 @@
+/*
+
+    Extension table, an addition to the generated Glad.
+
+    Glad is generated without extensions, so it has neither flags nor a public check of them.
+    gladLoadExtensions() reads the list of extensions of the current context once and interns
+    it into one block of memory with an open addressing hash table of the names,
+    gladHasExtension() checks a name without allocations and without a scan of the whole list.
+
+    Implemented by src/glad_ext.c, which uses only the public glad.h.
+*/
+
+#ifndef __glad_ext_h_
+#define __glad_ext_h_
+
+#include <glad/glad.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+GLAPI int gladLoadExtensions(void);
+
+GLAPI int gladHasExtension(const char *ext);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,27 @@
+/*
+
+    Lazy OpenGL loader, an addition to the generated Glad.
+
+    gladLoadGLLoaderLazy() is an opt-in replacement of gladLoadGLLoader(), which resolves
+    only glGetString to detect the version. All other function pointers of the supported
+    core versions are set to trampolines, which resolve the real entry point on the first call.
+
+    Implemented by src/glad_lazy.c, which is generated by gen_glad_lazy.py.
+*/
+
+#ifndef __glad_lazy_h_
+#define __glad_lazy_h_
+
+#include <glad/glad.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+GLAPI int gladLoadGLLoaderLazy(GLADloadproc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
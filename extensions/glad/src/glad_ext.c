@@ -0,0 +1,180 @@
+/*
+
+    Extension table, an addition to the generated Glad.
+
+    Extensions are interned once per context:
+    names are stored one after another in one block of memory and
+    the open addressing hash table keeps offsets of the names,
+    so gladHasExtension() neither allocates nor scans the whole list.
+
+    The table lives until the next call of gladLoadExtensions(),
+    which rebuilds it in the same memory.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <glad/glad_ext.h>
+
+static char *exts_names = NULL;
+static size_t exts_names_capacity = 0;
+static size_t exts_names_used = 0;
+static unsigned int *exts_table = NULL;
+static unsigned int exts_table_size = 0;
+static unsigned int exts_count = 0;
+
+static unsigned int hash_ext(const char *ext, size_t len) {
+    /* FNV-1a */
+    unsigned int hash = 2166136261u;
+    size_t index;
+    for(index = 0; index < len; index++) {
+        hash ^= (unsigned char)ext[index];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static int reserve_exts(size_t names_size, unsigned int count) {
+    unsigned int table_size = 16;
+
+    /* load factor stays below 1/2, memory of the previous context is reused */
+    while(table_size < 2 * count) {
+        table_size *= 2;
+    }
+
+    if(names_size > exts_names_capacity) {
+        char *names = (char *)realloc(exts_names, names_size);
+        if(names == NULL) {
+            return 0;
+        }
+        exts_names = names;
+        exts_names_capacity = names_size;
+    }
+
+    if(table_size > exts_table_size) {
+        unsigned int *table = (unsigned int *)realloc(exts_table, table_size * sizeof *exts_table);
+        if(table == NULL) {
+            return 0;
+        }
+        exts_table = table;
+        exts_table_size = table_size;
+    }
+
+    memset(exts_table, 0, exts_table_size * sizeof *exts_table);
+    exts_names_used = 0;
+    exts_count = 0;
+
+    return 1;
+}
+
+static void intern_ext(const char *ext, size_t len) {
+    unsigned int mask = exts_table_size - 1;
+    unsigned int slot = hash_ext(ext, len) & mask;
+
+    /* slot keeps offset + 1 of the name, 0 is an empty slot */
+    while(exts_table[slot] != 0) {
+        const char *e = exts_names + exts_table[slot] - 1;
+        if(strncmp(e, ext, len) == 0 && e[len] == '\0') {
+            return;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    memcpy(exts_names + exts_names_used, ext, len);
+    exts_names[exts_names_used + len] = '\0';
+    exts_table[slot] = (unsigned int)exts_names_used + 1;
+    exts_names_used += len + 1;
+    exts_count++;
+}
+
+static int load_exts_string(void) {
+    /* before OpenGL 3.0 the whole list is one string separated by spaces */
+    const char *exts = (const char *)glGetString(GL_EXTENSIONS);
+    const char *ext;
+    size_t len;
+    unsigned int count = 1;
+
+    if(exts == NULL) {
+        return reserve_exts(1, 0);
+    }
+
+    /* every space might separate two names */
+    for(ext = exts; *ext != '\0'; ext++) {
+        if(*ext == ' ') count++;
+    }
+    if(!reserve_exts(strlen(exts) + 1, count)) {
+        return 0;
+    }
+
+    for(ext = exts; *ext != '\0'; ext += len) {
+        while(*ext == ' ') ext++;
+        len = strcspn(ext, " ");
+        if(len > 0) intern_ext(ext, len);
+    }
+
+    return 1;
+}
+
+static int load_exts_indexed(void) {
+    /* GL_EXTENSIONS of glGetString is removed from the core profile,
+     * names are read one by one with glGetStringi
+     */
+    int index;
+    int num_exts_i = 0;
+    size_t names_size = 1;
+
+    glGetIntegerv(GL_NUM_EXTENSIONS, &num_exts_i);
+    if(num_exts_i < 0) {
+        num_exts_i = 0;
+    }
+
+    for(index = 0; index < num_exts_i; index++) {
+        const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
+        if(gl_str_tmp != NULL) names_size += strlen(gl_str_tmp) + 1;
+    }
+    if(!reserve_exts(names_size, (unsigned int)num_exts_i)) {
+        return 0;
+    }
+
+    for(index = 0; index < num_exts_i; index++) {
+        const char *gl_str_tmp = (const char*)glGetStringi(GL_EXTENSIONS, index);
+        size_t len;
+        if(gl_str_tmp == NULL) continue;
+        len = strlen(gl_str_tmp);
+        if(exts_names_used + len + 1 > exts_names_capacity) break;
+        intern_ext(gl_str_tmp, len);
+    }
+
+    return 1;
+}
+
+int gladLoadExtensions(void) {
+    if(GLAD_GL_VERSION_3_0 && glGetStringi != NULL) {
+        return load_exts_indexed();
+    }
+    if(glGetString != NULL) {
+        return load_exts_string();
+    }
+    return 0;
+}
+
+int gladHasExtension(const char *ext) {
+    unsigned int mask;
+    unsigned int slot;
+    size_t len;
+
+    if(ext == NULL || exts_table == NULL || exts_count == 0) {
+        return 0;
+    }
+
+    len = strlen(ext);
+    mask = exts_table_size - 1;
+    slot = hash_ext(ext, len) & mask;
+    while(exts_table[slot] != 0) {
+        if(strcmp(exts_names + exts_table[slot] - 1, ext) == 0) {
+            return 1;
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    return 0;
+}
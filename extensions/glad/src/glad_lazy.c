@@ -0,0 +1,5420 @@
+/*
+
+    Lazy OpenGL loader for glad 0.1.36.
+
+    Specification: gl
+    APIs: gl=4.6
+    Profile: compatibility
+
+    Every function pointer of the supported core versions starts as a trampoline,
+    which resolves the real entry point on the first call and patches the pointer,
+    so following calls go directly to the driver.
+
+    Generated by gen_glad_lazy.py from include/glad/glad.h and the
+    load_GL_VERSION_* functions of src/glad.c, don't edit it by hand.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <glad/glad_lazy.h>
+
+static GLADloadproc lazy_load = NULL;
+
+static void* resolve(const char *name) {
+    void *proc = lazy_load(name);
+    if(proc == NULL) {
+        fprintf(stderr, "glad: cannot resolve %s\n", name);
+        abort();
+    }
+    return proc;
+}
+
+static void APIENTRY lazy_glCullFace(GLenum mode) {
+	glad_glCullFace = (PFNGLCULLFACEPROC)resolve("glCullFace");
+	glad_glCullFace(mode);
+}
+static void APIENTRY lazy_glFrontFace(GLenum mode) {
+	glad_glFrontFace = (PFNGLFRONTFACEPROC)resolve("glFrontFace");
+	glad_glFrontFace(mode);
+}
+static void APIENTRY lazy_glHint(GLenum target, GLenum mode) {
+	glad_glHint = (PFNGLHINTPROC)resolve("glHint");
+	glad_glHint(target, mode);
+}
+static void APIENTRY lazy_glLineWidth(GLfloat width) {
+	glad_glLineWidth = (PFNGLLINEWIDTHPROC)resolve("glLineWidth");
+	glad_glLineWidth(width);
+}
+static void APIENTRY lazy_glPointSize(GLfloat size) {
+	glad_glPointSize = (PFNGLPOINTSIZEPROC)resolve("glPointSize");
+	glad_glPointSize(size);
+}
+static void APIENTRY lazy_glPolygonMode(GLenum face, GLenum mode) {
+	glad_glPolygonMode = (PFNGLPOLYGONMODEPROC)resolve("glPolygonMode");
+	glad_glPolygonMode(face, mode);
+}
+static void APIENTRY lazy_glScissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glScissor = (PFNGLSCISSORPROC)resolve("glScissor");
+	glad_glScissor(x, y, width, height);
+}
+static void APIENTRY lazy_glTexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	glad_glTexParameterf = (PFNGLTEXPARAMETERFPROC)resolve("glTexParameterf");
+	glad_glTexParameterf(target, pname, param);
+}
+static void APIENTRY lazy_glTexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	glad_glTexParameterfv = (PFNGLTEXPARAMETERFVPROC)resolve("glTexParameterfv");
+	glad_glTexParameterfv(target, pname, params);
+}
+static void APIENTRY lazy_glTexParameteri(GLenum target, GLenum pname, GLint param) {
+	glad_glTexParameteri = (PFNGLTEXPARAMETERIPROC)resolve("glTexParameteri");
+	glad_glTexParameteri(target, pname, param);
+}
+static void APIENTRY lazy_glTexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	glad_glTexParameteriv = (PFNGLTEXPARAMETERIVPROC)resolve("glTexParameteriv");
+	glad_glTexParameteriv(target, pname, params);
+}
+static void APIENTRY lazy_glTexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexImage1D = (PFNGLTEXIMAGE1DPROC)resolve("glTexImage1D");
+	glad_glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+}
+static void APIENTRY lazy_glTexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexImage2D = (PFNGLTEXIMAGE2DPROC)resolve("glTexImage2D");
+	glad_glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+}
+static void APIENTRY lazy_glDrawBuffer(GLenum buf) {
+	glad_glDrawBuffer = (PFNGLDRAWBUFFERPROC)resolve("glDrawBuffer");
+	glad_glDrawBuffer(buf);
+}
+static void APIENTRY lazy_glClear(GLbitfield mask) {
+	glad_glClear = (PFNGLCLEARPROC)resolve("glClear");
+	glad_glClear(mask);
+}
+static void APIENTRY lazy_glClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glClearColor = (PFNGLCLEARCOLORPROC)resolve("glClearColor");
+	glad_glClearColor(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glClearStencil(GLint s) {
+	glad_glClearStencil = (PFNGLCLEARSTENCILPROC)resolve("glClearStencil");
+	glad_glClearStencil(s);
+}
+static void APIENTRY lazy_glClearDepth(GLdouble depth) {
+	glad_glClearDepth = (PFNGLCLEARDEPTHPROC)resolve("glClearDepth");
+	glad_glClearDepth(depth);
+}
+static void APIENTRY lazy_glStencilMask(GLuint mask) {
+	glad_glStencilMask = (PFNGLSTENCILMASKPROC)resolve("glStencilMask");
+	glad_glStencilMask(mask);
+}
+static void APIENTRY lazy_glColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	glad_glColorMask = (PFNGLCOLORMASKPROC)resolve("glColorMask");
+	glad_glColorMask(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glDepthMask(GLboolean flag) {
+	glad_glDepthMask = (PFNGLDEPTHMASKPROC)resolve("glDepthMask");
+	glad_glDepthMask(flag);
+}
+static void APIENTRY lazy_glDisable(GLenum cap) {
+	glad_glDisable = (PFNGLDISABLEPROC)resolve("glDisable");
+	glad_glDisable(cap);
+}
+static void APIENTRY lazy_glEnable(GLenum cap) {
+	glad_glEnable = (PFNGLENABLEPROC)resolve("glEnable");
+	glad_glEnable(cap);
+}
+static void APIENTRY lazy_glFinish(void) {
+	glad_glFinish = (PFNGLFINISHPROC)resolve("glFinish");
+	glad_glFinish();
+}
+static void APIENTRY lazy_glFlush(void) {
+	glad_glFlush = (PFNGLFLUSHPROC)resolve("glFlush");
+	glad_glFlush();
+}
+static void APIENTRY lazy_glBlendFunc(GLenum sfactor, GLenum dfactor) {
+	glad_glBlendFunc = (PFNGLBLENDFUNCPROC)resolve("glBlendFunc");
+	glad_glBlendFunc(sfactor, dfactor);
+}
+static void APIENTRY lazy_glLogicOp(GLenum opcode) {
+	glad_glLogicOp = (PFNGLLOGICOPPROC)resolve("glLogicOp");
+	glad_glLogicOp(opcode);
+}
+static void APIENTRY lazy_glStencilFunc(GLenum func, GLint ref, GLuint mask) {
+	glad_glStencilFunc = (PFNGLSTENCILFUNCPROC)resolve("glStencilFunc");
+	glad_glStencilFunc(func, ref, mask);
+}
+static void APIENTRY lazy_glStencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	glad_glStencilOp = (PFNGLSTENCILOPPROC)resolve("glStencilOp");
+	glad_glStencilOp(fail, zfail, zpass);
+}
+static void APIENTRY lazy_glDepthFunc(GLenum func) {
+	glad_glDepthFunc = (PFNGLDEPTHFUNCPROC)resolve("glDepthFunc");
+	glad_glDepthFunc(func);
+}
+static void APIENTRY lazy_glPixelStoref(GLenum pname, GLfloat param) {
+	glad_glPixelStoref = (PFNGLPIXELSTOREFPROC)resolve("glPixelStoref");
+	glad_glPixelStoref(pname, param);
+}
+static void APIENTRY lazy_glPixelStorei(GLenum pname, GLint param) {
+	glad_glPixelStorei = (PFNGLPIXELSTOREIPROC)resolve("glPixelStorei");
+	glad_glPixelStorei(pname, param);
+}
+static void APIENTRY lazy_glReadBuffer(GLenum src) {
+	glad_glReadBuffer = (PFNGLREADBUFFERPROC)resolve("glReadBuffer");
+	glad_glReadBuffer(src);
+}
+static void APIENTRY lazy_glReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	glad_glReadPixels = (PFNGLREADPIXELSPROC)resolve("glReadPixels");
+	glad_glReadPixels(x, y, width, height, format, type, pixels);
+}
+static void APIENTRY lazy_glGetBooleanv(GLenum pname, GLboolean *data) {
+	glad_glGetBooleanv = (PFNGLGETBOOLEANVPROC)resolve("glGetBooleanv");
+	glad_glGetBooleanv(pname, data);
+}
+static void APIENTRY lazy_glGetDoublev(GLenum pname, GLdouble *data) {
+	glad_glGetDoublev = (PFNGLGETDOUBLEVPROC)resolve("glGetDoublev");
+	glad_glGetDoublev(pname, data);
+}
+static GLenum APIENTRY lazy_glGetError(void) {
+	glad_glGetError = (PFNGLGETERRORPROC)resolve("glGetError");
+	return glad_glGetError();
+}
+static void APIENTRY lazy_glGetFloatv(GLenum pname, GLfloat *data) {
+	glad_glGetFloatv = (PFNGLGETFLOATVPROC)resolve("glGetFloatv");
+	glad_glGetFloatv(pname, data);
+}
+static void APIENTRY lazy_glGetIntegerv(GLenum pname, GLint *data) {
+	glad_glGetIntegerv = (PFNGLGETINTEGERVPROC)resolve("glGetIntegerv");
+	glad_glGetIntegerv(pname, data);
+}
+static const GLubyte * APIENTRY lazy_glGetString(GLenum name) {
+	glad_glGetString = (PFNGLGETSTRINGPROC)resolve("glGetString");
+	return glad_glGetString(name);
+}
+static void APIENTRY lazy_glGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	glad_glGetTexImage = (PFNGLGETTEXIMAGEPROC)resolve("glGetTexImage");
+	glad_glGetTexImage(target, level, format, type, pixels);
+}
+static void APIENTRY lazy_glGetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetTexParameterfv = (PFNGLGETTEXPARAMETERFVPROC)resolve("glGetTexParameterfv");
+	glad_glGetTexParameterfv(target, pname, params);
+}
+static void APIENTRY lazy_glGetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetTexParameteriv = (PFNGLGETTEXPARAMETERIVPROC)resolve("glGetTexParameteriv");
+	glad_glGetTexParameteriv(target, pname, params);
+}
+static void APIENTRY lazy_glGetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	glad_glGetTexLevelParameterfv = (PFNGLGETTEXLEVELPARAMETERFVPROC)resolve("glGetTexLevelParameterfv");
+	glad_glGetTexLevelParameterfv(target, level, pname, params);
+}
+static void APIENTRY lazy_glGetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+	glad_glGetTexLevelParameteriv = (PFNGLGETTEXLEVELPARAMETERIVPROC)resolve("glGetTexLevelParameteriv");
+	glad_glGetTexLevelParameteriv(target, level, pname, params);
+}
+static GLboolean APIENTRY lazy_glIsEnabled(GLenum cap) {
+	glad_glIsEnabled = (PFNGLISENABLEDPROC)resolve("glIsEnabled");
+	return glad_glIsEnabled(cap);
+}
+static void APIENTRY lazy_glDepthRange(GLdouble n, GLdouble f) {
+	glad_glDepthRange = (PFNGLDEPTHRANGEPROC)resolve("glDepthRange");
+	glad_glDepthRange(n, f);
+}
+static void APIENTRY lazy_glViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glViewport = (PFNGLVIEWPORTPROC)resolve("glViewport");
+	glad_glViewport(x, y, width, height);
+}
+static void APIENTRY lazy_glNewList(GLuint list, GLenum mode) {
+	glad_glNewList = (PFNGLNEWLISTPROC)resolve("glNewList");
+	glad_glNewList(list, mode);
+}
+static void APIENTRY lazy_glEndList(void) {
+	glad_glEndList = (PFNGLENDLISTPROC)resolve("glEndList");
+	glad_glEndList();
+}
+static void APIENTRY lazy_glCallList(GLuint list) {
+	glad_glCallList = (PFNGLCALLLISTPROC)resolve("glCallList");
+	glad_glCallList(list);
+}
+static void APIENTRY lazy_glCallLists(GLsizei n, GLenum type, const void *lists) {
+	glad_glCallLists = (PFNGLCALLLISTSPROC)resolve("glCallLists");
+	glad_glCallLists(n, type, lists);
+}
+static void APIENTRY lazy_glDeleteLists(GLuint list, GLsizei range) {
+	glad_glDeleteLists = (PFNGLDELETELISTSPROC)resolve("glDeleteLists");
+	glad_glDeleteLists(list, range);
+}
+static GLuint APIENTRY lazy_glGenLists(GLsizei range) {
+	glad_glGenLists = (PFNGLGENLISTSPROC)resolve("glGenLists");
+	return glad_glGenLists(range);
+}
+static void APIENTRY lazy_glListBase(GLuint base) {
+	glad_glListBase = (PFNGLLISTBASEPROC)resolve("glListBase");
+	glad_glListBase(base);
+}
+static void APIENTRY lazy_glBegin(GLenum mode) {
+	glad_glBegin = (PFNGLBEGINPROC)resolve("glBegin");
+	glad_glBegin(mode);
+}
+static void APIENTRY lazy_glBitmap(GLsizei width, GLsizei height, GLfloat xorig, GLfloat yorig, GLfloat xmove, GLfloat ymove, const GLubyte *bitmap) {
+	glad_glBitmap = (PFNGLBITMAPPROC)resolve("glBitmap");
+	glad_glBitmap(width, height, xorig, yorig, xmove, ymove, bitmap);
+}
+static void APIENTRY lazy_glColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+	glad_glColor3b = (PFNGLCOLOR3BPROC)resolve("glColor3b");
+	glad_glColor3b(red, green, blue);
+}
+static void APIENTRY lazy_glColor3bv(const GLbyte *v) {
+	glad_glColor3bv = (PFNGLCOLOR3BVPROC)resolve("glColor3bv");
+	glad_glColor3bv(v);
+}
+static void APIENTRY lazy_glColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+	glad_glColor3d = (PFNGLCOLOR3DPROC)resolve("glColor3d");
+	glad_glColor3d(red, green, blue);
+}
+static void APIENTRY lazy_glColor3dv(const GLdouble *v) {
+	glad_glColor3dv = (PFNGLCOLOR3DVPROC)resolve("glColor3dv");
+	glad_glColor3dv(v);
+}
+static void APIENTRY lazy_glColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+	glad_glColor3f = (PFNGLCOLOR3FPROC)resolve("glColor3f");
+	glad_glColor3f(red, green, blue);
+}
+static void APIENTRY lazy_glColor3fv(const GLfloat *v) {
+	glad_glColor3fv = (PFNGLCOLOR3FVPROC)resolve("glColor3fv");
+	glad_glColor3fv(v);
+}
+static void APIENTRY lazy_glColor3i(GLint red, GLint green, GLint blue) {
+	glad_glColor3i = (PFNGLCOLOR3IPROC)resolve("glColor3i");
+	glad_glColor3i(red, green, blue);
+}
+static void APIENTRY lazy_glColor3iv(const GLint *v) {
+	glad_glColor3iv = (PFNGLCOLOR3IVPROC)resolve("glColor3iv");
+	glad_glColor3iv(v);
+}
+static void APIENTRY lazy_glColor3s(GLshort red, GLshort green, GLshort blue) {
+	glad_glColor3s = (PFNGLCOLOR3SPROC)resolve("glColor3s");
+	glad_glColor3s(red, green, blue);
+}
+static void APIENTRY lazy_glColor3sv(const GLshort *v) {
+	glad_glColor3sv = (PFNGLCOLOR3SVPROC)resolve("glColor3sv");
+	glad_glColor3sv(v);
+}
+static void APIENTRY lazy_glColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+	glad_glColor3ub = (PFNGLCOLOR3UBPROC)resolve("glColor3ub");
+	glad_glColor3ub(red, green, blue);
+}
+static void APIENTRY lazy_glColor3ubv(const GLubyte *v) {
+	glad_glColor3ubv = (PFNGLCOLOR3UBVPROC)resolve("glColor3ubv");
+	glad_glColor3ubv(v);
+}
+static void APIENTRY lazy_glColor3ui(GLuint red, GLuint green, GLuint blue) {
+	glad_glColor3ui = (PFNGLCOLOR3UIPROC)resolve("glColor3ui");
+	glad_glColor3ui(red, green, blue);
+}
+static void APIENTRY lazy_glColor3uiv(const GLuint *v) {
+	glad_glColor3uiv = (PFNGLCOLOR3UIVPROC)resolve("glColor3uiv");
+	glad_glColor3uiv(v);
+}
+static void APIENTRY lazy_glColor3us(GLushort red, GLushort green, GLushort blue) {
+	glad_glColor3us = (PFNGLCOLOR3USPROC)resolve("glColor3us");
+	glad_glColor3us(red, green, blue);
+}
+static void APIENTRY lazy_glColor3usv(const GLushort *v) {
+	glad_glColor3usv = (PFNGLCOLOR3USVPROC)resolve("glColor3usv");
+	glad_glColor3usv(v);
+}
+static void APIENTRY lazy_glColor4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha) {
+	glad_glColor4b = (PFNGLCOLOR4BPROC)resolve("glColor4b");
+	glad_glColor4b(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glColor4bv(const GLbyte *v) {
+	glad_glColor4bv = (PFNGLCOLOR4BVPROC)resolve("glColor4bv");
+	glad_glColor4bv(v);
+}
+static void APIENTRY lazy_glColor4d(GLdouble red, GLdouble green, GLdouble blue, GLdouble alpha) {
+	glad_glColor4d = (PFNGLCOLOR4DPROC)resolve("glColor4d");
+	glad_glColor4d(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glColor4dv(const GLdouble *v) {
+	glad_glColor4dv = (PFNGLCOLOR4DVPROC)resolve("glColor4dv");
+	glad_glColor4dv(v);
+}
+static void APIENTRY lazy_glColor4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glColor4f = (PFNGLCOLOR4FPROC)resolve("glColor4f");
+	glad_glColor4f(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glColor4fv(const GLfloat *v) {
+	glad_glColor4fv = (PFNGLCOLOR4FVPROC)resolve("glColor4fv");
+	glad_glColor4fv(v);
+}
+static void APIENTRY lazy_glColor4i(GLint red, GLint green, GLint blue, GLint alpha) {
+	glad_glColor4i = (PFNGLCOLOR4IPROC)resolve("glColor4i");
+	glad_glColor4i(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glColor4iv(const GLint *v) {
+	glad_glColor4iv = (PFNGLCOLOR4IVPROC)resolve("glColor4iv");
+	glad_glColor4iv(v);
+}
+static void APIENTRY lazy_glColor4s(GLshort red, GLshort green, GLshort blue, GLshort alpha) {
+	glad_glColor4s = (PFNGLCOLOR4SPROC)resolve("glColor4s");
+	glad_glColor4s(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glColor4sv(const GLshort *v) {
+	glad_glColor4sv = (PFNGLCOLOR4SVPROC)resolve("glColor4sv");
+	glad_glColor4sv(v);
+}
+static void APIENTRY lazy_glColor4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte alpha) {
+	glad_glColor4ub = (PFNGLCOLOR4UBPROC)resolve("glColor4ub");
+	glad_glColor4ub(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glColor4ubv(const GLubyte *v) {
+	glad_glColor4ubv = (PFNGLCOLOR4UBVPROC)resolve("glColor4ubv");
+	glad_glColor4ubv(v);
+}
+static void APIENTRY lazy_glColor4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha) {
+	glad_glColor4ui = (PFNGLCOLOR4UIPROC)resolve("glColor4ui");
+	glad_glColor4ui(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glColor4uiv(const GLuint *v) {
+	glad_glColor4uiv = (PFNGLCOLOR4UIVPROC)resolve("glColor4uiv");
+	glad_glColor4uiv(v);
+}
+static void APIENTRY lazy_glColor4us(GLushort red, GLushort green, GLushort blue, GLushort alpha) {
+	glad_glColor4us = (PFNGLCOLOR4USPROC)resolve("glColor4us");
+	glad_glColor4us(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glColor4usv(const GLushort *v) {
+	glad_glColor4usv = (PFNGLCOLOR4USVPROC)resolve("glColor4usv");
+	glad_glColor4usv(v);
+}
+static void APIENTRY lazy_glEdgeFlag(GLboolean flag) {
+	glad_glEdgeFlag = (PFNGLEDGEFLAGPROC)resolve("glEdgeFlag");
+	glad_glEdgeFlag(flag);
+}
+static void APIENTRY lazy_glEdgeFlagv(const GLboolean *flag) {
+	glad_glEdgeFlagv = (PFNGLEDGEFLAGVPROC)resolve("glEdgeFlagv");
+	glad_glEdgeFlagv(flag);
+}
+static void APIENTRY lazy_glEnd(void) {
+	glad_glEnd = (PFNGLENDPROC)resolve("glEnd");
+	glad_glEnd();
+}
+static void APIENTRY lazy_glIndexd(GLdouble c) {
+	glad_glIndexd = (PFNGLINDEXDPROC)resolve("glIndexd");
+	glad_glIndexd(c);
+}
+static void APIENTRY lazy_glIndexdv(const GLdouble *c) {
+	glad_glIndexdv = (PFNGLINDEXDVPROC)resolve("glIndexdv");
+	glad_glIndexdv(c);
+}
+static void APIENTRY lazy_glIndexf(GLfloat c) {
+	glad_glIndexf = (PFNGLINDEXFPROC)resolve("glIndexf");
+	glad_glIndexf(c);
+}
+static void APIENTRY lazy_glIndexfv(const GLfloat *c) {
+	glad_glIndexfv = (PFNGLINDEXFVPROC)resolve("glIndexfv");
+	glad_glIndexfv(c);
+}
+static void APIENTRY lazy_glIndexi(GLint c) {
+	glad_glIndexi = (PFNGLINDEXIPROC)resolve("glIndexi");
+	glad_glIndexi(c);
+}
+static void APIENTRY lazy_glIndexiv(const GLint *c) {
+	glad_glIndexiv = (PFNGLINDEXIVPROC)resolve("glIndexiv");
+	glad_glIndexiv(c);
+}
+static void APIENTRY lazy_glIndexs(GLshort c) {
+	glad_glIndexs = (PFNGLINDEXSPROC)resolve("glIndexs");
+	glad_glIndexs(c);
+}
+static void APIENTRY lazy_glIndexsv(const GLshort *c) {
+	glad_glIndexsv = (PFNGLINDEXSVPROC)resolve("glIndexsv");
+	glad_glIndexsv(c);
+}
+static void APIENTRY lazy_glNormal3b(GLbyte nx, GLbyte ny, GLbyte nz) {
+	glad_glNormal3b = (PFNGLNORMAL3BPROC)resolve("glNormal3b");
+	glad_glNormal3b(nx, ny, nz);
+}
+static void APIENTRY lazy_glNormal3bv(const GLbyte *v) {
+	glad_glNormal3bv = (PFNGLNORMAL3BVPROC)resolve("glNormal3bv");
+	glad_glNormal3bv(v);
+}
+static void APIENTRY lazy_glNormal3d(GLdouble nx, GLdouble ny, GLdouble nz) {
+	glad_glNormal3d = (PFNGLNORMAL3DPROC)resolve("glNormal3d");
+	glad_glNormal3d(nx, ny, nz);
+}
+static void APIENTRY lazy_glNormal3dv(const GLdouble *v) {
+	glad_glNormal3dv = (PFNGLNORMAL3DVPROC)resolve("glNormal3dv");
+	glad_glNormal3dv(v);
+}
+static void APIENTRY lazy_glNormal3f(GLfloat nx, GLfloat ny, GLfloat nz) {
+	glad_glNormal3f = (PFNGLNORMAL3FPROC)resolve("glNormal3f");
+	glad_glNormal3f(nx, ny, nz);
+}
+static void APIENTRY lazy_glNormal3fv(const GLfloat *v) {
+	glad_glNormal3fv = (PFNGLNORMAL3FVPROC)resolve("glNormal3fv");
+	glad_glNormal3fv(v);
+}
+static void APIENTRY lazy_glNormal3i(GLint nx, GLint ny, GLint nz) {
+	glad_glNormal3i = (PFNGLNORMAL3IPROC)resolve("glNormal3i");
+	glad_glNormal3i(nx, ny, nz);
+}
+static void APIENTRY lazy_glNormal3iv(const GLint *v) {
+	glad_glNormal3iv = (PFNGLNORMAL3IVPROC)resolve("glNormal3iv");
+	glad_glNormal3iv(v);
+}
+static void APIENTRY lazy_glNormal3s(GLshort nx, GLshort ny, GLshort nz) {
+	glad_glNormal3s = (PFNGLNORMAL3SPROC)resolve("glNormal3s");
+	glad_glNormal3s(nx, ny, nz);
+}
+static void APIENTRY lazy_glNormal3sv(const GLshort *v) {
+	glad_glNormal3sv = (PFNGLNORMAL3SVPROC)resolve("glNormal3sv");
+	glad_glNormal3sv(v);
+}
+static void APIENTRY lazy_glRasterPos2d(GLdouble x, GLdouble y) {
+	glad_glRasterPos2d = (PFNGLRASTERPOS2DPROC)resolve("glRasterPos2d");
+	glad_glRasterPos2d(x, y);
+}
+static void APIENTRY lazy_glRasterPos2dv(const GLdouble *v) {
+	glad_glRasterPos2dv = (PFNGLRASTERPOS2DVPROC)resolve("glRasterPos2dv");
+	glad_glRasterPos2dv(v);
+}
+static void APIENTRY lazy_glRasterPos2f(GLfloat x, GLfloat y) {
+	glad_glRasterPos2f = (PFNGLRASTERPOS2FPROC)resolve("glRasterPos2f");
+	glad_glRasterPos2f(x, y);
+}
+static void APIENTRY lazy_glRasterPos2fv(const GLfloat *v) {
+	glad_glRasterPos2fv = (PFNGLRASTERPOS2FVPROC)resolve("glRasterPos2fv");
+	glad_glRasterPos2fv(v);
+}
+static void APIENTRY lazy_glRasterPos2i(GLint x, GLint y) {
+	glad_glRasterPos2i = (PFNGLRASTERPOS2IPROC)resolve("glRasterPos2i");
+	glad_glRasterPos2i(x, y);
+}
+static void APIENTRY lazy_glRasterPos2iv(const GLint *v) {
+	glad_glRasterPos2iv = (PFNGLRASTERPOS2IVPROC)resolve("glRasterPos2iv");
+	glad_glRasterPos2iv(v);
+}
+static void APIENTRY lazy_glRasterPos2s(GLshort x, GLshort y) {
+	glad_glRasterPos2s = (PFNGLRASTERPOS2SPROC)resolve("glRasterPos2s");
+	glad_glRasterPos2s(x, y);
+}
+static void APIENTRY lazy_glRasterPos2sv(const GLshort *v) {
+	glad_glRasterPos2sv = (PFNGLRASTERPOS2SVPROC)resolve("glRasterPos2sv");
+	glad_glRasterPos2sv(v);
+}
+static void APIENTRY lazy_glRasterPos3d(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glRasterPos3d = (PFNGLRASTERPOS3DPROC)resolve("glRasterPos3d");
+	glad_glRasterPos3d(x, y, z);
+}
+static void APIENTRY lazy_glRasterPos3dv(const GLdouble *v) {
+	glad_glRasterPos3dv = (PFNGLRASTERPOS3DVPROC)resolve("glRasterPos3dv");
+	glad_glRasterPos3dv(v);
+}
+static void APIENTRY lazy_glRasterPos3f(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glRasterPos3f = (PFNGLRASTERPOS3FPROC)resolve("glRasterPos3f");
+	glad_glRasterPos3f(x, y, z);
+}
+static void APIENTRY lazy_glRasterPos3fv(const GLfloat *v) {
+	glad_glRasterPos3fv = (PFNGLRASTERPOS3FVPROC)resolve("glRasterPos3fv");
+	glad_glRasterPos3fv(v);
+}
+static void APIENTRY lazy_glRasterPos3i(GLint x, GLint y, GLint z) {
+	glad_glRasterPos3i = (PFNGLRASTERPOS3IPROC)resolve("glRasterPos3i");
+	glad_glRasterPos3i(x, y, z);
+}
+static void APIENTRY lazy_glRasterPos3iv(const GLint *v) {
+	glad_glRasterPos3iv = (PFNGLRASTERPOS3IVPROC)resolve("glRasterPos3iv");
+	glad_glRasterPos3iv(v);
+}
+static void APIENTRY lazy_glRasterPos3s(GLshort x, GLshort y, GLshort z) {
+	glad_glRasterPos3s = (PFNGLRASTERPOS3SPROC)resolve("glRasterPos3s");
+	glad_glRasterPos3s(x, y, z);
+}
+static void APIENTRY lazy_glRasterPos3sv(const GLshort *v) {
+	glad_glRasterPos3sv = (PFNGLRASTERPOS3SVPROC)resolve("glRasterPos3sv");
+	glad_glRasterPos3sv(v);
+}
+static void APIENTRY lazy_glRasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glRasterPos4d = (PFNGLRASTERPOS4DPROC)resolve("glRasterPos4d");
+	glad_glRasterPos4d(x, y, z, w);
+}
+static void APIENTRY lazy_glRasterPos4dv(const GLdouble *v) {
+	glad_glRasterPos4dv = (PFNGLRASTERPOS4DVPROC)resolve("glRasterPos4dv");
+	glad_glRasterPos4dv(v);
+}
+static void APIENTRY lazy_glRasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glRasterPos4f = (PFNGLRASTERPOS4FPROC)resolve("glRasterPos4f");
+	glad_glRasterPos4f(x, y, z, w);
+}
+static void APIENTRY lazy_glRasterPos4fv(const GLfloat *v) {
+	glad_glRasterPos4fv = (PFNGLRASTERPOS4FVPROC)resolve("glRasterPos4fv");
+	glad_glRasterPos4fv(v);
+}
+static void APIENTRY lazy_glRasterPos4i(GLint x, GLint y, GLint z, GLint w) {
+	glad_glRasterPos4i = (PFNGLRASTERPOS4IPROC)resolve("glRasterPos4i");
+	glad_glRasterPos4i(x, y, z, w);
+}
+static void APIENTRY lazy_glRasterPos4iv(const GLint *v) {
+	glad_glRasterPos4iv = (PFNGLRASTERPOS4IVPROC)resolve("glRasterPos4iv");
+	glad_glRasterPos4iv(v);
+}
+static void APIENTRY lazy_glRasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_glRasterPos4s = (PFNGLRASTERPOS4SPROC)resolve("glRasterPos4s");
+	glad_glRasterPos4s(x, y, z, w);
+}
+static void APIENTRY lazy_glRasterPos4sv(const GLshort *v) {
+	glad_glRasterPos4sv = (PFNGLRASTERPOS4SVPROC)resolve("glRasterPos4sv");
+	glad_glRasterPos4sv(v);
+}
+static void APIENTRY lazy_glRectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2) {
+	glad_glRectd = (PFNGLRECTDPROC)resolve("glRectd");
+	glad_glRectd(x1, y1, x2, y2);
+}
+static void APIENTRY lazy_glRectdv(const GLdouble *v1, const GLdouble *v2) {
+	glad_glRectdv = (PFNGLRECTDVPROC)resolve("glRectdv");
+	glad_glRectdv(v1, v2);
+}
+static void APIENTRY lazy_glRectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2) {
+	glad_glRectf = (PFNGLRECTFPROC)resolve("glRectf");
+	glad_glRectf(x1, y1, x2, y2);
+}
+static void APIENTRY lazy_glRectfv(const GLfloat *v1, const GLfloat *v2) {
+	glad_glRectfv = (PFNGLRECTFVPROC)resolve("glRectfv");
+	glad_glRectfv(v1, v2);
+}
+static void APIENTRY lazy_glRecti(GLint x1, GLint y1, GLint x2, GLint y2) {
+	glad_glRecti = (PFNGLRECTIPROC)resolve("glRecti");
+	glad_glRecti(x1, y1, x2, y2);
+}
+static void APIENTRY lazy_glRectiv(const GLint *v1, const GLint *v2) {
+	glad_glRectiv = (PFNGLRECTIVPROC)resolve("glRectiv");
+	glad_glRectiv(v1, v2);
+}
+static void APIENTRY lazy_glRects(GLshort x1, GLshort y1, GLshort x2, GLshort y2) {
+	glad_glRects = (PFNGLRECTSPROC)resolve("glRects");
+	glad_glRects(x1, y1, x2, y2);
+}
+static void APIENTRY lazy_glRectsv(const GLshort *v1, const GLshort *v2) {
+	glad_glRectsv = (PFNGLRECTSVPROC)resolve("glRectsv");
+	glad_glRectsv(v1, v2);
+}
+static void APIENTRY lazy_glTexCoord1d(GLdouble s) {
+	glad_glTexCoord1d = (PFNGLTEXCOORD1DPROC)resolve("glTexCoord1d");
+	glad_glTexCoord1d(s);
+}
+static void APIENTRY lazy_glTexCoord1dv(const GLdouble *v) {
+	glad_glTexCoord1dv = (PFNGLTEXCOORD1DVPROC)resolve("glTexCoord1dv");
+	glad_glTexCoord1dv(v);
+}
+static void APIENTRY lazy_glTexCoord1f(GLfloat s) {
+	glad_glTexCoord1f = (PFNGLTEXCOORD1FPROC)resolve("glTexCoord1f");
+	glad_glTexCoord1f(s);
+}
+static void APIENTRY lazy_glTexCoord1fv(const GLfloat *v) {
+	glad_glTexCoord1fv = (PFNGLTEXCOORD1FVPROC)resolve("glTexCoord1fv");
+	glad_glTexCoord1fv(v);
+}
+static void APIENTRY lazy_glTexCoord1i(GLint s) {
+	glad_glTexCoord1i = (PFNGLTEXCOORD1IPROC)resolve("glTexCoord1i");
+	glad_glTexCoord1i(s);
+}
+static void APIENTRY lazy_glTexCoord1iv(const GLint *v) {
+	glad_glTexCoord1iv = (PFNGLTEXCOORD1IVPROC)resolve("glTexCoord1iv");
+	glad_glTexCoord1iv(v);
+}
+static void APIENTRY lazy_glTexCoord1s(GLshort s) {
+	glad_glTexCoord1s = (PFNGLTEXCOORD1SPROC)resolve("glTexCoord1s");
+	glad_glTexCoord1s(s);
+}
+static void APIENTRY lazy_glTexCoord1sv(const GLshort *v) {
+	glad_glTexCoord1sv = (PFNGLTEXCOORD1SVPROC)resolve("glTexCoord1sv");
+	glad_glTexCoord1sv(v);
+}
+static void APIENTRY lazy_glTexCoord2d(GLdouble s, GLdouble t) {
+	glad_glTexCoord2d = (PFNGLTEXCOORD2DPROC)resolve("glTexCoord2d");
+	glad_glTexCoord2d(s, t);
+}
+static void APIENTRY lazy_glTexCoord2dv(const GLdouble *v) {
+	glad_glTexCoord2dv = (PFNGLTEXCOORD2DVPROC)resolve("glTexCoord2dv");
+	glad_glTexCoord2dv(v);
+}
+static void APIENTRY lazy_glTexCoord2f(GLfloat s, GLfloat t) {
+	glad_glTexCoord2f = (PFNGLTEXCOORD2FPROC)resolve("glTexCoord2f");
+	glad_glTexCoord2f(s, t);
+}
+static void APIENTRY lazy_glTexCoord2fv(const GLfloat *v) {
+	glad_glTexCoord2fv = (PFNGLTEXCOORD2FVPROC)resolve("glTexCoord2fv");
+	glad_glTexCoord2fv(v);
+}
+static void APIENTRY lazy_glTexCoord2i(GLint s, GLint t) {
+	glad_glTexCoord2i = (PFNGLTEXCOORD2IPROC)resolve("glTexCoord2i");
+	glad_glTexCoord2i(s, t);
+}
+static void APIENTRY lazy_glTexCoord2iv(const GLint *v) {
+	glad_glTexCoord2iv = (PFNGLTEXCOORD2IVPROC)resolve("glTexCoord2iv");
+	glad_glTexCoord2iv(v);
+}
+static void APIENTRY lazy_glTexCoord2s(GLshort s, GLshort t) {
+	glad_glTexCoord2s = (PFNGLTEXCOORD2SPROC)resolve("glTexCoord2s");
+	glad_glTexCoord2s(s, t);
+}
+static void APIENTRY lazy_glTexCoord2sv(const GLshort *v) {
+	glad_glTexCoord2sv = (PFNGLTEXCOORD2SVPROC)resolve("glTexCoord2sv");
+	glad_glTexCoord2sv(v);
+}
+static void APIENTRY lazy_glTexCoord3d(GLdouble s, GLdouble t, GLdouble r) {
+	glad_glTexCoord3d = (PFNGLTEXCOORD3DPROC)resolve("glTexCoord3d");
+	glad_glTexCoord3d(s, t, r);
+}
+static void APIENTRY lazy_glTexCoord3dv(const GLdouble *v) {
+	glad_glTexCoord3dv = (PFNGLTEXCOORD3DVPROC)resolve("glTexCoord3dv");
+	glad_glTexCoord3dv(v);
+}
+static void APIENTRY lazy_glTexCoord3f(GLfloat s, GLfloat t, GLfloat r) {
+	glad_glTexCoord3f = (PFNGLTEXCOORD3FPROC)resolve("glTexCoord3f");
+	glad_glTexCoord3f(s, t, r);
+}
+static void APIENTRY lazy_glTexCoord3fv(const GLfloat *v) {
+	glad_glTexCoord3fv = (PFNGLTEXCOORD3FVPROC)resolve("glTexCoord3fv");
+	glad_glTexCoord3fv(v);
+}
+static void APIENTRY lazy_glTexCoord3i(GLint s, GLint t, GLint r) {
+	glad_glTexCoord3i = (PFNGLTEXCOORD3IPROC)resolve("glTexCoord3i");
+	glad_glTexCoord3i(s, t, r);
+}
+static void APIENTRY lazy_glTexCoord3iv(const GLint *v) {
+	glad_glTexCoord3iv = (PFNGLTEXCOORD3IVPROC)resolve("glTexCoord3iv");
+	glad_glTexCoord3iv(v);
+}
+static void APIENTRY lazy_glTexCoord3s(GLshort s, GLshort t, GLshort r) {
+	glad_glTexCoord3s = (PFNGLTEXCOORD3SPROC)resolve("glTexCoord3s");
+	glad_glTexCoord3s(s, t, r);
+}
+static void APIENTRY lazy_glTexCoord3sv(const GLshort *v) {
+	glad_glTexCoord3sv = (PFNGLTEXCOORD3SVPROC)resolve("glTexCoord3sv");
+	glad_glTexCoord3sv(v);
+}
+static void APIENTRY lazy_glTexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+	glad_glTexCoord4d = (PFNGLTEXCOORD4DPROC)resolve("glTexCoord4d");
+	glad_glTexCoord4d(s, t, r, q);
+}
+static void APIENTRY lazy_glTexCoord4dv(const GLdouble *v) {
+	glad_glTexCoord4dv = (PFNGLTEXCOORD4DVPROC)resolve("glTexCoord4dv");
+	glad_glTexCoord4dv(v);
+}
+static void APIENTRY lazy_glTexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+	glad_glTexCoord4f = (PFNGLTEXCOORD4FPROC)resolve("glTexCoord4f");
+	glad_glTexCoord4f(s, t, r, q);
+}
+static void APIENTRY lazy_glTexCoord4fv(const GLfloat *v) {
+	glad_glTexCoord4fv = (PFNGLTEXCOORD4FVPROC)resolve("glTexCoord4fv");
+	glad_glTexCoord4fv(v);
+}
+static void APIENTRY lazy_glTexCoord4i(GLint s, GLint t, GLint r, GLint q) {
+	glad_glTexCoord4i = (PFNGLTEXCOORD4IPROC)resolve("glTexCoord4i");
+	glad_glTexCoord4i(s, t, r, q);
+}
+static void APIENTRY lazy_glTexCoord4iv(const GLint *v) {
+	glad_glTexCoord4iv = (PFNGLTEXCOORD4IVPROC)resolve("glTexCoord4iv");
+	glad_glTexCoord4iv(v);
+}
+static void APIENTRY lazy_glTexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q) {
+	glad_glTexCoord4s = (PFNGLTEXCOORD4SPROC)resolve("glTexCoord4s");
+	glad_glTexCoord4s(s, t, r, q);
+}
+static void APIENTRY lazy_glTexCoord4sv(const GLshort *v) {
+	glad_glTexCoord4sv = (PFNGLTEXCOORD4SVPROC)resolve("glTexCoord4sv");
+	glad_glTexCoord4sv(v);
+}
+static void APIENTRY lazy_glVertex2d(GLdouble x, GLdouble y) {
+	glad_glVertex2d = (PFNGLVERTEX2DPROC)resolve("glVertex2d");
+	glad_glVertex2d(x, y);
+}
+static void APIENTRY lazy_glVertex2dv(const GLdouble *v) {
+	glad_glVertex2dv = (PFNGLVERTEX2DVPROC)resolve("glVertex2dv");
+	glad_glVertex2dv(v);
+}
+static void APIENTRY lazy_glVertex2f(GLfloat x, GLfloat y) {
+	glad_glVertex2f = (PFNGLVERTEX2FPROC)resolve("glVertex2f");
+	glad_glVertex2f(x, y);
+}
+static void APIENTRY lazy_glVertex2fv(const GLfloat *v) {
+	glad_glVertex2fv = (PFNGLVERTEX2FVPROC)resolve("glVertex2fv");
+	glad_glVertex2fv(v);
+}
+static void APIENTRY lazy_glVertex2i(GLint x, GLint y) {
+	glad_glVertex2i = (PFNGLVERTEX2IPROC)resolve("glVertex2i");
+	glad_glVertex2i(x, y);
+}
+static void APIENTRY lazy_glVertex2iv(const GLint *v) {
+	glad_glVertex2iv = (PFNGLVERTEX2IVPROC)resolve("glVertex2iv");
+	glad_glVertex2iv(v);
+}
+static void APIENTRY lazy_glVertex2s(GLshort x, GLshort y) {
+	glad_glVertex2s = (PFNGLVERTEX2SPROC)resolve("glVertex2s");
+	glad_glVertex2s(x, y);
+}
+static void APIENTRY lazy_glVertex2sv(const GLshort *v) {
+	glad_glVertex2sv = (PFNGLVERTEX2SVPROC)resolve("glVertex2sv");
+	glad_glVertex2sv(v);
+}
+static void APIENTRY lazy_glVertex3d(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glVertex3d = (PFNGLVERTEX3DPROC)resolve("glVertex3d");
+	glad_glVertex3d(x, y, z);
+}
+static void APIENTRY lazy_glVertex3dv(const GLdouble *v) {
+	glad_glVertex3dv = (PFNGLVERTEX3DVPROC)resolve("glVertex3dv");
+	glad_glVertex3dv(v);
+}
+static void APIENTRY lazy_glVertex3f(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glVertex3f = (PFNGLVERTEX3FPROC)resolve("glVertex3f");
+	glad_glVertex3f(x, y, z);
+}
+static void APIENTRY lazy_glVertex3fv(const GLfloat *v) {
+	glad_glVertex3fv = (PFNGLVERTEX3FVPROC)resolve("glVertex3fv");
+	glad_glVertex3fv(v);
+}
+static void APIENTRY lazy_glVertex3i(GLint x, GLint y, GLint z) {
+	glad_glVertex3i = (PFNGLVERTEX3IPROC)resolve("glVertex3i");
+	glad_glVertex3i(x, y, z);
+}
+static void APIENTRY lazy_glVertex3iv(const GLint *v) {
+	glad_glVertex3iv = (PFNGLVERTEX3IVPROC)resolve("glVertex3iv");
+	glad_glVertex3iv(v);
+}
+static void APIENTRY lazy_glVertex3s(GLshort x, GLshort y, GLshort z) {
+	glad_glVertex3s = (PFNGLVERTEX3SPROC)resolve("glVertex3s");
+	glad_glVertex3s(x, y, z);
+}
+static void APIENTRY lazy_glVertex3sv(const GLshort *v) {
+	glad_glVertex3sv = (PFNGLVERTEX3SVPROC)resolve("glVertex3sv");
+	glad_glVertex3sv(v);
+}
+static void APIENTRY lazy_glVertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glVertex4d = (PFNGLVERTEX4DPROC)resolve("glVertex4d");
+	glad_glVertex4d(x, y, z, w);
+}
+static void APIENTRY lazy_glVertex4dv(const GLdouble *v) {
+	glad_glVertex4dv = (PFNGLVERTEX4DVPROC)resolve("glVertex4dv");
+	glad_glVertex4dv(v);
+}
+static void APIENTRY lazy_glVertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glVertex4f = (PFNGLVERTEX4FPROC)resolve("glVertex4f");
+	glad_glVertex4f(x, y, z, w);
+}
+static void APIENTRY lazy_glVertex4fv(const GLfloat *v) {
+	glad_glVertex4fv = (PFNGLVERTEX4FVPROC)resolve("glVertex4fv");
+	glad_glVertex4fv(v);
+}
+static void APIENTRY lazy_glVertex4i(GLint x, GLint y, GLint z, GLint w) {
+	glad_glVertex4i = (PFNGLVERTEX4IPROC)resolve("glVertex4i");
+	glad_glVertex4i(x, y, z, w);
+}
+static void APIENTRY lazy_glVertex4iv(const GLint *v) {
+	glad_glVertex4iv = (PFNGLVERTEX4IVPROC)resolve("glVertex4iv");
+	glad_glVertex4iv(v);
+}
+static void APIENTRY lazy_glVertex4s(GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_glVertex4s = (PFNGLVERTEX4SPROC)resolve("glVertex4s");
+	glad_glVertex4s(x, y, z, w);
+}
+static void APIENTRY lazy_glVertex4sv(const GLshort *v) {
+	glad_glVertex4sv = (PFNGLVERTEX4SVPROC)resolve("glVertex4sv");
+	glad_glVertex4sv(v);
+}
+static void APIENTRY lazy_glClipPlane(GLenum plane, const GLdouble *equation) {
+	glad_glClipPlane = (PFNGLCLIPPLANEPROC)resolve("glClipPlane");
+	glad_glClipPlane(plane, equation);
+}
+static void APIENTRY lazy_glColorMaterial(GLenum face, GLenum mode) {
+	glad_glColorMaterial = (PFNGLCOLORMATERIALPROC)resolve("glColorMaterial");
+	glad_glColorMaterial(face, mode);
+}
+static void APIENTRY lazy_glFogf(GLenum pname, GLfloat param) {
+	glad_glFogf = (PFNGLFOGFPROC)resolve("glFogf");
+	glad_glFogf(pname, param);
+}
+static void APIENTRY lazy_glFogfv(GLenum pname, const GLfloat *params) {
+	glad_glFogfv = (PFNGLFOGFVPROC)resolve("glFogfv");
+	glad_glFogfv(pname, params);
+}
+static void APIENTRY lazy_glFogi(GLenum pname, GLint param) {
+	glad_glFogi = (PFNGLFOGIPROC)resolve("glFogi");
+	glad_glFogi(pname, param);
+}
+static void APIENTRY lazy_glFogiv(GLenum pname, const GLint *params) {
+	glad_glFogiv = (PFNGLFOGIVPROC)resolve("glFogiv");
+	glad_glFogiv(pname, params);
+}
+static void APIENTRY lazy_glLightf(GLenum light, GLenum pname, GLfloat param) {
+	glad_glLightf = (PFNGLLIGHTFPROC)resolve("glLightf");
+	glad_glLightf(light, pname, param);
+}
+static void APIENTRY lazy_glLightfv(GLenum light, GLenum pname, const GLfloat *params) {
+	glad_glLightfv = (PFNGLLIGHTFVPROC)resolve("glLightfv");
+	glad_glLightfv(light, pname, params);
+}
+static void APIENTRY lazy_glLighti(GLenum light, GLenum pname, GLint param) {
+	glad_glLighti = (PFNGLLIGHTIPROC)resolve("glLighti");
+	glad_glLighti(light, pname, param);
+}
+static void APIENTRY lazy_glLightiv(GLenum light, GLenum pname, const GLint *params) {
+	glad_glLightiv = (PFNGLLIGHTIVPROC)resolve("glLightiv");
+	glad_glLightiv(light, pname, params);
+}
+static void APIENTRY lazy_glLightModelf(GLenum pname, GLfloat param) {
+	glad_glLightModelf = (PFNGLLIGHTMODELFPROC)resolve("glLightModelf");
+	glad_glLightModelf(pname, param);
+}
+static void APIENTRY lazy_glLightModelfv(GLenum pname, const GLfloat *params) {
+	glad_glLightModelfv = (PFNGLLIGHTMODELFVPROC)resolve("glLightModelfv");
+	glad_glLightModelfv(pname, params);
+}
+static void APIENTRY lazy_glLightModeli(GLenum pname, GLint param) {
+	glad_glLightModeli = (PFNGLLIGHTMODELIPROC)resolve("glLightModeli");
+	glad_glLightModeli(pname, param);
+}
+static void APIENTRY lazy_glLightModeliv(GLenum pname, const GLint *params) {
+	glad_glLightModeliv = (PFNGLLIGHTMODELIVPROC)resolve("glLightModeliv");
+	glad_glLightModeliv(pname, params);
+}
+static void APIENTRY lazy_glLineStipple(GLint factor, GLushort pattern) {
+	glad_glLineStipple = (PFNGLLINESTIPPLEPROC)resolve("glLineStipple");
+	glad_glLineStipple(factor, pattern);
+}
+static void APIENTRY lazy_glMaterialf(GLenum face, GLenum pname, GLfloat param) {
+	glad_glMaterialf = (PFNGLMATERIALFPROC)resolve("glMaterialf");
+	glad_glMaterialf(face, pname, param);
+}
+static void APIENTRY lazy_glMaterialfv(GLenum face, GLenum pname, const GLfloat *params) {
+	glad_glMaterialfv = (PFNGLMATERIALFVPROC)resolve("glMaterialfv");
+	glad_glMaterialfv(face, pname, params);
+}
+static void APIENTRY lazy_glMateriali(GLenum face, GLenum pname, GLint param) {
+	glad_glMateriali = (PFNGLMATERIALIPROC)resolve("glMateriali");
+	glad_glMateriali(face, pname, param);
+}
+static void APIENTRY lazy_glMaterialiv(GLenum face, GLenum pname, const GLint *params) {
+	glad_glMaterialiv = (PFNGLMATERIALIVPROC)resolve("glMaterialiv");
+	glad_glMaterialiv(face, pname, params);
+}
+static void APIENTRY lazy_glPolygonStipple(const GLubyte *mask) {
+	glad_glPolygonStipple = (PFNGLPOLYGONSTIPPLEPROC)resolve("glPolygonStipple");
+	glad_glPolygonStipple(mask);
+}
+static void APIENTRY lazy_glShadeModel(GLenum mode) {
+	glad_glShadeModel = (PFNGLSHADEMODELPROC)resolve("glShadeModel");
+	glad_glShadeModel(mode);
+}
+static void APIENTRY lazy_glTexEnvf(GLenum target, GLenum pname, GLfloat param) {
+	glad_glTexEnvf = (PFNGLTEXENVFPROC)resolve("glTexEnvf");
+	glad_glTexEnvf(target, pname, param);
+}
+static void APIENTRY lazy_glTexEnvfv(GLenum target, GLenum pname, const GLfloat *params) {
+	glad_glTexEnvfv = (PFNGLTEXENVFVPROC)resolve("glTexEnvfv");
+	glad_glTexEnvfv(target, pname, params);
+}
+static void APIENTRY lazy_glTexEnvi(GLenum target, GLenum pname, GLint param) {
+	glad_glTexEnvi = (PFNGLTEXENVIPROC)resolve("glTexEnvi");
+	glad_glTexEnvi(target, pname, param);
+}
+static void APIENTRY lazy_glTexEnviv(GLenum target, GLenum pname, const GLint *params) {
+	glad_glTexEnviv = (PFNGLTEXENVIVPROC)resolve("glTexEnviv");
+	glad_glTexEnviv(target, pname, params);
+}
+static void APIENTRY lazy_glTexGend(GLenum coord, GLenum pname, GLdouble param) {
+	glad_glTexGend = (PFNGLTEXGENDPROC)resolve("glTexGend");
+	glad_glTexGend(coord, pname, param);
+}
+static void APIENTRY lazy_glTexGendv(GLenum coord, GLenum pname, const GLdouble *params) {
+	glad_glTexGendv = (PFNGLTEXGENDVPROC)resolve("glTexGendv");
+	glad_glTexGendv(coord, pname, params);
+}
+static void APIENTRY lazy_glTexGenf(GLenum coord, GLenum pname, GLfloat param) {
+	glad_glTexGenf = (PFNGLTEXGENFPROC)resolve("glTexGenf");
+	glad_glTexGenf(coord, pname, param);
+}
+static void APIENTRY lazy_glTexGenfv(GLenum coord, GLenum pname, const GLfloat *params) {
+	glad_glTexGenfv = (PFNGLTEXGENFVPROC)resolve("glTexGenfv");
+	glad_glTexGenfv(coord, pname, params);
+}
+static void APIENTRY lazy_glTexGeni(GLenum coord, GLenum pname, GLint param) {
+	glad_glTexGeni = (PFNGLTEXGENIPROC)resolve("glTexGeni");
+	glad_glTexGeni(coord, pname, param);
+}
+static void APIENTRY lazy_glTexGeniv(GLenum coord, GLenum pname, const GLint *params) {
+	glad_glTexGeniv = (PFNGLTEXGENIVPROC)resolve("glTexGeniv");
+	glad_glTexGeniv(coord, pname, params);
+}
+static void APIENTRY lazy_glFeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer) {
+	glad_glFeedbackBuffer = (PFNGLFEEDBACKBUFFERPROC)resolve("glFeedbackBuffer");
+	glad_glFeedbackBuffer(size, type, buffer);
+}
+static void APIENTRY lazy_glSelectBuffer(GLsizei size, GLuint *buffer) {
+	glad_glSelectBuffer = (PFNGLSELECTBUFFERPROC)resolve("glSelectBuffer");
+	glad_glSelectBuffer(size, buffer);
+}
+static GLint APIENTRY lazy_glRenderMode(GLenum mode) {
+	glad_glRenderMode = (PFNGLRENDERMODEPROC)resolve("glRenderMode");
+	return glad_glRenderMode(mode);
+}
+static void APIENTRY lazy_glInitNames(void) {
+	glad_glInitNames = (PFNGLINITNAMESPROC)resolve("glInitNames");
+	glad_glInitNames();
+}
+static void APIENTRY lazy_glLoadName(GLuint name) {
+	glad_glLoadName = (PFNGLLOADNAMEPROC)resolve("glLoadName");
+	glad_glLoadName(name);
+}
+static void APIENTRY lazy_glPassThrough(GLfloat token) {
+	glad_glPassThrough = (PFNGLPASSTHROUGHPROC)resolve("glPassThrough");
+	glad_glPassThrough(token);
+}
+static void APIENTRY lazy_glPopName(void) {
+	glad_glPopName = (PFNGLPOPNAMEPROC)resolve("glPopName");
+	glad_glPopName();
+}
+static void APIENTRY lazy_glPushName(GLuint name) {
+	glad_glPushName = (PFNGLPUSHNAMEPROC)resolve("glPushName");
+	glad_glPushName(name);
+}
+static void APIENTRY lazy_glClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glClearAccum = (PFNGLCLEARACCUMPROC)resolve("glClearAccum");
+	glad_glClearAccum(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glClearIndex(GLfloat c) {
+	glad_glClearIndex = (PFNGLCLEARINDEXPROC)resolve("glClearIndex");
+	glad_glClearIndex(c);
+}
+static void APIENTRY lazy_glIndexMask(GLuint mask) {
+	glad_glIndexMask = (PFNGLINDEXMASKPROC)resolve("glIndexMask");
+	glad_glIndexMask(mask);
+}
+static void APIENTRY lazy_glAccum(GLenum op, GLfloat value) {
+	glad_glAccum = (PFNGLACCUMPROC)resolve("glAccum");
+	glad_glAccum(op, value);
+}
+static void APIENTRY lazy_glPopAttrib(void) {
+	glad_glPopAttrib = (PFNGLPOPATTRIBPROC)resolve("glPopAttrib");
+	glad_glPopAttrib();
+}
+static void APIENTRY lazy_glPushAttrib(GLbitfield mask) {
+	glad_glPushAttrib = (PFNGLPUSHATTRIBPROC)resolve("glPushAttrib");
+	glad_glPushAttrib(mask);
+}
+static void APIENTRY lazy_glMap1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble *points) {
+	glad_glMap1d = (PFNGLMAP1DPROC)resolve("glMap1d");
+	glad_glMap1d(target, u1, u2, stride, order, points);
+}
+static void APIENTRY lazy_glMap1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat *points) {
+	glad_glMap1f = (PFNGLMAP1FPROC)resolve("glMap1f");
+	glad_glMap1f(target, u1, u2, stride, order, points);
+}
+static void APIENTRY lazy_glMap2d(GLenum target, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble *points) {
+	glad_glMap2d = (PFNGLMAP2DPROC)resolve("glMap2d");
+	glad_glMap2d(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+static void APIENTRY lazy_glMap2f(GLenum target, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat *points) {
+	glad_glMap2f = (PFNGLMAP2FPROC)resolve("glMap2f");
+	glad_glMap2f(target, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+static void APIENTRY lazy_glMapGrid1d(GLint un, GLdouble u1, GLdouble u2) {
+	glad_glMapGrid1d = (PFNGLMAPGRID1DPROC)resolve("glMapGrid1d");
+	glad_glMapGrid1d(un, u1, u2);
+}
+static void APIENTRY lazy_glMapGrid1f(GLint un, GLfloat u1, GLfloat u2) {
+	glad_glMapGrid1f = (PFNGLMAPGRID1FPROC)resolve("glMapGrid1f");
+	glad_glMapGrid1f(un, u1, u2);
+}
+static void APIENTRY lazy_glMapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble v2) {
+	glad_glMapGrid2d = (PFNGLMAPGRID2DPROC)resolve("glMapGrid2d");
+	glad_glMapGrid2d(un, u1, u2, vn, v1, v2);
+}
+static void APIENTRY lazy_glMapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloat v1, GLfloat v2) {
+	glad_glMapGrid2f = (PFNGLMAPGRID2FPROC)resolve("glMapGrid2f");
+	glad_glMapGrid2f(un, u1, u2, vn, v1, v2);
+}
+static void APIENTRY lazy_glEvalCoord1d(GLdouble u) {
+	glad_glEvalCoord1d = (PFNGLEVALCOORD1DPROC)resolve("glEvalCoord1d");
+	glad_glEvalCoord1d(u);
+}
+static void APIENTRY lazy_glEvalCoord1dv(const GLdouble *u) {
+	glad_glEvalCoord1dv = (PFNGLEVALCOORD1DVPROC)resolve("glEvalCoord1dv");
+	glad_glEvalCoord1dv(u);
+}
+static void APIENTRY lazy_glEvalCoord1f(GLfloat u) {
+	glad_glEvalCoord1f = (PFNGLEVALCOORD1FPROC)resolve("glEvalCoord1f");
+	glad_glEvalCoord1f(u);
+}
+static void APIENTRY lazy_glEvalCoord1fv(const GLfloat *u) {
+	glad_glEvalCoord1fv = (PFNGLEVALCOORD1FVPROC)resolve("glEvalCoord1fv");
+	glad_glEvalCoord1fv(u);
+}
+static void APIENTRY lazy_glEvalCoord2d(GLdouble u, GLdouble v) {
+	glad_glEvalCoord2d = (PFNGLEVALCOORD2DPROC)resolve("glEvalCoord2d");
+	glad_glEvalCoord2d(u, v);
+}
+static void APIENTRY lazy_glEvalCoord2dv(const GLdouble *u) {
+	glad_glEvalCoord2dv = (PFNGLEVALCOORD2DVPROC)resolve("glEvalCoord2dv");
+	glad_glEvalCoord2dv(u);
+}
+static void APIENTRY lazy_glEvalCoord2f(GLfloat u, GLfloat v) {
+	glad_glEvalCoord2f = (PFNGLEVALCOORD2FPROC)resolve("glEvalCoord2f");
+	glad_glEvalCoord2f(u, v);
+}
+static void APIENTRY lazy_glEvalCoord2fv(const GLfloat *u) {
+	glad_glEvalCoord2fv = (PFNGLEVALCOORD2FVPROC)resolve("glEvalCoord2fv");
+	glad_glEvalCoord2fv(u);
+}
+static void APIENTRY lazy_glEvalMesh1(GLenum mode, GLint i1, GLint i2) {
+	glad_glEvalMesh1 = (PFNGLEVALMESH1PROC)resolve("glEvalMesh1");
+	glad_glEvalMesh1(mode, i1, i2);
+}
+static void APIENTRY lazy_glEvalPoint1(GLint i) {
+	glad_glEvalPoint1 = (PFNGLEVALPOINT1PROC)resolve("glEvalPoint1");
+	glad_glEvalPoint1(i);
+}
+static void APIENTRY lazy_glEvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j2) {
+	glad_glEvalMesh2 = (PFNGLEVALMESH2PROC)resolve("glEvalMesh2");
+	glad_glEvalMesh2(mode, i1, i2, j1, j2);
+}
+static void APIENTRY lazy_glEvalPoint2(GLint i, GLint j) {
+	glad_glEvalPoint2 = (PFNGLEVALPOINT2PROC)resolve("glEvalPoint2");
+	glad_glEvalPoint2(i, j);
+}
+static void APIENTRY lazy_glAlphaFunc(GLenum func, GLfloat ref) {
+	glad_glAlphaFunc = (PFNGLALPHAFUNCPROC)resolve("glAlphaFunc");
+	glad_glAlphaFunc(func, ref);
+}
+static void APIENTRY lazy_glPixelZoom(GLfloat xfactor, GLfloat yfactor) {
+	glad_glPixelZoom = (PFNGLPIXELZOOMPROC)resolve("glPixelZoom");
+	glad_glPixelZoom(xfactor, yfactor);
+}
+static void APIENTRY lazy_glPixelTransferf(GLenum pname, GLfloat param) {
+	glad_glPixelTransferf = (PFNGLPIXELTRANSFERFPROC)resolve("glPixelTransferf");
+	glad_glPixelTransferf(pname, param);
+}
+static void APIENTRY lazy_glPixelTransferi(GLenum pname, GLint param) {
+	glad_glPixelTransferi = (PFNGLPIXELTRANSFERIPROC)resolve("glPixelTransferi");
+	glad_glPixelTransferi(pname, param);
+}
+static void APIENTRY lazy_glPixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *values) {
+	glad_glPixelMapfv = (PFNGLPIXELMAPFVPROC)resolve("glPixelMapfv");
+	glad_glPixelMapfv(map, mapsize, values);
+}
+static void APIENTRY lazy_glPixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *values) {
+	glad_glPixelMapuiv = (PFNGLPIXELMAPUIVPROC)resolve("glPixelMapuiv");
+	glad_glPixelMapuiv(map, mapsize, values);
+}
+static void APIENTRY lazy_glPixelMapusv(GLenum map, GLsizei mapsize, const GLushort *values) {
+	glad_glPixelMapusv = (PFNGLPIXELMAPUSVPROC)resolve("glPixelMapusv");
+	glad_glPixelMapusv(map, mapsize, values);
+}
+static void APIENTRY lazy_glCopyPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum type) {
+	glad_glCopyPixels = (PFNGLCOPYPIXELSPROC)resolve("glCopyPixels");
+	glad_glCopyPixels(x, y, width, height, type);
+}
+static void APIENTRY lazy_glDrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_glDrawPixels = (PFNGLDRAWPIXELSPROC)resolve("glDrawPixels");
+	glad_glDrawPixels(width, height, format, type, pixels);
+}
+static void APIENTRY lazy_glGetClipPlane(GLenum plane, GLdouble *equation) {
+	glad_glGetClipPlane = (PFNGLGETCLIPPLANEPROC)resolve("glGetClipPlane");
+	glad_glGetClipPlane(plane, equation);
+}
+static void APIENTRY lazy_glGetLightfv(GLenum light, GLenum pname, GLfloat *params) {
+	glad_glGetLightfv = (PFNGLGETLIGHTFVPROC)resolve("glGetLightfv");
+	glad_glGetLightfv(light, pname, params);
+}
+static void APIENTRY lazy_glGetLightiv(GLenum light, GLenum pname, GLint *params) {
+	glad_glGetLightiv = (PFNGLGETLIGHTIVPROC)resolve("glGetLightiv");
+	glad_glGetLightiv(light, pname, params);
+}
+static void APIENTRY lazy_glGetMapdv(GLenum target, GLenum query, GLdouble *v) {
+	glad_glGetMapdv = (PFNGLGETMAPDVPROC)resolve("glGetMapdv");
+	glad_glGetMapdv(target, query, v);
+}
+static void APIENTRY lazy_glGetMapfv(GLenum target, GLenum query, GLfloat *v) {
+	glad_glGetMapfv = (PFNGLGETMAPFVPROC)resolve("glGetMapfv");
+	glad_glGetMapfv(target, query, v);
+}
+static void APIENTRY lazy_glGetMapiv(GLenum target, GLenum query, GLint *v) {
+	glad_glGetMapiv = (PFNGLGETMAPIVPROC)resolve("glGetMapiv");
+	glad_glGetMapiv(target, query, v);
+}
+static void APIENTRY lazy_glGetMaterialfv(GLenum face, GLenum pname, GLfloat *params) {
+	glad_glGetMaterialfv = (PFNGLGETMATERIALFVPROC)resolve("glGetMaterialfv");
+	glad_glGetMaterialfv(face, pname, params);
+}
+static void APIENTRY lazy_glGetMaterialiv(GLenum face, GLenum pname, GLint *params) {
+	glad_glGetMaterialiv = (PFNGLGETMATERIALIVPROC)resolve("glGetMaterialiv");
+	glad_glGetMaterialiv(face, pname, params);
+}
+static void APIENTRY lazy_glGetPixelMapfv(GLenum map, GLfloat *values) {
+	glad_glGetPixelMapfv = (PFNGLGETPIXELMAPFVPROC)resolve("glGetPixelMapfv");
+	glad_glGetPixelMapfv(map, values);
+}
+static void APIENTRY lazy_glGetPixelMapuiv(GLenum map, GLuint *values) {
+	glad_glGetPixelMapuiv = (PFNGLGETPIXELMAPUIVPROC)resolve("glGetPixelMapuiv");
+	glad_glGetPixelMapuiv(map, values);
+}
+static void APIENTRY lazy_glGetPixelMapusv(GLenum map, GLushort *values) {
+	glad_glGetPixelMapusv = (PFNGLGETPIXELMAPUSVPROC)resolve("glGetPixelMapusv");
+	glad_glGetPixelMapusv(map, values);
+}
+static void APIENTRY lazy_glGetPolygonStipple(GLubyte *mask) {
+	glad_glGetPolygonStipple = (PFNGLGETPOLYGONSTIPPLEPROC)resolve("glGetPolygonStipple");
+	glad_glGetPolygonStipple(mask);
+}
+static void APIENTRY lazy_glGetTexEnvfv(GLenum target, GLenum pname, GLfloat *params) {
+	glad_glGetTexEnvfv = (PFNGLGETTEXENVFVPROC)resolve("glGetTexEnvfv");
+	glad_glGetTexEnvfv(target, pname, params);
+}
+static void APIENTRY lazy_glGetTexEnviv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetTexEnviv = (PFNGLGETTEXENVIVPROC)resolve("glGetTexEnviv");
+	glad_glGetTexEnviv(target, pname, params);
+}
+static void APIENTRY lazy_glGetTexGendv(GLenum coord, GLenum pname, GLdouble *params) {
+	glad_glGetTexGendv = (PFNGLGETTEXGENDVPROC)resolve("glGetTexGendv");
+	glad_glGetTexGendv(coord, pname, params);
+}
+static void APIENTRY lazy_glGetTexGenfv(GLenum coord, GLenum pname, GLfloat *params) {
+	glad_glGetTexGenfv = (PFNGLGETTEXGENFVPROC)resolve("glGetTexGenfv");
+	glad_glGetTexGenfv(coord, pname, params);
+}
+static void APIENTRY lazy_glGetTexGeniv(GLenum coord, GLenum pname, GLint *params) {
+	glad_glGetTexGeniv = (PFNGLGETTEXGENIVPROC)resolve("glGetTexGeniv");
+	glad_glGetTexGeniv(coord, pname, params);
+}
+static GLboolean APIENTRY lazy_glIsList(GLuint list) {
+	glad_glIsList = (PFNGLISLISTPROC)resolve("glIsList");
+	return glad_glIsList(list);
+}
+static void APIENTRY lazy_glFrustum(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+	glad_glFrustum = (PFNGLFRUSTUMPROC)resolve("glFrustum");
+	glad_glFrustum(left, right, bottom, top, zNear, zFar);
+}
+static void APIENTRY lazy_glLoadIdentity(void) {
+	glad_glLoadIdentity = (PFNGLLOADIDENTITYPROC)resolve("glLoadIdentity");
+	glad_glLoadIdentity();
+}
+static void APIENTRY lazy_glLoadMatrixf(const GLfloat *m) {
+	glad_glLoadMatrixf = (PFNGLLOADMATRIXFPROC)resolve("glLoadMatrixf");
+	glad_glLoadMatrixf(m);
+}
+static void APIENTRY lazy_glLoadMatrixd(const GLdouble *m) {
+	glad_glLoadMatrixd = (PFNGLLOADMATRIXDPROC)resolve("glLoadMatrixd");
+	glad_glLoadMatrixd(m);
+}
+static void APIENTRY lazy_glMatrixMode(GLenum mode) {
+	glad_glMatrixMode = (PFNGLMATRIXMODEPROC)resolve("glMatrixMode");
+	glad_glMatrixMode(mode);
+}
+static void APIENTRY lazy_glMultMatrixf(const GLfloat *m) {
+	glad_glMultMatrixf = (PFNGLMULTMATRIXFPROC)resolve("glMultMatrixf");
+	glad_glMultMatrixf(m);
+}
+static void APIENTRY lazy_glMultMatrixd(const GLdouble *m) {
+	glad_glMultMatrixd = (PFNGLMULTMATRIXDPROC)resolve("glMultMatrixd");
+	glad_glMultMatrixd(m);
+}
+static void APIENTRY lazy_glOrtho(GLdouble left, GLdouble right, GLdouble bottom, GLdouble top, GLdouble zNear, GLdouble zFar) {
+	glad_glOrtho = (PFNGLORTHOPROC)resolve("glOrtho");
+	glad_glOrtho(left, right, bottom, top, zNear, zFar);
+}
+static void APIENTRY lazy_glPopMatrix(void) {
+	glad_glPopMatrix = (PFNGLPOPMATRIXPROC)resolve("glPopMatrix");
+	glad_glPopMatrix();
+}
+static void APIENTRY lazy_glPushMatrix(void) {
+	glad_glPushMatrix = (PFNGLPUSHMATRIXPROC)resolve("glPushMatrix");
+	glad_glPushMatrix();
+}
+static void APIENTRY lazy_glRotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glRotated = (PFNGLROTATEDPROC)resolve("glRotated");
+	glad_glRotated(angle, x, y, z);
+}
+static void APIENTRY lazy_glRotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glRotatef = (PFNGLROTATEFPROC)resolve("glRotatef");
+	glad_glRotatef(angle, x, y, z);
+}
+static void APIENTRY lazy_glScaled(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glScaled = (PFNGLSCALEDPROC)resolve("glScaled");
+	glad_glScaled(x, y, z);
+}
+static void APIENTRY lazy_glScalef(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glScalef = (PFNGLSCALEFPROC)resolve("glScalef");
+	glad_glScalef(x, y, z);
+}
+static void APIENTRY lazy_glTranslated(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glTranslated = (PFNGLTRANSLATEDPROC)resolve("glTranslated");
+	glad_glTranslated(x, y, z);
+}
+static void APIENTRY lazy_glTranslatef(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glTranslatef = (PFNGLTRANSLATEFPROC)resolve("glTranslatef");
+	glad_glTranslatef(x, y, z);
+}
+static void APIENTRY lazy_glDrawArrays(GLenum mode, GLint first, GLsizei count) {
+	glad_glDrawArrays = (PFNGLDRAWARRAYSPROC)resolve("glDrawArrays");
+	glad_glDrawArrays(mode, first, count);
+}
+static void APIENTRY lazy_glDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	glad_glDrawElements = (PFNGLDRAWELEMENTSPROC)resolve("glDrawElements");
+	glad_glDrawElements(mode, count, type, indices);
+}
+static void APIENTRY lazy_glGetPointerv(GLenum pname, void **params) {
+	glad_glGetPointerv = (PFNGLGETPOINTERVPROC)resolve("glGetPointerv");
+	glad_glGetPointerv(pname, params);
+}
+static void APIENTRY lazy_glPolygonOffset(GLfloat factor, GLfloat units) {
+	glad_glPolygonOffset = (PFNGLPOLYGONOFFSETPROC)resolve("glPolygonOffset");
+	glad_glPolygonOffset(factor, units);
+}
+static void APIENTRY lazy_glCopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	glad_glCopyTexImage1D = (PFNGLCOPYTEXIMAGE1DPROC)resolve("glCopyTexImage1D");
+	glad_glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+}
+static void APIENTRY lazy_glCopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	glad_glCopyTexImage2D = (PFNGLCOPYTEXIMAGE2DPROC)resolve("glCopyTexImage2D");
+	glad_glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+}
+static void APIENTRY lazy_glCopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	glad_glCopyTexSubImage1D = (PFNGLCOPYTEXSUBIMAGE1DPROC)resolve("glCopyTexSubImage1D");
+	glad_glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+}
+static void APIENTRY lazy_glCopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTexSubImage2D = (PFNGLCOPYTEXSUBIMAGE2DPROC)resolve("glCopyTexSubImage2D");
+	glad_glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY lazy_glTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage1D = (PFNGLTEXSUBIMAGE1DPROC)resolve("glTexSubImage1D");
+	glad_glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY lazy_glTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage2D = (PFNGLTEXSUBIMAGE2DPROC)resolve("glTexSubImage2D");
+	glad_glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY lazy_glBindTexture(GLenum target, GLuint texture) {
+	glad_glBindTexture = (PFNGLBINDTEXTUREPROC)resolve("glBindTexture");
+	glad_glBindTexture(target, texture);
+}
+static void APIENTRY lazy_glDeleteTextures(GLsizei n, const GLuint *textures) {
+	glad_glDeleteTextures = (PFNGLDELETETEXTURESPROC)resolve("glDeleteTextures");
+	glad_glDeleteTextures(n, textures);
+}
+static void APIENTRY lazy_glGenTextures(GLsizei n, GLuint *textures) {
+	glad_glGenTextures = (PFNGLGENTEXTURESPROC)resolve("glGenTextures");
+	glad_glGenTextures(n, textures);
+}
+static GLboolean APIENTRY lazy_glIsTexture(GLuint texture) {
+	glad_glIsTexture = (PFNGLISTEXTUREPROC)resolve("glIsTexture");
+	return glad_glIsTexture(texture);
+}
+static void APIENTRY lazy_glArrayElement(GLint i) {
+	glad_glArrayElement = (PFNGLARRAYELEMENTPROC)resolve("glArrayElement");
+	glad_glArrayElement(i);
+}
+static void APIENTRY lazy_glColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glColorPointer = (PFNGLCOLORPOINTERPROC)resolve("glColorPointer");
+	glad_glColorPointer(size, type, stride, pointer);
+}
+static void APIENTRY lazy_glDisableClientState(GLenum array) {
+	glad_glDisableClientState = (PFNGLDISABLECLIENTSTATEPROC)resolve("glDisableClientState");
+	glad_glDisableClientState(array);
+}
+static void APIENTRY lazy_glEdgeFlagPointer(GLsizei stride, const void *pointer) {
+	glad_glEdgeFlagPointer = (PFNGLEDGEFLAGPOINTERPROC)resolve("glEdgeFlagPointer");
+	glad_glEdgeFlagPointer(stride, pointer);
+}
+static void APIENTRY lazy_glEnableClientState(GLenum array) {
+	glad_glEnableClientState = (PFNGLENABLECLIENTSTATEPROC)resolve("glEnableClientState");
+	glad_glEnableClientState(array);
+}
+static void APIENTRY lazy_glIndexPointer(GLenum type, GLsizei stride, const void *pointer) {
+	glad_glIndexPointer = (PFNGLINDEXPOINTERPROC)resolve("glIndexPointer");
+	glad_glIndexPointer(type, stride, pointer);
+}
+static void APIENTRY lazy_glInterleavedArrays(GLenum format, GLsizei stride, const void *pointer) {
+	glad_glInterleavedArrays = (PFNGLINTERLEAVEDARRAYSPROC)resolve("glInterleavedArrays");
+	glad_glInterleavedArrays(format, stride, pointer);
+}
+static void APIENTRY lazy_glNormalPointer(GLenum type, GLsizei stride, const void *pointer) {
+	glad_glNormalPointer = (PFNGLNORMALPOINTERPROC)resolve("glNormalPointer");
+	glad_glNormalPointer(type, stride, pointer);
+}
+static void APIENTRY lazy_glTexCoordPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glTexCoordPointer = (PFNGLTEXCOORDPOINTERPROC)resolve("glTexCoordPointer");
+	glad_glTexCoordPointer(size, type, stride, pointer);
+}
+static void APIENTRY lazy_glVertexPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glVertexPointer = (PFNGLVERTEXPOINTERPROC)resolve("glVertexPointer");
+	glad_glVertexPointer(size, type, stride, pointer);
+}
+static GLboolean APIENTRY lazy_glAreTexturesResident(GLsizei n, const GLuint *textures, GLboolean *residences) {
+	glad_glAreTexturesResident = (PFNGLARETEXTURESRESIDENTPROC)resolve("glAreTexturesResident");
+	return glad_glAreTexturesResident(n, textures, residences);
+}
+static void APIENTRY lazy_glPrioritizeTextures(GLsizei n, const GLuint *textures, const GLfloat *priorities) {
+	glad_glPrioritizeTextures = (PFNGLPRIORITIZETEXTURESPROC)resolve("glPrioritizeTextures");
+	glad_glPrioritizeTextures(n, textures, priorities);
+}
+static void APIENTRY lazy_glIndexub(GLubyte c) {
+	glad_glIndexub = (PFNGLINDEXUBPROC)resolve("glIndexub");
+	glad_glIndexub(c);
+}
+static void APIENTRY lazy_glIndexubv(const GLubyte *c) {
+	glad_glIndexubv = (PFNGLINDEXUBVPROC)resolve("glIndexubv");
+	glad_glIndexubv(c);
+}
+static void APIENTRY lazy_glPopClientAttrib(void) {
+	glad_glPopClientAttrib = (PFNGLPOPCLIENTATTRIBPROC)resolve("glPopClientAttrib");
+	glad_glPopClientAttrib();
+}
+static void APIENTRY lazy_glPushClientAttrib(GLbitfield mask) {
+	glad_glPushClientAttrib = (PFNGLPUSHCLIENTATTRIBPROC)resolve("glPushClientAttrib");
+	glad_glPushClientAttrib(mask);
+}
+static void APIENTRY lazy_glDrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	glad_glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)resolve("glDrawRangeElements");
+	glad_glDrawRangeElements(mode, start, end, count, type, indices);
+}
+static void APIENTRY lazy_glTexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexImage3D = (PFNGLTEXIMAGE3DPROC)resolve("glTexImage3D");
+	glad_glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+static void APIENTRY lazy_glTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	glad_glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)resolve("glTexSubImage3D");
+	glad_glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY lazy_glCopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)resolve("glCopyTexSubImage3D");
+	glad_glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY lazy_glActiveTexture(GLenum texture) {
+	glad_glActiveTexture = (PFNGLACTIVETEXTUREPROC)resolve("glActiveTexture");
+	glad_glActiveTexture(texture);
+}
+static void APIENTRY lazy_glSampleCoverage(GLfloat value, GLboolean invert) {
+	glad_glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC)resolve("glSampleCoverage");
+	glad_glSampleCoverage(value, invert);
+}
+static void APIENTRY lazy_glCompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)resolve("glCompressedTexImage3D");
+	glad_glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)resolve("glCompressedTexImage2D");
+	glad_glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)resolve("glCompressedTexImage1D");
+	glad_glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)resolve("glCompressedTexSubImage3D");
+	glad_glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)resolve("glCompressedTexSubImage2D");
+	glad_glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)resolve("glCompressedTexSubImage1D");
+	glad_glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY lazy_glGetCompressedTexImage(GLenum target, GLint level, void *img) {
+	glad_glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)resolve("glGetCompressedTexImage");
+	glad_glGetCompressedTexImage(target, level, img);
+}
+static void APIENTRY lazy_glClientActiveTexture(GLenum texture) {
+	glad_glClientActiveTexture = (PFNGLCLIENTACTIVETEXTUREPROC)resolve("glClientActiveTexture");
+	glad_glClientActiveTexture(texture);
+}
+static void APIENTRY lazy_glMultiTexCoord1d(GLenum target, GLdouble s) {
+	glad_glMultiTexCoord1d = (PFNGLMULTITEXCOORD1DPROC)resolve("glMultiTexCoord1d");
+	glad_glMultiTexCoord1d(target, s);
+}
+static void APIENTRY lazy_glMultiTexCoord1dv(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord1dv = (PFNGLMULTITEXCOORD1DVPROC)resolve("glMultiTexCoord1dv");
+	glad_glMultiTexCoord1dv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord1f(GLenum target, GLfloat s) {
+	glad_glMultiTexCoord1f = (PFNGLMULTITEXCOORD1FPROC)resolve("glMultiTexCoord1f");
+	glad_glMultiTexCoord1f(target, s);
+}
+static void APIENTRY lazy_glMultiTexCoord1fv(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord1fv = (PFNGLMULTITEXCOORD1FVPROC)resolve("glMultiTexCoord1fv");
+	glad_glMultiTexCoord1fv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord1i(GLenum target, GLint s) {
+	glad_glMultiTexCoord1i = (PFNGLMULTITEXCOORD1IPROC)resolve("glMultiTexCoord1i");
+	glad_glMultiTexCoord1i(target, s);
+}
+static void APIENTRY lazy_glMultiTexCoord1iv(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord1iv = (PFNGLMULTITEXCOORD1IVPROC)resolve("glMultiTexCoord1iv");
+	glad_glMultiTexCoord1iv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord1s(GLenum target, GLshort s) {
+	glad_glMultiTexCoord1s = (PFNGLMULTITEXCOORD1SPROC)resolve("glMultiTexCoord1s");
+	glad_glMultiTexCoord1s(target, s);
+}
+static void APIENTRY lazy_glMultiTexCoord1sv(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord1sv = (PFNGLMULTITEXCOORD1SVPROC)resolve("glMultiTexCoord1sv");
+	glad_glMultiTexCoord1sv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord2d(GLenum target, GLdouble s, GLdouble t) {
+	glad_glMultiTexCoord2d = (PFNGLMULTITEXCOORD2DPROC)resolve("glMultiTexCoord2d");
+	glad_glMultiTexCoord2d(target, s, t);
+}
+static void APIENTRY lazy_glMultiTexCoord2dv(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord2dv = (PFNGLMULTITEXCOORD2DVPROC)resolve("glMultiTexCoord2dv");
+	glad_glMultiTexCoord2dv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord2f(GLenum target, GLfloat s, GLfloat t) {
+	glad_glMultiTexCoord2f = (PFNGLMULTITEXCOORD2FPROC)resolve("glMultiTexCoord2f");
+	glad_glMultiTexCoord2f(target, s, t);
+}
+static void APIENTRY lazy_glMultiTexCoord2fv(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord2fv = (PFNGLMULTITEXCOORD2FVPROC)resolve("glMultiTexCoord2fv");
+	glad_glMultiTexCoord2fv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord2i(GLenum target, GLint s, GLint t) {
+	glad_glMultiTexCoord2i = (PFNGLMULTITEXCOORD2IPROC)resolve("glMultiTexCoord2i");
+	glad_glMultiTexCoord2i(target, s, t);
+}
+static void APIENTRY lazy_glMultiTexCoord2iv(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord2iv = (PFNGLMULTITEXCOORD2IVPROC)resolve("glMultiTexCoord2iv");
+	glad_glMultiTexCoord2iv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord2s(GLenum target, GLshort s, GLshort t) {
+	glad_glMultiTexCoord2s = (PFNGLMULTITEXCOORD2SPROC)resolve("glMultiTexCoord2s");
+	glad_glMultiTexCoord2s(target, s, t);
+}
+static void APIENTRY lazy_glMultiTexCoord2sv(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord2sv = (PFNGLMULTITEXCOORD2SVPROC)resolve("glMultiTexCoord2sv");
+	glad_glMultiTexCoord2sv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdouble r) {
+	glad_glMultiTexCoord3d = (PFNGLMULTITEXCOORD3DPROC)resolve("glMultiTexCoord3d");
+	glad_glMultiTexCoord3d(target, s, t, r);
+}
+static void APIENTRY lazy_glMultiTexCoord3dv(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord3dv = (PFNGLMULTITEXCOORD3DVPROC)resolve("glMultiTexCoord3dv");
+	glad_glMultiTexCoord3dv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat r) {
+	glad_glMultiTexCoord3f = (PFNGLMULTITEXCOORD3FPROC)resolve("glMultiTexCoord3f");
+	glad_glMultiTexCoord3f(target, s, t, r);
+}
+static void APIENTRY lazy_glMultiTexCoord3fv(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord3fv = (PFNGLMULTITEXCOORD3FVPROC)resolve("glMultiTexCoord3fv");
+	glad_glMultiTexCoord3fv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r) {
+	glad_glMultiTexCoord3i = (PFNGLMULTITEXCOORD3IPROC)resolve("glMultiTexCoord3i");
+	glad_glMultiTexCoord3i(target, s, t, r);
+}
+static void APIENTRY lazy_glMultiTexCoord3iv(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord3iv = (PFNGLMULTITEXCOORD3IVPROC)resolve("glMultiTexCoord3iv");
+	glad_glMultiTexCoord3iv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort r) {
+	glad_glMultiTexCoord3s = (PFNGLMULTITEXCOORD3SPROC)resolve("glMultiTexCoord3s");
+	glad_glMultiTexCoord3s(target, s, t, r);
+}
+static void APIENTRY lazy_glMultiTexCoord3sv(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord3sv = (PFNGLMULTITEXCOORD3SVPROC)resolve("glMultiTexCoord3sv");
+	glad_glMultiTexCoord3sv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q) {
+	glad_glMultiTexCoord4d = (PFNGLMULTITEXCOORD4DPROC)resolve("glMultiTexCoord4d");
+	glad_glMultiTexCoord4d(target, s, t, r, q);
+}
+static void APIENTRY lazy_glMultiTexCoord4dv(GLenum target, const GLdouble *v) {
+	glad_glMultiTexCoord4dv = (PFNGLMULTITEXCOORD4DVPROC)resolve("glMultiTexCoord4dv");
+	glad_glMultiTexCoord4dv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q) {
+	glad_glMultiTexCoord4f = (PFNGLMULTITEXCOORD4FPROC)resolve("glMultiTexCoord4f");
+	glad_glMultiTexCoord4f(target, s, t, r, q);
+}
+static void APIENTRY lazy_glMultiTexCoord4fv(GLenum target, const GLfloat *v) {
+	glad_glMultiTexCoord4fv = (PFNGLMULTITEXCOORD4FVPROC)resolve("glMultiTexCoord4fv");
+	glad_glMultiTexCoord4fv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GLint q) {
+	glad_glMultiTexCoord4i = (PFNGLMULTITEXCOORD4IPROC)resolve("glMultiTexCoord4i");
+	glad_glMultiTexCoord4i(target, s, t, r, q);
+}
+static void APIENTRY lazy_glMultiTexCoord4iv(GLenum target, const GLint *v) {
+	glad_glMultiTexCoord4iv = (PFNGLMULTITEXCOORD4IVPROC)resolve("glMultiTexCoord4iv");
+	glad_glMultiTexCoord4iv(target, v);
+}
+static void APIENTRY lazy_glMultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort r, GLshort q) {
+	glad_glMultiTexCoord4s = (PFNGLMULTITEXCOORD4SPROC)resolve("glMultiTexCoord4s");
+	glad_glMultiTexCoord4s(target, s, t, r, q);
+}
+static void APIENTRY lazy_glMultiTexCoord4sv(GLenum target, const GLshort *v) {
+	glad_glMultiTexCoord4sv = (PFNGLMULTITEXCOORD4SVPROC)resolve("glMultiTexCoord4sv");
+	glad_glMultiTexCoord4sv(target, v);
+}
+static void APIENTRY lazy_glLoadTransposeMatrixf(const GLfloat *m) {
+	glad_glLoadTransposeMatrixf = (PFNGLLOADTRANSPOSEMATRIXFPROC)resolve("glLoadTransposeMatrixf");
+	glad_glLoadTransposeMatrixf(m);
+}
+static void APIENTRY lazy_glLoadTransposeMatrixd(const GLdouble *m) {
+	glad_glLoadTransposeMatrixd = (PFNGLLOADTRANSPOSEMATRIXDPROC)resolve("glLoadTransposeMatrixd");
+	glad_glLoadTransposeMatrixd(m);
+}
+static void APIENTRY lazy_glMultTransposeMatrixf(const GLfloat *m) {
+	glad_glMultTransposeMatrixf = (PFNGLMULTTRANSPOSEMATRIXFPROC)resolve("glMultTransposeMatrixf");
+	glad_glMultTransposeMatrixf(m);
+}
+static void APIENTRY lazy_glMultTransposeMatrixd(const GLdouble *m) {
+	glad_glMultTransposeMatrixd = (PFNGLMULTTRANSPOSEMATRIXDPROC)resolve("glMultTransposeMatrixd");
+	glad_glMultTransposeMatrixd(m);
+}
+static void APIENTRY lazy_glBlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	glad_glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)resolve("glBlendFuncSeparate");
+	glad_glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+static void APIENTRY lazy_glMultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	glad_glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)resolve("glMultiDrawArrays");
+	glad_glMultiDrawArrays(mode, first, count, drawcount);
+}
+static void APIENTRY lazy_glMultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	glad_glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)resolve("glMultiDrawElements");
+	glad_glMultiDrawElements(mode, count, type, indices, drawcount);
+}
+static void APIENTRY lazy_glPointParameterf(GLenum pname, GLfloat param) {
+	glad_glPointParameterf = (PFNGLPOINTPARAMETERFPROC)resolve("glPointParameterf");
+	glad_glPointParameterf(pname, param);
+}
+static void APIENTRY lazy_glPointParameterfv(GLenum pname, const GLfloat *params) {
+	glad_glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)resolve("glPointParameterfv");
+	glad_glPointParameterfv(pname, params);
+}
+static void APIENTRY lazy_glPointParameteri(GLenum pname, GLint param) {
+	glad_glPointParameteri = (PFNGLPOINTPARAMETERIPROC)resolve("glPointParameteri");
+	glad_glPointParameteri(pname, param);
+}
+static void APIENTRY lazy_glPointParameteriv(GLenum pname, const GLint *params) {
+	glad_glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)resolve("glPointParameteriv");
+	glad_glPointParameteriv(pname, params);
+}
+static void APIENTRY lazy_glFogCoordf(GLfloat coord) {
+	glad_glFogCoordf = (PFNGLFOGCOORDFPROC)resolve("glFogCoordf");
+	glad_glFogCoordf(coord);
+}
+static void APIENTRY lazy_glFogCoordfv(const GLfloat *coord) {
+	glad_glFogCoordfv = (PFNGLFOGCOORDFVPROC)resolve("glFogCoordfv");
+	glad_glFogCoordfv(coord);
+}
+static void APIENTRY lazy_glFogCoordd(GLdouble coord) {
+	glad_glFogCoordd = (PFNGLFOGCOORDDPROC)resolve("glFogCoordd");
+	glad_glFogCoordd(coord);
+}
+static void APIENTRY lazy_glFogCoorddv(const GLdouble *coord) {
+	glad_glFogCoorddv = (PFNGLFOGCOORDDVPROC)resolve("glFogCoorddv");
+	glad_glFogCoorddv(coord);
+}
+static void APIENTRY lazy_glFogCoordPointer(GLenum type, GLsizei stride, const void *pointer) {
+	glad_glFogCoordPointer = (PFNGLFOGCOORDPOINTERPROC)resolve("glFogCoordPointer");
+	glad_glFogCoordPointer(type, stride, pointer);
+}
+static void APIENTRY lazy_glSecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue) {
+	glad_glSecondaryColor3b = (PFNGLSECONDARYCOLOR3BPROC)resolve("glSecondaryColor3b");
+	glad_glSecondaryColor3b(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3bv(const GLbyte *v) {
+	glad_glSecondaryColor3bv = (PFNGLSECONDARYCOLOR3BVPROC)resolve("glSecondaryColor3bv");
+	glad_glSecondaryColor3bv(v);
+}
+static void APIENTRY lazy_glSecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue) {
+	glad_glSecondaryColor3d = (PFNGLSECONDARYCOLOR3DPROC)resolve("glSecondaryColor3d");
+	glad_glSecondaryColor3d(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3dv(const GLdouble *v) {
+	glad_glSecondaryColor3dv = (PFNGLSECONDARYCOLOR3DVPROC)resolve("glSecondaryColor3dv");
+	glad_glSecondaryColor3dv(v);
+}
+static void APIENTRY lazy_glSecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue) {
+	glad_glSecondaryColor3f = (PFNGLSECONDARYCOLOR3FPROC)resolve("glSecondaryColor3f");
+	glad_glSecondaryColor3f(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3fv(const GLfloat *v) {
+	glad_glSecondaryColor3fv = (PFNGLSECONDARYCOLOR3FVPROC)resolve("glSecondaryColor3fv");
+	glad_glSecondaryColor3fv(v);
+}
+static void APIENTRY lazy_glSecondaryColor3i(GLint red, GLint green, GLint blue) {
+	glad_glSecondaryColor3i = (PFNGLSECONDARYCOLOR3IPROC)resolve("glSecondaryColor3i");
+	glad_glSecondaryColor3i(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3iv(const GLint *v) {
+	glad_glSecondaryColor3iv = (PFNGLSECONDARYCOLOR3IVPROC)resolve("glSecondaryColor3iv");
+	glad_glSecondaryColor3iv(v);
+}
+static void APIENTRY lazy_glSecondaryColor3s(GLshort red, GLshort green, GLshort blue) {
+	glad_glSecondaryColor3s = (PFNGLSECONDARYCOLOR3SPROC)resolve("glSecondaryColor3s");
+	glad_glSecondaryColor3s(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3sv(const GLshort *v) {
+	glad_glSecondaryColor3sv = (PFNGLSECONDARYCOLOR3SVPROC)resolve("glSecondaryColor3sv");
+	glad_glSecondaryColor3sv(v);
+}
+static void APIENTRY lazy_glSecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue) {
+	glad_glSecondaryColor3ub = (PFNGLSECONDARYCOLOR3UBPROC)resolve("glSecondaryColor3ub");
+	glad_glSecondaryColor3ub(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3ubv(const GLubyte *v) {
+	glad_glSecondaryColor3ubv = (PFNGLSECONDARYCOLOR3UBVPROC)resolve("glSecondaryColor3ubv");
+	glad_glSecondaryColor3ubv(v);
+}
+static void APIENTRY lazy_glSecondaryColor3ui(GLuint red, GLuint green, GLuint blue) {
+	glad_glSecondaryColor3ui = (PFNGLSECONDARYCOLOR3UIPROC)resolve("glSecondaryColor3ui");
+	glad_glSecondaryColor3ui(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3uiv(const GLuint *v) {
+	glad_glSecondaryColor3uiv = (PFNGLSECONDARYCOLOR3UIVPROC)resolve("glSecondaryColor3uiv");
+	glad_glSecondaryColor3uiv(v);
+}
+static void APIENTRY lazy_glSecondaryColor3us(GLushort red, GLushort green, GLushort blue) {
+	glad_glSecondaryColor3us = (PFNGLSECONDARYCOLOR3USPROC)resolve("glSecondaryColor3us");
+	glad_glSecondaryColor3us(red, green, blue);
+}
+static void APIENTRY lazy_glSecondaryColor3usv(const GLushort *v) {
+	glad_glSecondaryColor3usv = (PFNGLSECONDARYCOLOR3USVPROC)resolve("glSecondaryColor3usv");
+	glad_glSecondaryColor3usv(v);
+}
+static void APIENTRY lazy_glSecondaryColorPointer(GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glSecondaryColorPointer = (PFNGLSECONDARYCOLORPOINTERPROC)resolve("glSecondaryColorPointer");
+	glad_glSecondaryColorPointer(size, type, stride, pointer);
+}
+static void APIENTRY lazy_glWindowPos2d(GLdouble x, GLdouble y) {
+	glad_glWindowPos2d = (PFNGLWINDOWPOS2DPROC)resolve("glWindowPos2d");
+	glad_glWindowPos2d(x, y);
+}
+static void APIENTRY lazy_glWindowPos2dv(const GLdouble *v) {
+	glad_glWindowPos2dv = (PFNGLWINDOWPOS2DVPROC)resolve("glWindowPos2dv");
+	glad_glWindowPos2dv(v);
+}
+static void APIENTRY lazy_glWindowPos2f(GLfloat x, GLfloat y) {
+	glad_glWindowPos2f = (PFNGLWINDOWPOS2FPROC)resolve("glWindowPos2f");
+	glad_glWindowPos2f(x, y);
+}
+static void APIENTRY lazy_glWindowPos2fv(const GLfloat *v) {
+	glad_glWindowPos2fv = (PFNGLWINDOWPOS2FVPROC)resolve("glWindowPos2fv");
+	glad_glWindowPos2fv(v);
+}
+static void APIENTRY lazy_glWindowPos2i(GLint x, GLint y) {
+	glad_glWindowPos2i = (PFNGLWINDOWPOS2IPROC)resolve("glWindowPos2i");
+	glad_glWindowPos2i(x, y);
+}
+static void APIENTRY lazy_glWindowPos2iv(const GLint *v) {
+	glad_glWindowPos2iv = (PFNGLWINDOWPOS2IVPROC)resolve("glWindowPos2iv");
+	glad_glWindowPos2iv(v);
+}
+static void APIENTRY lazy_glWindowPos2s(GLshort x, GLshort y) {
+	glad_glWindowPos2s = (PFNGLWINDOWPOS2SPROC)resolve("glWindowPos2s");
+	glad_glWindowPos2s(x, y);
+}
+static void APIENTRY lazy_glWindowPos2sv(const GLshort *v) {
+	glad_glWindowPos2sv = (PFNGLWINDOWPOS2SVPROC)resolve("glWindowPos2sv");
+	glad_glWindowPos2sv(v);
+}
+static void APIENTRY lazy_glWindowPos3d(GLdouble x, GLdouble y, GLdouble z) {
+	glad_glWindowPos3d = (PFNGLWINDOWPOS3DPROC)resolve("glWindowPos3d");
+	glad_glWindowPos3d(x, y, z);
+}
+static void APIENTRY lazy_glWindowPos3dv(const GLdouble *v) {
+	glad_glWindowPos3dv = (PFNGLWINDOWPOS3DVPROC)resolve("glWindowPos3dv");
+	glad_glWindowPos3dv(v);
+}
+static void APIENTRY lazy_glWindowPos3f(GLfloat x, GLfloat y, GLfloat z) {
+	glad_glWindowPos3f = (PFNGLWINDOWPOS3FPROC)resolve("glWindowPos3f");
+	glad_glWindowPos3f(x, y, z);
+}
+static void APIENTRY lazy_glWindowPos3fv(const GLfloat *v) {
+	glad_glWindowPos3fv = (PFNGLWINDOWPOS3FVPROC)resolve("glWindowPos3fv");
+	glad_glWindowPos3fv(v);
+}
+static void APIENTRY lazy_glWindowPos3i(GLint x, GLint y, GLint z) {
+	glad_glWindowPos3i = (PFNGLWINDOWPOS3IPROC)resolve("glWindowPos3i");
+	glad_glWindowPos3i(x, y, z);
+}
+static void APIENTRY lazy_glWindowPos3iv(const GLint *v) {
+	glad_glWindowPos3iv = (PFNGLWINDOWPOS3IVPROC)resolve("glWindowPos3iv");
+	glad_glWindowPos3iv(v);
+}
+static void APIENTRY lazy_glWindowPos3s(GLshort x, GLshort y, GLshort z) {
+	glad_glWindowPos3s = (PFNGLWINDOWPOS3SPROC)resolve("glWindowPos3s");
+	glad_glWindowPos3s(x, y, z);
+}
+static void APIENTRY lazy_glWindowPos3sv(const GLshort *v) {
+	glad_glWindowPos3sv = (PFNGLWINDOWPOS3SVPROC)resolve("glWindowPos3sv");
+	glad_glWindowPos3sv(v);
+}
+static void APIENTRY lazy_glBlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glad_glBlendColor = (PFNGLBLENDCOLORPROC)resolve("glBlendColor");
+	glad_glBlendColor(red, green, blue, alpha);
+}
+static void APIENTRY lazy_glBlendEquation(GLenum mode) {
+	glad_glBlendEquation = (PFNGLBLENDEQUATIONPROC)resolve("glBlendEquation");
+	glad_glBlendEquation(mode);
+}
+static void APIENTRY lazy_glGenQueries(GLsizei n, GLuint *ids) {
+	glad_glGenQueries = (PFNGLGENQUERIESPROC)resolve("glGenQueries");
+	glad_glGenQueries(n, ids);
+}
+static void APIENTRY lazy_glDeleteQueries(GLsizei n, const GLuint *ids) {
+	glad_glDeleteQueries = (PFNGLDELETEQUERIESPROC)resolve("glDeleteQueries");
+	glad_glDeleteQueries(n, ids);
+}
+static GLboolean APIENTRY lazy_glIsQuery(GLuint id) {
+	glad_glIsQuery = (PFNGLISQUERYPROC)resolve("glIsQuery");
+	return glad_glIsQuery(id);
+}
+static void APIENTRY lazy_glBeginQuery(GLenum target, GLuint id) {
+	glad_glBeginQuery = (PFNGLBEGINQUERYPROC)resolve("glBeginQuery");
+	glad_glBeginQuery(target, id);
+}
+static void APIENTRY lazy_glEndQuery(GLenum target) {
+	glad_glEndQuery = (PFNGLENDQUERYPROC)resolve("glEndQuery");
+	glad_glEndQuery(target);
+}
+static void APIENTRY lazy_glGetQueryiv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetQueryiv = (PFNGLGETQUERYIVPROC)resolve("glGetQueryiv");
+	glad_glGetQueryiv(target, pname, params);
+}
+static void APIENTRY lazy_glGetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+	glad_glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)resolve("glGetQueryObjectiv");
+	glad_glGetQueryObjectiv(id, pname, params);
+}
+static void APIENTRY lazy_glGetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+	glad_glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)resolve("glGetQueryObjectuiv");
+	glad_glGetQueryObjectuiv(id, pname, params);
+}
+static void APIENTRY lazy_glBindBuffer(GLenum target, GLuint buffer) {
+	glad_glBindBuffer = (PFNGLBINDBUFFERPROC)resolve("glBindBuffer");
+	glad_glBindBuffer(target, buffer);
+}
+static void APIENTRY lazy_glDeleteBuffers(GLsizei n, const GLuint *buffers) {
+	glad_glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)resolve("glDeleteBuffers");
+	glad_glDeleteBuffers(n, buffers);
+}
+static void APIENTRY lazy_glGenBuffers(GLsizei n, GLuint *buffers) {
+	glad_glGenBuffers = (PFNGLGENBUFFERSPROC)resolve("glGenBuffers");
+	glad_glGenBuffers(n, buffers);
+}
+static GLboolean APIENTRY lazy_glIsBuffer(GLuint buffer) {
+	glad_glIsBuffer = (PFNGLISBUFFERPROC)resolve("glIsBuffer");
+	return glad_glIsBuffer(buffer);
+}
+static void APIENTRY lazy_glBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	glad_glBufferData = (PFNGLBUFFERDATAPROC)resolve("glBufferData");
+	glad_glBufferData(target, size, data, usage);
+}
+static void APIENTRY lazy_glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	glad_glBufferSubData = (PFNGLBUFFERSUBDATAPROC)resolve("glBufferSubData");
+	glad_glBufferSubData(target, offset, size, data);
+}
+static void APIENTRY lazy_glGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+	glad_glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)resolve("glGetBufferSubData");
+	glad_glGetBufferSubData(target, offset, size, data);
+}
+static void * APIENTRY lazy_glMapBuffer(GLenum target, GLenum access) {
+	glad_glMapBuffer = (PFNGLMAPBUFFERPROC)resolve("glMapBuffer");
+	return glad_glMapBuffer(target, access);
+}
+static GLboolean APIENTRY lazy_glUnmapBuffer(GLenum target) {
+	glad_glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)resolve("glUnmapBuffer");
+	return glad_glUnmapBuffer(target);
+}
+static void APIENTRY lazy_glGetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)resolve("glGetBufferParameteriv");
+	glad_glGetBufferParameteriv(target, pname, params);
+}
+static void APIENTRY lazy_glGetBufferPointerv(GLenum target, GLenum pname, void **params) {
+	glad_glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)resolve("glGetBufferPointerv");
+	glad_glGetBufferPointerv(target, pname, params);
+}
+static void APIENTRY lazy_glBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	glad_glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)resolve("glBlendEquationSeparate");
+	glad_glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+static void APIENTRY lazy_glDrawBuffers(GLsizei n, const GLenum *bufs) {
+	glad_glDrawBuffers = (PFNGLDRAWBUFFERSPROC)resolve("glDrawBuffers");
+	glad_glDrawBuffers(n, bufs);
+}
+static void APIENTRY lazy_glStencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	glad_glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)resolve("glStencilOpSeparate");
+	glad_glStencilOpSeparate(face, sfail, dpfail, dppass);
+}
+static void APIENTRY lazy_glStencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	glad_glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)resolve("glStencilFuncSeparate");
+	glad_glStencilFuncSeparate(face, func, ref, mask);
+}
+static void APIENTRY lazy_glStencilMaskSeparate(GLenum face, GLuint mask) {
+	glad_glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)resolve("glStencilMaskSeparate");
+	glad_glStencilMaskSeparate(face, mask);
+}
+static void APIENTRY lazy_glAttachShader(GLuint program, GLuint shader) {
+	glad_glAttachShader = (PFNGLATTACHSHADERPROC)resolve("glAttachShader");
+	glad_glAttachShader(program, shader);
+}
+static void APIENTRY lazy_glBindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+	glad_glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)resolve("glBindAttribLocation");
+	glad_glBindAttribLocation(program, index, name);
+}
+static void APIENTRY lazy_glCompileShader(GLuint shader) {
+	glad_glCompileShader = (PFNGLCOMPILESHADERPROC)resolve("glCompileShader");
+	glad_glCompileShader(shader);
+}
+static GLuint APIENTRY lazy_glCreateProgram(void) {
+	glad_glCreateProgram = (PFNGLCREATEPROGRAMPROC)resolve("glCreateProgram");
+	return glad_glCreateProgram();
+}
+static GLuint APIENTRY lazy_glCreateShader(GLenum type) {
+	glad_glCreateShader = (PFNGLCREATESHADERPROC)resolve("glCreateShader");
+	return glad_glCreateShader(type);
+}
+static void APIENTRY lazy_glDeleteProgram(GLuint program) {
+	glad_glDeleteProgram = (PFNGLDELETEPROGRAMPROC)resolve("glDeleteProgram");
+	glad_glDeleteProgram(program);
+}
+static void APIENTRY lazy_glDeleteShader(GLuint shader) {
+	glad_glDeleteShader = (PFNGLDELETESHADERPROC)resolve("glDeleteShader");
+	glad_glDeleteShader(shader);
+}
+static void APIENTRY lazy_glDetachShader(GLuint program, GLuint shader) {
+	glad_glDetachShader = (PFNGLDETACHSHADERPROC)resolve("glDetachShader");
+	glad_glDetachShader(program, shader);
+}
+static void APIENTRY lazy_glDisableVertexAttribArray(GLuint index) {
+	glad_glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)resolve("glDisableVertexAttribArray");
+	glad_glDisableVertexAttribArray(index);
+}
+static void APIENTRY lazy_glEnableVertexAttribArray(GLuint index) {
+	glad_glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)resolve("glEnableVertexAttribArray");
+	glad_glEnableVertexAttribArray(index);
+}
+static void APIENTRY lazy_glGetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	glad_glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)resolve("glGetActiveAttrib");
+	glad_glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY lazy_glGetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	glad_glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)resolve("glGetActiveUniform");
+	glad_glGetActiveUniform(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY lazy_glGetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+	glad_glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)resolve("glGetAttachedShaders");
+	glad_glGetAttachedShaders(program, maxCount, count, shaders);
+}
+static GLint APIENTRY lazy_glGetAttribLocation(GLuint program, const GLchar *name) {
+	glad_glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)resolve("glGetAttribLocation");
+	return glad_glGetAttribLocation(program, name);
+}
+static void APIENTRY lazy_glGetProgramiv(GLuint program, GLenum pname, GLint *params) {
+	glad_glGetProgramiv = (PFNGLGETPROGRAMIVPROC)resolve("glGetProgramiv");
+	glad_glGetProgramiv(program, pname, params);
+}
+static void APIENTRY lazy_glGetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	glad_glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)resolve("glGetProgramInfoLog");
+	glad_glGetProgramInfoLog(program, bufSize, length, infoLog);
+}
+static void APIENTRY lazy_glGetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+	glad_glGetShaderiv = (PFNGLGETSHADERIVPROC)resolve("glGetShaderiv");
+	glad_glGetShaderiv(shader, pname, params);
+}
+static void APIENTRY lazy_glGetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	glad_glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)resolve("glGetShaderInfoLog");
+	glad_glGetShaderInfoLog(shader, bufSize, length, infoLog);
+}
+static void APIENTRY lazy_glGetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+	glad_glGetShaderSource = (PFNGLGETSHADERSOURCEPROC)resolve("glGetShaderSource");
+	glad_glGetShaderSource(shader, bufSize, length, source);
+}
+static GLint APIENTRY lazy_glGetUniformLocation(GLuint program, const GLchar *name) {
+	glad_glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)resolve("glGetUniformLocation");
+	return glad_glGetUniformLocation(program, name);
+}
+static void APIENTRY lazy_glGetUniformfv(GLuint program, GLint location, GLfloat *params) {
+	glad_glGetUniformfv = (PFNGLGETUNIFORMFVPROC)resolve("glGetUniformfv");
+	glad_glGetUniformfv(program, location, params);
+}
+static void APIENTRY lazy_glGetUniformiv(GLuint program, GLint location, GLint *params) {
+	glad_glGetUniformiv = (PFNGLGETUNIFORMIVPROC)resolve("glGetUniformiv");
+	glad_glGetUniformiv(program, location, params);
+}
+static void APIENTRY lazy_glGetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+	glad_glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)resolve("glGetVertexAttribdv");
+	glad_glGetVertexAttribdv(index, pname, params);
+}
+static void APIENTRY lazy_glGetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+	glad_glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)resolve("glGetVertexAttribfv");
+	glad_glGetVertexAttribfv(index, pname, params);
+}
+static void APIENTRY lazy_glGetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+	glad_glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)resolve("glGetVertexAttribiv");
+	glad_glGetVertexAttribiv(index, pname, params);
+}
+static void APIENTRY lazy_glGetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+	glad_glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)resolve("glGetVertexAttribPointerv");
+	glad_glGetVertexAttribPointerv(index, pname, pointer);
+}
+static GLboolean APIENTRY lazy_glIsProgram(GLuint program) {
+	glad_glIsProgram = (PFNGLISPROGRAMPROC)resolve("glIsProgram");
+	return glad_glIsProgram(program);
+}
+static GLboolean APIENTRY lazy_glIsShader(GLuint shader) {
+	glad_glIsShader = (PFNGLISSHADERPROC)resolve("glIsShader");
+	return glad_glIsShader(shader);
+}
+static void APIENTRY lazy_glLinkProgram(GLuint program) {
+	glad_glLinkProgram = (PFNGLLINKPROGRAMPROC)resolve("glLinkProgram");
+	glad_glLinkProgram(program);
+}
+static void APIENTRY lazy_glShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	glad_glShaderSource = (PFNGLSHADERSOURCEPROC)resolve("glShaderSource");
+	glad_glShaderSource(shader, count, string, length);
+}
+static void APIENTRY lazy_glUseProgram(GLuint program) {
+	glad_glUseProgram = (PFNGLUSEPROGRAMPROC)resolve("glUseProgram");
+	glad_glUseProgram(program);
+}
+static void APIENTRY lazy_glUniform1f(GLint location, GLfloat v0) {
+	glad_glUniform1f = (PFNGLUNIFORM1FPROC)resolve("glUniform1f");
+	glad_glUniform1f(location, v0);
+}
+static void APIENTRY lazy_glUniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	glad_glUniform2f = (PFNGLUNIFORM2FPROC)resolve("glUniform2f");
+	glad_glUniform2f(location, v0, v1);
+}
+static void APIENTRY lazy_glUniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	glad_glUniform3f = (PFNGLUNIFORM3FPROC)resolve("glUniform3f");
+	glad_glUniform3f(location, v0, v1, v2);
+}
+static void APIENTRY lazy_glUniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	glad_glUniform4f = (PFNGLUNIFORM4FPROC)resolve("glUniform4f");
+	glad_glUniform4f(location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glUniform1i(GLint location, GLint v0) {
+	glad_glUniform1i = (PFNGLUNIFORM1IPROC)resolve("glUniform1i");
+	glad_glUniform1i(location, v0);
+}
+static void APIENTRY lazy_glUniform2i(GLint location, GLint v0, GLint v1) {
+	glad_glUniform2i = (PFNGLUNIFORM2IPROC)resolve("glUniform2i");
+	glad_glUniform2i(location, v0, v1);
+}
+static void APIENTRY lazy_glUniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	glad_glUniform3i = (PFNGLUNIFORM3IPROC)resolve("glUniform3i");
+	glad_glUniform3i(location, v0, v1, v2);
+}
+static void APIENTRY lazy_glUniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	glad_glUniform4i = (PFNGLUNIFORM4IPROC)resolve("glUniform4i");
+	glad_glUniform4i(location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glUniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform1fv = (PFNGLUNIFORM1FVPROC)resolve("glUniform1fv");
+	glad_glUniform1fv(location, count, value);
+}
+static void APIENTRY lazy_glUniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform2fv = (PFNGLUNIFORM2FVPROC)resolve("glUniform2fv");
+	glad_glUniform2fv(location, count, value);
+}
+static void APIENTRY lazy_glUniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform3fv = (PFNGLUNIFORM3FVPROC)resolve("glUniform3fv");
+	glad_glUniform3fv(location, count, value);
+}
+static void APIENTRY lazy_glUniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	glad_glUniform4fv = (PFNGLUNIFORM4FVPROC)resolve("glUniform4fv");
+	glad_glUniform4fv(location, count, value);
+}
+static void APIENTRY lazy_glUniform1iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform1iv = (PFNGLUNIFORM1IVPROC)resolve("glUniform1iv");
+	glad_glUniform1iv(location, count, value);
+}
+static void APIENTRY lazy_glUniform2iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform2iv = (PFNGLUNIFORM2IVPROC)resolve("glUniform2iv");
+	glad_glUniform2iv(location, count, value);
+}
+static void APIENTRY lazy_glUniform3iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform3iv = (PFNGLUNIFORM3IVPROC)resolve("glUniform3iv");
+	glad_glUniform3iv(location, count, value);
+}
+static void APIENTRY lazy_glUniform4iv(GLint location, GLsizei count, const GLint *value) {
+	glad_glUniform4iv = (PFNGLUNIFORM4IVPROC)resolve("glUniform4iv");
+	glad_glUniform4iv(location, count, value);
+}
+static void APIENTRY lazy_glUniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)resolve("glUniformMatrix2fv");
+	glad_glUniformMatrix2fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)resolve("glUniformMatrix3fv");
+	glad_glUniformMatrix3fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)resolve("glUniformMatrix4fv");
+	glad_glUniformMatrix4fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glValidateProgram(GLuint program) {
+	glad_glValidateProgram = (PFNGLVALIDATEPROGRAMPROC)resolve("glValidateProgram");
+	glad_glValidateProgram(program);
+}
+static void APIENTRY lazy_glVertexAttrib1d(GLuint index, GLdouble x) {
+	glad_glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)resolve("glVertexAttrib1d");
+	glad_glVertexAttrib1d(index, x);
+}
+static void APIENTRY lazy_glVertexAttrib1dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)resolve("glVertexAttrib1dv");
+	glad_glVertexAttrib1dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib1f(GLuint index, GLfloat x) {
+	glad_glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)resolve("glVertexAttrib1f");
+	glad_glVertexAttrib1f(index, x);
+}
+static void APIENTRY lazy_glVertexAttrib1fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)resolve("glVertexAttrib1fv");
+	glad_glVertexAttrib1fv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib1s(GLuint index, GLshort x) {
+	glad_glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)resolve("glVertexAttrib1s");
+	glad_glVertexAttrib1s(index, x);
+}
+static void APIENTRY lazy_glVertexAttrib1sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)resolve("glVertexAttrib1sv");
+	glad_glVertexAttrib1sv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	glad_glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)resolve("glVertexAttrib2d");
+	glad_glVertexAttrib2d(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttrib2dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)resolve("glVertexAttrib2dv");
+	glad_glVertexAttrib2dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	glad_glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)resolve("glVertexAttrib2f");
+	glad_glVertexAttrib2f(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttrib2fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)resolve("glVertexAttrib2fv");
+	glad_glVertexAttrib2fv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	glad_glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)resolve("glVertexAttrib2s");
+	glad_glVertexAttrib2s(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttrib2sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)resolve("glVertexAttrib2sv");
+	glad_glVertexAttrib2sv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)resolve("glVertexAttrib3d");
+	glad_glVertexAttrib3d(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttrib3dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)resolve("glVertexAttrib3dv");
+	glad_glVertexAttrib3dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	glad_glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)resolve("glVertexAttrib3f");
+	glad_glVertexAttrib3f(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttrib3fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)resolve("glVertexAttrib3fv");
+	glad_glVertexAttrib3fv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	glad_glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)resolve("glVertexAttrib3s");
+	glad_glVertexAttrib3s(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttrib3sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)resolve("glVertexAttrib3sv");
+	glad_glVertexAttrib3sv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+	glad_glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)resolve("glVertexAttrib4Nbv");
+	glad_glVertexAttrib4Nbv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Niv(GLuint index, const GLint *v) {
+	glad_glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)resolve("glVertexAttrib4Niv");
+	glad_glVertexAttrib4Niv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Nsv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)resolve("glVertexAttrib4Nsv");
+	glad_glVertexAttrib4Nsv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	glad_glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)resolve("glVertexAttrib4Nub");
+	glad_glVertexAttrib4Nub(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+	glad_glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)resolve("glVertexAttrib4Nubv");
+	glad_glVertexAttrib4Nubv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)resolve("glVertexAttrib4Nuiv");
+	glad_glVertexAttrib4Nuiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4Nusv(GLuint index, const GLushort *v) {
+	glad_glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)resolve("glVertexAttrib4Nusv");
+	glad_glVertexAttrib4Nusv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4bv(GLuint index, const GLbyte *v) {
+	glad_glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)resolve("glVertexAttrib4bv");
+	glad_glVertexAttrib4bv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)resolve("glVertexAttrib4d");
+	glad_glVertexAttrib4d(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttrib4dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)resolve("glVertexAttrib4dv");
+	glad_glVertexAttrib4dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glad_glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)resolve("glVertexAttrib4f");
+	glad_glVertexAttrib4f(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttrib4fv(GLuint index, const GLfloat *v) {
+	glad_glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)resolve("glVertexAttrib4fv");
+	glad_glVertexAttrib4fv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4iv(GLuint index, const GLint *v) {
+	glad_glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)resolve("glVertexAttrib4iv");
+	glad_glVertexAttrib4iv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	glad_glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)resolve("glVertexAttrib4s");
+	glad_glVertexAttrib4s(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttrib4sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)resolve("glVertexAttrib4sv");
+	glad_glVertexAttrib4sv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4ubv(GLuint index, const GLubyte *v) {
+	glad_glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)resolve("glVertexAttrib4ubv");
+	glad_glVertexAttrib4ubv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)resolve("glVertexAttrib4uiv");
+	glad_glVertexAttrib4uiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttrib4usv(GLuint index, const GLushort *v) {
+	glad_glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)resolve("glVertexAttrib4usv");
+	glad_glVertexAttrib4usv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	glad_glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)resolve("glVertexAttribPointer");
+	glad_glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+static void APIENTRY lazy_glUniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)resolve("glUniformMatrix2x3fv");
+	glad_glUniformMatrix2x3fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)resolve("glUniformMatrix3x2fv");
+	glad_glUniformMatrix3x2fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)resolve("glUniformMatrix2x4fv");
+	glad_glUniformMatrix2x4fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)resolve("glUniformMatrix4x2fv");
+	glad_glUniformMatrix4x2fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)resolve("glUniformMatrix3x4fv");
+	glad_glUniformMatrix3x4fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)resolve("glUniformMatrix4x3fv");
+	glad_glUniformMatrix4x3fv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	glad_glColorMaski = (PFNGLCOLORMASKIPROC)resolve("glColorMaski");
+	glad_glColorMaski(index, r, g, b, a);
+}
+static void APIENTRY lazy_glGetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+	glad_glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC)resolve("glGetBooleani_v");
+	glad_glGetBooleani_v(target, index, data);
+}
+static void APIENTRY lazy_glGetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+	glad_glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)resolve("glGetIntegeri_v");
+	glad_glGetIntegeri_v(target, index, data);
+}
+static void APIENTRY lazy_glEnablei(GLenum target, GLuint index) {
+	glad_glEnablei = (PFNGLENABLEIPROC)resolve("glEnablei");
+	glad_glEnablei(target, index);
+}
+static void APIENTRY lazy_glDisablei(GLenum target, GLuint index) {
+	glad_glDisablei = (PFNGLDISABLEIPROC)resolve("glDisablei");
+	glad_glDisablei(target, index);
+}
+static GLboolean APIENTRY lazy_glIsEnabledi(GLenum target, GLuint index) {
+	glad_glIsEnabledi = (PFNGLISENABLEDIPROC)resolve("glIsEnabledi");
+	return glad_glIsEnabledi(target, index);
+}
+static void APIENTRY lazy_glBeginTransformFeedback(GLenum primitiveMode) {
+	glad_glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)resolve("glBeginTransformFeedback");
+	glad_glBeginTransformFeedback(primitiveMode);
+}
+static void APIENTRY lazy_glEndTransformFeedback(void) {
+	glad_glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)resolve("glEndTransformFeedback");
+	glad_glEndTransformFeedback();
+}
+static void APIENTRY lazy_glBindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)resolve("glBindBufferRange");
+	glad_glBindBufferRange(target, index, buffer, offset, size);
+}
+static void APIENTRY lazy_glBindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	glad_glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)resolve("glBindBufferBase");
+	glad_glBindBufferBase(target, index, buffer);
+}
+static void APIENTRY lazy_glTransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	glad_glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)resolve("glTransformFeedbackVaryings");
+	glad_glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+static void APIENTRY lazy_glGetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	glad_glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)resolve("glGetTransformFeedbackVarying");
+	glad_glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+}
+static void APIENTRY lazy_glClampColor(GLenum target, GLenum clamp) {
+	glad_glClampColor = (PFNGLCLAMPCOLORPROC)resolve("glClampColor");
+	glad_glClampColor(target, clamp);
+}
+static void APIENTRY lazy_glBeginConditionalRender(GLuint id, GLenum mode) {
+	glad_glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)resolve("glBeginConditionalRender");
+	glad_glBeginConditionalRender(id, mode);
+}
+static void APIENTRY lazy_glEndConditionalRender(void) {
+	glad_glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)resolve("glEndConditionalRender");
+	glad_glEndConditionalRender();
+}
+static void APIENTRY lazy_glVertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)resolve("glVertexAttribIPointer");
+	glad_glVertexAttribIPointer(index, size, type, stride, pointer);
+}
+static void APIENTRY lazy_glGetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+	glad_glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)resolve("glGetVertexAttribIiv");
+	glad_glGetVertexAttribIiv(index, pname, params);
+}
+static void APIENTRY lazy_glGetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+	glad_glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)resolve("glGetVertexAttribIuiv");
+	glad_glGetVertexAttribIuiv(index, pname, params);
+}
+static void APIENTRY lazy_glVertexAttribI1i(GLuint index, GLint x) {
+	glad_glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)resolve("glVertexAttribI1i");
+	glad_glVertexAttribI1i(index, x);
+}
+static void APIENTRY lazy_glVertexAttribI2i(GLuint index, GLint x, GLint y) {
+	glad_glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)resolve("glVertexAttribI2i");
+	glad_glVertexAttribI2i(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	glad_glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)resolve("glVertexAttribI3i");
+	glad_glVertexAttribI3i(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	glad_glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)resolve("glVertexAttribI4i");
+	glad_glVertexAttribI4i(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttribI1ui(GLuint index, GLuint x) {
+	glad_glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)resolve("glVertexAttribI1ui");
+	glad_glVertexAttribI1ui(index, x);
+}
+static void APIENTRY lazy_glVertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	glad_glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)resolve("glVertexAttribI2ui");
+	glad_glVertexAttribI2ui(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	glad_glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)resolve("glVertexAttribI3ui");
+	glad_glVertexAttribI3ui(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	glad_glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)resolve("glVertexAttribI4ui");
+	glad_glVertexAttribI4ui(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttribI1iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)resolve("glVertexAttribI1iv");
+	glad_glVertexAttribI1iv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI2iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)resolve("glVertexAttribI2iv");
+	glad_glVertexAttribI2iv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI3iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)resolve("glVertexAttribI3iv");
+	glad_glVertexAttribI3iv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4iv(GLuint index, const GLint *v) {
+	glad_glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)resolve("glVertexAttribI4iv");
+	glad_glVertexAttribI4iv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI1uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)resolve("glVertexAttribI1uiv");
+	glad_glVertexAttribI1uiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI2uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)resolve("glVertexAttribI2uiv");
+	glad_glVertexAttribI2uiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI3uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)resolve("glVertexAttribI3uiv");
+	glad_glVertexAttribI3uiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4uiv(GLuint index, const GLuint *v) {
+	glad_glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)resolve("glVertexAttribI4uiv");
+	glad_glVertexAttribI4uiv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4bv(GLuint index, const GLbyte *v) {
+	glad_glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)resolve("glVertexAttribI4bv");
+	glad_glVertexAttribI4bv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4sv(GLuint index, const GLshort *v) {
+	glad_glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)resolve("glVertexAttribI4sv");
+	glad_glVertexAttribI4sv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4ubv(GLuint index, const GLubyte *v) {
+	glad_glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)resolve("glVertexAttribI4ubv");
+	glad_glVertexAttribI4ubv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribI4usv(GLuint index, const GLushort *v) {
+	glad_glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)resolve("glVertexAttribI4usv");
+	glad_glVertexAttribI4usv(index, v);
+}
+static void APIENTRY lazy_glGetUniformuiv(GLuint program, GLint location, GLuint *params) {
+	glad_glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC)resolve("glGetUniformuiv");
+	glad_glGetUniformuiv(program, location, params);
+}
+static void APIENTRY lazy_glBindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+	glad_glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)resolve("glBindFragDataLocation");
+	glad_glBindFragDataLocation(program, color, name);
+}
+static GLint APIENTRY lazy_glGetFragDataLocation(GLuint program, const GLchar *name) {
+	glad_glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)resolve("glGetFragDataLocation");
+	return glad_glGetFragDataLocation(program, name);
+}
+static void APIENTRY lazy_glUniform1ui(GLint location, GLuint v0) {
+	glad_glUniform1ui = (PFNGLUNIFORM1UIPROC)resolve("glUniform1ui");
+	glad_glUniform1ui(location, v0);
+}
+static void APIENTRY lazy_glUniform2ui(GLint location, GLuint v0, GLuint v1) {
+	glad_glUniform2ui = (PFNGLUNIFORM2UIPROC)resolve("glUniform2ui");
+	glad_glUniform2ui(location, v0, v1);
+}
+static void APIENTRY lazy_glUniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	glad_glUniform3ui = (PFNGLUNIFORM3UIPROC)resolve("glUniform3ui");
+	glad_glUniform3ui(location, v0, v1, v2);
+}
+static void APIENTRY lazy_glUniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	glad_glUniform4ui = (PFNGLUNIFORM4UIPROC)resolve("glUniform4ui");
+	glad_glUniform4ui(location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glUniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform1uiv = (PFNGLUNIFORM1UIVPROC)resolve("glUniform1uiv");
+	glad_glUniform1uiv(location, count, value);
+}
+static void APIENTRY lazy_glUniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform2uiv = (PFNGLUNIFORM2UIVPROC)resolve("glUniform2uiv");
+	glad_glUniform2uiv(location, count, value);
+}
+static void APIENTRY lazy_glUniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform3uiv = (PFNGLUNIFORM3UIVPROC)resolve("glUniform3uiv");
+	glad_glUniform3uiv(location, count, value);
+}
+static void APIENTRY lazy_glUniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	glad_glUniform4uiv = (PFNGLUNIFORM4UIVPROC)resolve("glUniform4uiv");
+	glad_glUniform4uiv(location, count, value);
+}
+static void APIENTRY lazy_glTexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+	glad_glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)resolve("glTexParameterIiv");
+	glad_glTexParameterIiv(target, pname, params);
+}
+static void APIENTRY lazy_glTexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+	glad_glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)resolve("glTexParameterIuiv");
+	glad_glTexParameterIuiv(target, pname, params);
+}
+static void APIENTRY lazy_glGetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)resolve("glGetTexParameterIiv");
+	glad_glGetTexParameterIiv(target, pname, params);
+}
+static void APIENTRY lazy_glGetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+	glad_glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)resolve("glGetTexParameterIuiv");
+	glad_glGetTexParameterIuiv(target, pname, params);
+}
+static void APIENTRY lazy_glClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+	glad_glClearBufferiv = (PFNGLCLEARBUFFERIVPROC)resolve("glClearBufferiv");
+	glad_glClearBufferiv(buffer, drawbuffer, value);
+}
+static void APIENTRY lazy_glClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	glad_glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)resolve("glClearBufferuiv");
+	glad_glClearBufferuiv(buffer, drawbuffer, value);
+}
+static void APIENTRY lazy_glClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	glad_glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)resolve("glClearBufferfv");
+	glad_glClearBufferfv(buffer, drawbuffer, value);
+}
+static void APIENTRY lazy_glClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	glad_glClearBufferfi = (PFNGLCLEARBUFFERFIPROC)resolve("glClearBufferfi");
+	glad_glClearBufferfi(buffer, drawbuffer, depth, stencil);
+}
+static const GLubyte * APIENTRY lazy_glGetStringi(GLenum name, GLuint index) {
+	glad_glGetStringi = (PFNGLGETSTRINGIPROC)resolve("glGetStringi");
+	return glad_glGetStringi(name, index);
+}
+static GLboolean APIENTRY lazy_glIsRenderbuffer(GLuint renderbuffer) {
+	glad_glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC)resolve("glIsRenderbuffer");
+	return glad_glIsRenderbuffer(renderbuffer);
+}
+static void APIENTRY lazy_glBindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	glad_glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)resolve("glBindRenderbuffer");
+	glad_glBindRenderbuffer(target, renderbuffer);
+}
+static void APIENTRY lazy_glDeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+	glad_glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)resolve("glDeleteRenderbuffers");
+	glad_glDeleteRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY lazy_glGenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	glad_glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)resolve("glGenRenderbuffers");
+	glad_glGenRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY lazy_glRenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)resolve("glRenderbufferStorage");
+	glad_glRenderbufferStorage(target, internalformat, width, height);
+}
+static void APIENTRY lazy_glGetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)resolve("glGetRenderbufferParameteriv");
+	glad_glGetRenderbufferParameteriv(target, pname, params);
+}
+static GLboolean APIENTRY lazy_glIsFramebuffer(GLuint framebuffer) {
+	glad_glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC)resolve("glIsFramebuffer");
+	return glad_glIsFramebuffer(framebuffer);
+}
+static void APIENTRY lazy_glBindFramebuffer(GLenum target, GLuint framebuffer) {
+	glad_glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)resolve("glBindFramebuffer");
+	glad_glBindFramebuffer(target, framebuffer);
+}
+static void APIENTRY lazy_glDeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+	glad_glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)resolve("glDeleteFramebuffers");
+	glad_glDeleteFramebuffers(n, framebuffers);
+}
+static void APIENTRY lazy_glGenFramebuffers(GLsizei n, GLuint *framebuffers) {
+	glad_glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)resolve("glGenFramebuffers");
+	glad_glGenFramebuffers(n, framebuffers);
+}
+static GLenum APIENTRY lazy_glCheckFramebufferStatus(GLenum target) {
+	glad_glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)resolve("glCheckFramebufferStatus");
+	return glad_glCheckFramebufferStatus(target);
+}
+static void APIENTRY lazy_glFramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glad_glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)resolve("glFramebufferTexture1D");
+	glad_glFramebufferTexture1D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY lazy_glFramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glad_glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)resolve("glFramebufferTexture2D");
+	glad_glFramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+static void APIENTRY lazy_glFramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	glad_glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)resolve("glFramebufferTexture3D");
+	glad_glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+}
+static void APIENTRY lazy_glFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	glad_glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)resolve("glFramebufferRenderbuffer");
+	glad_glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY lazy_glGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	glad_glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)resolve("glGetFramebufferAttachmentParameteriv");
+	glad_glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+static void APIENTRY lazy_glGenerateMipmap(GLenum target) {
+	glad_glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)resolve("glGenerateMipmap");
+	glad_glGenerateMipmap(target);
+}
+static void APIENTRY lazy_glBlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	glad_glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)resolve("glBlitFramebuffer");
+	glad_glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static void APIENTRY lazy_glRenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)resolve("glRenderbufferStorageMultisample");
+	glad_glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+static void APIENTRY lazy_glFramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	glad_glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)resolve("glFramebufferTextureLayer");
+	glad_glFramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+static void * APIENTRY lazy_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	glad_glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)resolve("glMapBufferRange");
+	return glad_glMapBufferRange(target, offset, length, access);
+}
+static void APIENTRY lazy_glFlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	glad_glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)resolve("glFlushMappedBufferRange");
+	glad_glFlushMappedBufferRange(target, offset, length);
+}
+static void APIENTRY lazy_glBindVertexArray(GLuint array) {
+	glad_glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)resolve("glBindVertexArray");
+	glad_glBindVertexArray(array);
+}
+static void APIENTRY lazy_glDeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+	glad_glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)resolve("glDeleteVertexArrays");
+	glad_glDeleteVertexArrays(n, arrays);
+}
+static void APIENTRY lazy_glGenVertexArrays(GLsizei n, GLuint *arrays) {
+	glad_glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)resolve("glGenVertexArrays");
+	glad_glGenVertexArrays(n, arrays);
+}
+static GLboolean APIENTRY lazy_glIsVertexArray(GLuint array) {
+	glad_glIsVertexArray = (PFNGLISVERTEXARRAYPROC)resolve("glIsVertexArray");
+	return glad_glIsVertexArray(array);
+}
+static void APIENTRY lazy_glDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	glad_glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)resolve("glDrawArraysInstanced");
+	glad_glDrawArraysInstanced(mode, first, count, instancecount);
+}
+static void APIENTRY lazy_glDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	glad_glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)resolve("glDrawElementsInstanced");
+	glad_glDrawElementsInstanced(mode, count, type, indices, instancecount);
+}
+static void APIENTRY lazy_glTexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	glad_glTexBuffer = (PFNGLTEXBUFFERPROC)resolve("glTexBuffer");
+	glad_glTexBuffer(target, internalformat, buffer);
+}
+static void APIENTRY lazy_glPrimitiveRestartIndex(GLuint index) {
+	glad_glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)resolve("glPrimitiveRestartIndex");
+	glad_glPrimitiveRestartIndex(index);
+}
+static void APIENTRY lazy_glCopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	glad_glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)resolve("glCopyBufferSubData");
+	glad_glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+}
+static void APIENTRY lazy_glGetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+	glad_glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)resolve("glGetUniformIndices");
+	glad_glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+}
+static void APIENTRY lazy_glGetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+	glad_glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)resolve("glGetActiveUniformsiv");
+	glad_glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+}
+static void APIENTRY lazy_glGetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+	glad_glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)resolve("glGetActiveUniformName");
+	glad_glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+}
+static GLuint APIENTRY lazy_glGetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+	glad_glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)resolve("glGetUniformBlockIndex");
+	return glad_glGetUniformBlockIndex(program, uniformBlockName);
+}
+static void APIENTRY lazy_glGetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+	glad_glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)resolve("glGetActiveUniformBlockiv");
+	glad_glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+}
+static void APIENTRY lazy_glGetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+	glad_glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)resolve("glGetActiveUniformBlockName");
+	glad_glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+static void APIENTRY lazy_glUniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	glad_glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)resolve("glUniformBlockBinding");
+	glad_glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+static void APIENTRY lazy_glDrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	glad_glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)resolve("glDrawElementsBaseVertex");
+	glad_glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+static void APIENTRY lazy_glDrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	glad_glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)resolve("glDrawRangeElementsBaseVertex");
+	glad_glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+static void APIENTRY lazy_glDrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	glad_glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)resolve("glDrawElementsInstancedBaseVertex");
+	glad_glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+}
+static void APIENTRY lazy_glMultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	glad_glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)resolve("glMultiDrawElementsBaseVertex");
+	glad_glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+}
+static void APIENTRY lazy_glProvokingVertex(GLenum mode) {
+	glad_glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)resolve("glProvokingVertex");
+	glad_glProvokingVertex(mode);
+}
+static GLsync APIENTRY lazy_glFenceSync(GLenum condition, GLbitfield flags) {
+	glad_glFenceSync = (PFNGLFENCESYNCPROC)resolve("glFenceSync");
+	return glad_glFenceSync(condition, flags);
+}
+static GLboolean APIENTRY lazy_glIsSync(GLsync sync) {
+	glad_glIsSync = (PFNGLISSYNCPROC)resolve("glIsSync");
+	return glad_glIsSync(sync);
+}
+static void APIENTRY lazy_glDeleteSync(GLsync sync) {
+	glad_glDeleteSync = (PFNGLDELETESYNCPROC)resolve("glDeleteSync");
+	glad_glDeleteSync(sync);
+}
+static GLenum APIENTRY lazy_glClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	glad_glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)resolve("glClientWaitSync");
+	return glad_glClientWaitSync(sync, flags, timeout);
+}
+static void APIENTRY lazy_glWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	glad_glWaitSync = (PFNGLWAITSYNCPROC)resolve("glWaitSync");
+	glad_glWaitSync(sync, flags, timeout);
+}
+static void APIENTRY lazy_glGetInteger64v(GLenum pname, GLint64 *data) {
+	glad_glGetInteger64v = (PFNGLGETINTEGER64VPROC)resolve("glGetInteger64v");
+	glad_glGetInteger64v(pname, data);
+}
+static void APIENTRY lazy_glGetSynciv(GLsync sync, GLenum pname, GLsizei count, GLsizei *length, GLint *values) {
+	glad_glGetSynciv = (PFNGLGETSYNCIVPROC)resolve("glGetSynciv");
+	glad_glGetSynciv(sync, pname, count, length, values);
+}
+static void APIENTRY lazy_glGetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+	glad_glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)resolve("glGetInteger64i_v");
+	glad_glGetInteger64i_v(target, index, data);
+}
+static void APIENTRY lazy_glGetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+	glad_glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)resolve("glGetBufferParameteri64v");
+	glad_glGetBufferParameteri64v(target, pname, params);
+}
+static void APIENTRY lazy_glFramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	glad_glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)resolve("glFramebufferTexture");
+	glad_glFramebufferTexture(target, attachment, texture, level);
+}
+static void APIENTRY lazy_glTexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	glad_glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)resolve("glTexImage2DMultisample");
+	glad_glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY lazy_glTexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	glad_glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)resolve("glTexImage3DMultisample");
+	glad_glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY lazy_glGetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+	glad_glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)resolve("glGetMultisamplefv");
+	glad_glGetMultisamplefv(pname, index, val);
+}
+static void APIENTRY lazy_glSampleMaski(GLuint maskNumber, GLbitfield mask) {
+	glad_glSampleMaski = (PFNGLSAMPLEMASKIPROC)resolve("glSampleMaski");
+	glad_glSampleMaski(maskNumber, mask);
+}
+static void APIENTRY lazy_glBindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	glad_glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)resolve("glBindFragDataLocationIndexed");
+	glad_glBindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+static GLint APIENTRY lazy_glGetFragDataIndex(GLuint program, const GLchar *name) {
+	glad_glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)resolve("glGetFragDataIndex");
+	return glad_glGetFragDataIndex(program, name);
+}
+static void APIENTRY lazy_glGenSamplers(GLsizei count, GLuint *samplers) {
+	glad_glGenSamplers = (PFNGLGENSAMPLERSPROC)resolve("glGenSamplers");
+	glad_glGenSamplers(count, samplers);
+}
+static void APIENTRY lazy_glDeleteSamplers(GLsizei count, const GLuint *samplers) {
+	glad_glDeleteSamplers = (PFNGLDELETESAMPLERSPROC)resolve("glDeleteSamplers");
+	glad_glDeleteSamplers(count, samplers);
+}
+static GLboolean APIENTRY lazy_glIsSampler(GLuint sampler) {
+	glad_glIsSampler = (PFNGLISSAMPLERPROC)resolve("glIsSampler");
+	return glad_glIsSampler(sampler);
+}
+static void APIENTRY lazy_glBindSampler(GLuint unit, GLuint sampler) {
+	glad_glBindSampler = (PFNGLBINDSAMPLERPROC)resolve("glBindSampler");
+	glad_glBindSampler(unit, sampler);
+}
+static void APIENTRY lazy_glSamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	glad_glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)resolve("glSamplerParameteri");
+	glad_glSamplerParameteri(sampler, pname, param);
+}
+static void APIENTRY lazy_glSamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+	glad_glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)resolve("glSamplerParameteriv");
+	glad_glSamplerParameteriv(sampler, pname, param);
+}
+static void APIENTRY lazy_glSamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	glad_glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)resolve("glSamplerParameterf");
+	glad_glSamplerParameterf(sampler, pname, param);
+}
+static void APIENTRY lazy_glSamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+	glad_glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)resolve("glSamplerParameterfv");
+	glad_glSamplerParameterfv(sampler, pname, param);
+}
+static void APIENTRY lazy_glSamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+	glad_glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)resolve("glSamplerParameterIiv");
+	glad_glSamplerParameterIiv(sampler, pname, param);
+}
+static void APIENTRY lazy_glSamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+	glad_glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)resolve("glSamplerParameterIuiv");
+	glad_glSamplerParameterIuiv(sampler, pname, param);
+}
+static void APIENTRY lazy_glGetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+	glad_glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)resolve("glGetSamplerParameteriv");
+	glad_glGetSamplerParameteriv(sampler, pname, params);
+}
+static void APIENTRY lazy_glGetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+	glad_glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)resolve("glGetSamplerParameterIiv");
+	glad_glGetSamplerParameterIiv(sampler, pname, params);
+}
+static void APIENTRY lazy_glGetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+	glad_glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)resolve("glGetSamplerParameterfv");
+	glad_glGetSamplerParameterfv(sampler, pname, params);
+}
+static void APIENTRY lazy_glGetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+	glad_glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)resolve("glGetSamplerParameterIuiv");
+	glad_glGetSamplerParameterIuiv(sampler, pname, params);
+}
+static void APIENTRY lazy_glQueryCounter(GLuint id, GLenum target) {
+	glad_glQueryCounter = (PFNGLQUERYCOUNTERPROC)resolve("glQueryCounter");
+	glad_glQueryCounter(id, target);
+}
+static void APIENTRY lazy_glGetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+	glad_glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)resolve("glGetQueryObjecti64v");
+	glad_glGetQueryObjecti64v(id, pname, params);
+}
+static void APIENTRY lazy_glGetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+	glad_glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)resolve("glGetQueryObjectui64v");
+	glad_glGetQueryObjectui64v(id, pname, params);
+}
+static void APIENTRY lazy_glVertexAttribDivisor(GLuint index, GLuint divisor) {
+	glad_glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)resolve("glVertexAttribDivisor");
+	glad_glVertexAttribDivisor(index, divisor);
+}
+static void APIENTRY lazy_glVertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)resolve("glVertexAttribP1ui");
+	glad_glVertexAttribP1ui(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)resolve("glVertexAttribP1uiv");
+	glad_glVertexAttribP1uiv(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)resolve("glVertexAttribP2ui");
+	glad_glVertexAttribP2ui(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)resolve("glVertexAttribP2uiv");
+	glad_glVertexAttribP2uiv(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)resolve("glVertexAttribP3ui");
+	glad_glVertexAttribP3ui(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)resolve("glVertexAttribP3uiv");
+	glad_glVertexAttribP3uiv(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glad_glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)resolve("glVertexAttribP4ui");
+	glad_glVertexAttribP4ui(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glad_glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)resolve("glVertexAttribP4uiv");
+	glad_glVertexAttribP4uiv(index, type, normalized, value);
+}
+static void APIENTRY lazy_glVertexP2ui(GLenum type, GLuint value) {
+	glad_glVertexP2ui = (PFNGLVERTEXP2UIPROC)resolve("glVertexP2ui");
+	glad_glVertexP2ui(type, value);
+}
+static void APIENTRY lazy_glVertexP2uiv(GLenum type, const GLuint *value) {
+	glad_glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)resolve("glVertexP2uiv");
+	glad_glVertexP2uiv(type, value);
+}
+static void APIENTRY lazy_glVertexP3ui(GLenum type, GLuint value) {
+	glad_glVertexP3ui = (PFNGLVERTEXP3UIPROC)resolve("glVertexP3ui");
+	glad_glVertexP3ui(type, value);
+}
+static void APIENTRY lazy_glVertexP3uiv(GLenum type, const GLuint *value) {
+	glad_glVertexP3uiv = (PFNGLVERTEXP3UIVPROC)resolve("glVertexP3uiv");
+	glad_glVertexP3uiv(type, value);
+}
+static void APIENTRY lazy_glVertexP4ui(GLenum type, GLuint value) {
+	glad_glVertexP4ui = (PFNGLVERTEXP4UIPROC)resolve("glVertexP4ui");
+	glad_glVertexP4ui(type, value);
+}
+static void APIENTRY lazy_glVertexP4uiv(GLenum type, const GLuint *value) {
+	glad_glVertexP4uiv = (PFNGLVERTEXP4UIVPROC)resolve("glVertexP4uiv");
+	glad_glVertexP4uiv(type, value);
+}
+static void APIENTRY lazy_glTexCoordP1ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)resolve("glTexCoordP1ui");
+	glad_glTexCoordP1ui(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP1uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)resolve("glTexCoordP1uiv");
+	glad_glTexCoordP1uiv(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP2ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)resolve("glTexCoordP2ui");
+	glad_glTexCoordP2ui(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP2uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)resolve("glTexCoordP2uiv");
+	glad_glTexCoordP2uiv(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP3ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)resolve("glTexCoordP3ui");
+	glad_glTexCoordP3ui(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP3uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)resolve("glTexCoordP3uiv");
+	glad_glTexCoordP3uiv(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP4ui(GLenum type, GLuint coords) {
+	glad_glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)resolve("glTexCoordP4ui");
+	glad_glTexCoordP4ui(type, coords);
+}
+static void APIENTRY lazy_glTexCoordP4uiv(GLenum type, const GLuint *coords) {
+	glad_glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)resolve("glTexCoordP4uiv");
+	glad_glTexCoordP4uiv(type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP1ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)resolve("glMultiTexCoordP1ui");
+	glad_glMultiTexCoordP1ui(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP1uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)resolve("glMultiTexCoordP1uiv");
+	glad_glMultiTexCoordP1uiv(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP2ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)resolve("glMultiTexCoordP2ui");
+	glad_glMultiTexCoordP2ui(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP2uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)resolve("glMultiTexCoordP2uiv");
+	glad_glMultiTexCoordP2uiv(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP3ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)resolve("glMultiTexCoordP3ui");
+	glad_glMultiTexCoordP3ui(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP3uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)resolve("glMultiTexCoordP3uiv");
+	glad_glMultiTexCoordP3uiv(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP4ui(GLenum texture, GLenum type, GLuint coords) {
+	glad_glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)resolve("glMultiTexCoordP4ui");
+	glad_glMultiTexCoordP4ui(texture, type, coords);
+}
+static void APIENTRY lazy_glMultiTexCoordP4uiv(GLenum texture, GLenum type, const GLuint *coords) {
+	glad_glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)resolve("glMultiTexCoordP4uiv");
+	glad_glMultiTexCoordP4uiv(texture, type, coords);
+}
+static void APIENTRY lazy_glNormalP3ui(GLenum type, GLuint coords) {
+	glad_glNormalP3ui = (PFNGLNORMALP3UIPROC)resolve("glNormalP3ui");
+	glad_glNormalP3ui(type, coords);
+}
+static void APIENTRY lazy_glNormalP3uiv(GLenum type, const GLuint *coords) {
+	glad_glNormalP3uiv = (PFNGLNORMALP3UIVPROC)resolve("glNormalP3uiv");
+	glad_glNormalP3uiv(type, coords);
+}
+static void APIENTRY lazy_glColorP3ui(GLenum type, GLuint color) {
+	glad_glColorP3ui = (PFNGLCOLORP3UIPROC)resolve("glColorP3ui");
+	glad_glColorP3ui(type, color);
+}
+static void APIENTRY lazy_glColorP3uiv(GLenum type, const GLuint *color) {
+	glad_glColorP3uiv = (PFNGLCOLORP3UIVPROC)resolve("glColorP3uiv");
+	glad_glColorP3uiv(type, color);
+}
+static void APIENTRY lazy_glColorP4ui(GLenum type, GLuint color) {
+	glad_glColorP4ui = (PFNGLCOLORP4UIPROC)resolve("glColorP4ui");
+	glad_glColorP4ui(type, color);
+}
+static void APIENTRY lazy_glColorP4uiv(GLenum type, const GLuint *color) {
+	glad_glColorP4uiv = (PFNGLCOLORP4UIVPROC)resolve("glColorP4uiv");
+	glad_glColorP4uiv(type, color);
+}
+static void APIENTRY lazy_glSecondaryColorP3ui(GLenum type, GLuint color) {
+	glad_glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)resolve("glSecondaryColorP3ui");
+	glad_glSecondaryColorP3ui(type, color);
+}
+static void APIENTRY lazy_glSecondaryColorP3uiv(GLenum type, const GLuint *color) {
+	glad_glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)resolve("glSecondaryColorP3uiv");
+	glad_glSecondaryColorP3uiv(type, color);
+}
+static void APIENTRY lazy_glMinSampleShading(GLfloat value) {
+	glad_glMinSampleShading = (PFNGLMINSAMPLESHADINGPROC)resolve("glMinSampleShading");
+	glad_glMinSampleShading(value);
+}
+static void APIENTRY lazy_glBlendEquationi(GLuint buf, GLenum mode) {
+	glad_glBlendEquationi = (PFNGLBLENDEQUATIONIPROC)resolve("glBlendEquationi");
+	glad_glBlendEquationi(buf, mode);
+}
+static void APIENTRY lazy_glBlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlpha) {
+	glad_glBlendEquationSeparatei = (PFNGLBLENDEQUATIONSEPARATEIPROC)resolve("glBlendEquationSeparatei");
+	glad_glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+}
+static void APIENTRY lazy_glBlendFunci(GLuint buf, GLenum src, GLenum dst) {
+	glad_glBlendFunci = (PFNGLBLENDFUNCIPROC)resolve("glBlendFunci");
+	glad_glBlendFunci(buf, src, dst);
+}
+static void APIENTRY lazy_glBlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha) {
+	glad_glBlendFuncSeparatei = (PFNGLBLENDFUNCSEPARATEIPROC)resolve("glBlendFuncSeparatei");
+	glad_glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+static void APIENTRY lazy_glDrawArraysIndirect(GLenum mode, const void *indirect) {
+	glad_glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC)resolve("glDrawArraysIndirect");
+	glad_glDrawArraysIndirect(mode, indirect);
+}
+static void APIENTRY lazy_glDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect) {
+	glad_glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC)resolve("glDrawElementsIndirect");
+	glad_glDrawElementsIndirect(mode, type, indirect);
+}
+static void APIENTRY lazy_glUniform1d(GLint location, GLdouble x) {
+	glad_glUniform1d = (PFNGLUNIFORM1DPROC)resolve("glUniform1d");
+	glad_glUniform1d(location, x);
+}
+static void APIENTRY lazy_glUniform2d(GLint location, GLdouble x, GLdouble y) {
+	glad_glUniform2d = (PFNGLUNIFORM2DPROC)resolve("glUniform2d");
+	glad_glUniform2d(location, x, y);
+}
+static void APIENTRY lazy_glUniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glUniform3d = (PFNGLUNIFORM3DPROC)resolve("glUniform3d");
+	glad_glUniform3d(location, x, y, z);
+}
+static void APIENTRY lazy_glUniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glUniform4d = (PFNGLUNIFORM4DPROC)resolve("glUniform4d");
+	glad_glUniform4d(location, x, y, z, w);
+}
+static void APIENTRY lazy_glUniform1dv(GLint location, GLsizei count, const GLdouble *value) {
+	glad_glUniform1dv = (PFNGLUNIFORM1DVPROC)resolve("glUniform1dv");
+	glad_glUniform1dv(location, count, value);
+}
+static void APIENTRY lazy_glUniform2dv(GLint location, GLsizei count, const GLdouble *value) {
+	glad_glUniform2dv = (PFNGLUNIFORM2DVPROC)resolve("glUniform2dv");
+	glad_glUniform2dv(location, count, value);
+}
+static void APIENTRY lazy_glUniform3dv(GLint location, GLsizei count, const GLdouble *value) {
+	glad_glUniform3dv = (PFNGLUNIFORM3DVPROC)resolve("glUniform3dv");
+	glad_glUniform3dv(location, count, value);
+}
+static void APIENTRY lazy_glUniform4dv(GLint location, GLsizei count, const GLdouble *value) {
+	glad_glUniform4dv = (PFNGLUNIFORM4DVPROC)resolve("glUniform4dv");
+	glad_glUniform4dv(location, count, value);
+}
+static void APIENTRY lazy_glUniformMatrix2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix2dv = (PFNGLUNIFORMMATRIX2DVPROC)resolve("glUniformMatrix2dv");
+	glad_glUniformMatrix2dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix3dv = (PFNGLUNIFORMMATRIX3DVPROC)resolve("glUniformMatrix3dv");
+	glad_glUniformMatrix3dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix4dv = (PFNGLUNIFORMMATRIX4DVPROC)resolve("glUniformMatrix4dv");
+	glad_glUniformMatrix4dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix2x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix2x3dv = (PFNGLUNIFORMMATRIX2X3DVPROC)resolve("glUniformMatrix2x3dv");
+	glad_glUniformMatrix2x3dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix2x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix2x4dv = (PFNGLUNIFORMMATRIX2X4DVPROC)resolve("glUniformMatrix2x4dv");
+	glad_glUniformMatrix2x4dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix3x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix3x2dv = (PFNGLUNIFORMMATRIX3X2DVPROC)resolve("glUniformMatrix3x2dv");
+	glad_glUniformMatrix3x2dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix3x4dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix3x4dv = (PFNGLUNIFORMMATRIX3X4DVPROC)resolve("glUniformMatrix3x4dv");
+	glad_glUniformMatrix3x4dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix4x2dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix4x2dv = (PFNGLUNIFORMMATRIX4X2DVPROC)resolve("glUniformMatrix4x2dv");
+	glad_glUniformMatrix4x2dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glUniformMatrix4x3dv(GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glUniformMatrix4x3dv = (PFNGLUNIFORMMATRIX4X3DVPROC)resolve("glUniformMatrix4x3dv");
+	glad_glUniformMatrix4x3dv(location, count, transpose, value);
+}
+static void APIENTRY lazy_glGetUniformdv(GLuint program, GLint location, GLdouble *params) {
+	glad_glGetUniformdv = (PFNGLGETUNIFORMDVPROC)resolve("glGetUniformdv");
+	glad_glGetUniformdv(program, location, params);
+}
+static GLint APIENTRY lazy_glGetSubroutineUniformLocation(GLuint program, GLenum shadertype, const GLchar *name) {
+	glad_glGetSubroutineUniformLocation = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)resolve("glGetSubroutineUniformLocation");
+	return glad_glGetSubroutineUniformLocation(program, shadertype, name);
+}
+static GLuint APIENTRY lazy_glGetSubroutineIndex(GLuint program, GLenum shadertype, const GLchar *name) {
+	glad_glGetSubroutineIndex = (PFNGLGETSUBROUTINEINDEXPROC)resolve("glGetSubroutineIndex");
+	return glad_glGetSubroutineIndex(program, shadertype, name);
+}
+static void APIENTRY lazy_glGetActiveSubroutineUniformiv(GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint *values) {
+	glad_glGetActiveSubroutineUniformiv = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)resolve("glGetActiveSubroutineUniformiv");
+	glad_glGetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+}
+static void APIENTRY lazy_glGetActiveSubroutineUniformName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+	glad_glGetActiveSubroutineUniformName = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)resolve("glGetActiveSubroutineUniformName");
+	glad_glGetActiveSubroutineUniformName(program, shadertype, index, bufSize, length, name);
+}
+static void APIENTRY lazy_glGetActiveSubroutineName(GLuint program, GLenum shadertype, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+	glad_glGetActiveSubroutineName = (PFNGLGETACTIVESUBROUTINENAMEPROC)resolve("glGetActiveSubroutineName");
+	glad_glGetActiveSubroutineName(program, shadertype, index, bufSize, length, name);
+}
+static void APIENTRY lazy_glUniformSubroutinesuiv(GLenum shadertype, GLsizei count, const GLuint *indices) {
+	glad_glUniformSubroutinesuiv = (PFNGLUNIFORMSUBROUTINESUIVPROC)resolve("glUniformSubroutinesuiv");
+	glad_glUniformSubroutinesuiv(shadertype, count, indices);
+}
+static void APIENTRY lazy_glGetUniformSubroutineuiv(GLenum shadertype, GLint location, GLuint *params) {
+	glad_glGetUniformSubroutineuiv = (PFNGLGETUNIFORMSUBROUTINEUIVPROC)resolve("glGetUniformSubroutineuiv");
+	glad_glGetUniformSubroutineuiv(shadertype, location, params);
+}
+static void APIENTRY lazy_glGetProgramStageiv(GLuint program, GLenum shadertype, GLenum pname, GLint *values) {
+	glad_glGetProgramStageiv = (PFNGLGETPROGRAMSTAGEIVPROC)resolve("glGetProgramStageiv");
+	glad_glGetProgramStageiv(program, shadertype, pname, values);
+}
+static void APIENTRY lazy_glPatchParameteri(GLenum pname, GLint value) {
+	glad_glPatchParameteri = (PFNGLPATCHPARAMETERIPROC)resolve("glPatchParameteri");
+	glad_glPatchParameteri(pname, value);
+}
+static void APIENTRY lazy_glPatchParameterfv(GLenum pname, const GLfloat *values) {
+	glad_glPatchParameterfv = (PFNGLPATCHPARAMETERFVPROC)resolve("glPatchParameterfv");
+	glad_glPatchParameterfv(pname, values);
+}
+static void APIENTRY lazy_glBindTransformFeedback(GLenum target, GLuint id) {
+	glad_glBindTransformFeedback = (PFNGLBINDTRANSFORMFEEDBACKPROC)resolve("glBindTransformFeedback");
+	glad_glBindTransformFeedback(target, id);
+}
+static void APIENTRY lazy_glDeleteTransformFeedbacks(GLsizei n, const GLuint *ids) {
+	glad_glDeleteTransformFeedbacks = (PFNGLDELETETRANSFORMFEEDBACKSPROC)resolve("glDeleteTransformFeedbacks");
+	glad_glDeleteTransformFeedbacks(n, ids);
+}
+static void APIENTRY lazy_glGenTransformFeedbacks(GLsizei n, GLuint *ids) {
+	glad_glGenTransformFeedbacks = (PFNGLGENTRANSFORMFEEDBACKSPROC)resolve("glGenTransformFeedbacks");
+	glad_glGenTransformFeedbacks(n, ids);
+}
+static GLboolean APIENTRY lazy_glIsTransformFeedback(GLuint id) {
+	glad_glIsTransformFeedback = (PFNGLISTRANSFORMFEEDBACKPROC)resolve("glIsTransformFeedback");
+	return glad_glIsTransformFeedback(id);
+}
+static void APIENTRY lazy_glPauseTransformFeedback(void) {
+	glad_glPauseTransformFeedback = (PFNGLPAUSETRANSFORMFEEDBACKPROC)resolve("glPauseTransformFeedback");
+	glad_glPauseTransformFeedback();
+}
+static void APIENTRY lazy_glResumeTransformFeedback(void) {
+	glad_glResumeTransformFeedback = (PFNGLRESUMETRANSFORMFEEDBACKPROC)resolve("glResumeTransformFeedback");
+	glad_glResumeTransformFeedback();
+}
+static void APIENTRY lazy_glDrawTransformFeedback(GLenum mode, GLuint id) {
+	glad_glDrawTransformFeedback = (PFNGLDRAWTRANSFORMFEEDBACKPROC)resolve("glDrawTransformFeedback");
+	glad_glDrawTransformFeedback(mode, id);
+}
+static void APIENTRY lazy_glDrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint stream) {
+	glad_glDrawTransformFeedbackStream = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)resolve("glDrawTransformFeedbackStream");
+	glad_glDrawTransformFeedbackStream(mode, id, stream);
+}
+static void APIENTRY lazy_glBeginQueryIndexed(GLenum target, GLuint index, GLuint id) {
+	glad_glBeginQueryIndexed = (PFNGLBEGINQUERYINDEXEDPROC)resolve("glBeginQueryIndexed");
+	glad_glBeginQueryIndexed(target, index, id);
+}
+static void APIENTRY lazy_glEndQueryIndexed(GLenum target, GLuint index) {
+	glad_glEndQueryIndexed = (PFNGLENDQUERYINDEXEDPROC)resolve("glEndQueryIndexed");
+	glad_glEndQueryIndexed(target, index);
+}
+static void APIENTRY lazy_glGetQueryIndexediv(GLenum target, GLuint index, GLenum pname, GLint *params) {
+	glad_glGetQueryIndexediv = (PFNGLGETQUERYINDEXEDIVPROC)resolve("glGetQueryIndexediv");
+	glad_glGetQueryIndexediv(target, index, pname, params);
+}
+static void APIENTRY lazy_glReleaseShaderCompiler(void) {
+	glad_glReleaseShaderCompiler = (PFNGLRELEASESHADERCOMPILERPROC)resolve("glReleaseShaderCompiler");
+	glad_glReleaseShaderCompiler();
+}
+static void APIENTRY lazy_glShaderBinary(GLsizei count, const GLuint *shaders, GLenum binaryFormat, const void *binary, GLsizei length) {
+	glad_glShaderBinary = (PFNGLSHADERBINARYPROC)resolve("glShaderBinary");
+	glad_glShaderBinary(count, shaders, binaryFormat, binary, length);
+}
+static void APIENTRY lazy_glGetShaderPrecisionFormat(GLenum shadertype, GLenum precisiontype, GLint *range, GLint *precision) {
+	glad_glGetShaderPrecisionFormat = (PFNGLGETSHADERPRECISIONFORMATPROC)resolve("glGetShaderPrecisionFormat");
+	glad_glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+}
+static void APIENTRY lazy_glDepthRangef(GLfloat n, GLfloat f) {
+	glad_glDepthRangef = (PFNGLDEPTHRANGEFPROC)resolve("glDepthRangef");
+	glad_glDepthRangef(n, f);
+}
+static void APIENTRY lazy_glClearDepthf(GLfloat d) {
+	glad_glClearDepthf = (PFNGLCLEARDEPTHFPROC)resolve("glClearDepthf");
+	glad_glClearDepthf(d);
+}
+static void APIENTRY lazy_glGetProgramBinary(GLuint program, GLsizei bufSize, GLsizei *length, GLenum *binaryFormat, void *binary) {
+	glad_glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)resolve("glGetProgramBinary");
+	glad_glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+}
+static void APIENTRY lazy_glProgramBinary(GLuint program, GLenum binaryFormat, const void *binary, GLsizei length) {
+	glad_glProgramBinary = (PFNGLPROGRAMBINARYPROC)resolve("glProgramBinary");
+	glad_glProgramBinary(program, binaryFormat, binary, length);
+}
+static void APIENTRY lazy_glProgramParameteri(GLuint program, GLenum pname, GLint value) {
+	glad_glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)resolve("glProgramParameteri");
+	glad_glProgramParameteri(program, pname, value);
+}
+static void APIENTRY lazy_glUseProgramStages(GLuint pipeline, GLbitfield stages, GLuint program) {
+	glad_glUseProgramStages = (PFNGLUSEPROGRAMSTAGESPROC)resolve("glUseProgramStages");
+	glad_glUseProgramStages(pipeline, stages, program);
+}
+static void APIENTRY lazy_glActiveShaderProgram(GLuint pipeline, GLuint program) {
+	glad_glActiveShaderProgram = (PFNGLACTIVESHADERPROGRAMPROC)resolve("glActiveShaderProgram");
+	glad_glActiveShaderProgram(pipeline, program);
+}
+static GLuint APIENTRY lazy_glCreateShaderProgramv(GLenum type, GLsizei count, const GLchar *const*strings) {
+	glad_glCreateShaderProgramv = (PFNGLCREATESHADERPROGRAMVPROC)resolve("glCreateShaderProgramv");
+	return glad_glCreateShaderProgramv(type, count, strings);
+}
+static void APIENTRY lazy_glBindProgramPipeline(GLuint pipeline) {
+	glad_glBindProgramPipeline = (PFNGLBINDPROGRAMPIPELINEPROC)resolve("glBindProgramPipeline");
+	glad_glBindProgramPipeline(pipeline);
+}
+static void APIENTRY lazy_glDeleteProgramPipelines(GLsizei n, const GLuint *pipelines) {
+	glad_glDeleteProgramPipelines = (PFNGLDELETEPROGRAMPIPELINESPROC)resolve("glDeleteProgramPipelines");
+	glad_glDeleteProgramPipelines(n, pipelines);
+}
+static void APIENTRY lazy_glGenProgramPipelines(GLsizei n, GLuint *pipelines) {
+	glad_glGenProgramPipelines = (PFNGLGENPROGRAMPIPELINESPROC)resolve("glGenProgramPipelines");
+	glad_glGenProgramPipelines(n, pipelines);
+}
+static GLboolean APIENTRY lazy_glIsProgramPipeline(GLuint pipeline) {
+	glad_glIsProgramPipeline = (PFNGLISPROGRAMPIPELINEPROC)resolve("glIsProgramPipeline");
+	return glad_glIsProgramPipeline(pipeline);
+}
+static void APIENTRY lazy_glGetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *params) {
+	glad_glGetProgramPipelineiv = (PFNGLGETPROGRAMPIPELINEIVPROC)resolve("glGetProgramPipelineiv");
+	glad_glGetProgramPipelineiv(pipeline, pname, params);
+}
+static void APIENTRY lazy_glProgramUniform1i(GLuint program, GLint location, GLint v0) {
+	glad_glProgramUniform1i = (PFNGLPROGRAMUNIFORM1IPROC)resolve("glProgramUniform1i");
+	glad_glProgramUniform1i(program, location, v0);
+}
+static void APIENTRY lazy_glProgramUniform1iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_glProgramUniform1iv = (PFNGLPROGRAMUNIFORM1IVPROC)resolve("glProgramUniform1iv");
+	glad_glProgramUniform1iv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform1f(GLuint program, GLint location, GLfloat v0) {
+	glad_glProgramUniform1f = (PFNGLPROGRAMUNIFORM1FPROC)resolve("glProgramUniform1f");
+	glad_glProgramUniform1f(program, location, v0);
+}
+static void APIENTRY lazy_glProgramUniform1fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_glProgramUniform1fv = (PFNGLPROGRAMUNIFORM1FVPROC)resolve("glProgramUniform1fv");
+	glad_glProgramUniform1fv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform1d(GLuint program, GLint location, GLdouble v0) {
+	glad_glProgramUniform1d = (PFNGLPROGRAMUNIFORM1DPROC)resolve("glProgramUniform1d");
+	glad_glProgramUniform1d(program, location, v0);
+}
+static void APIENTRY lazy_glProgramUniform1dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_glProgramUniform1dv = (PFNGLPROGRAMUNIFORM1DVPROC)resolve("glProgramUniform1dv");
+	glad_glProgramUniform1dv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform1ui(GLuint program, GLint location, GLuint v0) {
+	glad_glProgramUniform1ui = (PFNGLPROGRAMUNIFORM1UIPROC)resolve("glProgramUniform1ui");
+	glad_glProgramUniform1ui(program, location, v0);
+}
+static void APIENTRY lazy_glProgramUniform1uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_glProgramUniform1uiv = (PFNGLPROGRAMUNIFORM1UIVPROC)resolve("glProgramUniform1uiv");
+	glad_glProgramUniform1uiv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform2i(GLuint program, GLint location, GLint v0, GLint v1) {
+	glad_glProgramUniform2i = (PFNGLPROGRAMUNIFORM2IPROC)resolve("glProgramUniform2i");
+	glad_glProgramUniform2i(program, location, v0, v1);
+}
+static void APIENTRY lazy_glProgramUniform2iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_glProgramUniform2iv = (PFNGLPROGRAMUNIFORM2IVPROC)resolve("glProgramUniform2iv");
+	glad_glProgramUniform2iv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform2f(GLuint program, GLint location, GLfloat v0, GLfloat v1) {
+	glad_glProgramUniform2f = (PFNGLPROGRAMUNIFORM2FPROC)resolve("glProgramUniform2f");
+	glad_glProgramUniform2f(program, location, v0, v1);
+}
+static void APIENTRY lazy_glProgramUniform2fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_glProgramUniform2fv = (PFNGLPROGRAMUNIFORM2FVPROC)resolve("glProgramUniform2fv");
+	glad_glProgramUniform2fv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform2d(GLuint program, GLint location, GLdouble v0, GLdouble v1) {
+	glad_glProgramUniform2d = (PFNGLPROGRAMUNIFORM2DPROC)resolve("glProgramUniform2d");
+	glad_glProgramUniform2d(program, location, v0, v1);
+}
+static void APIENTRY lazy_glProgramUniform2dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_glProgramUniform2dv = (PFNGLPROGRAMUNIFORM2DVPROC)resolve("glProgramUniform2dv");
+	glad_glProgramUniform2dv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform2ui(GLuint program, GLint location, GLuint v0, GLuint v1) {
+	glad_glProgramUniform2ui = (PFNGLPROGRAMUNIFORM2UIPROC)resolve("glProgramUniform2ui");
+	glad_glProgramUniform2ui(program, location, v0, v1);
+}
+static void APIENTRY lazy_glProgramUniform2uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_glProgramUniform2uiv = (PFNGLPROGRAMUNIFORM2UIVPROC)resolve("glProgramUniform2uiv");
+	glad_glProgramUniform2uiv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform3i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2) {
+	glad_glProgramUniform3i = (PFNGLPROGRAMUNIFORM3IPROC)resolve("glProgramUniform3i");
+	glad_glProgramUniform3i(program, location, v0, v1, v2);
+}
+static void APIENTRY lazy_glProgramUniform3iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_glProgramUniform3iv = (PFNGLPROGRAMUNIFORM3IVPROC)resolve("glProgramUniform3iv");
+	glad_glProgramUniform3iv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	glad_glProgramUniform3f = (PFNGLPROGRAMUNIFORM3FPROC)resolve("glProgramUniform3f");
+	glad_glProgramUniform3f(program, location, v0, v1, v2);
+}
+static void APIENTRY lazy_glProgramUniform3fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_glProgramUniform3fv = (PFNGLPROGRAMUNIFORM3FVPROC)resolve("glProgramUniform3fv");
+	glad_glProgramUniform3fv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2) {
+	glad_glProgramUniform3d = (PFNGLPROGRAMUNIFORM3DPROC)resolve("glProgramUniform3d");
+	glad_glProgramUniform3d(program, location, v0, v1, v2);
+}
+static void APIENTRY lazy_glProgramUniform3dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_glProgramUniform3dv = (PFNGLPROGRAMUNIFORM3DVPROC)resolve("glProgramUniform3dv");
+	glad_glProgramUniform3dv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	glad_glProgramUniform3ui = (PFNGLPROGRAMUNIFORM3UIPROC)resolve("glProgramUniform3ui");
+	glad_glProgramUniform3ui(program, location, v0, v1, v2);
+}
+static void APIENTRY lazy_glProgramUniform3uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_glProgramUniform3uiv = (PFNGLPROGRAMUNIFORM3UIVPROC)resolve("glProgramUniform3uiv");
+	glad_glProgramUniform3uiv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	glad_glProgramUniform4i = (PFNGLPROGRAMUNIFORM4IPROC)resolve("glProgramUniform4i");
+	glad_glProgramUniform4i(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glProgramUniform4iv(GLuint program, GLint location, GLsizei count, const GLint *value) {
+	glad_glProgramUniform4iv = (PFNGLPROGRAMUNIFORM4IVPROC)resolve("glProgramUniform4iv");
+	glad_glProgramUniform4iv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	glad_glProgramUniform4f = (PFNGLPROGRAMUNIFORM4FPROC)resolve("glProgramUniform4f");
+	glad_glProgramUniform4f(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glProgramUniform4fv(GLuint program, GLint location, GLsizei count, const GLfloat *value) {
+	glad_glProgramUniform4fv = (PFNGLPROGRAMUNIFORM4FVPROC)resolve("glProgramUniform4fv");
+	glad_glProgramUniform4fv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform4d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GLdouble v2, GLdouble v3) {
+	glad_glProgramUniform4d = (PFNGLPROGRAMUNIFORM4DPROC)resolve("glProgramUniform4d");
+	glad_glProgramUniform4d(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glProgramUniform4dv(GLuint program, GLint location, GLsizei count, const GLdouble *value) {
+	glad_glProgramUniform4dv = (PFNGLPROGRAMUNIFORM4DVPROC)resolve("glProgramUniform4dv");
+	glad_glProgramUniform4dv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	glad_glProgramUniform4ui = (PFNGLPROGRAMUNIFORM4UIPROC)resolve("glProgramUniform4ui");
+	glad_glProgramUniform4ui(program, location, v0, v1, v2, v3);
+}
+static void APIENTRY lazy_glProgramUniform4uiv(GLuint program, GLint location, GLsizei count, const GLuint *value) {
+	glad_glProgramUniform4uiv = (PFNGLPROGRAMUNIFORM4UIVPROC)resolve("glProgramUniform4uiv");
+	glad_glProgramUniform4uiv(program, location, count, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix2fv = (PFNGLPROGRAMUNIFORMMATRIX2FVPROC)resolve("glProgramUniformMatrix2fv");
+	glad_glProgramUniformMatrix2fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix3fv = (PFNGLPROGRAMUNIFORMMATRIX3FVPROC)resolve("glProgramUniformMatrix3fv");
+	glad_glProgramUniformMatrix3fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix4fv = (PFNGLPROGRAMUNIFORMMATRIX4FVPROC)resolve("glProgramUniformMatrix4fv");
+	glad_glProgramUniformMatrix4fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix2dv = (PFNGLPROGRAMUNIFORMMATRIX2DVPROC)resolve("glProgramUniformMatrix2dv");
+	glad_glProgramUniformMatrix2dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix3dv = (PFNGLPROGRAMUNIFORMMATRIX3DVPROC)resolve("glProgramUniformMatrix3dv");
+	glad_glProgramUniformMatrix3dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix4dv = (PFNGLPROGRAMUNIFORMMATRIX4DVPROC)resolve("glProgramUniformMatrix4dv");
+	glad_glProgramUniformMatrix4dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix2x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix2x3fv = (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)resolve("glProgramUniformMatrix2x3fv");
+	glad_glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix3x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix3x2fv = (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)resolve("glProgramUniformMatrix3x2fv");
+	glad_glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix2x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix2x4fv = (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)resolve("glProgramUniformMatrix2x4fv");
+	glad_glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix4x2fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix4x2fv = (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)resolve("glProgramUniformMatrix4x2fv");
+	glad_glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix3x4fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix3x4fv = (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)resolve("glProgramUniformMatrix3x4fv");
+	glad_glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix4x3fv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glad_glProgramUniformMatrix4x3fv = (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)resolve("glProgramUniformMatrix4x3fv");
+	glad_glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix2x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix2x3dv = (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)resolve("glProgramUniformMatrix2x3dv");
+	glad_glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix3x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix3x2dv = (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)resolve("glProgramUniformMatrix3x2dv");
+	glad_glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix2x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix2x4dv = (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)resolve("glProgramUniformMatrix2x4dv");
+	glad_glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix4x2dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix4x2dv = (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)resolve("glProgramUniformMatrix4x2dv");
+	glad_glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix3x4dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix3x4dv = (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)resolve("glProgramUniformMatrix3x4dv");
+	glad_glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glProgramUniformMatrix4x3dv(GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble *value) {
+	glad_glProgramUniformMatrix4x3dv = (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)resolve("glProgramUniformMatrix4x3dv");
+	glad_glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+}
+static void APIENTRY lazy_glValidateProgramPipeline(GLuint pipeline) {
+	glad_glValidateProgramPipeline = (PFNGLVALIDATEPROGRAMPIPELINEPROC)resolve("glValidateProgramPipeline");
+	glad_glValidateProgramPipeline(pipeline);
+}
+static void APIENTRY lazy_glGetProgramPipelineInfoLog(GLuint pipeline, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	glad_glGetProgramPipelineInfoLog = (PFNGLGETPROGRAMPIPELINEINFOLOGPROC)resolve("glGetProgramPipelineInfoLog");
+	glad_glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+}
+static void APIENTRY lazy_glVertexAttribL1d(GLuint index, GLdouble x) {
+	glad_glVertexAttribL1d = (PFNGLVERTEXATTRIBL1DPROC)resolve("glVertexAttribL1d");
+	glad_glVertexAttribL1d(index, x);
+}
+static void APIENTRY lazy_glVertexAttribL2d(GLuint index, GLdouble x, GLdouble y) {
+	glad_glVertexAttribL2d = (PFNGLVERTEXATTRIBL2DPROC)resolve("glVertexAttribL2d");
+	glad_glVertexAttribL2d(index, x, y);
+}
+static void APIENTRY lazy_glVertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	glad_glVertexAttribL3d = (PFNGLVERTEXATTRIBL3DPROC)resolve("glVertexAttribL3d");
+	glad_glVertexAttribL3d(index, x, y, z);
+}
+static void APIENTRY lazy_glVertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glad_glVertexAttribL4d = (PFNGLVERTEXATTRIBL4DPROC)resolve("glVertexAttribL4d");
+	glad_glVertexAttribL4d(index, x, y, z, w);
+}
+static void APIENTRY lazy_glVertexAttribL1dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttribL1dv = (PFNGLVERTEXATTRIBL1DVPROC)resolve("glVertexAttribL1dv");
+	glad_glVertexAttribL1dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribL2dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttribL2dv = (PFNGLVERTEXATTRIBL2DVPROC)resolve("glVertexAttribL2dv");
+	glad_glVertexAttribL2dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribL3dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttribL3dv = (PFNGLVERTEXATTRIBL3DVPROC)resolve("glVertexAttribL3dv");
+	glad_glVertexAttribL3dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribL4dv(GLuint index, const GLdouble *v) {
+	glad_glVertexAttribL4dv = (PFNGLVERTEXATTRIBL4DVPROC)resolve("glVertexAttribL4dv");
+	glad_glVertexAttribL4dv(index, v);
+}
+static void APIENTRY lazy_glVertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glad_glVertexAttribLPointer = (PFNGLVERTEXATTRIBLPOINTERPROC)resolve("glVertexAttribLPointer");
+	glad_glVertexAttribLPointer(index, size, type, stride, pointer);
+}
+static void APIENTRY lazy_glGetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *params) {
+	glad_glGetVertexAttribLdv = (PFNGLGETVERTEXATTRIBLDVPROC)resolve("glGetVertexAttribLdv");
+	glad_glGetVertexAttribLdv(index, pname, params);
+}
+static void APIENTRY lazy_glViewportArrayv(GLuint first, GLsizei count, const GLfloat *v) {
+	glad_glViewportArrayv = (PFNGLVIEWPORTARRAYVPROC)resolve("glViewportArrayv");
+	glad_glViewportArrayv(first, count, v);
+}
+static void APIENTRY lazy_glViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h) {
+	glad_glViewportIndexedf = (PFNGLVIEWPORTINDEXEDFPROC)resolve("glViewportIndexedf");
+	glad_glViewportIndexedf(index, x, y, w, h);
+}
+static void APIENTRY lazy_glViewportIndexedfv(GLuint index, const GLfloat *v) {
+	glad_glViewportIndexedfv = (PFNGLVIEWPORTINDEXEDFVPROC)resolve("glViewportIndexedfv");
+	glad_glViewportIndexedfv(index, v);
+}
+static void APIENTRY lazy_glScissorArrayv(GLuint first, GLsizei count, const GLint *v) {
+	glad_glScissorArrayv = (PFNGLSCISSORARRAYVPROC)resolve("glScissorArrayv");
+	glad_glScissorArrayv(first, count, v);
+}
+static void APIENTRY lazy_glScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height) {
+	glad_glScissorIndexed = (PFNGLSCISSORINDEXEDPROC)resolve("glScissorIndexed");
+	glad_glScissorIndexed(index, left, bottom, width, height);
+}
+static void APIENTRY lazy_glScissorIndexedv(GLuint index, const GLint *v) {
+	glad_glScissorIndexedv = (PFNGLSCISSORINDEXEDVPROC)resolve("glScissorIndexedv");
+	glad_glScissorIndexedv(index, v);
+}
+static void APIENTRY lazy_glDepthRangeArrayv(GLuint first, GLsizei count, const GLdouble *v) {
+	glad_glDepthRangeArrayv = (PFNGLDEPTHRANGEARRAYVPROC)resolve("glDepthRangeArrayv");
+	glad_glDepthRangeArrayv(first, count, v);
+}
+static void APIENTRY lazy_glDepthRangeIndexed(GLuint index, GLdouble n, GLdouble f) {
+	glad_glDepthRangeIndexed = (PFNGLDEPTHRANGEINDEXEDPROC)resolve("glDepthRangeIndexed");
+	glad_glDepthRangeIndexed(index, n, f);
+}
+static void APIENTRY lazy_glGetFloati_v(GLenum target, GLuint index, GLfloat *data) {
+	glad_glGetFloati_v = (PFNGLGETFLOATI_VPROC)resolve("glGetFloati_v");
+	glad_glGetFloati_v(target, index, data);
+}
+static void APIENTRY lazy_glGetDoublei_v(GLenum target, GLuint index, GLdouble *data) {
+	glad_glGetDoublei_v = (PFNGLGETDOUBLEI_VPROC)resolve("glGetDoublei_v");
+	glad_glGetDoublei_v(target, index, data);
+}
+static void APIENTRY lazy_glDrawArraysInstancedBaseInstance(GLenum mode, GLint first, GLsizei count, GLsizei instancecount, GLuint baseinstance) {
+	glad_glDrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)resolve("glDrawArraysInstancedBaseInstance");
+	glad_glDrawArraysInstancedBaseInstance(mode, first, count, instancecount, baseinstance);
+}
+static void APIENTRY lazy_glDrawElementsInstancedBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLuint baseinstance) {
+	glad_glDrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)resolve("glDrawElementsInstancedBaseInstance");
+	glad_glDrawElementsInstancedBaseInstance(mode, count, type, indices, instancecount, baseinstance);
+}
+static void APIENTRY lazy_glDrawElementsInstancedBaseVertexBaseInstance(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance) {
+	glad_glDrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)resolve("glDrawElementsInstancedBaseVertexBaseInstance");
+	glad_glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, instancecount, basevertex, baseinstance);
+}
+static void APIENTRY lazy_glGetInternalformativ(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint *params) {
+	glad_glGetInternalformativ = (PFNGLGETINTERNALFORMATIVPROC)resolve("glGetInternalformativ");
+	glad_glGetInternalformativ(target, internalformat, pname, count, params);
+}
+static void APIENTRY lazy_glGetActiveAtomicCounterBufferiv(GLuint program, GLuint bufferIndex, GLenum pname, GLint *params) {
+	glad_glGetActiveAtomicCounterBufferiv = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)resolve("glGetActiveAtomicCounterBufferiv");
+	glad_glGetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+}
+static void APIENTRY lazy_glBindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format) {
+	glad_glBindImageTexture = (PFNGLBINDIMAGETEXTUREPROC)resolve("glBindImageTexture");
+	glad_glBindImageTexture(unit, texture, level, layered, layer, access, format);
+}
+static void APIENTRY lazy_glMemoryBarrier(GLbitfield barriers) {
+	glad_glMemoryBarrier = (PFNGLMEMORYBARRIERPROC)resolve("glMemoryBarrier");
+	glad_glMemoryBarrier(barriers);
+}
+static void APIENTRY lazy_glTexStorage1D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width) {
+	glad_glTexStorage1D = (PFNGLTEXSTORAGE1DPROC)resolve("glTexStorage1D");
+	glad_glTexStorage1D(target, levels, internalformat, width);
+}
+static void APIENTRY lazy_glTexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glTexStorage2D = (PFNGLTEXSTORAGE2DPROC)resolve("glTexStorage2D");
+	glad_glTexStorage2D(target, levels, internalformat, width, height);
+}
+static void APIENTRY lazy_glTexStorage3D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+	glad_glTexStorage3D = (PFNGLTEXSTORAGE3DPROC)resolve("glTexStorage3D");
+	glad_glTexStorage3D(target, levels, internalformat, width, height, depth);
+}
+static void APIENTRY lazy_glDrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsizei instancecount) {
+	glad_glDrawTransformFeedbackInstanced = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)resolve("glDrawTransformFeedbackInstanced");
+	glad_glDrawTransformFeedbackInstanced(mode, id, instancecount);
+}
+static void APIENTRY lazy_glDrawTransformFeedbackStreamInstanced(GLenum mode, GLuint id, GLuint stream, GLsizei instancecount) {
+	glad_glDrawTransformFeedbackStreamInstanced = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)resolve("glDrawTransformFeedbackStreamInstanced");
+	glad_glDrawTransformFeedbackStreamInstanced(mode, id, stream, instancecount);
+}
+static void APIENTRY lazy_glClearBufferData(GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+	glad_glClearBufferData = (PFNGLCLEARBUFFERDATAPROC)resolve("glClearBufferData");
+	glad_glClearBufferData(target, internalformat, format, type, data);
+}
+static void APIENTRY lazy_glClearBufferSubData(GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+	glad_glClearBufferSubData = (PFNGLCLEARBUFFERSUBDATAPROC)resolve("glClearBufferSubData");
+	glad_glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+}
+static void APIENTRY lazy_glDispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z) {
+	glad_glDispatchCompute = (PFNGLDISPATCHCOMPUTEPROC)resolve("glDispatchCompute");
+	glad_glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+}
+static void APIENTRY lazy_glDispatchComputeIndirect(GLintptr indirect) {
+	glad_glDispatchComputeIndirect = (PFNGLDISPATCHCOMPUTEINDIRECTPROC)resolve("glDispatchComputeIndirect");
+	glad_glDispatchComputeIndirect(indirect);
+}
+static void APIENTRY lazy_glCopyImageSubData(GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth) {
+	glad_glCopyImageSubData = (PFNGLCOPYIMAGESUBDATAPROC)resolve("glCopyImageSubData");
+	glad_glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+}
+static void APIENTRY lazy_glFramebufferParameteri(GLenum target, GLenum pname, GLint param) {
+	glad_glFramebufferParameteri = (PFNGLFRAMEBUFFERPARAMETERIPROC)resolve("glFramebufferParameteri");
+	glad_glFramebufferParameteri(target, pname, param);
+}
+static void APIENTRY lazy_glGetFramebufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glad_glGetFramebufferParameteriv = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC)resolve("glGetFramebufferParameteriv");
+	glad_glGetFramebufferParameteriv(target, pname, params);
+}
+static void APIENTRY lazy_glGetInternalformati64v(GLenum target, GLenum internalformat, GLenum pname, GLsizei count, GLint64 *params) {
+	glad_glGetInternalformati64v = (PFNGLGETINTERNALFORMATI64VPROC)resolve("glGetInternalformati64v");
+	glad_glGetInternalformati64v(target, internalformat, pname, count, params);
+}
+static void APIENTRY lazy_glInvalidateTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth) {
+	glad_glInvalidateTexSubImage = (PFNGLINVALIDATETEXSUBIMAGEPROC)resolve("glInvalidateTexSubImage");
+	glad_glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+}
+static void APIENTRY lazy_glInvalidateTexImage(GLuint texture, GLint level) {
+	glad_glInvalidateTexImage = (PFNGLINVALIDATETEXIMAGEPROC)resolve("glInvalidateTexImage");
+	glad_glInvalidateTexImage(texture, level);
+}
+static void APIENTRY lazy_glInvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+	glad_glInvalidateBufferSubData = (PFNGLINVALIDATEBUFFERSUBDATAPROC)resolve("glInvalidateBufferSubData");
+	glad_glInvalidateBufferSubData(buffer, offset, length);
+}
+static void APIENTRY lazy_glInvalidateBufferData(GLuint buffer) {
+	glad_glInvalidateBufferData = (PFNGLINVALIDATEBUFFERDATAPROC)resolve("glInvalidateBufferData");
+	glad_glInvalidateBufferData(buffer);
+}
+static void APIENTRY lazy_glInvalidateFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments) {
+	glad_glInvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC)resolve("glInvalidateFramebuffer");
+	glad_glInvalidateFramebuffer(target, numAttachments, attachments);
+}
+static void APIENTRY lazy_glInvalidateSubFramebuffer(GLenum target, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glInvalidateSubFramebuffer = (PFNGLINVALIDATESUBFRAMEBUFFERPROC)resolve("glInvalidateSubFramebuffer");
+	glad_glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+}
+static void APIENTRY lazy_glMultiDrawArraysIndirect(GLenum mode, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	glad_glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)resolve("glMultiDrawArraysIndirect");
+	glad_glMultiDrawArraysIndirect(mode, indirect, drawcount, stride);
+}
+static void APIENTRY lazy_glMultiDrawElementsIndirect(GLenum mode, GLenum type, const void *indirect, GLsizei drawcount, GLsizei stride) {
+	glad_glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)resolve("glMultiDrawElementsIndirect");
+	glad_glMultiDrawElementsIndirect(mode, type, indirect, drawcount, stride);
+}
+static void APIENTRY lazy_glGetProgramInterfaceiv(GLuint program, GLenum programInterface, GLenum pname, GLint *params) {
+	glad_glGetProgramInterfaceiv = (PFNGLGETPROGRAMINTERFACEIVPROC)resolve("glGetProgramInterfaceiv");
+	glad_glGetProgramInterfaceiv(program, programInterface, pname, params);
+}
+static GLuint APIENTRY lazy_glGetProgramResourceIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+	glad_glGetProgramResourceIndex = (PFNGLGETPROGRAMRESOURCEINDEXPROC)resolve("glGetProgramResourceIndex");
+	return glad_glGetProgramResourceIndex(program, programInterface, name);
+}
+static void APIENTRY lazy_glGetProgramResourceName(GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei *length, GLchar *name) {
+	glad_glGetProgramResourceName = (PFNGLGETPROGRAMRESOURCENAMEPROC)resolve("glGetProgramResourceName");
+	glad_glGetProgramResourceName(program, programInterface, index, bufSize, length, name);
+}
+static void APIENTRY lazy_glGetProgramResourceiv(GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum *props, GLsizei count, GLsizei *length, GLint *params) {
+	glad_glGetProgramResourceiv = (PFNGLGETPROGRAMRESOURCEIVPROC)resolve("glGetProgramResourceiv");
+	glad_glGetProgramResourceiv(program, programInterface, index, propCount, props, count, length, params);
+}
+static GLint APIENTRY lazy_glGetProgramResourceLocation(GLuint program, GLenum programInterface, const GLchar *name) {
+	glad_glGetProgramResourceLocation = (PFNGLGETPROGRAMRESOURCELOCATIONPROC)resolve("glGetProgramResourceLocation");
+	return glad_glGetProgramResourceLocation(program, programInterface, name);
+}
+static GLint APIENTRY lazy_glGetProgramResourceLocationIndex(GLuint program, GLenum programInterface, const GLchar *name) {
+	glad_glGetProgramResourceLocationIndex = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)resolve("glGetProgramResourceLocationIndex");
+	return glad_glGetProgramResourceLocationIndex(program, programInterface, name);
+}
+static void APIENTRY lazy_glShaderStorageBlockBinding(GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding) {
+	glad_glShaderStorageBlockBinding = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC)resolve("glShaderStorageBlockBinding");
+	glad_glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+}
+static void APIENTRY lazy_glTexBufferRange(GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glTexBufferRange = (PFNGLTEXBUFFERRANGEPROC)resolve("glTexBufferRange");
+	glad_glTexBufferRange(target, internalformat, buffer, offset, size);
+}
+static void APIENTRY lazy_glTexStorage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	glad_glTexStorage2DMultisample = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC)resolve("glTexStorage2DMultisample");
+	glad_glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY lazy_glTexStorage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	glad_glTexStorage3DMultisample = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC)resolve("glTexStorage3DMultisample");
+	glad_glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY lazy_glTextureView(GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers) {
+	glad_glTextureView = (PFNGLTEXTUREVIEWPROC)resolve("glTextureView");
+	glad_glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+}
+static void APIENTRY lazy_glBindVertexBuffer(GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+	glad_glBindVertexBuffer = (PFNGLBINDVERTEXBUFFERPROC)resolve("glBindVertexBuffer");
+	glad_glBindVertexBuffer(bindingindex, buffer, offset, stride);
+}
+static void APIENTRY lazy_glVertexAttribFormat(GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+	glad_glVertexAttribFormat = (PFNGLVERTEXATTRIBFORMATPROC)resolve("glVertexAttribFormat");
+	glad_glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+}
+static void APIENTRY lazy_glVertexAttribIFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_glVertexAttribIFormat = (PFNGLVERTEXATTRIBIFORMATPROC)resolve("glVertexAttribIFormat");
+	glad_glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+}
+static void APIENTRY lazy_glVertexAttribLFormat(GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_glVertexAttribLFormat = (PFNGLVERTEXATTRIBLFORMATPROC)resolve("glVertexAttribLFormat");
+	glad_glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+}
+static void APIENTRY lazy_glVertexAttribBinding(GLuint attribindex, GLuint bindingindex) {
+	glad_glVertexAttribBinding = (PFNGLVERTEXATTRIBBINDINGPROC)resolve("glVertexAttribBinding");
+	glad_glVertexAttribBinding(attribindex, bindingindex);
+}
+static void APIENTRY lazy_glVertexBindingDivisor(GLuint bindingindex, GLuint divisor) {
+	glad_glVertexBindingDivisor = (PFNGLVERTEXBINDINGDIVISORPROC)resolve("glVertexBindingDivisor");
+	glad_glVertexBindingDivisor(bindingindex, divisor);
+}
+static void APIENTRY lazy_glDebugMessageControl(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint *ids, GLboolean enabled) {
+	glad_glDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC)resolve("glDebugMessageControl");
+	glad_glDebugMessageControl(source, type, severity, count, ids, enabled);
+}
+static void APIENTRY lazy_glDebugMessageInsert(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar *buf) {
+	glad_glDebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC)resolve("glDebugMessageInsert");
+	glad_glDebugMessageInsert(source, type, id, severity, length, buf);
+}
+static void APIENTRY lazy_glDebugMessageCallback(GLDEBUGPROC callback, const void *userParam) {
+	glad_glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)resolve("glDebugMessageCallback");
+	glad_glDebugMessageCallback(callback, userParam);
+}
+static GLuint APIENTRY lazy_glGetDebugMessageLog(GLuint count, GLsizei bufSize, GLenum *sources, GLenum *types, GLuint *ids, GLenum *severities, GLsizei *lengths, GLchar *messageLog) {
+	glad_glGetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC)resolve("glGetDebugMessageLog");
+	return glad_glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+static void APIENTRY lazy_glPushDebugGroup(GLenum source, GLuint id, GLsizei length, const GLchar *message) {
+	glad_glPushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)resolve("glPushDebugGroup");
+	glad_glPushDebugGroup(source, id, length, message);
+}
+static void APIENTRY lazy_glPopDebugGroup(void) {
+	glad_glPopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)resolve("glPopDebugGroup");
+	glad_glPopDebugGroup();
+}
+static void APIENTRY lazy_glObjectLabel(GLenum identifier, GLuint name, GLsizei length, const GLchar *label) {
+	glad_glObjectLabel = (PFNGLOBJECTLABELPROC)resolve("glObjectLabel");
+	glad_glObjectLabel(identifier, name, length, label);
+}
+static void APIENTRY lazy_glGetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	glad_glGetObjectLabel = (PFNGLGETOBJECTLABELPROC)resolve("glGetObjectLabel");
+	glad_glGetObjectLabel(identifier, name, bufSize, length, label);
+}
+static void APIENTRY lazy_glObjectPtrLabel(const void *ptr, GLsizei length, const GLchar *label) {
+	glad_glObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC)resolve("glObjectPtrLabel");
+	glad_glObjectPtrLabel(ptr, length, label);
+}
+static void APIENTRY lazy_glGetObjectPtrLabel(const void *ptr, GLsizei bufSize, GLsizei *length, GLchar *label) {
+	glad_glGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)resolve("glGetObjectPtrLabel");
+	glad_glGetObjectPtrLabel(ptr, bufSize, length, label);
+}
+static void APIENTRY lazy_glBufferStorage(GLenum target, GLsizeiptr size, const void *data, GLbitfield flags) {
+	glad_glBufferStorage = (PFNGLBUFFERSTORAGEPROC)resolve("glBufferStorage");
+	glad_glBufferStorage(target, size, data, flags);
+}
+static void APIENTRY lazy_glClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const void *data) {
+	glad_glClearTexImage = (PFNGLCLEARTEXIMAGEPROC)resolve("glClearTexImage");
+	glad_glClearTexImage(texture, level, format, type, data);
+}
+static void APIENTRY lazy_glClearTexSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data) {
+	glad_glClearTexSubImage = (PFNGLCLEARTEXSUBIMAGEPROC)resolve("glClearTexSubImage");
+	glad_glClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+}
+static void APIENTRY lazy_glBindBuffersBase(GLenum target, GLuint first, GLsizei count, const GLuint *buffers) {
+	glad_glBindBuffersBase = (PFNGLBINDBUFFERSBASEPROC)resolve("glBindBuffersBase");
+	glad_glBindBuffersBase(target, first, count, buffers);
+}
+static void APIENTRY lazy_glBindBuffersRange(GLenum target, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizeiptr *sizes) {
+	glad_glBindBuffersRange = (PFNGLBINDBUFFERSRANGEPROC)resolve("glBindBuffersRange");
+	glad_glBindBuffersRange(target, first, count, buffers, offsets, sizes);
+}
+static void APIENTRY lazy_glBindTextures(GLuint first, GLsizei count, const GLuint *textures) {
+	glad_glBindTextures = (PFNGLBINDTEXTURESPROC)resolve("glBindTextures");
+	glad_glBindTextures(first, count, textures);
+}
+static void APIENTRY lazy_glBindSamplers(GLuint first, GLsizei count, const GLuint *samplers) {
+	glad_glBindSamplers = (PFNGLBINDSAMPLERSPROC)resolve("glBindSamplers");
+	glad_glBindSamplers(first, count, samplers);
+}
+static void APIENTRY lazy_glBindImageTextures(GLuint first, GLsizei count, const GLuint *textures) {
+	glad_glBindImageTextures = (PFNGLBINDIMAGETEXTURESPROC)resolve("glBindImageTextures");
+	glad_glBindImageTextures(first, count, textures);
+}
+static void APIENTRY lazy_glBindVertexBuffers(GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+	glad_glBindVertexBuffers = (PFNGLBINDVERTEXBUFFERSPROC)resolve("glBindVertexBuffers");
+	glad_glBindVertexBuffers(first, count, buffers, offsets, strides);
+}
+static void APIENTRY lazy_glClipControl(GLenum origin, GLenum depth) {
+	glad_glClipControl = (PFNGLCLIPCONTROLPROC)resolve("glClipControl");
+	glad_glClipControl(origin, depth);
+}
+static void APIENTRY lazy_glCreateTransformFeedbacks(GLsizei n, GLuint *ids) {
+	glad_glCreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC)resolve("glCreateTransformFeedbacks");
+	glad_glCreateTransformFeedbacks(n, ids);
+}
+static void APIENTRY lazy_glTransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint buffer) {
+	glad_glTransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)resolve("glTransformFeedbackBufferBase");
+	glad_glTransformFeedbackBufferBase(xfb, index, buffer);
+}
+static void APIENTRY lazy_glTransformFeedbackBufferRange(GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glTransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)resolve("glTransformFeedbackBufferRange");
+	glad_glTransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+}
+static void APIENTRY lazy_glGetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *param) {
+	glad_glGetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC)resolve("glGetTransformFeedbackiv");
+	glad_glGetTransformFeedbackiv(xfb, pname, param);
+}
+static void APIENTRY lazy_glGetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint index, GLint *param) {
+	glad_glGetTransformFeedbacki_v = (PFNGLGETTRANSFORMFEEDBACKI_VPROC)resolve("glGetTransformFeedbacki_v");
+	glad_glGetTransformFeedbacki_v(xfb, pname, index, param);
+}
+static void APIENTRY lazy_glGetTransformFeedbacki64_v(GLuint xfb, GLenum pname, GLuint index, GLint64 *param) {
+	glad_glGetTransformFeedbacki64_v = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC)resolve("glGetTransformFeedbacki64_v");
+	glad_glGetTransformFeedbacki64_v(xfb, pname, index, param);
+}
+static void APIENTRY lazy_glCreateBuffers(GLsizei n, GLuint *buffers) {
+	glad_glCreateBuffers = (PFNGLCREATEBUFFERSPROC)resolve("glCreateBuffers");
+	glad_glCreateBuffers(n, buffers);
+}
+static void APIENTRY lazy_glNamedBufferStorage(GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags) {
+	glad_glNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)resolve("glNamedBufferStorage");
+	glad_glNamedBufferStorage(buffer, size, data, flags);
+}
+static void APIENTRY lazy_glNamedBufferData(GLuint buffer, GLsizeiptr size, const void *data, GLenum usage) {
+	glad_glNamedBufferData = (PFNGLNAMEDBUFFERDATAPROC)resolve("glNamedBufferData");
+	glad_glNamedBufferData(buffer, size, data, usage);
+}
+static void APIENTRY lazy_glNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data) {
+	glad_glNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC)resolve("glNamedBufferSubData");
+	glad_glNamedBufferSubData(buffer, offset, size, data);
+}
+static void APIENTRY lazy_glCopyNamedBufferSubData(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	glad_glCopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)resolve("glCopyNamedBufferSubData");
+	glad_glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+static void APIENTRY lazy_glClearNamedBufferData(GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data) {
+	glad_glClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC)resolve("glClearNamedBufferData");
+	glad_glClearNamedBufferData(buffer, internalformat, format, type, data);
+}
+static void APIENTRY lazy_glClearNamedBufferSubData(GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data) {
+	glad_glClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC)resolve("glClearNamedBufferSubData");
+	glad_glClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+}
+static void * APIENTRY lazy_glMapNamedBuffer(GLuint buffer, GLenum access) {
+	glad_glMapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC)resolve("glMapNamedBuffer");
+	return glad_glMapNamedBuffer(buffer, access);
+}
+static void * APIENTRY lazy_glMapNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	glad_glMapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC)resolve("glMapNamedBufferRange");
+	return glad_glMapNamedBufferRange(buffer, offset, length, access);
+}
+static GLboolean APIENTRY lazy_glUnmapNamedBuffer(GLuint buffer) {
+	glad_glUnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)resolve("glUnmapNamedBuffer");
+	return glad_glUnmapNamedBuffer(buffer);
+}
+static void APIENTRY lazy_glFlushMappedNamedBufferRange(GLuint buffer, GLintptr offset, GLsizeiptr length) {
+	glad_glFlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)resolve("glFlushMappedNamedBufferRange");
+	glad_glFlushMappedNamedBufferRange(buffer, offset, length);
+}
+static void APIENTRY lazy_glGetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint *params) {
+	glad_glGetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC)resolve("glGetNamedBufferParameteriv");
+	glad_glGetNamedBufferParameteriv(buffer, pname, params);
+}
+static void APIENTRY lazy_glGetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLint64 *params) {
+	glad_glGetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)resolve("glGetNamedBufferParameteri64v");
+	glad_glGetNamedBufferParameteri64v(buffer, pname, params);
+}
+static void APIENTRY lazy_glGetNamedBufferPointerv(GLuint buffer, GLenum pname, void **params) {
+	glad_glGetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC)resolve("glGetNamedBufferPointerv");
+	glad_glGetNamedBufferPointerv(buffer, pname, params);
+}
+static void APIENTRY lazy_glGetNamedBufferSubData(GLuint buffer, GLintptr offset, GLsizeiptr size, void *data) {
+	glad_glGetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC)resolve("glGetNamedBufferSubData");
+	glad_glGetNamedBufferSubData(buffer, offset, size, data);
+}
+static void APIENTRY lazy_glCreateFramebuffers(GLsizei n, GLuint *framebuffers) {
+	glad_glCreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC)resolve("glCreateFramebuffers");
+	glad_glCreateFramebuffers(n, framebuffers);
+}
+static void APIENTRY lazy_glNamedFramebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	glad_glNamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)resolve("glNamedFramebufferRenderbuffer");
+	glad_glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+}
+static void APIENTRY lazy_glNamedFramebufferParameteri(GLuint framebuffer, GLenum pname, GLint param) {
+	glad_glNamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)resolve("glNamedFramebufferParameteri");
+	glad_glNamedFramebufferParameteri(framebuffer, pname, param);
+}
+static void APIENTRY lazy_glNamedFramebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level) {
+	glad_glNamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)resolve("glNamedFramebufferTexture");
+	glad_glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+}
+static void APIENTRY lazy_glNamedFramebufferTextureLayer(GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	glad_glNamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)resolve("glNamedFramebufferTextureLayer");
+	glad_glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+}
+static void APIENTRY lazy_glNamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf) {
+	glad_glNamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)resolve("glNamedFramebufferDrawBuffer");
+	glad_glNamedFramebufferDrawBuffer(framebuffer, buf);
+}
+static void APIENTRY lazy_glNamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, const GLenum *bufs) {
+	glad_glNamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)resolve("glNamedFramebufferDrawBuffers");
+	glad_glNamedFramebufferDrawBuffers(framebuffer, n, bufs);
+}
+static void APIENTRY lazy_glNamedFramebufferReadBuffer(GLuint framebuffer, GLenum src) {
+	glad_glNamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)resolve("glNamedFramebufferReadBuffer");
+	glad_glNamedFramebufferReadBuffer(framebuffer, src);
+}
+static void APIENTRY lazy_glInvalidateNamedFramebufferData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments) {
+	glad_glInvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)resolve("glInvalidateNamedFramebufferData");
+	glad_glInvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+}
+static void APIENTRY lazy_glInvalidateNamedFramebufferSubData(GLuint framebuffer, GLsizei numAttachments, const GLenum *attachments, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glInvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)resolve("glInvalidateNamedFramebufferSubData");
+	glad_glInvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+}
+static void APIENTRY lazy_glClearNamedFramebufferiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint *value) {
+	glad_glClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)resolve("glClearNamedFramebufferiv");
+	glad_glClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+}
+static void APIENTRY lazy_glClearNamedFramebufferuiv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	glad_glClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)resolve("glClearNamedFramebufferuiv");
+	glad_glClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+}
+static void APIENTRY lazy_glClearNamedFramebufferfv(GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	glad_glClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)resolve("glClearNamedFramebufferfv");
+	glad_glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+}
+static void APIENTRY lazy_glClearNamedFramebufferfi(GLuint framebuffer, GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	glad_glClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)resolve("glClearNamedFramebufferfi");
+	glad_glClearNamedFramebufferfi(framebuffer, buffer, drawbuffer, depth, stencil);
+}
+static void APIENTRY lazy_glBlitNamedFramebuffer(GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	glad_glBlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC)resolve("glBlitNamedFramebuffer");
+	glad_glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+static GLenum APIENTRY lazy_glCheckNamedFramebufferStatus(GLuint framebuffer, GLenum target) {
+	glad_glCheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)resolve("glCheckNamedFramebufferStatus");
+	return glad_glCheckNamedFramebufferStatus(framebuffer, target);
+}
+static void APIENTRY lazy_glGetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pname, GLint *param) {
+	glad_glGetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)resolve("glGetNamedFramebufferParameteriv");
+	glad_glGetNamedFramebufferParameteriv(framebuffer, pname, param);
+}
+static void APIENTRY lazy_glGetNamedFramebufferAttachmentParameteriv(GLuint framebuffer, GLenum attachment, GLenum pname, GLint *params) {
+	glad_glGetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)resolve("glGetNamedFramebufferAttachmentParameteriv");
+	glad_glGetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+}
+static void APIENTRY lazy_glCreateRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	glad_glCreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC)resolve("glCreateRenderbuffers");
+	glad_glCreateRenderbuffers(n, renderbuffers);
+}
+static void APIENTRY lazy_glNamedRenderbufferStorage(GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glNamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC)resolve("glNamedRenderbufferStorage");
+	glad_glNamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+}
+static void APIENTRY lazy_glNamedRenderbufferStorageMultisample(GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glNamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)resolve("glNamedRenderbufferStorageMultisample");
+	glad_glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+}
+static void APIENTRY lazy_glGetNamedRenderbufferParameteriv(GLuint renderbuffer, GLenum pname, GLint *params) {
+	glad_glGetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)resolve("glGetNamedRenderbufferParameteriv");
+	glad_glGetNamedRenderbufferParameteriv(renderbuffer, pname, params);
+}
+static void APIENTRY lazy_glCreateTextures(GLenum target, GLsizei n, GLuint *textures) {
+	glad_glCreateTextures = (PFNGLCREATETEXTURESPROC)resolve("glCreateTextures");
+	glad_glCreateTextures(target, n, textures);
+}
+static void APIENTRY lazy_glTextureBuffer(GLuint texture, GLenum internalformat, GLuint buffer) {
+	glad_glTextureBuffer = (PFNGLTEXTUREBUFFERPROC)resolve("glTextureBuffer");
+	glad_glTextureBuffer(texture, internalformat, buffer);
+}
+static void APIENTRY lazy_glTextureBufferRange(GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glad_glTextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC)resolve("glTextureBufferRange");
+	glad_glTextureBufferRange(texture, internalformat, buffer, offset, size);
+}
+static void APIENTRY lazy_glTextureStorage1D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width) {
+	glad_glTextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC)resolve("glTextureStorage1D");
+	glad_glTextureStorage1D(texture, levels, internalformat, width);
+}
+static void APIENTRY lazy_glTextureStorage2D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height) {
+	glad_glTextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC)resolve("glTextureStorage2D");
+	glad_glTextureStorage2D(texture, levels, internalformat, width, height);
+}
+static void APIENTRY lazy_glTextureStorage3D(GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth) {
+	glad_glTextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC)resolve("glTextureStorage3D");
+	glad_glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+}
+static void APIENTRY lazy_glTextureStorage2DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	glad_glTextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)resolve("glTextureStorage2DMultisample");
+	glad_glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+}
+static void APIENTRY lazy_glTextureStorage3DMultisample(GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	glad_glTextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)resolve("glTextureStorage3DMultisample");
+	glad_glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+static void APIENTRY lazy_glTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	glad_glTextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC)resolve("glTextureSubImage1D");
+	glad_glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+}
+static void APIENTRY lazy_glTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glad_glTextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC)resolve("glTextureSubImage2D");
+	glad_glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+static void APIENTRY lazy_glTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	glad_glTextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC)resolve("glTextureSubImage3D");
+	glad_glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+static void APIENTRY lazy_glCompressedTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)resolve("glCompressedTextureSubImage1D");
+	glad_glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)resolve("glCompressedTextureSubImage2D");
+	glad_glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+static void APIENTRY lazy_glCompressedTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	glad_glCompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)resolve("glCompressedTextureSubImage3D");
+	glad_glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+static void APIENTRY lazy_glCopyTextureSubImage1D(GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	glad_glCopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC)resolve("glCopyTextureSubImage1D");
+	glad_glCopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+}
+static void APIENTRY lazy_glCopyTextureSubImage2D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC)resolve("glCopyTextureSubImage2D");
+	glad_glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+}
+static void APIENTRY lazy_glCopyTextureSubImage3D(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glad_glCopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC)resolve("glCopyTextureSubImage3D");
+	glad_glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+static void APIENTRY lazy_glTextureParameterf(GLuint texture, GLenum pname, GLfloat param) {
+	glad_glTextureParameterf = (PFNGLTEXTUREPARAMETERFPROC)resolve("glTextureParameterf");
+	glad_glTextureParameterf(texture, pname, param);
+}
+static void APIENTRY lazy_glTextureParameterfv(GLuint texture, GLenum pname, const GLfloat *param) {
+	glad_glTextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC)resolve("glTextureParameterfv");
+	glad_glTextureParameterfv(texture, pname, param);
+}
+static void APIENTRY lazy_glTextureParameteri(GLuint texture, GLenum pname, GLint param) {
+	glad_glTextureParameteri = (PFNGLTEXTUREPARAMETERIPROC)resolve("glTextureParameteri");
+	glad_glTextureParameteri(texture, pname, param);
+}
+static void APIENTRY lazy_glTextureParameterIiv(GLuint texture, GLenum pname, const GLint *params) {
+	glad_glTextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC)resolve("glTextureParameterIiv");
+	glad_glTextureParameterIiv(texture, pname, params);
+}
+static void APIENTRY lazy_glTextureParameterIuiv(GLuint texture, GLenum pname, const GLuint *params) {
+	glad_glTextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC)resolve("glTextureParameterIuiv");
+	glad_glTextureParameterIuiv(texture, pname, params);
+}
+static void APIENTRY lazy_glTextureParameteriv(GLuint texture, GLenum pname, const GLint *param) {
+	glad_glTextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC)resolve("glTextureParameteriv");
+	glad_glTextureParameteriv(texture, pname, param);
+}
+static void APIENTRY lazy_glGenerateTextureMipmap(GLuint texture) {
+	glad_glGenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC)resolve("glGenerateTextureMipmap");
+	glad_glGenerateTextureMipmap(texture);
+}
+static void APIENTRY lazy_glBindTextureUnit(GLuint unit, GLuint texture) {
+	glad_glBindTextureUnit = (PFNGLBINDTEXTUREUNITPROC)resolve("glBindTextureUnit");
+	glad_glBindTextureUnit(unit, texture);
+}
+static void APIENTRY lazy_glGetTextureImage(GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	glad_glGetTextureImage = (PFNGLGETTEXTUREIMAGEPROC)resolve("glGetTextureImage");
+	glad_glGetTextureImage(texture, level, format, type, bufSize, pixels);
+}
+static void APIENTRY lazy_glGetCompressedTextureImage(GLuint texture, GLint level, GLsizei bufSize, void *pixels) {
+	glad_glGetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)resolve("glGetCompressedTextureImage");
+	glad_glGetCompressedTextureImage(texture, level, bufSize, pixels);
+}
+static void APIENTRY lazy_glGetTextureLevelParameterfv(GLuint texture, GLint level, GLenum pname, GLfloat *params) {
+	glad_glGetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC)resolve("glGetTextureLevelParameterfv");
+	glad_glGetTextureLevelParameterfv(texture, level, pname, params);
+}
+static void APIENTRY lazy_glGetTextureLevelParameteriv(GLuint texture, GLint level, GLenum pname, GLint *params) {
+	glad_glGetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC)resolve("glGetTextureLevelParameteriv");
+	glad_glGetTextureLevelParameteriv(texture, level, pname, params);
+}
+static void APIENTRY lazy_glGetTextureParameterfv(GLuint texture, GLenum pname, GLfloat *params) {
+	glad_glGetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC)resolve("glGetTextureParameterfv");
+	glad_glGetTextureParameterfv(texture, pname, params);
+}
+static void APIENTRY lazy_glGetTextureParameterIiv(GLuint texture, GLenum pname, GLint *params) {
+	glad_glGetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC)resolve("glGetTextureParameterIiv");
+	glad_glGetTextureParameterIiv(texture, pname, params);
+}
+static void APIENTRY lazy_glGetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint *params) {
+	glad_glGetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC)resolve("glGetTextureParameterIuiv");
+	glad_glGetTextureParameterIuiv(texture, pname, params);
+}
+static void APIENTRY lazy_glGetTextureParameteriv(GLuint texture, GLenum pname, GLint *params) {
+	glad_glGetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC)resolve("glGetTextureParameteriv");
+	glad_glGetTextureParameteriv(texture, pname, params);
+}
+static void APIENTRY lazy_glCreateVertexArrays(GLsizei n, GLuint *arrays) {
+	glad_glCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)resolve("glCreateVertexArrays");
+	glad_glCreateVertexArrays(n, arrays);
+}
+static void APIENTRY lazy_glDisableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+	glad_glDisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC)resolve("glDisableVertexArrayAttrib");
+	glad_glDisableVertexArrayAttrib(vaobj, index);
+}
+static void APIENTRY lazy_glEnableVertexArrayAttrib(GLuint vaobj, GLuint index) {
+	glad_glEnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC)resolve("glEnableVertexArrayAttrib");
+	glad_glEnableVertexArrayAttrib(vaobj, index);
+}
+static void APIENTRY lazy_glVertexArrayElementBuffer(GLuint vaobj, GLuint buffer) {
+	glad_glVertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC)resolve("glVertexArrayElementBuffer");
+	glad_glVertexArrayElementBuffer(vaobj, buffer);
+}
+static void APIENTRY lazy_glVertexArrayVertexBuffer(GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride) {
+	glad_glVertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)resolve("glVertexArrayVertexBuffer");
+	glad_glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+}
+static void APIENTRY lazy_glVertexArrayVertexBuffers(GLuint vaobj, GLuint first, GLsizei count, const GLuint *buffers, const GLintptr *offsets, const GLsizei *strides) {
+	glad_glVertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC)resolve("glVertexArrayVertexBuffers");
+	glad_glVertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+}
+static void APIENTRY lazy_glVertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, GLuint bindingindex) {
+	glad_glVertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)resolve("glVertexArrayAttribBinding");
+	glad_glVertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+}
+static void APIENTRY lazy_glVertexArrayAttribFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset) {
+	glad_glVertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC)resolve("glVertexArrayAttribFormat");
+	glad_glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+}
+static void APIENTRY lazy_glVertexArrayAttribIFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_glVertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC)resolve("glVertexArrayAttribIFormat");
+	glad_glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+static void APIENTRY lazy_glVertexArrayAttribLFormat(GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset) {
+	glad_glVertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC)resolve("glVertexArrayAttribLFormat");
+	glad_glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+static void APIENTRY lazy_glVertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex, GLuint divisor) {
+	glad_glVertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)resolve("glVertexArrayBindingDivisor");
+	glad_glVertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+}
+static void APIENTRY lazy_glGetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param) {
+	glad_glGetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC)resolve("glGetVertexArrayiv");
+	glad_glGetVertexArrayiv(vaobj, pname, param);
+}
+static void APIENTRY lazy_glGetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum pname, GLint *param) {
+	glad_glGetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC)resolve("glGetVertexArrayIndexediv");
+	glad_glGetVertexArrayIndexediv(vaobj, index, pname, param);
+}
+static void APIENTRY lazy_glGetVertexArrayIndexed64iv(GLuint vaobj, GLuint index, GLenum pname, GLint64 *param) {
+	glad_glGetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC)resolve("glGetVertexArrayIndexed64iv");
+	glad_glGetVertexArrayIndexed64iv(vaobj, index, pname, param);
+}
+static void APIENTRY lazy_glCreateSamplers(GLsizei n, GLuint *samplers) {
+	glad_glCreateSamplers = (PFNGLCREATESAMPLERSPROC)resolve("glCreateSamplers");
+	glad_glCreateSamplers(n, samplers);
+}
+static void APIENTRY lazy_glCreateProgramPipelines(GLsizei n, GLuint *pipelines) {
+	glad_glCreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC)resolve("glCreateProgramPipelines");
+	glad_glCreateProgramPipelines(n, pipelines);
+}
+static void APIENTRY lazy_glCreateQueries(GLenum target, GLsizei n, GLuint *ids) {
+	glad_glCreateQueries = (PFNGLCREATEQUERIESPROC)resolve("glCreateQueries");
+	glad_glCreateQueries(target, n, ids);
+}
+static void APIENTRY lazy_glGetQueryBufferObjecti64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	glad_glGetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC)resolve("glGetQueryBufferObjecti64v");
+	glad_glGetQueryBufferObjecti64v(id, buffer, pname, offset);
+}
+static void APIENTRY lazy_glGetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	glad_glGetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC)resolve("glGetQueryBufferObjectiv");
+	glad_glGetQueryBufferObjectiv(id, buffer, pname, offset);
+}
+static void APIENTRY lazy_glGetQueryBufferObjectui64v(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	glad_glGetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC)resolve("glGetQueryBufferObjectui64v");
+	glad_glGetQueryBufferObjectui64v(id, buffer, pname, offset);
+}
+static void APIENTRY lazy_glGetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pname, GLintptr offset) {
+	glad_glGetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC)resolve("glGetQueryBufferObjectuiv");
+	glad_glGetQueryBufferObjectuiv(id, buffer, pname, offset);
+}
+static void APIENTRY lazy_glMemoryBarrierByRegion(GLbitfield barriers) {
+	glad_glMemoryBarrierByRegion = (PFNGLMEMORYBARRIERBYREGIONPROC)resolve("glMemoryBarrierByRegion");
+	glad_glMemoryBarrierByRegion(barriers);
+}
+static void APIENTRY lazy_glGetTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	glad_glGetTextureSubImage = (PFNGLGETTEXTURESUBIMAGEPROC)resolve("glGetTextureSubImage");
+	glad_glGetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+}
+static void APIENTRY lazy_glGetCompressedTextureSubImage(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels) {
+	glad_glGetCompressedTextureSubImage = (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)resolve("glGetCompressedTextureSubImage");
+	glad_glGetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+}
+static GLenum APIENTRY lazy_glGetGraphicsResetStatus(void) {
+	glad_glGetGraphicsResetStatus = (PFNGLGETGRAPHICSRESETSTATUSPROC)resolve("glGetGraphicsResetStatus");
+	return glad_glGetGraphicsResetStatus();
+}
+static void APIENTRY lazy_glGetnCompressedTexImage(GLenum target, GLint lod, GLsizei bufSize, void *pixels) {
+	glad_glGetnCompressedTexImage = (PFNGLGETNCOMPRESSEDTEXIMAGEPROC)resolve("glGetnCompressedTexImage");
+	glad_glGetnCompressedTexImage(target, lod, bufSize, pixels);
+}
+static void APIENTRY lazy_glGetnTexImage(GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels) {
+	glad_glGetnTexImage = (PFNGLGETNTEXIMAGEPROC)resolve("glGetnTexImage");
+	glad_glGetnTexImage(target, level, format, type, bufSize, pixels);
+}
+static void APIENTRY lazy_glGetnUniformdv(GLuint program, GLint location, GLsizei bufSize, GLdouble *params) {
+	glad_glGetnUniformdv = (PFNGLGETNUNIFORMDVPROC)resolve("glGetnUniformdv");
+	glad_glGetnUniformdv(program, location, bufSize, params);
+}
+static void APIENTRY lazy_glGetnUniformfv(GLuint program, GLint location, GLsizei bufSize, GLfloat *params) {
+	glad_glGetnUniformfv = (PFNGLGETNUNIFORMFVPROC)resolve("glGetnUniformfv");
+	glad_glGetnUniformfv(program, location, bufSize, params);
+}
+static void APIENTRY lazy_glGetnUniformiv(GLuint program, GLint location, GLsizei bufSize, GLint *params) {
+	glad_glGetnUniformiv = (PFNGLGETNUNIFORMIVPROC)resolve("glGetnUniformiv");
+	glad_glGetnUniformiv(program, location, bufSize, params);
+}
+static void APIENTRY lazy_glGetnUniformuiv(GLuint program, GLint location, GLsizei bufSize, GLuint *params) {
+	glad_glGetnUniformuiv = (PFNGLGETNUNIFORMUIVPROC)resolve("glGetnUniformuiv");
+	glad_glGetnUniformuiv(program, location, bufSize, params);
+}
+static void APIENTRY lazy_glReadnPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data) {
+	glad_glReadnPixels = (PFNGLREADNPIXELSPROC)resolve("glReadnPixels");
+	glad_glReadnPixels(x, y, width, height, format, type, bufSize, data);
+}
+static void APIENTRY lazy_glGetnMapdv(GLenum target, GLenum query, GLsizei bufSize, GLdouble *v) {
+	glad_glGetnMapdv = (PFNGLGETNMAPDVPROC)resolve("glGetnMapdv");
+	glad_glGetnMapdv(target, query, bufSize, v);
+}
+static void APIENTRY lazy_glGetnMapfv(GLenum target, GLenum query, GLsizei bufSize, GLfloat *v) {
+	glad_glGetnMapfv = (PFNGLGETNMAPFVPROC)resolve("glGetnMapfv");
+	glad_glGetnMapfv(target, query, bufSize, v);
+}
+static void APIENTRY lazy_glGetnMapiv(GLenum target, GLenum query, GLsizei bufSize, GLint *v) {
+	glad_glGetnMapiv = (PFNGLGETNMAPIVPROC)resolve("glGetnMapiv");
+	glad_glGetnMapiv(target, query, bufSize, v);
+}
+static void APIENTRY lazy_glGetnPixelMapfv(GLenum map, GLsizei bufSize, GLfloat *values) {
+	glad_glGetnPixelMapfv = (PFNGLGETNPIXELMAPFVPROC)resolve("glGetnPixelMapfv");
+	glad_glGetnPixelMapfv(map, bufSize, values);
+}
+static void APIENTRY lazy_glGetnPixelMapuiv(GLenum map, GLsizei bufSize, GLuint *values) {
+	glad_glGetnPixelMapuiv = (PFNGLGETNPIXELMAPUIVPROC)resolve("glGetnPixelMapuiv");
+	glad_glGetnPixelMapuiv(map, bufSize, values);
+}
+static void APIENTRY lazy_glGetnPixelMapusv(GLenum map, GLsizei bufSize, GLushort *values) {
+	glad_glGetnPixelMapusv = (PFNGLGETNPIXELMAPUSVPROC)resolve("glGetnPixelMapusv");
+	glad_glGetnPixelMapusv(map, bufSize, values);
+}
+static void APIENTRY lazy_glGetnPolygonStipple(GLsizei bufSize, GLubyte *pattern) {
+	glad_glGetnPolygonStipple = (PFNGLGETNPOLYGONSTIPPLEPROC)resolve("glGetnPolygonStipple");
+	glad_glGetnPolygonStipple(bufSize, pattern);
+}
+static void APIENTRY lazy_glGetnColorTable(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *table) {
+	glad_glGetnColorTable = (PFNGLGETNCOLORTABLEPROC)resolve("glGetnColorTable");
+	glad_glGetnColorTable(target, format, type, bufSize, table);
+}
+static void APIENTRY lazy_glGetnConvolutionFilter(GLenum target, GLenum format, GLenum type, GLsizei bufSize, void *image) {
+	glad_glGetnConvolutionFilter = (PFNGLGETNCONVOLUTIONFILTERPROC)resolve("glGetnConvolutionFilter");
+	glad_glGetnConvolutionFilter(target, format, type, bufSize, image);
+}
+static void APIENTRY lazy_glGetnSeparableFilter(GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void *row, GLsizei columnBufSize, void *column, void *span) {
+	glad_glGetnSeparableFilter = (PFNGLGETNSEPARABLEFILTERPROC)resolve("glGetnSeparableFilter");
+	glad_glGetnSeparableFilter(target, format, type, rowBufSize, row, columnBufSize, column, span);
+}
+static void APIENTRY lazy_glGetnHistogram(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values) {
+	glad_glGetnHistogram = (PFNGLGETNHISTOGRAMPROC)resolve("glGetnHistogram");
+	glad_glGetnHistogram(target, reset, format, type, bufSize, values);
+}
+static void APIENTRY lazy_glGetnMinmax(GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void *values) {
+	glad_glGetnMinmax = (PFNGLGETNMINMAXPROC)resolve("glGetnMinmax");
+	glad_glGetnMinmax(target, reset, format, type, bufSize, values);
+}
+static void APIENTRY lazy_glTextureBarrier(void) {
+	glad_glTextureBarrier = (PFNGLTEXTUREBARRIERPROC)resolve("glTextureBarrier");
+	glad_glTextureBarrier();
+}
+static void APIENTRY lazy_glSpecializeShader(GLuint shader, const GLchar *pEntryPoint, GLuint numSpecializationConstants, const GLuint *pConstantIndex, const GLuint *pConstantValue) {
+	glad_glSpecializeShader = (PFNGLSPECIALIZESHADERPROC)resolve("glSpecializeShader");
+	glad_glSpecializeShader(shader, pEntryPoint, numSpecializationConstants, pConstantIndex, pConstantValue);
+}
+static void APIENTRY lazy_glMultiDrawArraysIndirectCount(GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+	glad_glMultiDrawArraysIndirectCount = (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC)resolve("glMultiDrawArraysIndirectCount");
+	glad_glMultiDrawArraysIndirectCount(mode, indirect, drawcount, maxdrawcount, stride);
+}
+static void APIENTRY lazy_glMultiDrawElementsIndirectCount(GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride) {
+	glad_glMultiDrawElementsIndirectCount = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC)resolve("glMultiDrawElementsIndirectCount");
+	glad_glMultiDrawElementsIndirectCount(mode, type, indirect, drawcount, maxdrawcount, stride);
+}
+static void APIENTRY lazy_glPolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat clamp) {
+	glad_glPolygonOffsetClamp = (PFNGLPOLYGONOFFSETCLAMPPROC)resolve("glPolygonOffsetClamp");
+	glad_glPolygonOffsetClamp(factor, units, clamp);
+}
+static void lazy_GL_VERSION_1_0(void) {
+	if(!GLAD_GL_VERSION_1_0) return;
+	glad_glCullFace = lazy_glCullFace;
+	glad_glFrontFace = lazy_glFrontFace;
+	glad_glHint = lazy_glHint;
+	glad_glLineWidth = lazy_glLineWidth;
+	glad_glPointSize = lazy_glPointSize;
+	glad_glPolygonMode = lazy_glPolygonMode;
+	glad_glScissor = lazy_glScissor;
+	glad_glTexParameterf = lazy_glTexParameterf;
+	glad_glTexParameterfv = lazy_glTexParameterfv;
+	glad_glTexParameteri = lazy_glTexParameteri;
+	glad_glTexParameteriv = lazy_glTexParameteriv;
+	glad_glTexImage1D = lazy_glTexImage1D;
+	glad_glTexImage2D = lazy_glTexImage2D;
+	glad_glDrawBuffer = lazy_glDrawBuffer;
+	glad_glClear = lazy_glClear;
+	glad_glClearColor = lazy_glClearColor;
+	glad_glClearStencil = lazy_glClearStencil;
+	glad_glClearDepth = lazy_glClearDepth;
+	glad_glStencilMask = lazy_glStencilMask;
+	glad_glColorMask = lazy_glColorMask;
+	glad_glDepthMask = lazy_glDepthMask;
+	glad_glDisable = lazy_glDisable;
+	glad_glEnable = lazy_glEnable;
+	glad_glFinish = lazy_glFinish;
+	glad_glFlush = lazy_glFlush;
+	glad_glBlendFunc = lazy_glBlendFunc;
+	glad_glLogicOp = lazy_glLogicOp;
+	glad_glStencilFunc = lazy_glStencilFunc;
+	glad_glStencilOp = lazy_glStencilOp;
+	glad_glDepthFunc = lazy_glDepthFunc;
+	glad_glPixelStoref = lazy_glPixelStoref;
+	glad_glPixelStorei = lazy_glPixelStorei;
+	glad_glReadBuffer = lazy_glReadBuffer;
+	glad_glReadPixels = lazy_glReadPixels;
+	glad_glGetBooleanv = lazy_glGetBooleanv;
+	glad_glGetDoublev = lazy_glGetDoublev;
+	glad_glGetError = lazy_glGetError;
+	glad_glGetFloatv = lazy_glGetFloatv;
+	glad_glGetIntegerv = lazy_glGetIntegerv;
+	glad_glGetString = lazy_glGetString;
+	glad_glGetTexImage = lazy_glGetTexImage;
+	glad_glGetTexParameterfv = lazy_glGetTexParameterfv;
+	glad_glGetTexParameteriv = lazy_glGetTexParameteriv;
+	glad_glGetTexLevelParameterfv = lazy_glGetTexLevelParameterfv;
+	glad_glGetTexLevelParameteriv = lazy_glGetTexLevelParameteriv;
+	glad_glIsEnabled = lazy_glIsEnabled;
+	glad_glDepthRange = lazy_glDepthRange;
+	glad_glViewport = lazy_glViewport;
+	glad_glNewList = lazy_glNewList;
+	glad_glEndList = lazy_glEndList;
+	glad_glCallList = lazy_glCallList;
+	glad_glCallLists = lazy_glCallLists;
+	glad_glDeleteLists = lazy_glDeleteLists;
+	glad_glGenLists = lazy_glGenLists;
+	glad_glListBase = lazy_glListBase;
+	glad_glBegin = lazy_glBegin;
+	glad_glBitmap = lazy_glBitmap;
+	glad_glColor3b = lazy_glColor3b;
+	glad_glColor3bv = lazy_glColor3bv;
+	glad_glColor3d = lazy_glColor3d;
+	glad_glColor3dv = lazy_glColor3dv;
+	glad_glColor3f = lazy_glColor3f;
+	glad_glColor3fv = lazy_glColor3fv;
+	glad_glColor3i = lazy_glColor3i;
+	glad_glColor3iv = lazy_glColor3iv;
+	glad_glColor3s = lazy_glColor3s;
+	glad_glColor3sv = lazy_glColor3sv;
+	glad_glColor3ub = lazy_glColor3ub;
+	glad_glColor3ubv = lazy_glColor3ubv;
+	glad_glColor3ui = lazy_glColor3ui;
+	glad_glColor3uiv = lazy_glColor3uiv;
+	glad_glColor3us = lazy_glColor3us;
+	glad_glColor3usv = lazy_glColor3usv;
+	glad_glColor4b = lazy_glColor4b;
+	glad_glColor4bv = lazy_glColor4bv;
+	glad_glColor4d = lazy_glColor4d;
+	glad_glColor4dv = lazy_glColor4dv;
+	glad_glColor4f = lazy_glColor4f;
+	glad_glColor4fv = lazy_glColor4fv;
+	glad_glColor4i = lazy_glColor4i;
+	glad_glColor4iv = lazy_glColor4iv;
+	glad_glColor4s = lazy_glColor4s;
+	glad_glColor4sv = lazy_glColor4sv;
+	glad_glColor4ub = lazy_glColor4ub;
+	glad_glColor4ubv = lazy_glColor4ubv;
+	glad_glColor4ui = lazy_glColor4ui;
+	glad_glColor4uiv = lazy_glColor4uiv;
+	glad_glColor4us = lazy_glColor4us;
+	glad_glColor4usv = lazy_glColor4usv;
+	glad_glEdgeFlag = lazy_glEdgeFlag;
+	glad_glEdgeFlagv = lazy_glEdgeFlagv;
+	glad_glEnd = lazy_glEnd;
+	glad_glIndexd = lazy_glIndexd;
+	glad_glIndexdv = lazy_glIndexdv;
+	glad_glIndexf = lazy_glIndexf;
+	glad_glIndexfv = lazy_glIndexfv;
+	glad_glIndexi = lazy_glIndexi;
+	glad_glIndexiv = lazy_glIndexiv;
+	glad_glIndexs = lazy_glIndexs;
+	glad_glIndexsv = lazy_glIndexsv;
+	glad_glNormal3b = lazy_glNormal3b;
+	glad_glNormal3bv = lazy_glNormal3bv;
+	glad_glNormal3d = lazy_glNormal3d;
+	glad_glNormal3dv = lazy_glNormal3dv;
+	glad_glNormal3f = lazy_glNormal3f;
+	glad_glNormal3fv = lazy_glNormal3fv;
+	glad_glNormal3i = lazy_glNormal3i;
+	glad_glNormal3iv = lazy_glNormal3iv;
+	glad_glNormal3s = lazy_glNormal3s;
+	glad_glNormal3sv = lazy_glNormal3sv;
+	glad_glRasterPos2d = lazy_glRasterPos2d;
+	glad_glRasterPos2dv = lazy_glRasterPos2dv;
+	glad_glRasterPos2f = lazy_glRasterPos2f;
+	glad_glRasterPos2fv = lazy_glRasterPos2fv;
+	glad_glRasterPos2i = lazy_glRasterPos2i;
+	glad_glRasterPos2iv = lazy_glRasterPos2iv;
+	glad_glRasterPos2s = lazy_glRasterPos2s;
+	glad_glRasterPos2sv = lazy_glRasterPos2sv;
+	glad_glRasterPos3d = lazy_glRasterPos3d;
+	glad_glRasterPos3dv = lazy_glRasterPos3dv;
+	glad_glRasterPos3f = lazy_glRasterPos3f;
+	glad_glRasterPos3fv = lazy_glRasterPos3fv;
+	glad_glRasterPos3i = lazy_glRasterPos3i;
+	glad_glRasterPos3iv = lazy_glRasterPos3iv;
+	glad_glRasterPos3s = lazy_glRasterPos3s;
+	glad_glRasterPos3sv = lazy_glRasterPos3sv;
+	glad_glRasterPos4d = lazy_glRasterPos4d;
+	glad_glRasterPos4dv = lazy_glRasterPos4dv;
+	glad_glRasterPos4f = lazy_glRasterPos4f;
+	glad_glRasterPos4fv = lazy_glRasterPos4fv;
+	glad_glRasterPos4i = lazy_glRasterPos4i;
+	glad_glRasterPos4iv = lazy_glRasterPos4iv;
+	glad_glRasterPos4s = lazy_glRasterPos4s;
+	glad_glRasterPos4sv = lazy_glRasterPos4sv;
+	glad_glRectd = lazy_glRectd;
+	glad_glRectdv = lazy_glRectdv;
+	glad_glRectf = lazy_glRectf;
+	glad_glRectfv = lazy_glRectfv;
+	glad_glRecti = lazy_glRecti;
+	glad_glRectiv = lazy_glRectiv;
+	glad_glRects = lazy_glRects;
+	glad_glRectsv = lazy_glRectsv;
+	glad_glTexCoord1d = lazy_glTexCoord1d;
+	glad_glTexCoord1dv = lazy_glTexCoord1dv;
+	glad_glTexCoord1f = lazy_glTexCoord1f;
+	glad_glTexCoord1fv = lazy_glTexCoord1fv;
+	glad_glTexCoord1i = lazy_glTexCoord1i;
+	glad_glTexCoord1iv = lazy_glTexCoord1iv;
+	glad_glTexCoord1s = lazy_glTexCoord1s;
+	glad_glTexCoord1sv = lazy_glTexCoord1sv;
+	glad_glTexCoord2d = lazy_glTexCoord2d;
+	glad_glTexCoord2dv = lazy_glTexCoord2dv;
+	glad_glTexCoord2f = lazy_glTexCoord2f;
+	glad_glTexCoord2fv = lazy_glTexCoord2fv;
+	glad_glTexCoord2i = lazy_glTexCoord2i;
+	glad_glTexCoord2iv = lazy_glTexCoord2iv;
+	glad_glTexCoord2s = lazy_glTexCoord2s;
+	glad_glTexCoord2sv = lazy_glTexCoord2sv;
+	glad_glTexCoord3d = lazy_glTexCoord3d;
+	glad_glTexCoord3dv = lazy_glTexCoord3dv;
+	glad_glTexCoord3f = lazy_glTexCoord3f;
+	glad_glTexCoord3fv = lazy_glTexCoord3fv;
+	glad_glTexCoord3i = lazy_glTexCoord3i;
+	glad_glTexCoord3iv = lazy_glTexCoord3iv;
+	glad_glTexCoord3s = lazy_glTexCoord3s;
+	glad_glTexCoord3sv = lazy_glTexCoord3sv;
+	glad_glTexCoord4d = lazy_glTexCoord4d;
+	glad_glTexCoord4dv = lazy_glTexCoord4dv;
+	glad_glTexCoord4f = lazy_glTexCoord4f;
+	glad_glTexCoord4fv = lazy_glTexCoord4fv;
+	glad_glTexCoord4i = lazy_glTexCoord4i;
+	glad_glTexCoord4iv = lazy_glTexCoord4iv;
+	glad_glTexCoord4s = lazy_glTexCoord4s;
+	glad_glTexCoord4sv = lazy_glTexCoord4sv;
+	glad_glVertex2d = lazy_glVertex2d;
+	glad_glVertex2dv = lazy_glVertex2dv;
+	glad_glVertex2f = lazy_glVertex2f;
+	glad_glVertex2fv = lazy_glVertex2fv;
+	glad_glVertex2i = lazy_glVertex2i;
+	glad_glVertex2iv = lazy_glVertex2iv;
+	glad_glVertex2s = lazy_glVertex2s;
+	glad_glVertex2sv = lazy_glVertex2sv;
+	glad_glVertex3d = lazy_glVertex3d;
+	glad_glVertex3dv = lazy_glVertex3dv;
+	glad_glVertex3f = lazy_glVertex3f;
+	glad_glVertex3fv = lazy_glVertex3fv;
+	glad_glVertex3i = lazy_glVertex3i;
+	glad_glVertex3iv = lazy_glVertex3iv;
+	glad_glVertex3s = lazy_glVertex3s;
+	glad_glVertex3sv = lazy_glVertex3sv;
+	glad_glVertex4d = lazy_glVertex4d;
+	glad_glVertex4dv = lazy_glVertex4dv;
+	glad_glVertex4f = lazy_glVertex4f;
+	glad_glVertex4fv = lazy_glVertex4fv;
+	glad_glVertex4i = lazy_glVertex4i;
+	glad_glVertex4iv = lazy_glVertex4iv;
+	glad_glVertex4s = lazy_glVertex4s;
+	glad_glVertex4sv = lazy_glVertex4sv;
+	glad_glClipPlane = lazy_glClipPlane;
+	glad_glColorMaterial = lazy_glColorMaterial;
+	glad_glFogf = lazy_glFogf;
+	glad_glFogfv = lazy_glFogfv;
+	glad_glFogi = lazy_glFogi;
+	glad_glFogiv = lazy_glFogiv;
+	glad_glLightf = lazy_glLightf;
+	glad_glLightfv = lazy_glLightfv;
+	glad_glLighti = lazy_glLighti;
+	glad_glLightiv = lazy_glLightiv;
+	glad_glLightModelf = lazy_glLightModelf;
+	glad_glLightModelfv = lazy_glLightModelfv;
+	glad_glLightModeli = lazy_glLightModeli;
+	glad_glLightModeliv = lazy_glLightModeliv;
+	glad_glLineStipple = lazy_glLineStipple;
+	glad_glMaterialf = lazy_glMaterialf;
+	glad_glMaterialfv = lazy_glMaterialfv;
+	glad_glMateriali = lazy_glMateriali;
+	glad_glMaterialiv = lazy_glMaterialiv;
+	glad_glPolygonStipple = lazy_glPolygonStipple;
+	glad_glShadeModel = lazy_glShadeModel;
+	glad_glTexEnvf = lazy_glTexEnvf;
+	glad_glTexEnvfv = lazy_glTexEnvfv;
+	glad_glTexEnvi = lazy_glTexEnvi;
+	glad_glTexEnviv = lazy_glTexEnviv;
+	glad_glTexGend = lazy_glTexGend;
+	glad_glTexGendv = lazy_glTexGendv;
+	glad_glTexGenf = lazy_glTexGenf;
+	glad_glTexGenfv = lazy_glTexGenfv;
+	glad_glTexGeni = lazy_glTexGeni;
+	glad_glTexGeniv = lazy_glTexGeniv;
+	glad_glFeedbackBuffer = lazy_glFeedbackBuffer;
+	glad_glSelectBuffer = lazy_glSelectBuffer;
+	glad_glRenderMode = lazy_glRenderMode;
+	glad_glInitNames = lazy_glInitNames;
+	glad_glLoadName = lazy_glLoadName;
+	glad_glPassThrough = lazy_glPassThrough;
+	glad_glPopName = lazy_glPopName;
+	glad_glPushName = lazy_glPushName;
+	glad_glClearAccum = lazy_glClearAccum;
+	glad_glClearIndex = lazy_glClearIndex;
+	glad_glIndexMask = lazy_glIndexMask;
+	glad_glAccum = lazy_glAccum;
+	glad_glPopAttrib = lazy_glPopAttrib;
+	glad_glPushAttrib = lazy_glPushAttrib;
+	glad_glMap1d = lazy_glMap1d;
+	glad_glMap1f = lazy_glMap1f;
+	glad_glMap2d = lazy_glMap2d;
+	glad_glMap2f = lazy_glMap2f;
+	glad_glMapGrid1d = lazy_glMapGrid1d;
+	glad_glMapGrid1f = lazy_glMapGrid1f;
+	glad_glMapGrid2d = lazy_glMapGrid2d;
+	glad_glMapGrid2f = lazy_glMapGrid2f;
+	glad_glEvalCoord1d = lazy_glEvalCoord1d;
+	glad_glEvalCoord1dv = lazy_glEvalCoord1dv;
+	glad_glEvalCoord1f = lazy_glEvalCoord1f;
+	glad_glEvalCoord1fv = lazy_glEvalCoord1fv;
+	glad_glEvalCoord2d = lazy_glEvalCoord2d;
+	glad_glEvalCoord2dv = lazy_glEvalCoord2dv;
+	glad_glEvalCoord2f = lazy_glEvalCoord2f;
+	glad_glEvalCoord2fv = lazy_glEvalCoord2fv;
+	glad_glEvalMesh1 = lazy_glEvalMesh1;
+	glad_glEvalPoint1 = lazy_glEvalPoint1;
+	glad_glEvalMesh2 = lazy_glEvalMesh2;
+	glad_glEvalPoint2 = lazy_glEvalPoint2;
+	glad_glAlphaFunc = lazy_glAlphaFunc;
+	glad_glPixelZoom = lazy_glPixelZoom;
+	glad_glPixelTransferf = lazy_glPixelTransferf;
+	glad_glPixelTransferi = lazy_glPixelTransferi;
+	glad_glPixelMapfv = lazy_glPixelMapfv;
+	glad_glPixelMapuiv = lazy_glPixelMapuiv;
+	glad_glPixelMapusv = lazy_glPixelMapusv;
+	glad_glCopyPixels = lazy_glCopyPixels;
+	glad_glDrawPixels = lazy_glDrawPixels;
+	glad_glGetClipPlane = lazy_glGetClipPlane;
+	glad_glGetLightfv = lazy_glGetLightfv;
+	glad_glGetLightiv = lazy_glGetLightiv;
+	glad_glGetMapdv = lazy_glGetMapdv;
+	glad_glGetMapfv = lazy_glGetMapfv;
+	glad_glGetMapiv = lazy_glGetMapiv;
+	glad_glGetMaterialfv = lazy_glGetMaterialfv;
+	glad_glGetMaterialiv = lazy_glGetMaterialiv;
+	glad_glGetPixelMapfv = lazy_glGetPixelMapfv;
+	glad_glGetPixelMapuiv = lazy_glGetPixelMapuiv;
+	glad_glGetPixelMapusv = lazy_glGetPixelMapusv;
+	glad_glGetPolygonStipple = lazy_glGetPolygonStipple;
+	glad_glGetTexEnvfv = lazy_glGetTexEnvfv;
+	glad_glGetTexEnviv = lazy_glGetTexEnviv;
+	glad_glGetTexGendv = lazy_glGetTexGendv;
+	glad_glGetTexGenfv = lazy_glGetTexGenfv;
+	glad_glGetTexGeniv = lazy_glGetTexGeniv;
+	glad_glIsList = lazy_glIsList;
+	glad_glFrustum = lazy_glFrustum;
+	glad_glLoadIdentity = lazy_glLoadIdentity;
+	glad_glLoadMatrixf = lazy_glLoadMatrixf;
+	glad_glLoadMatrixd = lazy_glLoadMatrixd;
+	glad_glMatrixMode = lazy_glMatrixMode;
+	glad_glMultMatrixf = lazy_glMultMatrixf;
+	glad_glMultMatrixd = lazy_glMultMatrixd;
+	glad_glOrtho = lazy_glOrtho;
+	glad_glPopMatrix = lazy_glPopMatrix;
+	glad_glPushMatrix = lazy_glPushMatrix;
+	glad_glRotated = lazy_glRotated;
+	glad_glRotatef = lazy_glRotatef;
+	glad_glScaled = lazy_glScaled;
+	glad_glScalef = lazy_glScalef;
+	glad_glTranslated = lazy_glTranslated;
+	glad_glTranslatef = lazy_glTranslatef;
+}
+static void lazy_GL_VERSION_1_1(void) {
+	if(!GLAD_GL_VERSION_1_1) return;
+	glad_glDrawArrays = lazy_glDrawArrays;
+	glad_glDrawElements = lazy_glDrawElements;
+	glad_glGetPointerv = lazy_glGetPointerv;
+	glad_glPolygonOffset = lazy_glPolygonOffset;
+	glad_glCopyTexImage1D = lazy_glCopyTexImage1D;
+	glad_glCopyTexImage2D = lazy_glCopyTexImage2D;
+	glad_glCopyTexSubImage1D = lazy_glCopyTexSubImage1D;
+	glad_glCopyTexSubImage2D = lazy_glCopyTexSubImage2D;
+	glad_glTexSubImage1D = lazy_glTexSubImage1D;
+	glad_glTexSubImage2D = lazy_glTexSubImage2D;
+	glad_glBindTexture = lazy_glBindTexture;
+	glad_glDeleteTextures = lazy_glDeleteTextures;
+	glad_glGenTextures = lazy_glGenTextures;
+	glad_glIsTexture = lazy_glIsTexture;
+	glad_glArrayElement = lazy_glArrayElement;
+	glad_glColorPointer = lazy_glColorPointer;
+	glad_glDisableClientState = lazy_glDisableClientState;
+	glad_glEdgeFlagPointer = lazy_glEdgeFlagPointer;
+	glad_glEnableClientState = lazy_glEnableClientState;
+	glad_glIndexPointer = lazy_glIndexPointer;
+	glad_glInterleavedArrays = lazy_glInterleavedArrays;
+	glad_glNormalPointer = lazy_glNormalPointer;
+	glad_glTexCoordPointer = lazy_glTexCoordPointer;
+	glad_glVertexPointer = lazy_glVertexPointer;
+	glad_glAreTexturesResident = lazy_glAreTexturesResident;
+	glad_glPrioritizeTextures = lazy_glPrioritizeTextures;
+	glad_glIndexub = lazy_glIndexub;
+	glad_glIndexubv = lazy_glIndexubv;
+	glad_glPopClientAttrib = lazy_glPopClientAttrib;
+	glad_glPushClientAttrib = lazy_glPushClientAttrib;
+}
+static void lazy_GL_VERSION_1_2(void) {
+	if(!GLAD_GL_VERSION_1_2) return;
+	glad_glDrawRangeElements = lazy_glDrawRangeElements;
+	glad_glTexImage3D = lazy_glTexImage3D;
+	glad_glTexSubImage3D = lazy_glTexSubImage3D;
+	glad_glCopyTexSubImage3D = lazy_glCopyTexSubImage3D;
+}
+static void lazy_GL_VERSION_1_3(void) {
+	if(!GLAD_GL_VERSION_1_3) return;
+	glad_glActiveTexture = lazy_glActiveTexture;
+	glad_glSampleCoverage = lazy_glSampleCoverage;
+	glad_glCompressedTexImage3D = lazy_glCompressedTexImage3D;
+	glad_glCompressedTexImage2D = lazy_glCompressedTexImage2D;
+	glad_glCompressedTexImage1D = lazy_glCompressedTexImage1D;
+	glad_glCompressedTexSubImage3D = lazy_glCompressedTexSubImage3D;
+	glad_glCompressedTexSubImage2D = lazy_glCompressedTexSubImage2D;
+	glad_glCompressedTexSubImage1D = lazy_glCompressedTexSubImage1D;
+	glad_glGetCompressedTexImage = lazy_glGetCompressedTexImage;
+	glad_glClientActiveTexture = lazy_glClientActiveTexture;
+	glad_glMultiTexCoord1d = lazy_glMultiTexCoord1d;
+	glad_glMultiTexCoord1dv = lazy_glMultiTexCoord1dv;
+	glad_glMultiTexCoord1f = lazy_glMultiTexCoord1f;
+	glad_glMultiTexCoord1fv = lazy_glMultiTexCoord1fv;
+	glad_glMultiTexCoord1i = lazy_glMultiTexCoord1i;
+	glad_glMultiTexCoord1iv = lazy_glMultiTexCoord1iv;
+	glad_glMultiTexCoord1s = lazy_glMultiTexCoord1s;
+	glad_glMultiTexCoord1sv = lazy_glMultiTexCoord1sv;
+	glad_glMultiTexCoord2d = lazy_glMultiTexCoord2d;
+	glad_glMultiTexCoord2dv = lazy_glMultiTexCoord2dv;
+	glad_glMultiTexCoord2f = lazy_glMultiTexCoord2f;
+	glad_glMultiTexCoord2fv = lazy_glMultiTexCoord2fv;
+	glad_glMultiTexCoord2i = lazy_glMultiTexCoord2i;
+	glad_glMultiTexCoord2iv = lazy_glMultiTexCoord2iv;
+	glad_glMultiTexCoord2s = lazy_glMultiTexCoord2s;
+	glad_glMultiTexCoord2sv = lazy_glMultiTexCoord2sv;
+	glad_glMultiTexCoord3d = lazy_glMultiTexCoord3d;
+	glad_glMultiTexCoord3dv = lazy_glMultiTexCoord3dv;
+	glad_glMultiTexCoord3f = lazy_glMultiTexCoord3f;
+	glad_glMultiTexCoord3fv = lazy_glMultiTexCoord3fv;
+	glad_glMultiTexCoord3i = lazy_glMultiTexCoord3i;
+	glad_glMultiTexCoord3iv = lazy_glMultiTexCoord3iv;
+	glad_glMultiTexCoord3s = lazy_glMultiTexCoord3s;
+	glad_glMultiTexCoord3sv = lazy_glMultiTexCoord3sv;
+	glad_glMultiTexCoord4d = lazy_glMultiTexCoord4d;
+	glad_glMultiTexCoord4dv = lazy_glMultiTexCoord4dv;
+	glad_glMultiTexCoord4f = lazy_glMultiTexCoord4f;
+	glad_glMultiTexCoord4fv = lazy_glMultiTexCoord4fv;
+	glad_glMultiTexCoord4i = lazy_glMultiTexCoord4i;
+	glad_glMultiTexCoord4iv = lazy_glMultiTexCoord4iv;
+	glad_glMultiTexCoord4s = lazy_glMultiTexCoord4s;
+	glad_glMultiTexCoord4sv = lazy_glMultiTexCoord4sv;
+	glad_glLoadTransposeMatrixf = lazy_glLoadTransposeMatrixf;
+	glad_glLoadTransposeMatrixd = lazy_glLoadTransposeMatrixd;
+	glad_glMultTransposeMatrixf = lazy_glMultTransposeMatrixf;
+	glad_glMultTransposeMatrixd = lazy_glMultTransposeMatrixd;
+}
+static void lazy_GL_VERSION_1_4(void) {
+	if(!GLAD_GL_VERSION_1_4) return;
+	glad_glBlendFuncSeparate = lazy_glBlendFuncSeparate;
+	glad_glMultiDrawArrays = lazy_glMultiDrawArrays;
+	glad_glMultiDrawElements = lazy_glMultiDrawElements;
+	glad_glPointParameterf = lazy_glPointParameterf;
+	glad_glPointParameterfv = lazy_glPointParameterfv;
+	glad_glPointParameteri = lazy_glPointParameteri;
+	glad_glPointParameteriv = lazy_glPointParameteriv;
+	glad_glFogCoordf = lazy_glFogCoordf;
+	glad_glFogCoordfv = lazy_glFogCoordfv;
+	glad_glFogCoordd = lazy_glFogCoordd;
+	glad_glFogCoorddv = lazy_glFogCoorddv;
+	glad_glFogCoordPointer = lazy_glFogCoordPointer;
+	glad_glSecondaryColor3b = lazy_glSecondaryColor3b;
+	glad_glSecondaryColor3bv = lazy_glSecondaryColor3bv;
+	glad_glSecondaryColor3d = lazy_glSecondaryColor3d;
+	glad_glSecondaryColor3dv = lazy_glSecondaryColor3dv;
+	glad_glSecondaryColor3f = lazy_glSecondaryColor3f;
+	glad_glSecondaryColor3fv = lazy_glSecondaryColor3fv;
+	glad_glSecondaryColor3i = lazy_glSecondaryColor3i;
+	glad_glSecondaryColor3iv = lazy_glSecondaryColor3iv;
+	glad_glSecondaryColor3s = lazy_glSecondaryColor3s;
+	glad_glSecondaryColor3sv = lazy_glSecondaryColor3sv;
+	glad_glSecondaryColor3ub = lazy_glSecondaryColor3ub;
+	glad_glSecondaryColor3ubv = lazy_glSecondaryColor3ubv;
+	glad_glSecondaryColor3ui = lazy_glSecondaryColor3ui;
+	glad_glSecondaryColor3uiv = lazy_glSecondaryColor3uiv;
+	glad_glSecondaryColor3us = lazy_glSecondaryColor3us;
+	glad_glSecondaryColor3usv = lazy_glSecondaryColor3usv;
+	glad_glSecondaryColorPointer = lazy_glSecondaryColorPointer;
+	glad_glWindowPos2d = lazy_glWindowPos2d;
+	glad_glWindowPos2dv = lazy_glWindowPos2dv;
+	glad_glWindowPos2f = lazy_glWindowPos2f;
+	glad_glWindowPos2fv = lazy_glWindowPos2fv;
+	glad_glWindowPos2i = lazy_glWindowPos2i;
+	glad_glWindowPos2iv = lazy_glWindowPos2iv;
+	glad_glWindowPos2s = lazy_glWindowPos2s;
+	glad_glWindowPos2sv = lazy_glWindowPos2sv;
+	glad_glWindowPos3d = lazy_glWindowPos3d;
+	glad_glWindowPos3dv = lazy_glWindowPos3dv;
+	glad_glWindowPos3f = lazy_glWindowPos3f;
+	glad_glWindowPos3fv = lazy_glWindowPos3fv;
+	glad_glWindowPos3i = lazy_glWindowPos3i;
+	glad_glWindowPos3iv = lazy_glWindowPos3iv;
+	glad_glWindowPos3s = lazy_glWindowPos3s;
+	glad_glWindowPos3sv = lazy_glWindowPos3sv;
+	glad_glBlendColor = lazy_glBlendColor;
+	glad_glBlendEquation = lazy_glBlendEquation;
+}
+static void lazy_GL_VERSION_1_5(void) {
+	if(!GLAD_GL_VERSION_1_5) return;
+	glad_glGenQueries = lazy_glGenQueries;
+	glad_glDeleteQueries = lazy_glDeleteQueries;
+	glad_glIsQuery = lazy_glIsQuery;
+	glad_glBeginQuery = lazy_glBeginQuery;
+	glad_glEndQuery = lazy_glEndQuery;
+	glad_glGetQueryiv = lazy_glGetQueryiv;
+	glad_glGetQueryObjectiv = lazy_glGetQueryObjectiv;
+	glad_glGetQueryObjectuiv = lazy_glGetQueryObjectuiv;
+	glad_glBindBuffer = lazy_glBindBuffer;
+	glad_glDeleteBuffers = lazy_glDeleteBuffers;
+	glad_glGenBuffers = lazy_glGenBuffers;
+	glad_glIsBuffer = lazy_glIsBuffer;
+	glad_glBufferData = lazy_glBufferData;
+	glad_glBufferSubData = lazy_glBufferSubData;
+	glad_glGetBufferSubData = lazy_glGetBufferSubData;
+	glad_glMapBuffer = lazy_glMapBuffer;
+	glad_glUnmapBuffer = lazy_glUnmapBuffer;
+	glad_glGetBufferParameteriv = lazy_glGetBufferParameteriv;
+	glad_glGetBufferPointerv = lazy_glGetBufferPointerv;
+}
+static void lazy_GL_VERSION_2_0(void) {
+	if(!GLAD_GL_VERSION_2_0) return;
+	glad_glBlendEquationSeparate = lazy_glBlendEquationSeparate;
+	glad_glDrawBuffers = lazy_glDrawBuffers;
+	glad_glStencilOpSeparate = lazy_glStencilOpSeparate;
+	glad_glStencilFuncSeparate = lazy_glStencilFuncSeparate;
+	glad_glStencilMaskSeparate = lazy_glStencilMaskSeparate;
+	glad_glAttachShader = lazy_glAttachShader;
+	glad_glBindAttribLocation = lazy_glBindAttribLocation;
+	glad_glCompileShader = lazy_glCompileShader;
+	glad_glCreateProgram = lazy_glCreateProgram;
+	glad_glCreateShader = lazy_glCreateShader;
+	glad_glDeleteProgram = lazy_glDeleteProgram;
+	glad_glDeleteShader = lazy_glDeleteShader;
+	glad_glDetachShader = lazy_glDetachShader;
+	glad_glDisableVertexAttribArray = lazy_glDisableVertexAttribArray;
+	glad_glEnableVertexAttribArray = lazy_glEnableVertexAttribArray;
+	glad_glGetActiveAttrib = lazy_glGetActiveAttrib;
+	glad_glGetActiveUniform = lazy_glGetActiveUniform;
+	glad_glGetAttachedShaders = lazy_glGetAttachedShaders;
+	glad_glGetAttribLocation = lazy_glGetAttribLocation;
+	glad_glGetProgramiv = lazy_glGetProgramiv;
+	glad_glGetProgramInfoLog = lazy_glGetProgramInfoLog;
+	glad_glGetShaderiv = lazy_glGetShaderiv;
+	glad_glGetShaderInfoLog = lazy_glGetShaderInfoLog;
+	glad_glGetShaderSource = lazy_glGetShaderSource;
+	glad_glGetUniformLocation = lazy_glGetUniformLocation;
+	glad_glGetUniformfv = lazy_glGetUniformfv;
+	glad_glGetUniformiv = lazy_glGetUniformiv;
+	glad_glGetVertexAttribdv = lazy_glGetVertexAttribdv;
+	glad_glGetVertexAttribfv = lazy_glGetVertexAttribfv;
+	glad_glGetVertexAttribiv = lazy_glGetVertexAttribiv;
+	glad_glGetVertexAttribPointerv = lazy_glGetVertexAttribPointerv;
+	glad_glIsProgram = lazy_glIsProgram;
+	glad_glIsShader = lazy_glIsShader;
+	glad_glLinkProgram = lazy_glLinkProgram;
+	glad_glShaderSource = lazy_glShaderSource;
+	glad_glUseProgram = lazy_glUseProgram;
+	glad_glUniform1f = lazy_glUniform1f;
+	glad_glUniform2f = lazy_glUniform2f;
+	glad_glUniform3f = lazy_glUniform3f;
+	glad_glUniform4f = lazy_glUniform4f;
+	glad_glUniform1i = lazy_glUniform1i;
+	glad_glUniform2i = lazy_glUniform2i;
+	glad_glUniform3i = lazy_glUniform3i;
+	glad_glUniform4i = lazy_glUniform4i;
+	glad_glUniform1fv = lazy_glUniform1fv;
+	glad_glUniform2fv = lazy_glUniform2fv;
+	glad_glUniform3fv = lazy_glUniform3fv;
+	glad_glUniform4fv = lazy_glUniform4fv;
+	glad_glUniform1iv = lazy_glUniform1iv;
+	glad_glUniform2iv = lazy_glUniform2iv;
+	glad_glUniform3iv = lazy_glUniform3iv;
+	glad_glUniform4iv = lazy_glUniform4iv;
+	glad_glUniformMatrix2fv = lazy_glUniformMatrix2fv;
+	glad_glUniformMatrix3fv = lazy_glUniformMatrix3fv;
+	glad_glUniformMatrix4fv = lazy_glUniformMatrix4fv;
+	glad_glValidateProgram = lazy_glValidateProgram;
+	glad_glVertexAttrib1d = lazy_glVertexAttrib1d;
+	glad_glVertexAttrib1dv = lazy_glVertexAttrib1dv;
+	glad_glVertexAttrib1f = lazy_glVertexAttrib1f;
+	glad_glVertexAttrib1fv = lazy_glVertexAttrib1fv;
+	glad_glVertexAttrib1s = lazy_glVertexAttrib1s;
+	glad_glVertexAttrib1sv = lazy_glVertexAttrib1sv;
+	glad_glVertexAttrib2d = lazy_glVertexAttrib2d;
+	glad_glVertexAttrib2dv = lazy_glVertexAttrib2dv;
+	glad_glVertexAttrib2f = lazy_glVertexAttrib2f;
+	glad_glVertexAttrib2fv = lazy_glVertexAttrib2fv;
+	glad_glVertexAttrib2s = lazy_glVertexAttrib2s;
+	glad_glVertexAttrib2sv = lazy_glVertexAttrib2sv;
+	glad_glVertexAttrib3d = lazy_glVertexAttrib3d;
+	glad_glVertexAttrib3dv = lazy_glVertexAttrib3dv;
+	glad_glVertexAttrib3f = lazy_glVertexAttrib3f;
+	glad_glVertexAttrib3fv = lazy_glVertexAttrib3fv;
+	glad_glVertexAttrib3s = lazy_glVertexAttrib3s;
+	glad_glVertexAttrib3sv = lazy_glVertexAttrib3sv;
+	glad_glVertexAttrib4Nbv = lazy_glVertexAttrib4Nbv;
+	glad_glVertexAttrib4Niv = lazy_glVertexAttrib4Niv;
+	glad_glVertexAttrib4Nsv = lazy_glVertexAttrib4Nsv;
+	glad_glVertexAttrib4Nub = lazy_glVertexAttrib4Nub;
+	glad_glVertexAttrib4Nubv = lazy_glVertexAttrib4Nubv;
+	glad_glVertexAttrib4Nuiv = lazy_glVertexAttrib4Nuiv;
+	glad_glVertexAttrib4Nusv = lazy_glVertexAttrib4Nusv;
+	glad_glVertexAttrib4bv = lazy_glVertexAttrib4bv;
+	glad_glVertexAttrib4d = lazy_glVertexAttrib4d;
+	glad_glVertexAttrib4dv = lazy_glVertexAttrib4dv;
+	glad_glVertexAttrib4f = lazy_glVertexAttrib4f;
+	glad_glVertexAttrib4fv = lazy_glVertexAttrib4fv;
+	glad_glVertexAttrib4iv = lazy_glVertexAttrib4iv;
+	glad_glVertexAttrib4s = lazy_glVertexAttrib4s;
+	glad_glVertexAttrib4sv = lazy_glVertexAttrib4sv;
+	glad_glVertexAttrib4ubv = lazy_glVertexAttrib4ubv;
+	glad_glVertexAttrib4uiv = lazy_glVertexAttrib4uiv;
+	glad_glVertexAttrib4usv = lazy_glVertexAttrib4usv;
+	glad_glVertexAttribPointer = lazy_glVertexAttribPointer;
+}
+static void lazy_GL_VERSION_2_1(void) {
+	if(!GLAD_GL_VERSION_2_1) return;
+	glad_glUniformMatrix2x3fv = lazy_glUniformMatrix2x3fv;
+	glad_glUniformMatrix3x2fv = lazy_glUniformMatrix3x2fv;
+	glad_glUniformMatrix2x4fv = lazy_glUniformMatrix2x4fv;
+	glad_glUniformMatrix4x2fv = lazy_glUniformMatrix4x2fv;
+	glad_glUniformMatrix3x4fv = lazy_glUniformMatrix3x4fv;
+	glad_glUniformMatrix4x3fv = lazy_glUniformMatrix4x3fv;
+}
+static void lazy_GL_VERSION_3_0(void) {
+	if(!GLAD_GL_VERSION_3_0) return;
+	glad_glColorMaski = lazy_glColorMaski;
+	glad_glGetBooleani_v = lazy_glGetBooleani_v;
+	glad_glGetIntegeri_v = lazy_glGetIntegeri_v;
+	glad_glEnablei = lazy_glEnablei;
+	glad_glDisablei = lazy_glDisablei;
+	glad_glIsEnabledi = lazy_glIsEnabledi;
+	glad_glBeginTransformFeedback = lazy_glBeginTransformFeedback;
+	glad_glEndTransformFeedback = lazy_glEndTransformFeedback;
+	glad_glBindBufferRange = lazy_glBindBufferRange;
+	glad_glBindBufferBase = lazy_glBindBufferBase;
+	glad_glTransformFeedbackVaryings = lazy_glTransformFeedbackVaryings;
+	glad_glGetTransformFeedbackVarying = lazy_glGetTransformFeedbackVarying;
+	glad_glClampColor = lazy_glClampColor;
+	glad_glBeginConditionalRender = lazy_glBeginConditionalRender;
+	glad_glEndConditionalRender = lazy_glEndConditionalRender;
+	glad_glVertexAttribIPointer = lazy_glVertexAttribIPointer;
+	glad_glGetVertexAttribIiv = lazy_glGetVertexAttribIiv;
+	glad_glGetVertexAttribIuiv = lazy_glGetVertexAttribIuiv;
+	glad_glVertexAttribI1i = lazy_glVertexAttribI1i;
+	glad_glVertexAttribI2i = lazy_glVertexAttribI2i;
+	glad_glVertexAttribI3i = lazy_glVertexAttribI3i;
+	glad_glVertexAttribI4i = lazy_glVertexAttribI4i;
+	glad_glVertexAttribI1ui = lazy_glVertexAttribI1ui;
+	glad_glVertexAttribI2ui = lazy_glVertexAttribI2ui;
+	glad_glVertexAttribI3ui = lazy_glVertexAttribI3ui;
+	glad_glVertexAttribI4ui = lazy_glVertexAttribI4ui;
+	glad_glVertexAttribI1iv = lazy_glVertexAttribI1iv;
+	glad_glVertexAttribI2iv = lazy_glVertexAttribI2iv;
+	glad_glVertexAttribI3iv = lazy_glVertexAttribI3iv;
+	glad_glVertexAttribI4iv = lazy_glVertexAttribI4iv;
+	glad_glVertexAttribI1uiv = lazy_glVertexAttribI1uiv;
+	glad_glVertexAttribI2uiv = lazy_glVertexAttribI2uiv;
+	glad_glVertexAttribI3uiv = lazy_glVertexAttribI3uiv;
+	glad_glVertexAttribI4uiv = lazy_glVertexAttribI4uiv;
+	glad_glVertexAttribI4bv = lazy_glVertexAttribI4bv;
+	glad_glVertexAttribI4sv = lazy_glVertexAttribI4sv;
+	glad_glVertexAttribI4ubv = lazy_glVertexAttribI4ubv;
+	glad_glVertexAttribI4usv = lazy_glVertexAttribI4usv;
+	glad_glGetUniformuiv = lazy_glGetUniformuiv;
+	glad_glBindFragDataLocation = lazy_glBindFragDataLocation;
+	glad_glGetFragDataLocation = lazy_glGetFragDataLocation;
+	glad_glUniform1ui = lazy_glUniform1ui;
+	glad_glUniform2ui = lazy_glUniform2ui;
+	glad_glUniform3ui = lazy_glUniform3ui;
+	glad_glUniform4ui = lazy_glUniform4ui;
+	glad_glUniform1uiv = lazy_glUniform1uiv;
+	glad_glUniform2uiv = lazy_glUniform2uiv;
+	glad_glUniform3uiv = lazy_glUniform3uiv;
+	glad_glUniform4uiv = lazy_glUniform4uiv;
+	glad_glTexParameterIiv = lazy_glTexParameterIiv;
+	glad_glTexParameterIuiv = lazy_glTexParameterIuiv;
+	glad_glGetTexParameterIiv = lazy_glGetTexParameterIiv;
+	glad_glGetTexParameterIuiv = lazy_glGetTexParameterIuiv;
+	glad_glClearBufferiv = lazy_glClearBufferiv;
+	glad_glClearBufferuiv = lazy_glClearBufferuiv;
+	glad_glClearBufferfv = lazy_glClearBufferfv;
+	glad_glClearBufferfi = lazy_glClearBufferfi;
+	glad_glGetStringi = lazy_glGetStringi;
+	glad_glIsRenderbuffer = lazy_glIsRenderbuffer;
+	glad_glBindRenderbuffer = lazy_glBindRenderbuffer;
+	glad_glDeleteRenderbuffers = lazy_glDeleteRenderbuffers;
+	glad_glGenRenderbuffers = lazy_glGenRenderbuffers;
+	glad_glRenderbufferStorage = lazy_glRenderbufferStorage;
+	glad_glGetRenderbufferParameteriv = lazy_glGetRenderbufferParameteriv;
+	glad_glIsFramebuffer = lazy_glIsFramebuffer;
+	glad_glBindFramebuffer = lazy_glBindFramebuffer;
+	glad_glDeleteFramebuffers = lazy_glDeleteFramebuffers;
+	glad_glGenFramebuffers = lazy_glGenFramebuffers;
+	glad_glCheckFramebufferStatus = lazy_glCheckFramebufferStatus;
+	glad_glFramebufferTexture1D = lazy_glFramebufferTexture1D;
+	glad_glFramebufferTexture2D = lazy_glFramebufferTexture2D;
+	glad_glFramebufferTexture3D = lazy_glFramebufferTexture3D;
+	glad_glFramebufferRenderbuffer = lazy_glFramebufferRenderbuffer;
+	glad_glGetFramebufferAttachmentParameteriv = lazy_glGetFramebufferAttachmentParameteriv;
+	glad_glGenerateMipmap = lazy_glGenerateMipmap;
+	glad_glBlitFramebuffer = lazy_glBlitFramebuffer;
+	glad_glRenderbufferStorageMultisample = lazy_glRenderbufferStorageMultisample;
+	glad_glFramebufferTextureLayer = lazy_glFramebufferTextureLayer;
+	glad_glMapBufferRange = lazy_glMapBufferRange;
+	glad_glFlushMappedBufferRange = lazy_glFlushMappedBufferRange;
+	glad_glBindVertexArray = lazy_glBindVertexArray;
+	glad_glDeleteVertexArrays = lazy_glDeleteVertexArrays;
+	glad_glGenVertexArrays = lazy_glGenVertexArrays;
+	glad_glIsVertexArray = lazy_glIsVertexArray;
+}
+static void lazy_GL_VERSION_3_1(void) {
+	if(!GLAD_GL_VERSION_3_1) return;
+	glad_glDrawArraysInstanced = lazy_glDrawArraysInstanced;
+	glad_glDrawElementsInstanced = lazy_glDrawElementsInstanced;
+	glad_glTexBuffer = lazy_glTexBuffer;
+	glad_glPrimitiveRestartIndex = lazy_glPrimitiveRestartIndex;
+	glad_glCopyBufferSubData = lazy_glCopyBufferSubData;
+	glad_glGetUniformIndices = lazy_glGetUniformIndices;
+	glad_glGetActiveUniformsiv = lazy_glGetActiveUniformsiv;
+	glad_glGetActiveUniformName = lazy_glGetActiveUniformName;
+	glad_glGetUniformBlockIndex = lazy_glGetUniformBlockIndex;
+	glad_glGetActiveUniformBlockiv = lazy_glGetActiveUniformBlockiv;
+	glad_glGetActiveUniformBlockName = lazy_glGetActiveUniformBlockName;
+	glad_glUniformBlockBinding = lazy_glUniformBlockBinding;
+	glad_glBindBufferRange = lazy_glBindBufferRange;
+	glad_glBindBufferBase = lazy_glBindBufferBase;
+	glad_glGetIntegeri_v = lazy_glGetIntegeri_v;
+}
+static void lazy_GL_VERSION_3_2(void) {
+	if(!GLAD_GL_VERSION_3_2) return;
+	glad_glDrawElementsBaseVertex = lazy_glDrawElementsBaseVertex;
+	glad_glDrawRangeElementsBaseVertex = lazy_glDrawRangeElementsBaseVertex;
+	glad_glDrawElementsInstancedBaseVertex = lazy_glDrawElementsInstancedBaseVertex;
+	glad_glMultiDrawElementsBaseVertex = lazy_glMultiDrawElementsBaseVertex;
+	glad_glProvokingVertex = lazy_glProvokingVertex;
+	glad_glFenceSync = lazy_glFenceSync;
+	glad_glIsSync = lazy_glIsSync;
+	glad_glDeleteSync = lazy_glDeleteSync;
+	glad_glClientWaitSync = lazy_glClientWaitSync;
+	glad_glWaitSync = lazy_glWaitSync;
+	glad_glGetInteger64v = lazy_glGetInteger64v;
+	glad_glGetSynciv = lazy_glGetSynciv;
+	glad_glGetInteger64i_v = lazy_glGetInteger64i_v;
+	glad_glGetBufferParameteri64v = lazy_glGetBufferParameteri64v;
+	glad_glFramebufferTexture = lazy_glFramebufferTexture;
+	glad_glTexImage2DMultisample = lazy_glTexImage2DMultisample;
+	glad_glTexImage3DMultisample = lazy_glTexImage3DMultisample;
+	glad_glGetMultisamplefv = lazy_glGetMultisamplefv;
+	glad_glSampleMaski = lazy_glSampleMaski;
+}
+static void lazy_GL_VERSION_3_3(void) {
+	if(!GLAD_GL_VERSION_3_3) return;
+	glad_glBindFragDataLocationIndexed = lazy_glBindFragDataLocationIndexed;
+	glad_glGetFragDataIndex = lazy_glGetFragDataIndex;
+	glad_glGenSamplers = lazy_glGenSamplers;
+	glad_glDeleteSamplers = lazy_glDeleteSamplers;
+	glad_glIsSampler = lazy_glIsSampler;
+	glad_glBindSampler = lazy_glBindSampler;
+	glad_glSamplerParameteri = lazy_glSamplerParameteri;
+	glad_glSamplerParameteriv = lazy_glSamplerParameteriv;
+	glad_glSamplerParameterf = lazy_glSamplerParameterf;
+	glad_glSamplerParameterfv = lazy_glSamplerParameterfv;
+	glad_glSamplerParameterIiv = lazy_glSamplerParameterIiv;
+	glad_glSamplerParameterIuiv = lazy_glSamplerParameterIuiv;
+	glad_glGetSamplerParameteriv = lazy_glGetSamplerParameteriv;
+	glad_glGetSamplerParameterIiv = lazy_glGetSamplerParameterIiv;
+	glad_glGetSamplerParameterfv = lazy_glGetSamplerParameterfv;
+	glad_glGetSamplerParameterIuiv = lazy_glGetSamplerParameterIuiv;
+	glad_glQueryCounter = lazy_glQueryCounter;
+	glad_glGetQueryObjecti64v = lazy_glGetQueryObjecti64v;
+	glad_glGetQueryObjectui64v = lazy_glGetQueryObjectui64v;
+	glad_glVertexAttribDivisor = lazy_glVertexAttribDivisor;
+	glad_glVertexAttribP1ui = lazy_glVertexAttribP1ui;
+	glad_glVertexAttribP1uiv = lazy_glVertexAttribP1uiv;
+	glad_glVertexAttribP2ui = lazy_glVertexAttribP2ui;
+	glad_glVertexAttribP2uiv = lazy_glVertexAttribP2uiv;
+	glad_glVertexAttribP3ui = lazy_glVertexAttribP3ui;
+	glad_glVertexAttribP3uiv = lazy_glVertexAttribP3uiv;
+	glad_glVertexAttribP4ui = lazy_glVertexAttribP4ui;
+	glad_glVertexAttribP4uiv = lazy_glVertexAttribP4uiv;
+	glad_glVertexP2ui = lazy_glVertexP2ui;
+	glad_glVertexP2uiv = lazy_glVertexP2uiv;
+	glad_glVertexP3ui = lazy_glVertexP3ui;
+	glad_glVertexP3uiv = lazy_glVertexP3uiv;
+	glad_glVertexP4ui = lazy_glVertexP4ui;
+	glad_glVertexP4uiv = lazy_glVertexP4uiv;
+	glad_glTexCoordP1ui = lazy_glTexCoordP1ui;
+	glad_glTexCoordP1uiv = lazy_glTexCoordP1uiv;
+	glad_glTexCoordP2ui = lazy_glTexCoordP2ui;
+	glad_glTexCoordP2uiv = lazy_glTexCoordP2uiv;
+	glad_glTexCoordP3ui = lazy_glTexCoordP3ui;
+	glad_glTexCoordP3uiv = lazy_glTexCoordP3uiv;
+	glad_glTexCoordP4ui = lazy_glTexCoordP4ui;
+	glad_glTexCoordP4uiv = lazy_glTexCoordP4uiv;
+	glad_glMultiTexCoordP1ui = lazy_glMultiTexCoordP1ui;
+	glad_glMultiTexCoordP1uiv = lazy_glMultiTexCoordP1uiv;
+	glad_glMultiTexCoordP2ui = lazy_glMultiTexCoordP2ui;
+	glad_glMultiTexCoordP2uiv = lazy_glMultiTexCoordP2uiv;
+	glad_glMultiTexCoordP3ui = lazy_glMultiTexCoordP3ui;
+	glad_glMultiTexCoordP3uiv = lazy_glMultiTexCoordP3uiv;
+	glad_glMultiTexCoordP4ui = lazy_glMultiTexCoordP4ui;
+	glad_glMultiTexCoordP4uiv = lazy_glMultiTexCoordP4uiv;
+	glad_glNormalP3ui = lazy_glNormalP3ui;
+	glad_glNormalP3uiv = lazy_glNormalP3uiv;
+	glad_glColorP3ui = lazy_glColorP3ui;
+	glad_glColorP3uiv = lazy_glColorP3uiv;
+	glad_glColorP4ui = lazy_glColorP4ui;
+	glad_glColorP4uiv = lazy_glColorP4uiv;
+	glad_glSecondaryColorP3ui = lazy_glSecondaryColorP3ui;
+	glad_glSecondaryColorP3uiv = lazy_glSecondaryColorP3uiv;
+}
+static void lazy_GL_VERSION_4_0(void) {
+	if(!GLAD_GL_VERSION_4_0) return;
+	glad_glMinSampleShading = lazy_glMinSampleShading;
+	glad_glBlendEquationi = lazy_glBlendEquationi;
+	glad_glBlendEquationSeparatei = lazy_glBlendEquationSeparatei;
+	glad_glBlendFunci = lazy_glBlendFunci;
+	glad_glBlendFuncSeparatei = lazy_glBlendFuncSeparatei;
+	glad_glDrawArraysIndirect = lazy_glDrawArraysIndirect;
+	glad_glDrawElementsIndirect = lazy_glDrawElementsIndirect;
+	glad_glUniform1d = lazy_glUniform1d;
+	glad_glUniform2d = lazy_glUniform2d;
+	glad_glUniform3d = lazy_glUniform3d;
+	glad_glUniform4d = lazy_glUniform4d;
+	glad_glUniform1dv = lazy_glUniform1dv;
+	glad_glUniform2dv = lazy_glUniform2dv;
+	glad_glUniform3dv = lazy_glUniform3dv;
+	glad_glUniform4dv = lazy_glUniform4dv;
+	glad_glUniformMatrix2dv = lazy_glUniformMatrix2dv;
+	glad_glUniformMatrix3dv = lazy_glUniformMatrix3dv;
+	glad_glUniformMatrix4dv = lazy_glUniformMatrix4dv;
+	glad_glUniformMatrix2x3dv = lazy_glUniformMatrix2x3dv;
+	glad_glUniformMatrix2x4dv = lazy_glUniformMatrix2x4dv;
+	glad_glUniformMatrix3x2dv = lazy_glUniformMatrix3x2dv;
+	glad_glUniformMatrix3x4dv = lazy_glUniformMatrix3x4dv;
+	glad_glUniformMatrix4x2dv = lazy_glUniformMatrix4x2dv;
+	glad_glUniformMatrix4x3dv = lazy_glUniformMatrix4x3dv;
+	glad_glGetUniformdv = lazy_glGetUniformdv;
+	glad_glGetSubroutineUniformLocation = lazy_glGetSubroutineUniformLocation;
+	glad_glGetSubroutineIndex = lazy_glGetSubroutineIndex;
+	glad_glGetActiveSubroutineUniformiv = lazy_glGetActiveSubroutineUniformiv;
+	glad_glGetActiveSubroutineUniformName = lazy_glGetActiveSubroutineUniformName;
+	glad_glGetActiveSubroutineName = lazy_glGetActiveSubroutineName;
+	glad_glUniformSubroutinesuiv = lazy_glUniformSubroutinesuiv;
+	glad_glGetUniformSubroutineuiv = lazy_glGetUniformSubroutineuiv;
+	glad_glGetProgramStageiv = lazy_glGetProgramStageiv;
+	glad_glPatchParameteri = lazy_glPatchParameteri;
+	glad_glPatchParameterfv = lazy_glPatchParameterfv;
+	glad_glBindTransformFeedback = lazy_glBindTransformFeedback;
+	glad_glDeleteTransformFeedbacks = lazy_glDeleteTransformFeedbacks;
+	glad_glGenTransformFeedbacks = lazy_glGenTransformFeedbacks;
+	glad_glIsTransformFeedback = lazy_glIsTransformFeedback;
+	glad_glPauseTransformFeedback = lazy_glPauseTransformFeedback;
+	glad_glResumeTransformFeedback = lazy_glResumeTransformFeedback;
+	glad_glDrawTransformFeedback = lazy_glDrawTransformFeedback;
+	glad_glDrawTransformFeedbackStream = lazy_glDrawTransformFeedbackStream;
+	glad_glBeginQueryIndexed = lazy_glBeginQueryIndexed;
+	glad_glEndQueryIndexed = lazy_glEndQueryIndexed;
+	glad_glGetQueryIndexediv = lazy_glGetQueryIndexediv;
+}
+static void lazy_GL_VERSION_4_1(void) {
+	if(!GLAD_GL_VERSION_4_1) return;
+	glad_glReleaseShaderCompiler = lazy_glReleaseShaderCompiler;
+	glad_glShaderBinary = lazy_glShaderBinary;
+	glad_glGetShaderPrecisionFormat = lazy_glGetShaderPrecisionFormat;
+	glad_glDepthRangef = lazy_glDepthRangef;
+	glad_glClearDepthf = lazy_glClearDepthf;
+	glad_glGetProgramBinary = lazy_glGetProgramBinary;
+	glad_glProgramBinary = lazy_glProgramBinary;
+	glad_glProgramParameteri = lazy_glProgramParameteri;
+	glad_glUseProgramStages = lazy_glUseProgramStages;
+	glad_glActiveShaderProgram = lazy_glActiveShaderProgram;
+	glad_glCreateShaderProgramv = lazy_glCreateShaderProgramv;
+	glad_glBindProgramPipeline = lazy_glBindProgramPipeline;
+	glad_glDeleteProgramPipelines = lazy_glDeleteProgramPipelines;
+	glad_glGenProgramPipelines = lazy_glGenProgramPipelines;
+	glad_glIsProgramPipeline = lazy_glIsProgramPipeline;
+	glad_glGetProgramPipelineiv = lazy_glGetProgramPipelineiv;
+	glad_glProgramParameteri = lazy_glProgramParameteri;
+	glad_glProgramUniform1i = lazy_glProgramUniform1i;
+	glad_glProgramUniform1iv = lazy_glProgramUniform1iv;
+	glad_glProgramUniform1f = lazy_glProgramUniform1f;
+	glad_glProgramUniform1fv = lazy_glProgramUniform1fv;
+	glad_glProgramUniform1d = lazy_glProgramUniform1d;
+	glad_glProgramUniform1dv = lazy_glProgramUniform1dv;
+	glad_glProgramUniform1ui = lazy_glProgramUniform1ui;
+	glad_glProgramUniform1uiv = lazy_glProgramUniform1uiv;
+	glad_glProgramUniform2i = lazy_glProgramUniform2i;
+	glad_glProgramUniform2iv = lazy_glProgramUniform2iv;
+	glad_glProgramUniform2f = lazy_glProgramUniform2f;
+	glad_glProgramUniform2fv = lazy_glProgramUniform2fv;
+	glad_glProgramUniform2d = lazy_glProgramUniform2d;
+	glad_glProgramUniform2dv = lazy_glProgramUniform2dv;
+	glad_glProgramUniform2ui = lazy_glProgramUniform2ui;
+	glad_glProgramUniform2uiv = lazy_glProgramUniform2uiv;
+	glad_glProgramUniform3i = lazy_glProgramUniform3i;
+	glad_glProgramUniform3iv = lazy_glProgramUniform3iv;
+	glad_glProgramUniform3f = lazy_glProgramUniform3f;
+	glad_glProgramUniform3fv = lazy_glProgramUniform3fv;
+	glad_glProgramUniform3d = lazy_glProgramUniform3d;
+	glad_glProgramUniform3dv = lazy_glProgramUniform3dv;
+	glad_glProgramUniform3ui = lazy_glProgramUniform3ui;
+	glad_glProgramUniform3uiv = lazy_glProgramUniform3uiv;
+	glad_glProgramUniform4i = lazy_glProgramUniform4i;
+	glad_glProgramUniform4iv = lazy_glProgramUniform4iv;
+	glad_glProgramUniform4f = lazy_glProgramUniform4f;
+	glad_glProgramUniform4fv = lazy_glProgramUniform4fv;
+	glad_glProgramUniform4d = lazy_glProgramUniform4d;
+	glad_glProgramUniform4dv = lazy_glProgramUniform4dv;
+	glad_glProgramUniform4ui = lazy_glProgramUniform4ui;
+	glad_glProgramUniform4uiv = lazy_glProgramUniform4uiv;
+	glad_glProgramUniformMatrix2fv = lazy_glProgramUniformMatrix2fv;
+	glad_glProgramUniformMatrix3fv = lazy_glProgramUniformMatrix3fv;
+	glad_glProgramUniformMatrix4fv = lazy_glProgramUniformMatrix4fv;
+	glad_glProgramUniformMatrix2dv = lazy_glProgramUniformMatrix2dv;
+	glad_glProgramUniformMatrix3dv = lazy_glProgramUniformMatrix3dv;
+	glad_glProgramUniformMatrix4dv = lazy_glProgramUniformMatrix4dv;
+	glad_glProgramUniformMatrix2x3fv = lazy_glProgramUniformMatrix2x3fv;
+	glad_glProgramUniformMatrix3x2fv = lazy_glProgramUniformMatrix3x2fv;
+	glad_glProgramUniformMatrix2x4fv = lazy_glProgramUniformMatrix2x4fv;
+	glad_glProgramUniformMatrix4x2fv = lazy_glProgramUniformMatrix4x2fv;
+	glad_glProgramUniformMatrix3x4fv = lazy_glProgramUniformMatrix3x4fv;
+	glad_glProgramUniformMatrix4x3fv = lazy_glProgramUniformMatrix4x3fv;
+	glad_glProgramUniformMatrix2x3dv = lazy_glProgramUniformMatrix2x3dv;
+	glad_glProgramUniformMatrix3x2dv = lazy_glProgramUniformMatrix3x2dv;
+	glad_glProgramUniformMatrix2x4dv = lazy_glProgramUniformMatrix2x4dv;
+	glad_glProgramUniformMatrix4x2dv = lazy_glProgramUniformMatrix4x2dv;
+	glad_glProgramUniformMatrix3x4dv = lazy_glProgramUniformMatrix3x4dv;
+	glad_glProgramUniformMatrix4x3dv = lazy_glProgramUniformMatrix4x3dv;
+	glad_glValidateProgramPipeline = lazy_glValidateProgramPipeline;
+	glad_glGetProgramPipelineInfoLog = lazy_glGetProgramPipelineInfoLog;
+	glad_glVertexAttribL1d = lazy_glVertexAttribL1d;
+	glad_glVertexAttribL2d = lazy_glVertexAttribL2d;
+	glad_glVertexAttribL3d = lazy_glVertexAttribL3d;
+	glad_glVertexAttribL4d = lazy_glVertexAttribL4d;
+	glad_glVertexAttribL1dv = lazy_glVertexAttribL1dv;
+	glad_glVertexAttribL2dv = lazy_glVertexAttribL2dv;
+	glad_glVertexAttribL3dv = lazy_glVertexAttribL3dv;
+	glad_glVertexAttribL4dv = lazy_glVertexAttribL4dv;
+	glad_glVertexAttribLPointer = lazy_glVertexAttribLPointer;
+	glad_glGetVertexAttribLdv = lazy_glGetVertexAttribLdv;
+	glad_glViewportArrayv = lazy_glViewportArrayv;
+	glad_glViewportIndexedf = lazy_glViewportIndexedf;
+	glad_glViewportIndexedfv = lazy_glViewportIndexedfv;
+	glad_glScissorArrayv = lazy_glScissorArrayv;
+	glad_glScissorIndexed = lazy_glScissorIndexed;
+	glad_glScissorIndexedv = lazy_glScissorIndexedv;
+	glad_glDepthRangeArrayv = lazy_glDepthRangeArrayv;
+	glad_glDepthRangeIndexed = lazy_glDepthRangeIndexed;
+	glad_glGetFloati_v = lazy_glGetFloati_v;
+	glad_glGetDoublei_v = lazy_glGetDoublei_v;
+}
+static void lazy_GL_VERSION_4_2(void) {
+	if(!GLAD_GL_VERSION_4_2) return;
+	glad_glDrawArraysInstancedBaseInstance = lazy_glDrawArraysInstancedBaseInstance;
+	glad_glDrawElementsInstancedBaseInstance = lazy_glDrawElementsInstancedBaseInstance;
+	glad_glDrawElementsInstancedBaseVertexBaseInstance = lazy_glDrawElementsInstancedBaseVertexBaseInstance;
+	glad_glGetInternalformativ = lazy_glGetInternalformativ;
+	glad_glGetActiveAtomicCounterBufferiv = lazy_glGetActiveAtomicCounterBufferiv;
+	glad_glBindImageTexture = lazy_glBindImageTexture;
+	glad_glMemoryBarrier = lazy_glMemoryBarrier;
+	glad_glTexStorage1D = lazy_glTexStorage1D;
+	glad_glTexStorage2D = lazy_glTexStorage2D;
+	glad_glTexStorage3D = lazy_glTexStorage3D;
+	glad_glDrawTransformFeedbackInstanced = lazy_glDrawTransformFeedbackInstanced;
+	glad_glDrawTransformFeedbackStreamInstanced = lazy_glDrawTransformFeedbackStreamInstanced;
+}
+static void lazy_GL_VERSION_4_3(void) {
+	if(!GLAD_GL_VERSION_4_3) return;
+	glad_glClearBufferData = lazy_glClearBufferData;
+	glad_glClearBufferSubData = lazy_glClearBufferSubData;
+	glad_glDispatchCompute = lazy_glDispatchCompute;
+	glad_glDispatchComputeIndirect = lazy_glDispatchComputeIndirect;
+	glad_glCopyImageSubData = lazy_glCopyImageSubData;
+	glad_glFramebufferParameteri = lazy_glFramebufferParameteri;
+	glad_glGetFramebufferParameteriv = lazy_glGetFramebufferParameteriv;
+	glad_glGetInternalformati64v = lazy_glGetInternalformati64v;
+	glad_glInvalidateTexSubImage = lazy_glInvalidateTexSubImage;
+	glad_glInvalidateTexImage = lazy_glInvalidateTexImage;
+	glad_glInvalidateBufferSubData = lazy_glInvalidateBufferSubData;
+	glad_glInvalidateBufferData = lazy_glInvalidateBufferData;
+	glad_glInvalidateFramebuffer = lazy_glInvalidateFramebuffer;
+	glad_glInvalidateSubFramebuffer = lazy_glInvalidateSubFramebuffer;
+	glad_glMultiDrawArraysIndirect = lazy_glMultiDrawArraysIndirect;
+	glad_glMultiDrawElementsIndirect = lazy_glMultiDrawElementsIndirect;
+	glad_glGetProgramInterfaceiv = lazy_glGetProgramInterfaceiv;
+	glad_glGetProgramResourceIndex = lazy_glGetProgramResourceIndex;
+	glad_glGetProgramResourceName = lazy_glGetProgramResourceName;
+	glad_glGetProgramResourceiv = lazy_glGetProgramResourceiv;
+	glad_glGetProgramResourceLocation = lazy_glGetProgramResourceLocation;
+	glad_glGetProgramResourceLocationIndex = lazy_glGetProgramResourceLocationIndex;
+	glad_glShaderStorageBlockBinding = lazy_glShaderStorageBlockBinding;
+	glad_glTexBufferRange = lazy_glTexBufferRange;
+	glad_glTexStorage2DMultisample = lazy_glTexStorage2DMultisample;
+	glad_glTexStorage3DMultisample = lazy_glTexStorage3DMultisample;
+	glad_glTextureView = lazy_glTextureView;
+	glad_glBindVertexBuffer = lazy_glBindVertexBuffer;
+	glad_glVertexAttribFormat = lazy_glVertexAttribFormat;
+	glad_glVertexAttribIFormat = lazy_glVertexAttribIFormat;
+	glad_glVertexAttribLFormat = lazy_glVertexAttribLFormat;
+	glad_glVertexAttribBinding = lazy_glVertexAttribBinding;
+	glad_glVertexBindingDivisor = lazy_glVertexBindingDivisor;
+	glad_glDebugMessageControl = lazy_glDebugMessageControl;
+	glad_glDebugMessageInsert = lazy_glDebugMessageInsert;
+	glad_glDebugMessageCallback = lazy_glDebugMessageCallback;
+	glad_glGetDebugMessageLog = lazy_glGetDebugMessageLog;
+	glad_glPushDebugGroup = lazy_glPushDebugGroup;
+	glad_glPopDebugGroup = lazy_glPopDebugGroup;
+	glad_glObjectLabel = lazy_glObjectLabel;
+	glad_glGetObjectLabel = lazy_glGetObjectLabel;
+	glad_glObjectPtrLabel = lazy_glObjectPtrLabel;
+	glad_glGetObjectPtrLabel = lazy_glGetObjectPtrLabel;
+	glad_glGetPointerv = lazy_glGetPointerv;
+}
+static void lazy_GL_VERSION_4_4(void) {
+	if(!GLAD_GL_VERSION_4_4) return;
+	glad_glBufferStorage = lazy_glBufferStorage;
+	glad_glClearTexImage = lazy_glClearTexImage;
+	glad_glClearTexSubImage = lazy_glClearTexSubImage;
+	glad_glBindBuffersBase = lazy_glBindBuffersBase;
+	glad_glBindBuffersRange = lazy_glBindBuffersRange;
+	glad_glBindTextures = lazy_glBindTextures;
+	glad_glBindSamplers = lazy_glBindSamplers;
+	glad_glBindImageTextures = lazy_glBindImageTextures;
+	glad_glBindVertexBuffers = lazy_glBindVertexBuffers;
+}
+static void lazy_GL_VERSION_4_5(void) {
+	if(!GLAD_GL_VERSION_4_5) return;
+	glad_glClipControl = lazy_glClipControl;
+	glad_glCreateTransformFeedbacks = lazy_glCreateTransformFeedbacks;
+	glad_glTransformFeedbackBufferBase = lazy_glTransformFeedbackBufferBase;
+	glad_glTransformFeedbackBufferRange = lazy_glTransformFeedbackBufferRange;
+	glad_glGetTransformFeedbackiv = lazy_glGetTransformFeedbackiv;
+	glad_glGetTransformFeedbacki_v = lazy_glGetTransformFeedbacki_v;
+	glad_glGetTransformFeedbacki64_v = lazy_glGetTransformFeedbacki64_v;
+	glad_glCreateBuffers = lazy_glCreateBuffers;
+	glad_glNamedBufferStorage = lazy_glNamedBufferStorage;
+	glad_glNamedBufferData = lazy_glNamedBufferData;
+	glad_glNamedBufferSubData = lazy_glNamedBufferSubData;
+	glad_glCopyNamedBufferSubData = lazy_glCopyNamedBufferSubData;
+	glad_glClearNamedBufferData = lazy_glClearNamedBufferData;
+	glad_glClearNamedBufferSubData = lazy_glClearNamedBufferSubData;
+	glad_glMapNamedBuffer = lazy_glMapNamedBuffer;
+	glad_glMapNamedBufferRange = lazy_glMapNamedBufferRange;
+	glad_glUnmapNamedBuffer = lazy_glUnmapNamedBuffer;
+	glad_glFlushMappedNamedBufferRange = lazy_glFlushMappedNamedBufferRange;
+	glad_glGetNamedBufferParameteriv = lazy_glGetNamedBufferParameteriv;
+	glad_glGetNamedBufferParameteri64v = lazy_glGetNamedBufferParameteri64v;
+	glad_glGetNamedBufferPointerv = lazy_glGetNamedBufferPointerv;
+	glad_glGetNamedBufferSubData = lazy_glGetNamedBufferSubData;
+	glad_glCreateFramebuffers = lazy_glCreateFramebuffers;
+	glad_glNamedFramebufferRenderbuffer = lazy_glNamedFramebufferRenderbuffer;
+	glad_glNamedFramebufferParameteri = lazy_glNamedFramebufferParameteri;
+	glad_glNamedFramebufferTexture = lazy_glNamedFramebufferTexture;
+	glad_glNamedFramebufferTextureLayer = lazy_glNamedFramebufferTextureLayer;
+	glad_glNamedFramebufferDrawBuffer = lazy_glNamedFramebufferDrawBuffer;
+	glad_glNamedFramebufferDrawBuffers = lazy_glNamedFramebufferDrawBuffers;
+	glad_glNamedFramebufferReadBuffer = lazy_glNamedFramebufferReadBuffer;
+	glad_glInvalidateNamedFramebufferData = lazy_glInvalidateNamedFramebufferData;
+	glad_glInvalidateNamedFramebufferSubData = lazy_glInvalidateNamedFramebufferSubData;
+	glad_glClearNamedFramebufferiv = lazy_glClearNamedFramebufferiv;
+	glad_glClearNamedFramebufferuiv = lazy_glClearNamedFramebufferuiv;
+	glad_glClearNamedFramebufferfv = lazy_glClearNamedFramebufferfv;
+	glad_glClearNamedFramebufferfi = lazy_glClearNamedFramebufferfi;
+	glad_glBlitNamedFramebuffer = lazy_glBlitNamedFramebuffer;
+	glad_glCheckNamedFramebufferStatus = lazy_glCheckNamedFramebufferStatus;
+	glad_glGetNamedFramebufferParameteriv = lazy_glGetNamedFramebufferParameteriv;
+	glad_glGetNamedFramebufferAttachmentParameteriv = lazy_glGetNamedFramebufferAttachmentParameteriv;
+	glad_glCreateRenderbuffers = lazy_glCreateRenderbuffers;
+	glad_glNamedRenderbufferStorage = lazy_glNamedRenderbufferStorage;
+	glad_glNamedRenderbufferStorageMultisample = lazy_glNamedRenderbufferStorageMultisample;
+	glad_glGetNamedRenderbufferParameteriv = lazy_glGetNamedRenderbufferParameteriv;
+	glad_glCreateTextures = lazy_glCreateTextures;
+	glad_glTextureBuffer = lazy_glTextureBuffer;
+	glad_glTextureBufferRange = lazy_glTextureBufferRange;
+	glad_glTextureStorage1D = lazy_glTextureStorage1D;
+	glad_glTextureStorage2D = lazy_glTextureStorage2D;
+	glad_glTextureStorage3D = lazy_glTextureStorage3D;
+	glad_glTextureStorage2DMultisample = lazy_glTextureStorage2DMultisample;
+	glad_glTextureStorage3DMultisample = lazy_glTextureStorage3DMultisample;
+	glad_glTextureSubImage1D = lazy_glTextureSubImage1D;
+	glad_glTextureSubImage2D = lazy_glTextureSubImage2D;
+	glad_glTextureSubImage3D = lazy_glTextureSubImage3D;
+	glad_glCompressedTextureSubImage1D = lazy_glCompressedTextureSubImage1D;
+	glad_glCompressedTextureSubImage2D = lazy_glCompressedTextureSubImage2D;
+	glad_glCompressedTextureSubImage3D = lazy_glCompressedTextureSubImage3D;
+	glad_glCopyTextureSubImage1D = lazy_glCopyTextureSubImage1D;
+	glad_glCopyTextureSubImage2D = lazy_glCopyTextureSubImage2D;
+	glad_glCopyTextureSubImage3D = lazy_glCopyTextureSubImage3D;
+	glad_glTextureParameterf = lazy_glTextureParameterf;
+	glad_glTextureParameterfv = lazy_glTextureParameterfv;
+	glad_glTextureParameteri = lazy_glTextureParameteri;
+	glad_glTextureParameterIiv = lazy_glTextureParameterIiv;
+	glad_glTextureParameterIuiv = lazy_glTextureParameterIuiv;
+	glad_glTextureParameteriv = lazy_glTextureParameteriv;
+	glad_glGenerateTextureMipmap = lazy_glGenerateTextureMipmap;
+	glad_glBindTextureUnit = lazy_glBindTextureUnit;
+	glad_glGetTextureImage = lazy_glGetTextureImage;
+	glad_glGetCompressedTextureImage = lazy_glGetCompressedTextureImage;
+	glad_glGetTextureLevelParameterfv = lazy_glGetTextureLevelParameterfv;
+	glad_glGetTextureLevelParameteriv = lazy_glGetTextureLevelParameteriv;
+	glad_glGetTextureParameterfv = lazy_glGetTextureParameterfv;
+	glad_glGetTextureParameterIiv = lazy_glGetTextureParameterIiv;
+	glad_glGetTextureParameterIuiv = lazy_glGetTextureParameterIuiv;
+	glad_glGetTextureParameteriv = lazy_glGetTextureParameteriv;
+	glad_glCreateVertexArrays = lazy_glCreateVertexArrays;
+	glad_glDisableVertexArrayAttrib = lazy_glDisableVertexArrayAttrib;
+	glad_glEnableVertexArrayAttrib = lazy_glEnableVertexArrayAttrib;
+	glad_glVertexArrayElementBuffer = lazy_glVertexArrayElementBuffer;
+	glad_glVertexArrayVertexBuffer = lazy_glVertexArrayVertexBuffer;
+	glad_glVertexArrayVertexBuffers = lazy_glVertexArrayVertexBuffers;
+	glad_glVertexArrayAttribBinding = lazy_glVertexArrayAttribBinding;
+	glad_glVertexArrayAttribFormat = lazy_glVertexArrayAttribFormat;
+	glad_glVertexArrayAttribIFormat = lazy_glVertexArrayAttribIFormat;
+	glad_glVertexArrayAttribLFormat = lazy_glVertexArrayAttribLFormat;
+	glad_glVertexArrayBindingDivisor = lazy_glVertexArrayBindingDivisor;
+	glad_glGetVertexArrayiv = lazy_glGetVertexArrayiv;
+	glad_glGetVertexArrayIndexediv = lazy_glGetVertexArrayIndexediv;
+	glad_glGetVertexArrayIndexed64iv = lazy_glGetVertexArrayIndexed64iv;
+	glad_glCreateSamplers = lazy_glCreateSamplers;
+	glad_glCreateProgramPipelines = lazy_glCreateProgramPipelines;
+	glad_glCreateQueries = lazy_glCreateQueries;
+	glad_glGetQueryBufferObjecti64v = lazy_glGetQueryBufferObjecti64v;
+	glad_glGetQueryBufferObjectiv = lazy_glGetQueryBufferObjectiv;
+	glad_glGetQueryBufferObjectui64v = lazy_glGetQueryBufferObjectui64v;
+	glad_glGetQueryBufferObjectuiv = lazy_glGetQueryBufferObjectuiv;
+	glad_glMemoryBarrierByRegion = lazy_glMemoryBarrierByRegion;
+	glad_glGetTextureSubImage = lazy_glGetTextureSubImage;
+	glad_glGetCompressedTextureSubImage = lazy_glGetCompressedTextureSubImage;
+	glad_glGetGraphicsResetStatus = lazy_glGetGraphicsResetStatus;
+	glad_glGetnCompressedTexImage = lazy_glGetnCompressedTexImage;
+	glad_glGetnTexImage = lazy_glGetnTexImage;
+	glad_glGetnUniformdv = lazy_glGetnUniformdv;
+	glad_glGetnUniformfv = lazy_glGetnUniformfv;
+	glad_glGetnUniformiv = lazy_glGetnUniformiv;
+	glad_glGetnUniformuiv = lazy_glGetnUniformuiv;
+	glad_glReadnPixels = lazy_glReadnPixels;
+	glad_glGetnMapdv = lazy_glGetnMapdv;
+	glad_glGetnMapfv = lazy_glGetnMapfv;
+	glad_glGetnMapiv = lazy_glGetnMapiv;
+	glad_glGetnPixelMapfv = lazy_glGetnPixelMapfv;
+	glad_glGetnPixelMapuiv = lazy_glGetnPixelMapuiv;
+	glad_glGetnPixelMapusv = lazy_glGetnPixelMapusv;
+	glad_glGetnPolygonStipple = lazy_glGetnPolygonStipple;
+	glad_glGetnColorTable = lazy_glGetnColorTable;
+	glad_glGetnConvolutionFilter = lazy_glGetnConvolutionFilter;
+	glad_glGetnSeparableFilter = lazy_glGetnSeparableFilter;
+	glad_glGetnHistogram = lazy_glGetnHistogram;
+	glad_glGetnMinmax = lazy_glGetnMinmax;
+	glad_glTextureBarrier = lazy_glTextureBarrier;
+}
+static void lazy_GL_VERSION_4_6(void) {
+	if(!GLAD_GL_VERSION_4_6) return;
+	glad_glSpecializeShader = lazy_glSpecializeShader;
+	glad_glMultiDrawArraysIndirectCount = lazy_glMultiDrawArraysIndirectCount;
+	glad_glMultiDrawElementsIndirectCount = lazy_glMultiDrawElementsIndirectCount;
+	glad_glPolygonOffsetClamp = lazy_glPolygonOffsetClamp;
+}
+
+static void lazy_find_coreGL(void) {
+    int i, major = 0, minor = 0;
+
+    const char* version;
+    const char* prefixes[] = {
+        "OpenGL ES-CM ",
+        "OpenGL ES-CL ",
+        "OpenGL ES ",
+        NULL
+    };
+
+    version = (const char*) glGetString(GL_VERSION);
+    if (!version) return;
+
+    for (i = 0;  prefixes[i];  i++) {
+        const size_t length = strlen(prefixes[i]);
+        if (strncmp(version, prefixes[i], length) == 0) {
+            version += length;
+            break;
+        }
+    }
+
+#ifdef _MSC_VER
+    sscanf_s(version, "%d.%d", &major, &minor);
+#else
+    sscanf(version, "%d.%d", &major, &minor);
+#endif
+
+    GLVersion.major = major; GLVersion.minor = minor;
+	GLAD_GL_VERSION_1_0 = (major == 1 && minor >= 0) || major > 1;
+	GLAD_GL_VERSION_1_1 = (major == 1 && minor >= 1) || major > 1;
+	GLAD_GL_VERSION_1_2 = (major == 1 && minor >= 2) || major > 1;
+	GLAD_GL_VERSION_1_3 = (major == 1 && minor >= 3) || major > 1;
+	GLAD_GL_VERSION_1_4 = (major == 1 && minor >= 4) || major > 1;
+	GLAD_GL_VERSION_1_5 = (major == 1 && minor >= 5) || major > 1;
+	GLAD_GL_VERSION_2_0 = (major == 2 && minor >= 0) || major > 2;
+	GLAD_GL_VERSION_2_1 = (major == 2 && minor >= 1) || major > 2;
+	GLAD_GL_VERSION_3_0 = (major == 3 && minor >= 0) || major > 3;
+	GLAD_GL_VERSION_3_1 = (major == 3 && minor >= 1) || major > 3;
+	GLAD_GL_VERSION_3_2 = (major == 3 && minor >= 2) || major > 3;
+	GLAD_GL_VERSION_3_3 = (major == 3 && minor >= 3) || major > 3;
+	GLAD_GL_VERSION_4_0 = (major == 4 && minor >= 0) || major > 4;
+	GLAD_GL_VERSION_4_1 = (major == 4 && minor >= 1) || major > 4;
+	GLAD_GL_VERSION_4_2 = (major == 4 && minor >= 2) || major > 4;
+	GLAD_GL_VERSION_4_3 = (major == 4 && minor >= 3) || major > 4;
+	GLAD_GL_VERSION_4_4 = (major == 4 && minor >= 4) || major > 4;
+	GLAD_GL_VERSION_4_5 = (major == 4 && minor >= 5) || major > 4;
+	GLAD_GL_VERSION_4_6 = (major == 4 && minor >= 6) || major > 4;
+}
+
+int gladLoadGLLoaderLazy(GLADloadproc load) {
+	PFNGLGETSTRINGPROC get_string;
+
+	GLVersion.major = 0; GLVersion.minor = 0;
+	glGetString = (PFNGLGETSTRINGPROC)load("glGetString");
+	if(glGetString == NULL) return 0;
+	if(glGetString(GL_VERSION) == NULL) return 0;
+	lazy_find_coreGL();
+
+	/* glGetString is already resolved, it doesn't need a trampoline */
+	get_string = glad_glGetString;
+	lazy_load = load;
+	lazy_GL_VERSION_1_0();
+	lazy_GL_VERSION_1_1();
+	lazy_GL_VERSION_1_2();
+	lazy_GL_VERSION_1_3();
+	lazy_GL_VERSION_1_4();
+	lazy_GL_VERSION_1_5();
+	lazy_GL_VERSION_2_0();
+	lazy_GL_VERSION_2_1();
+	lazy_GL_VERSION_3_0();
+	lazy_GL_VERSION_3_1();
+	lazy_GL_VERSION_3_2();
+	lazy_GL_VERSION_3_3();
+	lazy_GL_VERSION_4_0();
+	lazy_GL_VERSION_4_1();
+	lazy_GL_VERSION_4_2();
+	lazy_GL_VERSION_4_3();
+	lazy_GL_VERSION_4_4();
+	lazy_GL_VERSION_4_5();
+	lazy_GL_VERSION_4_6();
+	glad_glGetString = get_string;
+
+	return GLVersion.major != 0 || GLVersion.minor != 0;
+}
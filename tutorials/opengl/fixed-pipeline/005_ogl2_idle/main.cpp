@@ -0,0 +1,396 @@
+/*
+    OpenGL 2.1 tutorial
+    
+    Idle and background frame rate
+ */
+
+#include <cstdlib>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+/* don't load OpenGL, will be done by Glad
+ */
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+#include <glad/glad.h>
+
+
+/* initial size of the window
+ */
+static const int window_width  = 1280;
+static const int window_height = 720;
+
+/* invisible window wakes up at least this often to check its state, in seconds
+ */
+static const double idle_wait_timeout = 0.5;
+
+/* frame rate of the window without focus, 0 - not limited
+ */
+static const double default_background_fps = 10.0;
+
+/* application data
+ */
+struct oglApp {
+    bool         glfw_init { false };
+    GLFWwindow  *window    { nullptr };
+    bool         gl_loaded { false };
+
+    struct {
+        bool     iconified      { false };                  /* window is minimized */
+        bool     focused        { true };                   /* window receives the input */
+        bool     parked         { false };                  /* render loop doesn't draw anything */
+        double   background_fps { default_background_fps }; /* frame rate without focus, 0 - not limited */
+        double   next_frame     { 0.0 };                    /* earliest time of the next background frame */
+        uint32_t skipped        { 0 };                      /* frames not rendered while parked or limited */
+    } idle;
+};
+
+/* callbacks
+ */
+
+static void glfw_error_callback( int error, const char* description ) {
+    std::cerr
+        << "GLFW error: "
+            << description
+            << std::endl;
+}
+
+static void window_iconify_callback(
+    GLFWwindow* window,
+    int iconified
+) {
+    oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+    app->idle.iconified = ( iconified == GLFW_TRUE );
+}
+
+static void window_focus_callback(
+    GLFWwindow* window,
+    int focused
+) {
+    /* first background frame is rendered without delay
+     */
+    oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+    app->idle.focused    = ( focused == GLFW_TRUE );
+    app->idle.next_frame = 0.0;
+}
+
+static void key_callback(
+    GLFWwindow* window,
+    int key,
+    int scancode,
+    int action,
+    int mods
+) {
+    /* ESC - close application
+    */
+    if ( key == GLFW_KEY_ESCAPE && action == GLFW_PRESS )
+        glfwSetWindowShouldClose( window, GLFW_TRUE );
+
+    /* B - switch the frame rate limit of the window without focus
+     */
+    if ( key == GLFW_KEY_B && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        app->idle.background_fps = ( app->idle.background_fps > 0.0 ) ? 0.0 : default_background_fps;
+
+        std::cout
+            << "Background frame rate: "
+                << ( app->idle.background_fps > 0.0 ? std::to_string( app->idle.background_fps ) : "not limited" )
+                << std::endl;
+    }
+}
+
+static bool init_glfw( oglApp &app ) {
+    /* setup error callback first to catch all errors
+     */
+    (void)glfwSetErrorCallback( glfw_error_callback );
+
+    /* init the library
+     */
+    if( glfwInit() == GLFW_FALSE )
+        return false;
+
+    app.glfw_init = true;
+
+    return true;
+}
+
+static bool cleanup_glfw( oglApp &app ) {
+    if( !app.glfw_init )
+        return true;
+
+    /* cleanup GLFW resources
+     */
+    glfwTerminate();
+    app.glfw_init = false;
+
+    return true;
+}
+
+static bool init_window( oglApp &app ) {
+    if( !app.glfw_init )
+        return false;
+
+    /* request OpenGL 2.1
+     */
+    glfwWindowHint( GLFW_CONTEXT_VERSION_MAJOR, 2 );
+    glfwWindowHint( GLFW_CONTEXT_VERSION_MINOR, 1 );
+
+    /* window can be resized, minimized and covered by other windows
+     */
+    glfwWindowHint( GLFW_RESIZABLE, GLFW_TRUE );
+
+    app.window = glfwCreateWindow(
+        window_width,
+        window_height,
+        "OpenGL 2.1 - Tutorial - Idle",
+        nullptr,
+        nullptr
+    );
+    if( !app.window )
+        return false;
+
+    /* setup user pointer
+     */
+    glfwSetWindowUserPointer(
+        app.window,
+       &app
+    );
+
+    /* connect OpenGL context with window
+     */
+    glfwMakeContextCurrent( app.window );
+    glfwSwapInterval( 1 );  /* update window every time */
+
+    /* acquire the keyboard
+     */
+    glfwSetKeyCallback(
+        app.window,
+        key_callback
+    );
+
+    /* visibility and focus drive the render loop scheduler
+     */
+    glfwSetWindowIconifyCallback(
+        app.window,
+        window_iconify_callback
+    );
+    glfwSetWindowFocusCallback(
+        app.window,
+        window_focus_callback
+    );
+    app.idle.focused = ( glfwGetWindowAttrib( app.window, GLFW_FOCUSED ) == GLFW_TRUE );
+
+    return true;
+}
+
+static bool cleanup_window( oglApp &app ) {
+    if( !app.window )
+        return true;
+
+    /* destroy GLFW window
+     */
+    glfwDestroyWindow( app.window );
+    app.window = nullptr;
+
+    return true;
+}
+
+static bool init_opengl( oglApp &app ) {
+    if( !app.window )
+        return false;
+
+    /* run Glad and load actual version of OpenGL
+     */
+    if( !gladLoadGL() )
+        return false;
+
+    app.gl_loaded = true;
+
+    std::cout
+        << "OpenGL renderer: "
+            << reinterpret_cast< const char* > ( glGetString( GL_RENDERER ) )
+            << std::endl;
+
+    std::cout
+        << "OpenGL driver version: "
+            << reinterpret_cast< const char* > ( glGetString( GL_VERSION ) )
+            << std::endl;
+
+    /* setup window clean color - light blue
+     */
+    glClearColor( 0.0f, 0.3f, 0.6f, 1.0f );
+
+    return true;
+}
+
+static bool cleanup_opengl( oglApp &app ) {
+    if( !app.gl_loaded )
+        return false;
+
+    app.gl_loaded = false;
+
+    /* nothing is here
+     */
+    return true;
+}
+
+static bool init( oglApp &app ) {
+    if( !init_glfw( app ) )
+        return false;
+    if( !init_window( app ) )
+        return false;
+    if( !init_opengl( app ) )
+        return false;
+
+    return true;
+}
+
+static bool cleanup( oglApp &app ) {
+    if( !cleanup_opengl( app ) )
+        return false;
+    if( !cleanup_window( app ) )
+        return false;
+    if( !cleanup_glfw( app ) )
+        return false;
+
+    return true;
+}
+
+/* idle scheduler
+ */
+
+static bool is_window_visible( oglApp &app ) {
+    if( app.idle.iconified )
+        return false;
+    if( glfwGetWindowAttrib( app.window, GLFW_VISIBLE ) == GLFW_FALSE )
+        return false;
+
+    /* some platforms report the minimized window only by the zero size
+     */
+    int frame_width, frame_height;
+    glfwGetFramebufferSize(
+        app.window,
+       &frame_width,
+       &frame_height
+    );
+    return ( frame_width != 0 ) && ( frame_height != 0 );
+}
+
+static void park( oglApp &app, bool parked ) {
+    if( app.idle.parked == parked )
+        return;
+    app.idle.parked = parked;
+
+    std::cout
+        << "Rendering "
+            << ( parked ? "paused" : "resumed" )
+            << ", frames skipped: "
+            << app.idle.skipped
+            << std::endl;
+    app.idle.skipped = 0;
+}
+
+static bool update_idle( oglApp &app ) {
+    /* invisible window draws nothing and sleeps until any event,
+     * timeout is only a safety net for platforms without iconify events
+     */
+    if( !is_window_visible( app ) ) {
+        park( app, true );
+        app.idle.skipped++;
+        glfwWaitEventsTimeout( idle_wait_timeout );
+        return false;
+    }
+    park( app, false );
+
+    if( app.idle.focused || ( app.idle.background_fps <= 0.0 ) )
+        return true;
+
+    /* window without focus sleeps until the next frame is due,
+     * input still wakes it up earlier
+     */
+    const double now = glfwGetTime();
+    if( now < app.idle.next_frame ) {
+        app.idle.skipped++;
+        glfwWaitEventsTimeout( app.idle.next_frame - now );
+        return false;
+    }
+
+    /* keep the cadence, but don't catch up missed frames after a long sleep
+     */
+    const double period = 1.0 / app.idle.background_fps;
+    app.idle.next_frame = ( now - app.idle.next_frame > period ) ? now + period
+                                                                 : app.idle.next_frame + period;
+
+    return true;
+}
+
+static void draw( oglApp &app ) {
+    int frame_width, frame_height;
+
+    /* read the actual frame buffer size of the window
+     */
+    glfwGetFramebufferSize(
+        app.window,
+       &frame_width,
+       &frame_height
+    );
+
+        /* Synchronize viewport with window size
+         */
+        glViewport(
+            0, 0,
+            frame_width, frame_height
+        );
+
+        /* clean window background
+         */
+        glClear(
+            GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT
+        );
+
+
+    /* update window
+     */
+    glfwSwapBuffers( app.window );
+}
+
+int main() {
+    oglApp app;
+
+    if( !init( app ) ) {
+        std::cerr
+            << "Cannot initialize the application"
+                << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    /* render loop
+     */
+    while( glfwWindowShouldClose( app.window ) == GLFW_FALSE ) {
+        /* hidden or limited window waits for events instead of the next frame
+         */
+        if( !update_idle( app ) )
+            continue;
+
+        /* draw the context of the window
+         */
+        draw( app );
+
+        /* proceed keyboard and mouse
+         */
+        glfwPollEvents();
+    }
+
+    if( !cleanup( app ) ) {
+        std::cerr
+            << "Cleanup failed"
+                << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout
+        << "Job is done!"
+            << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,754 @@
+/*
+    OpenGL 2.1 tutorial
+    
+    Fullscreen toggle
+ */
+
+#include <cstdlib>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <array>
+#include <algorithm>
+#include <cmath>
+#include <chrono>
+#include <thread>
+#include <optional>
+
+/* don't load OpenGL, will be done by Glad
+ */
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+#include <glad/glad.h>
+
+
+/* initial size of the window
+ */
+static const int window_width  = 1280;
+static const int window_height = 720;
+
+/* invisible window wakes up at least this often to check its state, in seconds
+ */
+static const double idle_wait_timeout = 0.5;
+
+/* frame rate of the window without focus, 0 - not limited
+ */
+static const double default_background_fps = 10.0;
+
+/* frame rates of the frame limiter switched by the key, 0 - not limited
+ */
+static const std::array< double, 5 > frame_rate_targets { 0.0, 60.0, 90.0, 120.0, 144.0 };
+static const size_t default_frame_rate_target = 2;
+
+/* frame limiter settings:
+ *  duration of one sleep step, in seconds
+ *  initial guess of the worst sleep step, in seconds
+ *  weight of the new measurement in the sleep statistics
+ */
+static const double limiter_sleep_step = 0.001;
+static const double limiter_sleep_guess = 0.005;
+static const double limiter_sleep_smoothing = 0.1;
+
+/* how the window occupies the display
+ */
+enum class oglWindowMode {
+    windowed,   /* ordinary window with decorations */
+    borderless, /* window covers the whole monitor, video mode of the desktop is kept */
+    exclusive   /* monitor is switched to the best video mode of the native resolution */
+};
+
+/* application data
+ */
+struct oglApp {
+    bool         glfw_init { false };
+    GLFWwindow  *window    { nullptr };
+    bool         gl_loaded { false };
+    bool         vsync     { false }; /* swap waits for the vertical blank */
+
+    struct {
+        bool     iconified      { false };                  /* window is minimized */
+        bool     focused        { true };                   /* window receives the input */
+        bool     parked         { false };                  /* render loop doesn't draw anything */
+        double   background_fps { default_background_fps }; /* frame rate without focus, 0 - not limited */
+        double   next_frame     { 0.0 };                    /* earliest time of the next background frame */
+        uint32_t skipped        { 0 };                      /* frames not rendered while parked or limited */
+    } idle;
+
+    struct {
+        size_t   target       { default_frame_rate_target }; /* index in frame_rate_targets */
+        double   deadline     { 0.0 };                       /* start time of the next frame, 0 - no cadence yet */
+
+        double   sleep_mean   { limiter_sleep_step };        /* smoothed duration of one sleep step */
+        double   sleep_var    { 0.0 };                       /* smoothed variance of the sleep step */
+        double   sleep_worst  { limiter_sleep_guess };       /* sleep step which is still safe before the deadline */
+
+        double   period_start { 0.0 };                       /* start time of the current report period */
+        uint32_t frames       { 0 };                         /* frames in the current report period */
+        double   error_sum    { 0.0 };                       /* sum of overshoots in the current period */
+        double   error_max    { 0.0 };                       /* worst overshoot in the current period */
+        uint32_t error_count  { 0 };                         /* amount of limited frames in the current period */
+        uint32_t late_count   { 0 };                         /* frames after the deadline, the limiter didn't wait */
+    } limiter;
+
+    struct {
+        oglWindowMode                  mode { oglWindowMode::windowed }; /* actual mode of the window */
+        std::optional< oglWindowMode > request;                          /* mode requested by the user */
+
+        int x      { 0 }; /* placement of the window to restore the windowed mode */
+        int y      { 0 };
+        int width  { window_width };
+        int height { window_height };
+    } display;
+};
+
+/* callbacks
+ */
+
+static void glfw_error_callback( int error, const char* description ) {
+    std::cerr
+        << "GLFW error: "
+            << description
+            << std::endl;
+}
+
+static void window_iconify_callback(
+    GLFWwindow* window,
+    int iconified
+) {
+    oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+    app->idle.iconified = ( iconified == GLFW_TRUE );
+}
+
+static void window_focus_callback(
+    GLFWwindow* window,
+    int focused
+) {
+    /* first background frame is rendered without delay
+     */
+    oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+    app->idle.focused    = ( focused == GLFW_TRUE );
+    app->idle.next_frame = 0.0;
+}
+
+static void key_callback(
+    GLFWwindow* window,
+    int key,
+    int scancode,
+    int action,
+    int mods
+) {
+    /* ESC - close application
+    */
+    if ( key == GLFW_KEY_ESCAPE && action == GLFW_PRESS )
+        glfwSetWindowShouldClose( window, GLFW_TRUE );
+
+    /* T - switch the target frame rate of the frame limiter
+     */
+    if ( key == GLFW_KEY_T && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        app->limiter.target   = ( app->limiter.target + 1 ) % frame_rate_targets.size();
+        app->limiter.deadline = 0.0;
+
+        const double target_fps = frame_rate_targets[app->limiter.target];
+        std::cout
+            << "Frame limiter: "
+                << ( target_fps > 0.0 ? std::to_string( target_fps ) : "off" )
+                << std::endl;
+    }
+
+    /* V - switch the vertical synchronization
+     */
+    if ( key == GLFW_KEY_V && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        app->vsync = !app->vsync;
+        glfwSwapInterval( app->vsync ? 1 : 0 );
+
+        std::cout
+            << "Vertical synchronization: "
+                << ( app->vsync ? "on" : "off" )
+                << std::endl;
+    }
+
+    /* B - switch the frame rate limit of the window without focus
+     */
+    if ( key == GLFW_KEY_B && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        app->idle.background_fps = ( app->idle.background_fps > 0.0 ) ? 0.0 : default_background_fps;
+
+        std::cout
+            << "Background frame rate: "
+                << ( app->idle.background_fps > 0.0 ? std::to_string( app->idle.background_fps ) : "not limited" )
+                << std::endl;
+    }
+
+    /* F11 - switch windowed, borderless and exclusive fullscreen modes,
+     * the mode is changed in the render loop
+     */
+    if ( key == GLFW_KEY_F11 && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        switch( app->display.mode ) {
+        case oglWindowMode::windowed:
+            app->display.request = oglWindowMode::borderless;
+            break;
+        case oglWindowMode::borderless:
+            app->display.request = oglWindowMode::exclusive;
+            break;
+        case oglWindowMode::exclusive:
+            app->display.request = oglWindowMode::windowed;
+            break;
+        }
+    }
+}
+
+static bool init_glfw( oglApp &app ) {
+    /* setup error callback first to catch all errors
+     */
+    (void)glfwSetErrorCallback( glfw_error_callback );
+
+    /* init the library
+     */
+    if( glfwInit() == GLFW_FALSE )
+        return false;
+
+    app.glfw_init = true;
+
+    return true;
+}
+
+static bool cleanup_glfw( oglApp &app ) {
+    if( !app.glfw_init )
+        return true;
+
+    /* cleanup GLFW resources
+     */
+    glfwTerminate();
+    app.glfw_init = false;
+
+    return true;
+}
+
+static bool init_window( oglApp &app ) {
+    if( !app.glfw_init )
+        return false;
+
+    /* request OpenGL 2.1
+     */
+    glfwWindowHint( GLFW_CONTEXT_VERSION_MAJOR, 2 );
+    glfwWindowHint( GLFW_CONTEXT_VERSION_MINOR, 1 );
+
+    /* window can be resized, minimized and covered by other windows
+     */
+    glfwWindowHint( GLFW_RESIZABLE, GLFW_TRUE );
+
+    app.window = glfwCreateWindow(
+        window_width,
+        window_height,
+        "OpenGL 2.1 - Tutorial - Fullscreen toggle",
+        nullptr,
+        nullptr
+    );
+    if( !app.window )
+        return false;
+
+    /* setup user pointer
+     */
+    glfwSetWindowUserPointer(
+        app.window,
+       &app
+    );
+
+    /* connect OpenGL context with window
+     */
+    glfwMakeContextCurrent( app.window );
+    glfwSwapInterval( app.vsync ? 1 : 0 );  /* frame rate is limited by the application */
+
+    /* acquire the keyboard
+     */
+    glfwSetKeyCallback(
+        app.window,
+        key_callback
+    );
+
+    /* visibility and focus drive the render loop scheduler
+     */
+    glfwSetWindowIconifyCallback(
+        app.window,
+        window_iconify_callback
+    );
+    glfwSetWindowFocusCallback(
+        app.window,
+        window_focus_callback
+    );
+    app.idle.focused = ( glfwGetWindowAttrib( app.window, GLFW_FOCUSED ) == GLFW_TRUE );
+
+    return true;
+}
+
+static bool cleanup_window( oglApp &app ) {
+    if( !app.window )
+        return true;
+
+    /* destroy GLFW window
+     */
+    glfwDestroyWindow( app.window );
+    app.window = nullptr;
+
+    return true;
+}
+
+/* window mode
+ */
+
+static GLFWmonitor* select_monitor( oglApp &app ) {
+    /* monitor under the center of the window,
+     * fullscreen window is already on its monitor
+     */
+    GLFWmonitor *window_monitor = glfwGetWindowMonitor( app.window );
+    if( window_monitor )
+        return window_monitor;
+
+    int x, y, width, height;
+    glfwGetWindowPos( app.window, &x, &y );
+    glfwGetWindowSize( app.window, &width, &height );
+    const int center_x = x + width / 2;
+    const int center_y = y + height / 2;
+
+    int monitor_count = 0;
+    GLFWmonitor **monitors = glfwGetMonitors( &monitor_count );
+    for( int i = 0; i < monitor_count; ++i ) {
+        int monitor_x, monitor_y;
+        glfwGetMonitorPos( monitors[i], &monitor_x, &monitor_y );
+        const GLFWvidmode *mode = glfwGetVideoMode( monitors[i] );
+        if( !mode )
+            continue;
+
+        if( ( center_x >= monitor_x ) && ( center_x < monitor_x + mode->width ) &&
+            ( center_y >= monitor_y ) && ( center_y < monitor_y + mode->height ) )
+            return monitors[i];
+    }
+
+    return glfwGetPrimaryMonitor();
+}
+
+static const GLFWvidmode* select_video_mode( GLFWmonitor *monitor ) {
+    int mode_count = 0;
+    const GLFWvidmode *modes = glfwGetVideoModes( monitor, &mode_count );
+    if( !modes || !mode_count )
+        return glfwGetVideoMode( monitor );
+
+    /* native resolution is the biggest one,
+     * among its modes take the highest refresh rate, then the deepest color
+     */
+    const GLFWvidmode *best = &modes[0];
+    for( int i = 1; i < mode_count; ++i ) {
+        const GLFWvidmode &mode = modes[i];
+        const int64_t mode_area = static_cast< int64_t > ( mode.width ) * mode.height;
+        const int64_t best_area = static_cast< int64_t > ( best->width ) * best->height;
+        const int mode_bits = mode.redBits + mode.greenBits + mode.blueBits;
+        const int best_bits = best->redBits + best->greenBits + best->blueBits;
+
+        if( mode_area != best_area ) {
+            if( mode_area > best_area )
+                best = &mode;
+        }
+        else if( mode.refreshRate != best->refreshRate ) {
+            if( mode.refreshRate > best->refreshRate )
+                best = &mode;
+        }
+        else if( mode_bits > best_bits )
+            best = &mode;
+    }
+
+    return best;
+}
+
+static void set_window_mode( oglApp &app, oglWindowMode mode ) {
+    if( mode == app.display.mode )
+        return;
+
+    /* remember where the window was to return it back later
+     */
+    if( app.display.mode == oglWindowMode::windowed ) {
+        glfwGetWindowPos( app.window, &app.display.x, &app.display.y );
+        glfwGetWindowSize( app.window, &app.display.width, &app.display.height );
+    }
+
+    GLFWmonitor *monitor = select_monitor( app );
+    const GLFWvidmode *video_mode = nullptr;
+    switch( mode ) {
+    case oglWindowMode::windowed:
+        glfwSetWindowMonitor( app.window,
+                              nullptr,
+                              app.display.x,
+                              app.display.y,
+                              app.display.width,
+                              app.display.height,
+                              GLFW_DONT_CARE );
+        break;
+    case oglWindowMode::borderless:
+        /* the same video mode as the desktop, the monitor doesn't switch
+         */
+        video_mode = glfwGetVideoMode( monitor );
+        break;
+    case oglWindowMode::exclusive:
+        video_mode = select_video_mode( monitor );
+        break;
+    }
+
+    if( video_mode ) {
+        glfwSetWindowMonitor( app.window,
+                              monitor,
+                              0,
+                              0,
+                              video_mode->width,
+                              video_mode->height,
+                              video_mode->refreshRate );
+    }
+
+    app.display.mode = mode;
+
+    std::cout
+        << "Window mode: "
+            << ( mode == oglWindowMode::windowed ? "windowed"
+                 : mode == oglWindowMode::borderless ? "borderless" : "exclusive" );
+    if( video_mode ) {
+        std::cout
+            << ", "
+                << glfwGetMonitorName( monitor )
+                << ' '
+                << video_mode->width
+                << 'x'
+                << video_mode->height
+                << '@'
+                << video_mode->refreshRate
+                << "Hz";
+    }
+    std::cout
+        << std::endl;
+}
+
+static void update_window_mode( oglApp &app ) {
+    if( !app.display.request )
+        return;
+
+    set_window_mode( app, *app.display.request );
+    app.display.request.reset();
+
+    /* OpenGL context stays the same,
+     * but some drivers forget the swap interval after the switch
+     */
+    glfwSwapInterval( app.vsync ? 1 : 0 );
+}
+
+static bool init_opengl( oglApp &app ) {
+    if( !app.window )
+        return false;
+
+    /* run Glad and load actual version of OpenGL
+     */
+    if( !gladLoadGL() )
+        return false;
+
+    app.gl_loaded = true;
+
+    std::cout
+        << "OpenGL renderer: "
+            << reinterpret_cast< const char* > ( glGetString( GL_RENDERER ) )
+            << std::endl;
+
+    std::cout
+        << "OpenGL driver version: "
+            << reinterpret_cast< const char* > ( glGetString( GL_VERSION ) )
+            << std::endl;
+
+    /* setup window clean color - light blue
+     */
+    glClearColor( 0.0f, 0.3f, 0.6f, 1.0f );
+
+    return true;
+}
+
+static bool cleanup_opengl( oglApp &app ) {
+    if( !app.gl_loaded )
+        return false;
+
+    app.gl_loaded = false;
+
+    /* nothing is here
+     */
+    return true;
+}
+
+static bool init( oglApp &app ) {
+    if( !init_glfw( app ) )
+        return false;
+    if( !init_window( app ) )
+        return false;
+    if( !init_opengl( app ) )
+        return false;
+
+    return true;
+}
+
+static bool cleanup( oglApp &app ) {
+    if( !cleanup_opengl( app ) )
+        return false;
+    if( !cleanup_window( app ) )
+        return false;
+    if( !cleanup_glfw( app ) )
+        return false;
+
+    return true;
+}
+
+/* idle scheduler
+ */
+
+static bool is_window_visible( oglApp &app ) {
+    if( app.idle.iconified )
+        return false;
+    if( glfwGetWindowAttrib( app.window, GLFW_VISIBLE ) == GLFW_FALSE )
+        return false;
+
+    /* some platforms report the minimized window only by the zero size
+     */
+    int frame_width, frame_height;
+    glfwGetFramebufferSize(
+        app.window,
+       &frame_width,
+       &frame_height
+    );
+    return ( frame_width != 0 ) && ( frame_height != 0 );
+}
+
+static void park( oglApp &app, bool parked ) {
+    if( app.idle.parked == parked )
+        return;
+    app.idle.parked = parked;
+
+    std::cout
+        << "Rendering "
+            << ( parked ? "paused" : "resumed" )
+            << ", frames skipped: "
+            << app.idle.skipped
+            << std::endl;
+    app.idle.skipped = 0;
+}
+
+static bool update_idle( oglApp &app ) {
+    /* invisible window draws nothing and sleeps until any event,
+     * timeout is only a safety net for platforms without iconify events
+     */
+    if( !is_window_visible( app ) ) {
+        park( app, true );
+        app.idle.skipped++;
+        glfwWaitEventsTimeout( idle_wait_timeout );
+        return false;
+    }
+    park( app, false );
+
+    if( app.idle.focused || ( app.idle.background_fps <= 0.0 ) )
+        return true;
+
+    /* window without focus sleeps until the next frame is due,
+     * input still wakes it up earlier
+     */
+    const double now = glfwGetTime();
+    if( now < app.idle.next_frame ) {
+        app.idle.skipped++;
+        glfwWaitEventsTimeout( app.idle.next_frame - now );
+        return false;
+    }
+
+    /* keep the cadence, but don't catch up missed frames after a long sleep
+     */
+    const double period = 1.0 / app.idle.background_fps;
+    app.idle.next_frame = ( now - app.idle.next_frame > period ) ? now + period
+                                                                 : app.idle.next_frame + period;
+
+    return true;
+}
+
+/* frame limiter
+ */
+
+static void update_sleep_estimate( oglApp &app, double slept ) {
+    /* the OS wakes the thread up later than requested, how much later depends on
+     * the timer resolution and the load, so the worst case is learned at runtime
+     */
+    const double delta = slept - app.limiter.sleep_mean;
+    app.limiter.sleep_mean += limiter_sleep_smoothing * delta;
+    app.limiter.sleep_var   = ( 1.0 - limiter_sleep_smoothing ) * ( app.limiter.sleep_var + limiter_sleep_smoothing * delta * delta );
+    app.limiter.sleep_worst = app.limiter.sleep_mean + 2.0 * std::sqrt( app.limiter.sleep_var );
+}
+
+static void report_frame_limiter( oglApp &app, double now ) {
+    app.limiter.frames++;
+
+    /* report once per second
+     */
+    const double period = now - app.limiter.period_start;
+    if( period < 1.0 )
+        return;
+
+    std::cout
+        << "Frame limiter: "
+            << app.limiter.frames / period
+            << " fps, error "
+            << ( app.limiter.error_count ? 1000000.0 * app.limiter.error_sum / app.limiter.error_count : 0.0 )
+            << " us, max "
+            << 1000000.0 * app.limiter.error_max
+            << " us, late frames "
+            << app.limiter.late_count
+            << std::endl;
+
+    app.limiter.period_start = now;
+    app.limiter.frames       = 0;
+    app.limiter.error_sum    = 0.0;
+    app.limiter.error_max    = 0.0;
+    app.limiter.error_count  = 0;
+    app.limiter.late_count   = 0;
+}
+
+static void limit_frame_rate( oglApp &app ) {
+    const double target_fps = frame_rate_targets[app.limiter.target];
+    if( target_fps <= 0.0 ) {
+        app.limiter.deadline = 0.0;
+        return;
+    }
+
+    const double period = 1.0 / target_fps;
+    double now = glfwGetTime();
+
+    /* first frame: start the cadence and the report period
+     */
+    if( app.limiter.deadline == 0.0 ) {
+        app.limiter.deadline     = now + period;
+        app.limiter.period_start = now;
+        app.limiter.frames       = 0;
+        return;
+    }
+
+    /* the frame is late for the whole period: start the new cadence,
+     * missed frames are not caught up, the report keeps counting frames
+     */
+    if( now - app.limiter.deadline > period ) {
+        app.limiter.deadline = now + period;
+        app.limiter.late_count++;
+        report_frame_limiter( app, now );
+        return;
+    }
+
+    /* the frame came after the deadline by itself, the limiter has nothing to wait for,
+     * the lateness comes from the time of the frame and is not the error of the limiter
+     */
+    const bool waited = ( now < app.limiter.deadline );
+
+    /* sleep in short steps while even the worst step ends before the deadline
+     */
+    while( app.limiter.deadline - now > app.limiter.sleep_worst ) {
+        std::this_thread::sleep_for( std::chrono::duration< double >( limiter_sleep_step ) );
+        const double woke = glfwGetTime();
+        update_sleep_estimate( app, woke - now );
+        now = woke;
+    }
+
+    /* spin the rest of the time, the thread gives CPU to others but never sleeps
+     */
+    while( now < app.limiter.deadline ) {
+        std::this_thread::yield();
+        now = glfwGetTime();
+    }
+
+    /* overshoot is the error of the limiter itself
+     */
+    if( waited ) {
+        const double error = now - app.limiter.deadline;
+        app.limiter.error_sum += error;
+        app.limiter.error_max  = std::max( app.limiter.error_max, error );
+        app.limiter.error_count++;
+    }
+    else
+        app.limiter.late_count++;
+
+    app.limiter.deadline += period;
+    report_frame_limiter( app, now );
+}
+
+static void draw( oglApp &app ) {
+    int frame_width, frame_height;
+
+    /* read the actual frame buffer size of the window
+     */
+    glfwGetFramebufferSize(
+        app.window,
+       &frame_width,
+       &frame_height
+    );
+
+        /* Synchronize viewport with window size
+         */
+        glViewport(
+            0, 0,
+            frame_width, frame_height
+        );
+
+        /* clean window background
+         */
+        glClear(
+            GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT
+        );
+
+
+    /* update window
+     */
+    glfwSwapBuffers( app.window );
+}
+
+int main() {
+    oglApp app;
+
+    if( !init( app ) ) {
+        std::cerr
+            << "Cannot initialize the application"
+                << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    /* render loop
+     */
+    while( glfwWindowShouldClose( app.window ) == GLFW_FALSE ) {
+        /* hidden or limited window waits for events instead of the next frame
+         */
+        if( !update_idle( app ) )
+            continue;
+
+        /* wait for the start of the next frame at the target frame rate
+         */
+        limit_frame_rate( app );
+
+        /* draw the context of the window
+         */
+        draw( app );
+
+        /* proceed keyboard and mouse
+         */
+        glfwPollEvents();
+
+        /* switch the window mode on request of the user
+         */
+        update_window_mode( app );
+    }
+
+    if( !cleanup( app ) ) {
+        std::cerr
+            << "Cleanup failed"
+                << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout
+        << "Job is done!"
+            << std::endl;
+    return EXIT_SUCCESS;
+}
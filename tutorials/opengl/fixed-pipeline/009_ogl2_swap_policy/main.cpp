@@ -0,0 +1,1423 @@
+/*
+    OpenGL 2.1 tutorial
+    
+    Swap policy
+ */
+
+#include <cstdlib>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <array>
+#include <algorithm>
+#include <cmath>
+#include <chrono>
+#include <thread>
+#include <optional>
+#include <fstream>
+#include <condition_variable>
+#include <mutex>
+#include <deque>
+#include <vector>
+
+/* don't load OpenGL, will be done by Glad
+ */
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+#include <glad/glad.h>
+#include <glad/glad_ext.h>
+
+
+/* initial size of the window
+ */
+static const int window_width  = 1280;
+static const int window_height = 720;
+
+/* invisible window wakes up at least this often to check its state, in seconds
+ */
+static const double idle_wait_timeout = 0.5;
+
+/* frame rate of the window without focus, 0 - not limited
+ */
+static const double default_background_fps = 10.0;
+
+/* frame rates of the frame limiter switched by the key, 0 - not limited
+ */
+static const std::array< double, 5 > frame_rate_targets { 0.0, 60.0, 90.0, 120.0, 144.0 };
+static const size_t default_frame_rate_target = 2;
+
+/* frame limiter settings:
+ *  duration of one sleep step, in seconds
+ *  initial guess of the worst sleep step, in seconds
+ *  weight of the new measurement in the sleep statistics
+ */
+static const double limiter_sleep_step = 0.001;
+static const double limiter_sleep_guess = 0.005;
+static const double limiter_sleep_smoothing = 0.1;
+
+/* amount of buffers in every pixel ring: GPU works with the oldest ones while CPU uses the newest
+ */
+static const uint32_t pixel_ring_size = 3;
+
+/* images waiting for the writer thread, the next images are dropped instead of piling up in memory
+ */
+static const size_t max_pending_images = 8;
+
+/* size of the texture streamed every frame, in texels
+ */
+static const int stream_texture_size = 512;
+
+/* file of the video capture, raw BGRA frames from bottom to top
+ */
+static const char capture_file_name[] = "capture.bgra";
+
+/* refresh rate assumed when the monitor doesn't report it, in Hz
+ */
+static const int default_refresh_rate = 60;
+
+/* swap interval of the interval policy: every frame stays on the screen for this amount of vertical blanks
+ */
+static const int swap_interval_divider = 2;
+
+/* automatic swap policy:
+ *  frames in one decision window
+ *  share of late frames which switches the synchronization off, and back on
+ */
+static const uint32_t swap_window_frames = 120;
+static const double swap_late_high = 0.05;
+static const double swap_late_low  = 0.01;
+
+/* frame is late when the time between swaps is longer than this part of the expected period:
+ *  with the synchronization a missed vertical blank doubles the period,
+ *  adaptive synchronization shows late frames immediately, so they are only a bit longer,
+ *  without the synchronization the frame must leave some headroom to go back
+ */
+static const double swap_late_synchronized = 1.5;
+static const double swap_late_adaptive     = 1.05;
+static const double swap_late_immediate    = 0.9;
+
+/* how the window occupies the display
+ */
+enum class oglWindowMode {
+    windowed,   /* ordinary window with decorations */
+    borderless, /* window covers the whole monitor, video mode of the desktop is kept */
+    exclusive   /* monitor is switched to the best video mode of the native resolution */
+};
+
+/* how the swap waits for the vertical blank
+ */
+enum class oglSwapPolicy {
+    immediate, /* interval 0, the swap never waits, frames tear */
+    vsync,     /* interval 1, every frame waits for the vertical blank */
+    interval,  /* interval N, every frame stays on the screen for N vertical blanks */
+    adaptive,  /* interval -1, frames in time wait, late frames tear instead of waiting for the next blank */
+    automatic  /* vsync while frames are in time, adaptive or immediate while they are late */
+};
+
+static const std::array< const char*, 5 > swap_policy_names { "immediate", "vsync", "interval", "adaptive", "automatic" };
+static const oglSwapPolicy default_swap_policy = oglSwapPolicy::automatic;
+
+/* image copied out of the pixel buffer, written to files by the writer thread
+ */
+struct oglReadbackImage {
+    std::vector< uint8_t > pixels;
+    int                    width      { 0 };
+    int                    height     { 0 };
+    uint64_t               delay      { 0 };     /* frames between the request and the copy */
+    bool                   screenshot { false }; /* one TGA file */
+    bool                   capture    { false }; /* frame of the video capture */
+};
+
+/* buffer of the pixel ring
+ */
+struct oglPixelSlot {
+    GLuint     buffer     { 0 };
+    GLsizeiptr capacity   { 0 };       /* size of the buffer storage */
+    GLsync     fence      { nullptr }; /* GPU finished the transfer, no fence without ARB_sync */
+    uint64_t   frame      { 0 };       /* frame of the transfer */
+    bool       pending    { false };   /* transfer is not consumed yet */
+    int        width      { 0 };       /* size of the image in the buffer */
+    int        height     { 0 };
+    bool       screenshot { false };   /* consumers of the image, one read back serves both */
+    bool       capture    { false };
+};
+
+/* ring of pixel buffer objects, one transfer per slot
+ */
+struct oglPixelRing {
+    GLenum                                      target { 0 };  /* GL_PIXEL_PACK_BUFFER or GL_PIXEL_UNPACK_BUFFER */
+    GLenum                                      usage  { 0 };  /* GL_STREAM_READ or GL_STREAM_DRAW */
+    std::array< oglPixelSlot, pixel_ring_size > slots;
+    uint32_t                                    next   { 0 };  /* slot of the next transfer */
+    uint32_t                                    stalls { 0 };  /* transfers skipped, the slot was still in use */
+};
+
+/* application data
+ */
+struct oglApp {
+    bool         glfw_init { false };
+    GLFWwindow  *window    { nullptr };
+    bool         gl_loaded { false };
+
+    struct {
+        oglSwapPolicy                  policy { default_swap_policy }; /* actual policy */
+        std::optional< oglSwapPolicy > request;                        /* policy requested by the user */
+
+        bool     tear_control   { false }; /* negative intervals are supported by the window system */
+        bool     synchronized   { true };  /* automatic policy waits for the vertical blank */
+        int      interval       { 0 };     /* interval passed to the driver */
+        double   refresh_period { 1.0 / default_refresh_rate }; /* period of the monitor with the window */
+
+        double   last_swap      { 0.0 };   /* time of the previous swap, 0 - no previous frame */
+        uint32_t frames         { 0 };     /* measured frames in the current decision window */
+        uint32_t late           { 0 };     /* late frames in the current decision window */
+    } swap;
+
+    struct {
+        bool     iconified      { false };                  /* window is minimized */
+        bool     focused        { true };                   /* window receives the input */
+        bool     parked         { false };                  /* render loop doesn't draw anything */
+        double   background_fps { default_background_fps }; /* frame rate without focus, 0 - not limited */
+        double   next_frame     { 0.0 };                    /* earliest time of the next background frame */
+        uint32_t skipped        { 0 };                      /* frames not rendered while parked or limited */
+    } idle;
+
+    struct {
+        size_t   target       { default_frame_rate_target }; /* index in frame_rate_targets */
+        double   deadline     { 0.0 };                       /* start time of the next frame, 0 - no cadence yet */
+
+        double   sleep_mean   { limiter_sleep_step };        /* smoothed duration of one sleep step */
+        double   sleep_var    { 0.0 };                       /* smoothed variance of the sleep step */
+        double   sleep_worst  { limiter_sleep_guess };       /* sleep step which is still safe before the deadline */
+
+        double   period_start { 0.0 };                       /* start time of the current report period */
+        uint32_t frames       { 0 };                         /* frames in the current report period */
+        double   error_sum    { 0.0 };                       /* sum of overshoots in the current period */
+        double   error_max    { 0.0 };                       /* worst overshoot in the current period */
+        uint32_t error_count  { 0 };                         /* amount of limited frames in the current period */
+        uint32_t late_count   { 0 };                         /* frames after the deadline, the limiter didn't wait */
+    } limiter;
+
+    struct {
+        oglWindowMode                  mode { oglWindowMode::windowed }; /* actual mode of the window */
+        std::optional< oglWindowMode > request;                          /* mode requested by the user */
+
+        int x      { 0 }; /* placement of the window to restore the windowed mode */
+        int y      { 0 };
+        int width  { window_width };
+        int height { window_height };
+    } display;
+
+    struct {
+        bool          sync       { false }; /* fences are supported: OpenGL 3.2 or GL_ARB_sync */
+        uint64_t      frame      { 0 };     /* frames rendered since the start */
+
+        oglPixelRing  pack;                 /* read back of the frame */
+        bool          screenshot { false }; /* screenshot of the next frame is requested */
+        bool          capture    { false }; /* every frame is read back */
+
+        /* files are written by the writer thread, the render thread only copies mapped images,
+         * counters and the capture file belong to the writer
+         */
+        std::thread                    writer;
+        std::mutex                     mutex;
+        std::condition_variable        cv;
+        std::deque< oglReadbackImage > images;               /* images waiting for the writer */
+        bool                           stop        { false }; /* writer must finish */
+        uint32_t                       dropped     { 0 };     /* images not queued, the writer was behind */
+        std::ofstream                  capture_file;          /* frames of the video capture */
+        uint32_t                       screenshots { 0 };     /* files written */
+        uint32_t                       captured    { 0 };     /* frames written to the capture file */
+
+        oglPixelRing  unpack;               /* texture streaming */
+        GLuint        texture    { 0 };     /* texture updated every frame */
+        uint32_t      streamed   { 0 };     /* frames uploaded to the texture */
+    } pixels;
+};
+
+/* callbacks
+ */
+
+static void glfw_error_callback( int error, const char* description ) {
+    std::cerr
+        << "GLFW error: "
+            << description
+            << std::endl;
+}
+
+static void window_iconify_callback(
+    GLFWwindow* window,
+    int iconified
+) {
+    oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+    app->idle.iconified = ( iconified == GLFW_TRUE );
+}
+
+static void window_focus_callback(
+    GLFWwindow* window,
+    int focused
+) {
+    /* first background frame is rendered without delay
+     */
+    oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+    app->idle.focused    = ( focused == GLFW_TRUE );
+    app->idle.next_frame = 0.0;
+}
+
+static void key_callback(
+    GLFWwindow* window,
+    int key,
+    int scancode,
+    int action,
+    int mods
+) {
+    /* ESC - close application
+    */
+    if ( key == GLFW_KEY_ESCAPE && action == GLFW_PRESS )
+        glfwSetWindowShouldClose( window, GLFW_TRUE );
+
+    /* T - switch the target frame rate of the frame limiter
+     */
+    if ( key == GLFW_KEY_T && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        app->limiter.target   = ( app->limiter.target + 1 ) % frame_rate_targets.size();
+        app->limiter.deadline = 0.0;
+
+        const double target_fps = frame_rate_targets[app->limiter.target];
+        std::cout
+            << "Frame limiter: "
+                << ( target_fps > 0.0 ? std::to_string( target_fps ) : "off" )
+                << std::endl;
+    }
+
+    /* V - switch the swap policy, the policy is changed in the render loop
+     */
+    if ( key == GLFW_KEY_V && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        const oglSwapPolicy policy = app->swap.request.value_or( app->swap.policy );
+        app->swap.request = static_cast< oglSwapPolicy > ( ( static_cast< size_t > ( policy ) + 1 ) % swap_policy_names.size() );
+    }
+
+    /* B - switch the frame rate limit of the window without focus
+     */
+    if ( key == GLFW_KEY_B && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        app->idle.background_fps = ( app->idle.background_fps > 0.0 ) ? 0.0 : default_background_fps;
+
+        std::cout
+            << "Background frame rate: "
+                << ( app->idle.background_fps > 0.0 ? std::to_string( app->idle.background_fps ) : "not limited" )
+                << std::endl;
+    }
+
+    /* P - save the screenshot, the file is written when the read back is done
+     */
+    if ( key == GLFW_KEY_P && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        app->pixels.screenshot = true;
+    }
+
+    /* R - start or stop the video capture
+     */
+    if ( key == GLFW_KEY_R && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        app->pixels.capture = !app->pixels.capture;
+
+        std::cout
+            << "Video capture: "
+                << ( app->pixels.capture ? "on" : "off" )
+                << std::endl;
+    }
+
+    /* F11 - switch windowed, borderless and exclusive fullscreen modes,
+     * the mode is changed in the render loop
+     */
+    if ( key == GLFW_KEY_F11 && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        switch( app->display.mode ) {
+        case oglWindowMode::windowed:
+            app->display.request = oglWindowMode::borderless;
+            break;
+        case oglWindowMode::borderless:
+            app->display.request = oglWindowMode::exclusive;
+            break;
+        case oglWindowMode::exclusive:
+            app->display.request = oglWindowMode::windowed;
+            break;
+        }
+    }
+}
+
+static bool init_glfw( oglApp &app ) {
+    /* setup error callback first to catch all errors
+     */
+    (void)glfwSetErrorCallback( glfw_error_callback );
+
+    /* init the library
+     */
+    if( glfwInit() == GLFW_FALSE )
+        return false;
+
+    app.glfw_init = true;
+
+    return true;
+}
+
+static bool cleanup_glfw( oglApp &app ) {
+    if( !app.glfw_init )
+        return true;
+
+    /* cleanup GLFW resources
+     */
+    glfwTerminate();
+    app.glfw_init = false;
+
+    return true;
+}
+
+static bool init_window( oglApp &app ) {
+    if( !app.glfw_init )
+        return false;
+
+    /* request OpenGL 2.1
+     */
+    glfwWindowHint( GLFW_CONTEXT_VERSION_MAJOR, 2 );
+    glfwWindowHint( GLFW_CONTEXT_VERSION_MINOR, 1 );
+
+    /* window can be resized, minimized and covered by other windows
+     */
+    glfwWindowHint( GLFW_RESIZABLE, GLFW_TRUE );
+
+    app.window = glfwCreateWindow(
+        window_width,
+        window_height,
+        "OpenGL 2.1 - Tutorial - Swap policy",
+        nullptr,
+        nullptr
+    );
+    if( !app.window )
+        return false;
+
+    /* setup user pointer
+     */
+    glfwSetWindowUserPointer(
+        app.window,
+       &app
+    );
+
+    /* connect OpenGL context with window
+     */
+    glfwMakeContextCurrent( app.window );
+
+    /* acquire the keyboard
+     */
+    glfwSetKeyCallback(
+        app.window,
+        key_callback
+    );
+
+    /* visibility and focus drive the render loop scheduler
+     */
+    glfwSetWindowIconifyCallback(
+        app.window,
+        window_iconify_callback
+    );
+    glfwSetWindowFocusCallback(
+        app.window,
+        window_focus_callback
+    );
+    app.idle.focused = ( glfwGetWindowAttrib( app.window, GLFW_FOCUSED ) == GLFW_TRUE );
+
+    return true;
+}
+
+static bool cleanup_window( oglApp &app ) {
+    if( !app.window )
+        return true;
+
+    /* destroy GLFW window
+     */
+    glfwDestroyWindow( app.window );
+    app.window = nullptr;
+
+    return true;
+}
+
+/* window mode
+ */
+
+static GLFWmonitor* select_monitor( oglApp &app ) {
+    /* monitor under the center of the window,
+     * fullscreen window is already on its monitor
+     */
+    GLFWmonitor *window_monitor = glfwGetWindowMonitor( app.window );
+    if( window_monitor )
+        return window_monitor;
+
+    int x, y, width, height;
+    glfwGetWindowPos( app.window, &x, &y );
+    glfwGetWindowSize( app.window, &width, &height );
+    const int center_x = x + width / 2;
+    const int center_y = y + height / 2;
+
+    int monitor_count = 0;
+    GLFWmonitor **monitors = glfwGetMonitors( &monitor_count );
+    for( int i = 0; i < monitor_count; ++i ) {
+        int monitor_x, monitor_y;
+        glfwGetMonitorPos( monitors[i], &monitor_x, &monitor_y );
+        const GLFWvidmode *mode = glfwGetVideoMode( monitors[i] );
+        if( !mode )
+            continue;
+
+        if( ( center_x >= monitor_x ) && ( center_x < monitor_x + mode->width ) &&
+            ( center_y >= monitor_y ) && ( center_y < monitor_y + mode->height ) )
+            return monitors[i];
+    }
+
+    return glfwGetPrimaryMonitor();
+}
+
+static const GLFWvidmode* select_video_mode( GLFWmonitor *monitor ) {
+    int mode_count = 0;
+    const GLFWvidmode *modes = glfwGetVideoModes( monitor, &mode_count );
+    if( !modes || !mode_count )
+        return glfwGetVideoMode( monitor );
+
+    /* native resolution is the biggest one,
+     * among its modes take the highest refresh rate, then the deepest color
+     */
+    const GLFWvidmode *best = &modes[0];
+    for( int i = 1; i < mode_count; ++i ) {
+        const GLFWvidmode &mode = modes[i];
+        const int64_t mode_area = static_cast< int64_t > ( mode.width ) * mode.height;
+        const int64_t best_area = static_cast< int64_t > ( best->width ) * best->height;
+        const int mode_bits = mode.redBits + mode.greenBits + mode.blueBits;
+        const int best_bits = best->redBits + best->greenBits + best->blueBits;
+
+        if( mode_area != best_area ) {
+            if( mode_area > best_area )
+                best = &mode;
+        }
+        else if( mode.refreshRate != best->refreshRate ) {
+            if( mode.refreshRate > best->refreshRate )
+                best = &mode;
+        }
+        else if( mode_bits > best_bits )
+            best = &mode;
+    }
+
+    return best;
+}
+
+/* swap policy
+ */
+
+static void update_refresh_period( oglApp &app ) {
+    /* period of the vertical blank of the monitor with the window,
+     * some monitors report the refresh rate as 0
+     */
+    const GLFWvidmode *video_mode = glfwGetVideoMode( select_monitor( app ) );
+    const int refresh_rate = ( video_mode && ( video_mode->refreshRate > 0 ) ) ? video_mode->refreshRate : default_refresh_rate;
+    app.swap.refresh_period = 1.0 / refresh_rate;
+}
+
+static int get_swap_interval( oglApp &app ) {
+    /* negative interval needs the tear control, without it the vertical synchronization is used
+     */
+    switch( app.swap.policy ) {
+    case oglSwapPolicy::immediate:
+        return 0;
+    case oglSwapPolicy::vsync:
+        return 1;
+    case oglSwapPolicy::interval:
+        return swap_interval_divider;
+    case oglSwapPolicy::adaptive:
+        return app.swap.tear_control ? -1 : 1;
+    case oglSwapPolicy::automatic:
+        if( app.swap.synchronized )
+            return 1;
+        return app.swap.tear_control ? -1 : 0;
+    }
+    return 1;
+}
+
+static void reset_swap_timing( oglApp &app ) {
+    app.swap.last_swap = 0.0;
+    app.swap.frames    = 0;
+    app.swap.late      = 0;
+}
+
+static void apply_swap_interval( oglApp &app ) {
+    app.swap.interval = get_swap_interval( app );
+    glfwSwapInterval( app.swap.interval );
+    reset_swap_timing( app );
+}
+
+static void report_swap_policy( oglApp &app ) {
+    std::cout
+        << "Swap policy: "
+            << swap_policy_names[static_cast< size_t > ( app.swap.policy )]
+            << ", interval "
+            << app.swap.interval
+            << ", refresh "
+            << 1.0 / app.swap.refresh_period
+            << " Hz"
+            << std::endl;
+}
+
+static void init_swap_policy( oglApp &app ) {
+    /* negative intervals come with the tear control extension of the window system,
+     * the context must be current to check it
+     */
+    app.swap.tear_control = ( glfwExtensionSupported( "GLX_EXT_swap_control_tear" ) == GLFW_TRUE )
+                         || ( glfwExtensionSupported( "WGL_EXT_swap_control_tear" ) == GLFW_TRUE );
+
+    std::cout
+        << "Swap tear control: "
+            << ( app.swap.tear_control ? "supported" : "not supported" )
+            << std::endl;
+
+    update_refresh_period( app );
+    apply_swap_interval( app );
+    report_swap_policy( app );
+}
+
+static void update_swap_policy( oglApp &app ) {
+    /* the policy switched by the user starts with the synchronization
+     */
+    if( app.swap.request ) {
+        app.swap.policy = *app.swap.request;
+        app.swap.request.reset();
+        app.swap.synchronized = true;
+        apply_swap_interval( app );
+        report_swap_policy( app );
+        return;
+    }
+
+    const double now  = glfwGetTime();
+    const double last = app.swap.last_swap;
+    app.swap.last_swap = now;
+
+    /* the first frame after the pause has nothing to compare with,
+     * frames of the window without focus are slow on purpose
+     */
+    if( ( last == 0.0 ) || !app.idle.focused )
+        return;
+
+    /* the expected period is the vertical blank times the interval,
+     * or the period of the frame limiter if it is longer
+     */
+    const double target_fps = frame_rate_targets[app.limiter.target];
+    const double expected   = std::max( std::max( app.swap.interval, 1 ) * app.swap.refresh_period,
+                                        ( target_fps > 0.0 ) ? 1.0 / target_fps : 0.0 );
+    const double late_limit = ( app.swap.interval > 0 ) ? swap_late_synchronized
+                            : ( app.swap.interval < 0 ) ? swap_late_adaptive : swap_late_immediate;
+
+    app.swap.frames++;
+    if( now - last > expected * late_limit ) {
+        app.swap.late++;
+    }
+
+    if( app.swap.frames < swap_window_frames )
+        return;
+
+    const double late_share = static_cast< double > ( app.swap.late ) / app.swap.frames;
+    app.swap.frames = 0;
+    app.swap.late   = 0;
+
+    if( app.swap.policy != oglSwapPolicy::automatic )
+        return;
+
+    /* synchronized frames which miss the vertical blank wait for the next one and the frame rate halves,
+     * so with many late frames the synchronization is switched off, and back on when frames are in time again
+     */
+    const bool synchronized = app.swap.synchronized ? ( late_share <= swap_late_high )
+                                                    : ( late_share <  swap_late_low );
+    if( synchronized == app.swap.synchronized )
+        return;
+
+    app.swap.synchronized = synchronized;
+    apply_swap_interval( app );
+
+    std::cout
+        << "Swap policy: automatic, late frames "
+            << 100.0 * late_share
+            << "%, interval "
+            << app.swap.interval
+            << std::endl;
+}
+
+static void set_window_mode( oglApp &app, oglWindowMode mode ) {
+    if( mode == app.display.mode )
+        return;
+
+    /* remember where the window was to return it back later
+     */
+    if( app.display.mode == oglWindowMode::windowed ) {
+        glfwGetWindowPos( app.window, &app.display.x, &app.display.y );
+        glfwGetWindowSize( app.window, &app.display.width, &app.display.height );
+    }
+
+    GLFWmonitor *monitor = select_monitor( app );
+    const GLFWvidmode *video_mode = nullptr;
+    switch( mode ) {
+    case oglWindowMode::windowed:
+        glfwSetWindowMonitor( app.window,
+                              nullptr,
+                              app.display.x,
+                              app.display.y,
+                              app.display.width,
+                              app.display.height,
+                              GLFW_DONT_CARE );
+        break;
+    case oglWindowMode::borderless:
+        /* the same video mode as the desktop, the monitor doesn't switch
+         */
+        video_mode = glfwGetVideoMode( monitor );
+        break;
+    case oglWindowMode::exclusive:
+        video_mode = select_video_mode( monitor );
+        break;
+    }
+
+    if( video_mode ) {
+        glfwSetWindowMonitor( app.window,
+                              monitor,
+                              0,
+                              0,
+                              video_mode->width,
+                              video_mode->height,
+                              video_mode->refreshRate );
+    }
+
+    app.display.mode = mode;
+
+    std::cout
+        << "Window mode: "
+            << ( mode == oglWindowMode::windowed ? "windowed"
+                 : mode == oglWindowMode::borderless ? "borderless" : "exclusive" );
+    if( video_mode ) {
+        std::cout
+            << ", "
+                << glfwGetMonitorName( monitor )
+                << ' '
+                << video_mode->width
+                << 'x'
+                << video_mode->height
+                << '@'
+                << video_mode->refreshRate
+                << "Hz";
+    }
+    std::cout
+        << std::endl;
+}
+
+static void update_window_mode( oglApp &app ) {
+    if( !app.display.request )
+        return;
+
+    set_window_mode( app, *app.display.request );
+    app.display.request.reset();
+
+    /* OpenGL context stays the same,
+     * but some drivers forget the swap interval after the switch,
+     * and the monitor might have another refresh rate
+     */
+    update_refresh_period( app );
+    apply_swap_interval( app );
+}
+
+/* pixel buffers
+ */
+
+static void create_pixel_ring( oglPixelRing &ring, GLenum target, GLenum usage ) {
+    ring.target = target;
+    ring.usage  = usage;
+    for( auto &slot: ring.slots )
+        glGenBuffers( 1, &slot.buffer );
+}
+
+static void release_pixel_slot( oglPixelSlot &slot ) {
+    if( slot.fence )
+        glDeleteSync( slot.fence );
+    slot.fence   = nullptr;
+    slot.pending = false;
+}
+
+static void cleanup_pixel_ring( oglPixelRing &ring ) {
+    for( auto &slot: ring.slots ) {
+        release_pixel_slot( slot );
+        glDeleteBuffers( 1, &slot.buffer );
+        slot.buffer   = 0;
+        slot.capacity = 0;
+    }
+}
+
+static void reserve_pixel_slot( oglPixelRing &ring, oglPixelSlot &slot, GLsizeiptr size ) {
+    /* the buffer grows with the window and never shrinks
+     */
+    if( slot.capacity >= size )
+        return;
+
+    glBufferData( ring.target, size, nullptr, ring.usage );
+    slot.capacity = size;
+}
+
+static bool is_pixel_slot_ready( oglApp &app, const oglPixelSlot &slot ) {
+    if( !slot.pending )
+        return true;
+
+    /* the fence is only tested, nobody waits
+     */
+    if( slot.fence )
+        return glClientWaitSync( slot.fence, 0, 0 ) != GL_TIMEOUT_EXPIRED;
+
+    /* without fences the slot is considered ready when the ring went around,
+     * GPU is rarely that late, otherwise the map waits for it
+     */
+    return ( app.pixels.frame - slot.frame ) >= pixel_ring_size - 1;
+}
+
+static void fence_pixel_slot( oglApp &app, oglPixelRing &ring, oglPixelSlot &slot ) {
+    if( app.pixels.sync )
+        slot.fence = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+    slot.frame   = app.pixels.frame;
+    slot.pending = true;
+
+    ring.next = ( ring.next + 1 ) % pixel_ring_size;
+}
+
+static void write_screenshot( oglApp &app, const oglReadbackImage &image ) {
+    /* TGA keeps BGRA pixels from bottom to top, exactly like glReadPixels returns them
+     */
+    const std::string file_name = "screenshot_" + std::to_string( app.pixels.screenshots++ ) + ".tga";
+    const uint8_t header[18] = {
+        0, 0, 2,                        /* no ID, no color map, uncompressed true color */
+        0, 0, 0, 0, 0,                  /* color map */
+        0, 0, 0, 0,                     /* origin */
+        static_cast< uint8_t > ( image.width & 0xFF ), static_cast< uint8_t > ( image.width >> 8 ),
+        static_cast< uint8_t > ( image.height & 0xFF ), static_cast< uint8_t > ( image.height >> 8 ),
+        32, 8                           /* bits per pixel, 8 bits of alpha, bottom-left origin */
+    };
+
+    std::ofstream file( file_name, std::ios::binary );
+    file.write( reinterpret_cast< const char* > ( header ), sizeof( header ) );
+    file.write( reinterpret_cast< const char* > ( image.pixels.data() ), static_cast< std::streamsize > ( image.pixels.size() ) );
+
+    std::cout
+        << "Screenshot: "
+            << file_name
+            << ", "
+            << image.width
+            << 'x'
+            << image.height
+            << ", "
+            << image.delay
+            << " frames after the request"
+            << std::endl;
+}
+
+static void write_capture( oglApp &app, const oglReadbackImage &image ) {
+    if( !app.pixels.capture_file.is_open() )
+        app.pixels.capture_file.open( capture_file_name, std::ios::binary | std::ios::trunc );
+
+    app.pixels.capture_file.write( reinterpret_cast< const char* > ( image.pixels.data() ), static_cast< std::streamsize > ( image.pixels.size() ) );
+    app.pixels.captured++;
+}
+
+static void image_writer( oglApp *app ) {
+    std::unique_lock< std::mutex > lock( app->pixels.mutex );
+    for( ;; ) {
+        app->pixels.cv.wait( lock, [app] { return app->pixels.stop || !app->pixels.images.empty(); } );
+        if( app->pixels.images.empty() )
+            return;
+
+        oglReadbackImage image = std::move( app->pixels.images.front() );
+        app->pixels.images.pop_front();
+
+        /* files are slow, the render thread must not wait for them
+         */
+        lock.unlock();
+        if( image.screenshot )
+            write_screenshot( *app, image );
+        if( image.capture )
+            write_capture( *app, image );
+        lock.lock();
+    }
+}
+
+static void queue_readback_image( oglApp &app, oglReadbackImage &&image ) {
+    {
+        std::lock_guard< std::mutex > lock( app.pixels.mutex );
+        if( app.pixels.images.size() >= max_pending_images ) {
+            app.pixels.dropped++;
+            return;
+        }
+        app.pixels.images.push_back( std::move( image ) );
+    }
+    app.pixels.cv.notify_one();
+}
+
+static void stop_image_writer( oglApp &app ) {
+    /* the writer finishes all queued images before it exits
+     */
+    if( app.pixels.writer.joinable() ) {
+        {
+            std::lock_guard< std::mutex > lock( app.pixels.mutex );
+            app.pixels.stop = true;
+        }
+        app.pixels.cv.notify_one();
+        app.pixels.writer.join();
+    }
+    app.pixels.capture_file.close();
+}
+
+static bool request_readback( oglApp &app, bool screenshot, bool capture, int width, int height ) {
+    /* the frame is dropped instead of waiting for the oldest read back
+     */
+    oglPixelRing &ring = app.pixels.pack;
+    oglPixelSlot &slot = ring.slots[ring.next];
+    if( slot.pending ) {
+        ring.stalls++;
+        return false;
+    }
+
+    /* glReadPixels into the bound pack buffer returns immediately,
+     * the copy is done by GPU later
+     */
+    glBindBuffer( GL_PIXEL_PACK_BUFFER, slot.buffer );
+    reserve_pixel_slot( ring, slot, static_cast< GLsizeiptr > ( width ) * height * 4 );
+    glReadPixels( 0, 0, width, height, GL_BGRA, GL_UNSIGNED_BYTE, nullptr );
+    glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 );
+
+    slot.width      = width;
+    slot.height     = height;
+    slot.screenshot = screenshot;
+    slot.capture    = capture;
+    fence_pixel_slot( app, ring, slot );
+
+    return true;
+}
+
+static void update_readbacks( oglApp &app ) {
+    /* images are consumed in the order of requests, starting from the oldest slot
+     */
+    oglPixelRing &ring = app.pixels.pack;
+    for( uint32_t i = 0; i < pixel_ring_size; ++i ) {
+        oglPixelSlot &slot = ring.slots[( ring.next + i ) % pixel_ring_size];
+        if( !slot.pending )
+            continue;
+        if( !is_pixel_slot_ready( app, slot ) )
+            break;
+
+        /* the mapped image is only copied, files are written by the writer thread
+         */
+        oglReadbackImage image;
+        glBindBuffer( GL_PIXEL_PACK_BUFFER, slot.buffer );
+        const uint8_t *pixels = static_cast< const uint8_t* > ( glMapBuffer( GL_PIXEL_PACK_BUFFER, GL_READ_ONLY ) );
+        if( pixels ) {
+            image.pixels.assign( pixels, pixels + static_cast< size_t > ( slot.width ) * slot.height * 4 );
+            glUnmapBuffer( GL_PIXEL_PACK_BUFFER );
+        }
+        glBindBuffer( GL_PIXEL_PACK_BUFFER, 0 );
+
+        image.width      = slot.width;
+        image.height     = slot.height;
+        image.delay      = app.pixels.frame - slot.frame;
+        image.screenshot = slot.screenshot;
+        image.capture    = slot.capture;
+        release_pixel_slot( slot );
+
+        if( pixels )
+            queue_readback_image( app, std::move( image ) );
+    }
+}
+
+static void write_stream_pixels( uint8_t *pixels, double time ) {
+    /* plasma, changes every frame like a video
+     */
+    const float t = static_cast< float > ( time );
+    for( int y = 0; y < stream_texture_size; ++y ) {
+        for( int x = 0; x < stream_texture_size; ++x ) {
+            const float u = static_cast< float > ( x ) / stream_texture_size;
+            const float v = static_cast< float > ( y ) / stream_texture_size;
+            const float wave = std::sin( 10.0f * u + t ) + std::sin( 10.0f * v + 1.3f * t ) + std::sin( 10.0f * ( u + v ) + 0.7f * t );
+
+            uint8_t *texel = pixels + ( y * stream_texture_size + x ) * 4;
+            texel[0] = static_cast< uint8_t > ( 127.5f + 127.5f * std::sin( wave + 4.0f ) );
+            texel[1] = static_cast< uint8_t > ( 127.5f + 127.5f * std::sin( wave + 2.0f ) );
+            texel[2] = static_cast< uint8_t > ( 127.5f + 127.5f * std::sin( wave ) );
+            texel[3] = 255;
+        }
+    }
+}
+
+static void stream_texture( oglApp &app ) {
+    /* the frame of the stream is skipped instead of waiting for GPU
+     */
+    oglPixelRing &ring = app.pixels.unpack;
+    oglPixelSlot &slot = ring.slots[ring.next];
+    if( !is_pixel_slot_ready( app, slot ) ) {
+        ring.stalls++;
+        return;
+    }
+    release_pixel_slot( slot );
+
+    const GLsizeiptr size = static_cast< GLsizeiptr > ( stream_texture_size ) * stream_texture_size * 4;
+    glBindBuffer( GL_PIXEL_UNPACK_BUFFER, slot.buffer );
+    reserve_pixel_slot( ring, slot, size );
+
+    /* without fences the storage is orphaned, so the map never waits for GPU
+     */
+    if( !app.pixels.sync )
+        glBufferData( GL_PIXEL_UNPACK_BUFFER, size, nullptr, ring.usage );
+
+    uint8_t *pixels = static_cast< uint8_t* > ( glMapBuffer( GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY ) );
+    if( pixels ) {
+        write_stream_pixels( pixels, glfwGetTime() );
+        glUnmapBuffer( GL_PIXEL_UNPACK_BUFFER );
+
+        /* the texture reads from the bound unpack buffer, the copy is done by GPU
+         */
+        glBindTexture( GL_TEXTURE_2D, app.pixels.texture );
+        glTexSubImage2D( GL_TEXTURE_2D, 0, 0, 0, stream_texture_size, stream_texture_size, GL_BGRA, GL_UNSIGNED_BYTE, nullptr );
+        glBindTexture( GL_TEXTURE_2D, 0 );
+        app.pixels.streamed++;
+    }
+    glBindBuffer( GL_PIXEL_UNPACK_BUFFER, 0 );
+
+    fence_pixel_slot( app, ring, slot );
+}
+
+static bool load_arb_sync() {
+    /* Glad is generated without extensions and loads the fence functions
+     * only for OpenGL 3.2; functions of GL_ARB_sync have the same names
+     * without a suffix, so they are loaded into the same pointers
+     */
+    glad_glFenceSync = reinterpret_cast< PFNGLFENCESYNCPROC > ( glfwGetProcAddress( "glFenceSync" ) );
+    glad_glClientWaitSync = reinterpret_cast< PFNGLCLIENTWAITSYNCPROC > ( glfwGetProcAddress( "glClientWaitSync" ) );
+    glad_glDeleteSync = reinterpret_cast< PFNGLDELETESYNCPROC > ( glfwGetProcAddress( "glDeleteSync" ) );
+
+    return glad_glFenceSync && glad_glClientWaitSync && glad_glDeleteSync;
+}
+
+static void create_pixel_buffers( oglApp &app ) {
+    /* pixel buffer objects are part of OpenGL 2.1,
+     * fences come with OpenGL 3.2 or GL_ARB_sync
+     */
+    app.pixels.sync = GLAD_GL_VERSION_3_2 || ( gladHasExtension( "GL_ARB_sync" ) && load_arb_sync() );
+    create_pixel_ring( app.pixels.pack, GL_PIXEL_PACK_BUFFER, GL_STREAM_READ );
+    create_pixel_ring( app.pixels.unpack, GL_PIXEL_UNPACK_BUFFER, GL_STREAM_DRAW );
+
+    glGenTextures( 1, &app.pixels.texture );
+    glBindTexture( GL_TEXTURE_2D, app.pixels.texture );
+    glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA8, stream_texture_size, stream_texture_size, 0, GL_BGRA, GL_UNSIGNED_BYTE, nullptr );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+    glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+    glBindTexture( GL_TEXTURE_2D, 0 );
+
+    std::cout
+        << "Pixel buffers: "
+            << pixel_ring_size
+            << " per ring, fences "
+            << ( app.pixels.sync ? "on" : "not supported" )
+            << std::endl;
+
+    /* screenshots and the video capture are written to files outside of the render thread
+     */
+    app.pixels.writer = std::thread( image_writer, &app );
+}
+
+static void cleanup_pixel_buffers( oglApp &app ) {
+    /* the last read backs are still written: GPU finishes everything,
+     * then slots without fences are ready too
+     */
+    glFinish();
+    app.pixels.frame += pixel_ring_size;
+    update_readbacks( app );
+    stop_image_writer( app );
+
+    std::cout
+        << "Pixel buffers: screenshots "
+            << app.pixels.screenshots
+            << ", captured frames "
+            << app.pixels.captured
+            << ", dropped read backs "
+            << app.pixels.pack.stalls
+            << ", dropped images "
+            << app.pixels.dropped
+            << ", streamed frames "
+            << app.pixels.streamed
+            << ", skipped uploads "
+            << app.pixels.unpack.stalls
+            << std::endl;
+
+    cleanup_pixel_ring( app.pixels.pack );
+    cleanup_pixel_ring( app.pixels.unpack );
+    glDeleteTextures( 1, &app.pixels.texture );
+    app.pixels.texture = 0;
+}
+
+static bool init_opengl( oglApp &app ) {
+    if( !app.window )
+        return false;
+
+    /* run Glad and load actual version of OpenGL
+     */
+    if( !gladLoadGL() )
+        return false;
+
+    /* Glad is generated without extensions, read the list of the context once
+     */
+    if( !gladLoadExtensions() )
+        return false;
+
+    app.gl_loaded = true;
+
+    std::cout
+        << "OpenGL renderer: "
+            << reinterpret_cast< const char* > ( glGetString( GL_RENDERER ) )
+            << std::endl;
+
+    std::cout
+        << "OpenGL driver version: "
+            << reinterpret_cast< const char* > ( glGetString( GL_VERSION ) )
+            << std::endl;
+
+    /* swap interval is chosen by the policy and changed at runtime
+     */
+    init_swap_policy( app );
+
+    /* setup window clean color - light blue
+     */
+    glClearColor( 0.0f, 0.3f, 0.6f, 1.0f );
+
+    /* rings of pixel buffers for the read back and for the texture streaming
+     */
+    create_pixel_buffers( app );
+
+    return true;
+}
+
+static bool cleanup_opengl( oglApp &app ) {
+    if( !app.gl_loaded )
+        return false;
+
+    cleanup_pixel_buffers( app );
+
+    app.gl_loaded = false;
+
+    return true;
+}
+
+static bool init( oglApp &app ) {
+    if( !init_glfw( app ) )
+        return false;
+    if( !init_window( app ) )
+        return false;
+    if( !init_opengl( app ) )
+        return false;
+
+    return true;
+}
+
+static bool cleanup( oglApp &app ) {
+    if( !cleanup_opengl( app ) )
+        return false;
+    if( !cleanup_window( app ) )
+        return false;
+    if( !cleanup_glfw( app ) )
+        return false;
+
+    return true;
+}
+
+/* idle scheduler
+ */
+
+static bool is_window_visible( oglApp &app ) {
+    if( app.idle.iconified )
+        return false;
+    if( glfwGetWindowAttrib( app.window, GLFW_VISIBLE ) == GLFW_FALSE )
+        return false;
+
+    /* some platforms report the minimized window only by the zero size
+     */
+    int frame_width, frame_height;
+    glfwGetFramebufferSize(
+        app.window,
+       &frame_width,
+       &frame_height
+    );
+    return ( frame_width != 0 ) && ( frame_height != 0 );
+}
+
+static void park( oglApp &app, bool parked ) {
+    if( app.idle.parked == parked )
+        return;
+    app.idle.parked = parked;
+
+    /* the pause is not a late frame
+     */
+    reset_swap_timing( app );
+
+    std::cout
+        << "Rendering "
+            << ( parked ? "paused" : "resumed" )
+            << ", frames skipped: "
+            << app.idle.skipped
+            << std::endl;
+    app.idle.skipped = 0;
+}
+
+static bool update_idle( oglApp &app ) {
+    /* invisible window draws nothing and sleeps until any event,
+     * timeout is only a safety net for platforms without iconify events
+     */
+    if( !is_window_visible( app ) ) {
+        park( app, true );
+        app.idle.skipped++;
+        glfwWaitEventsTimeout( idle_wait_timeout );
+        return false;
+    }
+    park( app, false );
+
+    if( app.idle.focused || ( app.idle.background_fps <= 0.0 ) )
+        return true;
+
+    /* window without focus sleeps until the next frame is due,
+     * input still wakes it up earlier
+     */
+    const double now = glfwGetTime();
+    if( now < app.idle.next_frame ) {
+        app.idle.skipped++;
+        glfwWaitEventsTimeout( app.idle.next_frame - now );
+        return false;
+    }
+
+    /* keep the cadence, but don't catch up missed frames after a long sleep
+     */
+    const double period = 1.0 / app.idle.background_fps;
+    app.idle.next_frame = ( now - app.idle.next_frame > period ) ? now + period
+                                                                 : app.idle.next_frame + period;
+
+    return true;
+}
+
+/* frame limiter
+ */
+
+static void update_sleep_estimate( oglApp &app, double slept ) {
+    /* the OS wakes the thread up later than requested, how much later depends on
+     * the timer resolution and the load, so the worst case is learned at runtime
+     */
+    const double delta = slept - app.limiter.sleep_mean;
+    app.limiter.sleep_mean += limiter_sleep_smoothing * delta;
+    app.limiter.sleep_var   = ( 1.0 - limiter_sleep_smoothing ) * ( app.limiter.sleep_var + limiter_sleep_smoothing * delta * delta );
+    app.limiter.sleep_worst = app.limiter.sleep_mean + 2.0 * std::sqrt( app.limiter.sleep_var );
+}
+
+static void report_frame_limiter( oglApp &app, double now ) {
+    app.limiter.frames++;
+
+    /* report once per second
+     */
+    const double period = now - app.limiter.period_start;
+    if( period < 1.0 )
+        return;
+
+    std::cout
+        << "Frame limiter: "
+            << app.limiter.frames / period
+            << " fps, error "
+            << ( app.limiter.error_count ? 1000000.0 * app.limiter.error_sum / app.limiter.error_count : 0.0 )
+            << " us, max "
+            << 1000000.0 * app.limiter.error_max
+            << " us, late frames "
+            << app.limiter.late_count
+            << std::endl;
+
+    app.limiter.period_start = now;
+    app.limiter.frames       = 0;
+    app.limiter.error_sum    = 0.0;
+    app.limiter.error_max    = 0.0;
+    app.limiter.error_count  = 0;
+    app.limiter.late_count   = 0;
+}
+
+static void limit_frame_rate( oglApp &app ) {
+    const double target_fps = frame_rate_targets[app.limiter.target];
+    if( target_fps <= 0.0 ) {
+        app.limiter.deadline = 0.0;
+        return;
+    }
+
+    const double period = 1.0 / target_fps;
+    double now = glfwGetTime();
+
+    /* first frame: start the cadence and the report period
+     */
+    if( app.limiter.deadline == 0.0 ) {
+        app.limiter.deadline     = now + period;
+        app.limiter.period_start = now;
+        app.limiter.frames       = 0;
+        return;
+    }
+
+    /* the frame is late for the whole period: start the new cadence,
+     * missed frames are not caught up, the report keeps counting frames
+     */
+    if( now - app.limiter.deadline > period ) {
+        app.limiter.deadline = now + period;
+        app.limiter.late_count++;
+        report_frame_limiter( app, now );
+        return;
+    }
+
+    /* the frame came after the deadline by itself, the limiter has nothing to wait for,
+     * the lateness comes from the time of the frame and is not the error of the limiter
+     */
+    const bool waited = ( now < app.limiter.deadline );
+
+    /* sleep in short steps while even the worst step ends before the deadline
+     */
+    while( app.limiter.deadline - now > app.limiter.sleep_worst ) {
+        std::this_thread::sleep_for( std::chrono::duration< double >( limiter_sleep_step ) );
+        const double woke = glfwGetTime();
+        update_sleep_estimate( app, woke - now );
+        now = woke;
+    }
+
+    /* spin the rest of the time, the thread gives CPU to others but never sleeps
+     */
+    while( now < app.limiter.deadline ) {
+        std::this_thread::yield();
+        now = glfwGetTime();
+    }
+
+    /* overshoot is the error of the limiter itself
+     */
+    if( waited ) {
+        const double error = now - app.limiter.deadline;
+        app.limiter.error_sum += error;
+        app.limiter.error_max  = std::max( app.limiter.error_max, error );
+        app.limiter.error_count++;
+    }
+    else
+        app.limiter.late_count++;
+
+    app.limiter.deadline += period;
+    report_frame_limiter( app, now );
+}
+
+static void draw( oglApp &app ) {
+    int frame_width, frame_height;
+
+    /* read the actual frame buffer size of the window
+     */
+    glfwGetFramebufferSize(
+        app.window,
+       &frame_width,
+       &frame_height
+    );
+
+        /* Synchronize viewport with window size
+         */
+        glViewport(
+            0, 0,
+            frame_width, frame_height
+        );
+
+        /* clean window background
+         */
+        glClear(
+            GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT
+        );
+
+        /* read backs of previous frames go to files when GPU finished them
+         */
+        update_readbacks( app );
+
+        /* streamed texture in the corner of the window
+         */
+        stream_texture( app );
+
+        const float corner_width  = 2.0f * stream_texture_size / std::max( frame_width, 1 );
+        const float corner_height = 2.0f * stream_texture_size / std::max( frame_height, 1 );
+        glEnable( GL_TEXTURE_2D );
+        glBindTexture( GL_TEXTURE_2D, app.pixels.texture );
+        glBegin( GL_QUADS );
+            glTexCoord2f( 0.0f, 0.0f ); glVertex2f( 1.0f - corner_width, -1.0f );
+            glTexCoord2f( 1.0f, 0.0f ); glVertex2f( 1.0f,                -1.0f );
+            glTexCoord2f( 1.0f, 1.0f ); glVertex2f( 1.0f,                -1.0f + corner_height );
+            glTexCoord2f( 0.0f, 1.0f ); glVertex2f( 1.0f - corner_width, -1.0f + corner_height );
+        glEnd();
+        glBindTexture( GL_TEXTURE_2D, 0 );
+        glDisable( GL_TEXTURE_2D );
+
+        /* read back of the finished frame, before the swap
+         */
+        if( app.pixels.screenshot || app.pixels.capture ) {
+            if( request_readback( app, app.pixels.screenshot, app.pixels.capture, frame_width, frame_height ) )
+                app.pixels.screenshot = false;
+        }
+        app.pixels.frame++;
+
+    /* update window
+     */
+    glfwSwapBuffers( app.window );
+
+    /* late frames switch the automatic swap policy
+     */
+    update_swap_policy( app );
+}
+
+int main() {
+    oglApp app;
+
+    if( !init( app ) ) {
+        std::cerr
+            << "Cannot initialize the application"
+                << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    /* render loop
+     */
+    while( glfwWindowShouldClose( app.window ) == GLFW_FALSE ) {
+        /* hidden or limited window waits for events instead of the next frame
+         */
+        if( !update_idle( app ) )
+            continue;
+
+        /* wait for the start of the next frame at the target frame rate
+         */
+        limit_frame_rate( app );
+
+        /* draw the context of the window
+         */
+        draw( app );
+
+        /* proceed keyboard and mouse
+         */
+        glfwPollEvents();
+
+        /* switch the window mode on request of the user
+         */
+        update_window_mode( app );
+    }
+
+    if( !cleanup( app ) ) {
+        std::cerr
+            << "Cleanup failed"
+                << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout
+        << "Job is done!"
+            << std::endl;
+    return EXIT_SUCCESS;
+}
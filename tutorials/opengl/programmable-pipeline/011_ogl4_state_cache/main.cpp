@@ -0,0 +1,1771 @@
+/*
+    OpenGL 4.6 tutorial
+    
+    State cache
+ */
+
+#include <cstdlib>
+#include <cstdint>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <array>
+#include <algorithm>
+#include <cmath>
+#include <chrono>
+#include <thread>
+#include <optional>
+#include <map>
+#include <tuple>
+#include <deque>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+/* don't load OpenGL, will be done by Glad
+ */
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+#include <glad/glad.h>
+#include <glad/glad_ext.h>
+
+
+/* initial size of the window
+ */
+static const int window_width  = 1280;
+static const int window_height = 720;
+
+/* invisible window wakes up at least this often to check its state, in seconds
+ */
+static const double idle_wait_timeout = 0.5;
+
+/* frame rate of the window without focus, 0 - not limited
+ */
+static const double default_background_fps = 10.0;
+
+/* frame rates of the frame limiter switched by the key, 0 - not limited
+ */
+static const std::array< double, 5 > frame_rate_targets { 0.0, 60.0, 90.0, 120.0, 144.0 };
+static const size_t default_frame_rate_target = 2;
+
+/* frame limiter settings:
+ *  duration of one sleep step, in seconds
+ *  initial guess of the worst sleep step, in seconds
+ *  weight of the new measurement in the sleep statistics
+ */
+static const double limiter_sleep_step = 0.001;
+static const double limiter_sleep_guess = 0.005;
+static const double limiter_sleep_smoothing = 0.1;
+
+/* amount of frames which can wait for their GPU time,
+ * results are read a few frames later without stalling the pipeline
+ */
+static const uint32_t timer_frames = 4;
+
+/* measured GPU passes of the frame
+ */
+static const std::array< const char*, 2 > gpu_pass_names { "clear", "particles" };
+
+/* streamed geometry: amount of quads written every frame, every quad is two triangles
+ */
+static const uint32_t stream_quads    = 20000;
+static const uint32_t stream_vertices = stream_quads * 6;
+
+/* amount of regions in the persistent ring: GPU might read two of them while CPU writes the third
+ */
+static const uint32_t stream_regions = 3;
+
+/* wait for the region of the ring, in nanoseconds
+ */
+static const GLuint64 stream_wait_timeout = 1000000;
+
+/* particles are drawn by several batches, every batch sets own state like an independent renderer
+ */
+static const uint32_t particle_batches = 8;
+
+/* size of the particle sprite in texels
+ */
+static const int sprite_size = 16;
+
+/* texture units shadowed by the state cache
+ */
+static const uint32_t state_texture_units = 16;
+
+/* amount of frames measured in every upload mode at the start
+ */
+static const uint32_t benchmark_frames = 300;
+
+/* particle shaders
+ */
+static const char particle_vertex_shader[] = R"(
+#version 460 core
+
+layout( location = 0 ) in vec2 position;
+layout( location = 1 ) in vec4 color;
+
+out vec4 vertex_color;
+out vec2 sprite_coord;
+
+/* every quad is two triangles, the corner is known from the vertex index
+ */
+const vec2 corners[6] = vec2[6](
+    vec2( 0.0, 0.0 ), vec2( 1.0, 0.0 ), vec2( 1.0, 1.0 ),
+    vec2( 0.0, 0.0 ), vec2( 1.0, 1.0 ), vec2( 0.0, 1.0 )
+);
+
+void main() {
+    gl_Position  = vec4( position, 0.0, 1.0 );
+    vertex_color = color;
+    sprite_coord = corners[gl_VertexID % 6];
+}
+)";
+
+static const char particle_fragment_shader[] = R"(
+#version 460 core
+
+layout( binding = 0 ) uniform sampler2D sprite;
+
+in  vec4 vertex_color;
+in  vec2 sprite_coord;
+out vec4 fragment_color;
+
+void main() {
+    fragment_color = vec4( vertex_color.rgb, vertex_color.a * texture( sprite, sprite_coord ).r );
+}
+)";
+
+/* debug context is created in debug builds, release builds create the context without
+ * error checking, environment variable OGL_DEBUG=1 switches the debug context on in any build
+ */
+#ifdef NDEBUG
+static const bool default_debug_context = false;
+#else
+static const bool default_debug_context = true;
+#endif
+static const char debug_context_variable[] = "OGL_DEBUG";
+
+/* every message is counted, but only first messages with the same ID are logged
+ */
+static const uint64_t debug_log_repeats = 3;
+
+/* how the window occupies the display
+ */
+enum class oglWindowMode {
+    windowed,   /* ordinary window with decorations */
+    borderless, /* window covers the whole monitor, video mode of the desktop is kept */
+    exclusive   /* monitor is switched to the best video mode of the native resolution */
+};
+
+/* how the streamed geometry gets to GPU
+ */
+enum class oglUploadMode {
+    persistent, /* write directly to the persistently mapped ring */
+    subdata,    /* glBufferSubData to the same buffer every frame */
+    orphan      /* glBufferData( nullptr ) orphans the old storage, then glBufferSubData */
+};
+static const std::array< const char*, 3 > upload_mode_names { "persistent", "subdata", "orphan" };
+
+/* vertex of the particle
+ */
+struct oglVertex {
+    float   x, y;       /* position in normalized device coordinates */
+    uint8_t r, g, b, a; /* color */
+};
+
+/* message of the debug output waiting for the logger
+ */
+struct oglDebugMessage {
+    GLenum      source;
+    GLenum      type;
+    GLuint      id;
+    GLenum      severity;
+    std::string text;
+};
+
+/* application data
+ */
+struct oglApp {
+    bool         glfw_init { false };
+    GLFWwindow  *window    { nullptr };
+    bool         gl_loaded { false };
+    bool         vsync     { false }; /* swap waits for the vertical blank */
+
+    struct {
+        bool     iconified      { false };                  /* window is minimized */
+        bool     focused        { true };                   /* window receives the input */
+        bool     parked         { false };                  /* render loop doesn't draw anything */
+        double   background_fps { default_background_fps }; /* frame rate without focus, 0 - not limited */
+        double   next_frame     { 0.0 };                    /* earliest time of the next background frame */
+        uint32_t skipped        { 0 };                      /* frames not rendered while parked or limited */
+    } idle;
+
+    struct {
+        size_t   target       { default_frame_rate_target }; /* index in frame_rate_targets */
+        double   deadline     { 0.0 };                       /* start time of the next frame, 0 - no cadence yet */
+
+        double   sleep_mean   { limiter_sleep_step };        /* smoothed duration of one sleep step */
+        double   sleep_var    { 0.0 };                       /* smoothed variance of the sleep step */
+        double   sleep_worst  { limiter_sleep_guess };       /* sleep step which is still safe before the deadline */
+
+        double   error_sum    { 0.0 };                       /* sum of overshoots in the current period */
+        double   error_max    { 0.0 };                       /* worst overshoot in the current period */
+        uint32_t error_count  { 0 };                         /* amount of limited frames in the current period */
+        uint32_t late_count   { 0 };                         /* frames after the deadline, the limiter didn't wait */
+    } limiter;
+
+    struct {
+        oglWindowMode                  mode { oglWindowMode::windowed }; /* actual mode of the window */
+        std::optional< oglWindowMode > request;                          /* mode requested by the user */
+
+        int x      { 0 }; /* placement of the window to restore the windowed mode */
+        int y      { 0 };
+        int width  { window_width };
+        int height { window_height };
+
+        int frame_width  { 0 }; /* size of the frame buffer, updated only by the callback */
+        int frame_height { 0 };
+    } display;
+
+    /* shadow copy of OpenGL state, std::nullopt and missing keys - state is unknown
+     */
+    struct {
+        bool                                             enabled { true }; /* redundant calls are skipped */
+
+        std::optional< std::array< GLint, 4 > >          viewport;
+        std::optional< std::array< GLfloat, 4 > >        clear_color;
+        std::map< GLenum, GLuint >                       buffers;   /* per target */
+        std::array< std::optional< GLuint >, state_texture_units > textures; /* per texture unit */
+        std::optional< GLuint >                          program;
+        std::optional< GLuint >                          vertex_array;
+        std::map< GLenum, bool >                         enables;   /* per capability */
+
+        uint64_t                                         issued  { 0 }; /* calls passed to OpenGL in the current period */
+        uint64_t                                         skipped { 0 }; /* redundant calls in the current period */
+    } state;
+
+    struct {
+        bool     supported { false }; /* GL_TIMESTAMP counter has valid bits */
+        bool     active    { false }; /* current frame writes timestamps */
+
+        /* one timestamp before the first pass and one after every pass
+         */
+        std::array< std::array< GLuint, gpu_pass_names.size() + 1 >, timer_frames > queries {};
+        std::array< bool, timer_frames > pending {}; /* queries of the frame wait for the result */
+        uint32_t write   { 0 };                     /* slot of the current frame */
+        uint32_t read    { 0 };                     /* oldest slot waiting for the result */
+        uint32_t dropped { 0 };                     /* frames not measured because the ring was full */
+    } timer;
+
+    struct {
+        bool                     context  { false }; /* context is created with debug flag */
+        bool                     no_error { false }; /* context doesn't check errors */
+
+        /* messages arrive from driver threads, the callback only counts them
+         * and queues the text, the logger thread writes it
+         */
+        std::mutex                          mutex;
+        std::condition_variable             cv;
+        std::map< std::tuple< GLenum, GLenum, GLuint >, uint64_t > counters; /* per source, type and ID */
+        std::deque< oglDebugMessage >       queue;           /* messages waiting for the logger */
+        bool                                stop { false };  /* logger must finish */
+        std::thread                         logger;          /* logging thread */
+
+        std::atomic< uint32_t >             messages    { 0 }; /* messages in the current report period */
+        std::atomic< uint32_t >             performance { 0 }; /* performance warnings in the current report period */
+    } debug;
+
+    struct {
+        GLuint                  program { 0 };       /* particle shaders */
+        GLuint                  vao     { 0 };       /* vertex format of particles */
+        GLuint                  sprite  { 0 };       /* round shape of the particle */
+
+        bool                    persistent { false };       /* immutable storage with DSA is supported */
+        GLuint                  ring       { 0 };           /* persistently mapped buffer */
+        uint8_t                *ring_data  { nullptr };     /* the buffer is mapped for the whole lifetime */
+        GLsizeiptr              region_size { 0 };          /* one region keeps all vertices of the frame */
+        uint32_t                region     { 0 };           /* region of the current frame */
+        std::array< GLsync, stream_regions > fences {};     /* GPU finished reading the region */
+
+        GLuint                  buffer  { 0 };              /* buffer of naive upload modes */
+        std::vector< oglVertex > staging;                   /* vertices of naive upload modes */
+
+        oglUploadMode           mode    { oglUploadMode::persistent }; /* actual upload mode */
+        uint32_t                waits   { 0 };              /* region was still in use by GPU */
+    } stream;
+
+    struct {
+        bool                    running { true };  /* benchmark switches upload modes by itself */
+        uint32_t                frames  { 0 };     /* frames measured in the actual mode */
+        double                  upload_time_sum { 0.0 };
+        std::array< double, upload_mode_names.size() > results {}; /* average upload time of every mode */
+    } benchmark;
+
+    struct {
+        double   period_start { 0.0 }; /* start time of the current report period */
+        uint32_t frames       { 0 };   /* frames in the current report period */
+        double   cpu_time_sum { 0.0 }; /* CPU time spent in draw() without the swap */
+        double   upload_time_sum { 0.0 }; /* CPU time of the geometry upload */
+
+        std::array< double, gpu_pass_names.size() > gpu_time_sum {}; /* GPU time of every pass */
+        uint32_t gpu_samples  { 0 };   /* frames with GPU time in the current period */
+    } stats;
+};
+
+/* callbacks
+ */
+
+static void glfw_error_callback( int error, const char* description ) {
+    std::cerr
+        << "GLFW error: "
+            << description
+            << std::endl;
+}
+
+static void window_iconify_callback(
+    GLFWwindow* window,
+    int iconified
+) {
+    oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+    app->idle.iconified = ( iconified == GLFW_TRUE );
+}
+
+static void window_focus_callback(
+    GLFWwindow* window,
+    int focused
+) {
+    /* first background frame is rendered without delay
+     */
+    oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+    app->idle.focused    = ( focused == GLFW_TRUE );
+    app->idle.next_frame = 0.0;
+}
+
+static void framebuffer_size_callback(
+    GLFWwindow* window,
+    int width,
+    int height
+) {
+    /* the only place which reads the size of the frame buffer,
+     * draw() doesn't query the window every frame
+     */
+    oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+    app->display.frame_width  = width;
+    app->display.frame_height = height;
+}
+
+static void key_callback(
+    GLFWwindow* window,
+    int key,
+    int scancode,
+    int action,
+    int mods
+) {
+    /* ESC - close application
+    */
+    if ( key == GLFW_KEY_ESCAPE && action == GLFW_PRESS )
+        glfwSetWindowShouldClose( window, GLFW_TRUE );
+
+    /* T - switch the target frame rate of the frame limiter
+     */
+    if ( key == GLFW_KEY_T && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        app->limiter.target   = ( app->limiter.target + 1 ) % frame_rate_targets.size();
+        app->limiter.deadline = 0.0;
+
+        const double target_fps = frame_rate_targets[app->limiter.target];
+        std::cout
+            << "Frame limiter: "
+                << ( target_fps > 0.0 ? std::to_string( target_fps ) : "off" )
+                << std::endl;
+    }
+
+    /* V - switch the vertical synchronization
+     */
+    if ( key == GLFW_KEY_V && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        app->vsync = !app->vsync;
+        glfwSwapInterval( app->vsync ? 1 : 0 );
+
+        std::cout
+            << "Vertical synchronization: "
+                << ( app->vsync ? "on" : "off" )
+                << std::endl;
+    }
+
+    /* U - switch the upload mode of the geometry, the benchmark stops
+     */
+    if ( key == GLFW_KEY_U && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        app->benchmark.running = false;
+        do {
+            const size_t mode = ( static_cast< size_t > ( app->stream.mode ) + 1 ) % upload_mode_names.size();
+            app->stream.mode = static_cast< oglUploadMode > ( mode );
+        } while( ( app->stream.mode == oglUploadMode::persistent ) && !app->stream.persistent );
+
+        std::cout
+            << "Upload mode: "
+                << upload_mode_names[static_cast< size_t > ( app->stream.mode )]
+                << std::endl;
+    }
+
+    /* C - switch the state cache, without the cache every call goes to the driver
+     */
+    if ( key == GLFW_KEY_C && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        app->state.enabled = !app->state.enabled;
+
+        std::cout
+            << "State cache: "
+                << ( app->state.enabled ? "on" : "off" )
+                << std::endl;
+    }
+
+    /* B - switch the frame rate limit of the window without focus
+     */
+    if ( key == GLFW_KEY_B && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        app->idle.background_fps = ( app->idle.background_fps > 0.0 ) ? 0.0 : default_background_fps;
+
+        std::cout
+            << "Background frame rate: "
+                << ( app->idle.background_fps > 0.0 ? std::to_string( app->idle.background_fps ) : "not limited" )
+                << std::endl;
+    }
+
+    /* F11 - switch windowed, borderless and exclusive fullscreen modes,
+     * the mode is changed in the render loop
+     */
+    if ( key == GLFW_KEY_F11 && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        switch( app->display.mode ) {
+        case oglWindowMode::windowed:
+            app->display.request = oglWindowMode::borderless;
+            break;
+        case oglWindowMode::borderless:
+            app->display.request = oglWindowMode::exclusive;
+            break;
+        case oglWindowMode::exclusive:
+            app->display.request = oglWindowMode::windowed;
+            break;
+        }
+    }
+}
+
+static bool init_glfw( oglApp &app ) {
+    /* setup error callback first to catch all errors
+     */
+    (void)glfwSetErrorCallback( glfw_error_callback );
+
+    /* init the library
+     */
+    if( glfwInit() == GLFW_FALSE )
+        return false;
+
+    app.glfw_init = true;
+
+    return true;
+}
+
+static bool cleanup_glfw( oglApp &app ) {
+    if( !app.glfw_init )
+        return true;
+
+    /* cleanup GLFW resources
+     */
+    glfwTerminate();
+    app.glfw_init = false;
+
+    return true;
+}
+
+static bool init_window( oglApp &app ) {
+    if( !app.glfw_init )
+        return false;
+
+    /* request OpenGL 4.6
+     */
+    glfwWindowHint( GLFW_CONTEXT_VERSION_MAJOR, 4 );
+    glfwWindowHint( GLFW_CONTEXT_VERSION_MINOR, 6 );
+
+    /* window can be resized, minimized and covered by other windows
+     */
+    glfwWindowHint( GLFW_RESIZABLE, GLFW_TRUE );
+
+    /* debug context reports errors and warnings of the driver,
+     * otherwise the driver doesn't check errors at all
+     */
+    const char *debug_variable = std::getenv( debug_context_variable );
+    app.debug.context = default_debug_context || ( debug_variable && std::string( debug_variable ) == "1" );
+    glfwWindowHint( GLFW_OPENGL_DEBUG_CONTEXT, app.debug.context ? GLFW_TRUE : GLFW_FALSE );
+    glfwWindowHint( GLFW_CONTEXT_NO_ERROR, app.debug.context ? GLFW_FALSE : GLFW_TRUE );
+
+    app.window = glfwCreateWindow(
+        window_width,
+        window_height,
+        "OpenGL 4.6 - Tutorial - State cache",
+        nullptr,
+        nullptr
+    );
+    if( !app.window )
+        return false;
+
+    /* setup user pointer
+     */
+    glfwSetWindowUserPointer(
+        app.window,
+       &app
+    );
+
+    /* connect OpenGL context with window
+     */
+    glfwMakeContextCurrent( app.window );
+    glfwSwapInterval( app.vsync ? 1 : 0 );  /* frame rate is limited by the application */
+
+    /* acquire the keyboard
+     */
+    glfwSetKeyCallback(
+        app.window,
+        key_callback
+    );
+
+    /* visibility and focus drive the render loop scheduler
+     */
+    glfwSetWindowIconifyCallback(
+        app.window,
+        window_iconify_callback
+    );
+    glfwSetWindowFocusCallback(
+        app.window,
+        window_focus_callback
+    );
+    app.idle.focused = ( glfwGetWindowAttrib( app.window, GLFW_FOCUSED ) == GLFW_TRUE );
+
+    /* size of the frame buffer is read once here and then updated by the callback
+     */
+    glfwSetFramebufferSizeCallback(
+        app.window,
+        framebuffer_size_callback
+    );
+    glfwGetFramebufferSize(
+        app.window,
+       &app.display.frame_width,
+       &app.display.frame_height
+    );
+
+    return true;
+}
+
+static bool cleanup_window( oglApp &app ) {
+    if( !app.window )
+        return true;
+
+    /* destroy GLFW window
+     */
+    glfwDestroyWindow( app.window );
+    app.window = nullptr;
+
+    return true;
+}
+
+/* window mode
+ */
+
+static GLFWmonitor* select_monitor( oglApp &app ) {
+    /* monitor under the center of the window,
+     * fullscreen window is already on its monitor
+     */
+    GLFWmonitor *window_monitor = glfwGetWindowMonitor( app.window );
+    if( window_monitor )
+        return window_monitor;
+
+    int x, y, width, height;
+    glfwGetWindowPos( app.window, &x, &y );
+    glfwGetWindowSize( app.window, &width, &height );
+    const int center_x = x + width / 2;
+    const int center_y = y + height / 2;
+
+    int monitor_count = 0;
+    GLFWmonitor **monitors = glfwGetMonitors( &monitor_count );
+    for( int i = 0; i < monitor_count; ++i ) {
+        int monitor_x, monitor_y;
+        glfwGetMonitorPos( monitors[i], &monitor_x, &monitor_y );
+        const GLFWvidmode *mode = glfwGetVideoMode( monitors[i] );
+        if( !mode )
+            continue;
+
+        if( ( center_x >= monitor_x ) && ( center_x < monitor_x + mode->width ) &&
+            ( center_y >= monitor_y ) && ( center_y < monitor_y + mode->height ) )
+            return monitors[i];
+    }
+
+    return glfwGetPrimaryMonitor();
+}
+
+static const GLFWvidmode* select_video_mode( GLFWmonitor *monitor ) {
+    int mode_count = 0;
+    const GLFWvidmode *modes = glfwGetVideoModes( monitor, &mode_count );
+    if( !modes || !mode_count )
+        return glfwGetVideoMode( monitor );
+
+    /* native resolution is the biggest one,
+     * among its modes take the highest refresh rate, then the deepest color
+     */
+    const GLFWvidmode *best = &modes[0];
+    for( int i = 1; i < mode_count; ++i ) {
+        const GLFWvidmode &mode = modes[i];
+        const int64_t mode_area = static_cast< int64_t > ( mode.width ) * mode.height;
+        const int64_t best_area = static_cast< int64_t > ( best->width ) * best->height;
+        const int mode_bits = mode.redBits + mode.greenBits + mode.blueBits;
+        const int best_bits = best->redBits + best->greenBits + best->blueBits;
+
+        if( mode_area != best_area ) {
+            if( mode_area > best_area )
+                best = &mode;
+        }
+        else if( mode.refreshRate != best->refreshRate ) {
+            if( mode.refreshRate > best->refreshRate )
+                best = &mode;
+        }
+        else if( mode_bits > best_bits )
+            best = &mode;
+    }
+
+    return best;
+}
+
+static void set_window_mode( oglApp &app, oglWindowMode mode ) {
+    if( mode == app.display.mode )
+        return;
+
+    /* remember where the window was to return it back later
+     */
+    if( app.display.mode == oglWindowMode::windowed ) {
+        glfwGetWindowPos( app.window, &app.display.x, &app.display.y );
+        glfwGetWindowSize( app.window, &app.display.width, &app.display.height );
+    }
+
+    GLFWmonitor *monitor = select_monitor( app );
+    const GLFWvidmode *video_mode = nullptr;
+    switch( mode ) {
+    case oglWindowMode::windowed:
+        glfwSetWindowMonitor( app.window,
+                              nullptr,
+                              app.display.x,
+                              app.display.y,
+                              app.display.width,
+                              app.display.height,
+                              GLFW_DONT_CARE );
+        break;
+    case oglWindowMode::borderless:
+        /* the same video mode as the desktop, the monitor doesn't switch
+         */
+        video_mode = glfwGetVideoMode( monitor );
+        break;
+    case oglWindowMode::exclusive:
+        video_mode = select_video_mode( monitor );
+        break;
+    }
+
+    if( video_mode ) {
+        glfwSetWindowMonitor( app.window,
+                              monitor,
+                              0,
+                              0,
+                              video_mode->width,
+                              video_mode->height,
+                              video_mode->refreshRate );
+    }
+
+    app.display.mode = mode;
+
+    std::cout
+        << "Window mode: "
+            << ( mode == oglWindowMode::windowed ? "windowed"
+                 : mode == oglWindowMode::borderless ? "borderless" : "exclusive" );
+    if( video_mode ) {
+        std::cout
+            << ", "
+                << glfwGetMonitorName( monitor )
+                << ' '
+                << video_mode->width
+                << 'x'
+                << video_mode->height
+                << '@'
+                << video_mode->refreshRate
+                << "Hz";
+    }
+    std::cout
+        << std::endl;
+}
+
+static void update_window_mode( oglApp &app ) {
+    if( !app.display.request )
+        return;
+
+    set_window_mode( app, *app.display.request );
+    app.display.request.reset();
+
+    /* OpenGL context stays the same,
+     * but some drivers forget the swap interval after the switch
+     */
+    glfwSwapInterval( app.vsync ? 1 : 0 );
+}
+
+/* GPU timer
+ */
+
+static bool create_gpu_timer( oglApp &app ) {
+    /* timestamps are part of OpenGL 3.3,
+     * but the counter might have no valid bits on some implementations
+     */
+    GLint counter_bits = 0;
+    glGetQueryiv( GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &counter_bits );
+    app.timer.supported = ( counter_bits > 0 );
+    if( !app.timer.supported ) {
+        std::cout
+            << "GPU timer is not supported"
+                << std::endl;
+        return true;
+    }
+
+    for( auto &frame_queries: app.timer.queries )
+        glGenQueries( static_cast< GLsizei > ( frame_queries.size() ), frame_queries.data() );
+
+    return true;
+}
+
+static void cleanup_gpu_timer( oglApp &app ) {
+    if( !app.timer.supported )
+        return;
+
+    for( auto &frame_queries: app.timer.queries )
+        glDeleteQueries( static_cast< GLsizei > ( frame_queries.size() ), frame_queries.data() );
+    app.timer.supported = false;
+}
+
+static void read_gpu_timer( oglApp &app ) {
+    /* queries finish in order, when the last timestamp of the frame is available
+     * all others are available too, the result is read without waiting
+     */
+    while( app.timer.pending[app.timer.read] ) {
+        const auto &frame_queries = app.timer.queries[app.timer.read];
+
+        GLint available = GL_FALSE;
+        glGetQueryObjectiv( frame_queries.back(), GL_QUERY_RESULT_AVAILABLE, &available );
+        if( available == GL_FALSE )
+            break;
+
+        std::array< GLuint64, gpu_pass_names.size() + 1 > timestamps;
+        for( size_t i = 0; i < frame_queries.size(); ++i )
+            glGetQueryObjectui64v( frame_queries[i], GL_QUERY_RESULT, &timestamps[i] );
+
+        for( size_t pass = 0; pass < gpu_pass_names.size(); ++pass )
+            app.stats.gpu_time_sum[pass] += ( timestamps[pass + 1] - timestamps[pass] ) / 1000000.0;
+        app.stats.gpu_samples++;
+
+        app.timer.pending[app.timer.read] = false;
+        app.timer.read = ( app.timer.read + 1 ) % timer_frames;
+    }
+}
+
+static void begin_gpu_frame( oglApp &app ) {
+    app.timer.active = false;
+    if( !app.timer.supported )
+        return;
+
+    read_gpu_timer( app );
+
+    /* the ring is full when GPU is too far behind,
+     * the frame is not measured instead of waiting for the old results
+     */
+    if( app.timer.pending[app.timer.write] ) {
+        app.timer.dropped++;
+        return;
+    }
+
+    app.timer.active = true;
+    glQueryCounter( app.timer.queries[app.timer.write][0], GL_TIMESTAMP );
+}
+
+static void end_gpu_pass( oglApp &app, size_t pass ) {
+    if( !app.timer.active )
+        return;
+
+    glQueryCounter( app.timer.queries[app.timer.write][pass + 1], GL_TIMESTAMP );
+}
+
+static void end_gpu_frame( oglApp &app ) {
+    if( !app.timer.active )
+        return;
+
+    app.timer.pending[app.timer.write] = true;
+    app.timer.write = ( app.timer.write + 1 ) % timer_frames;
+}
+
+/* debug output
+ */
+
+static const char* debug_source_name( GLenum source ) {
+    switch( source ) {
+    case GL_DEBUG_SOURCE_API:             return "API";
+    case GL_DEBUG_SOURCE_WINDOW_SYSTEM:   return "window system";
+    case GL_DEBUG_SOURCE_SHADER_COMPILER: return "shader compiler";
+    case GL_DEBUG_SOURCE_THIRD_PARTY:     return "third party";
+    case GL_DEBUG_SOURCE_APPLICATION:     return "application";
+    default:                              return "other";
+    }
+}
+
+static const char* debug_type_name( GLenum type ) {
+    switch( type ) {
+    case GL_DEBUG_TYPE_ERROR:               return "error";
+    case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "deprecated";
+    case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:  return "undefined behavior";
+    case GL_DEBUG_TYPE_PORTABILITY:         return "portability";
+    case GL_DEBUG_TYPE_PERFORMANCE:         return "performance";
+    case GL_DEBUG_TYPE_MARKER:              return "marker";
+    case GL_DEBUG_TYPE_PUSH_GROUP:          return "push group";
+    case GL_DEBUG_TYPE_POP_GROUP:           return "pop group";
+    default:                                return "other";
+    }
+}
+
+static const char* debug_severity_name( GLenum severity ) {
+    switch( severity ) {
+    case GL_DEBUG_SEVERITY_HIGH:   return "high";
+    case GL_DEBUG_SEVERITY_MEDIUM: return "medium";
+    case GL_DEBUG_SEVERITY_LOW:    return "low";
+    default:                       return "notification";
+    }
+}
+
+static void APIENTRY gl_debug_callback(
+          GLenum  source,
+          GLenum  type,
+          GLuint  id,
+          GLenum  severity,
+          GLsizei length,
+    const GLchar *message,
+    const void   *user_param
+) {
+    /* the output is asynchronous, the callback might be called by any thread
+     * of the driver, so it only counts the message and queues it for the logger
+     */
+    oglApp *app = static_cast< oglApp* > ( const_cast< void* > ( user_param ) );
+    app->debug.messages++;
+    if( type == GL_DEBUG_TYPE_PERFORMANCE )
+        app->debug.performance++;
+
+    {
+        std::lock_guard< std::mutex > lock( app->debug.mutex );
+        const uint64_t count = ++app->debug.counters[std::make_tuple( source, type, id )];
+        if( count > debug_log_repeats )
+            return;
+
+        app->debug.queue.push_back( oglDebugMessage {
+            .source   = source,
+            .type     = type,
+            .id       = id,
+            .severity = severity,
+            .text     = ( length < 0 ) ? std::string( message ) : std::string( message, length )
+        } );
+    }
+    app->debug.cv.notify_one();
+}
+
+static void debug_logger( oglApp *app ) {
+    std::unique_lock< std::mutex > lock( app->debug.mutex );
+    for( ;; ) {
+        app->debug.cv.wait( lock, [app] { return app->debug.stop || !app->debug.queue.empty(); } );
+        if( app->debug.queue.empty() )
+            return;
+
+        oglDebugMessage message = std::move( app->debug.queue.front() );
+        app->debug.queue.pop_front();
+
+        /* the output is slow, the callback must not wait for it
+         */
+        lock.unlock();
+        std::cerr
+            << "OpenGL "
+                << debug_type_name( message.type )
+                << " ("
+                << debug_source_name( message.source )
+                << ", "
+                << debug_severity_name( message.severity )
+                << ", ID "
+                << message.id
+                << "): "
+                << message.text
+                << std::endl;
+        lock.lock();
+    }
+}
+
+static bool create_debug_output( oglApp &app ) {
+    GLint context_flags = 0;
+    glGetIntegerv( GL_CONTEXT_FLAGS, &context_flags );
+    app.debug.context  = ( context_flags & GL_CONTEXT_FLAG_DEBUG_BIT ) != 0;
+    app.debug.no_error = ( context_flags & GL_CONTEXT_FLAG_NO_ERROR_BIT ) != 0;
+
+    std::cout
+        << "OpenGL context: "
+            << ( app.debug.context ? "debug" : app.debug.no_error ? "no error" : "default" )
+            << std::endl;
+
+    /* KHR_debug is part of OpenGL 4.3
+     */
+    if( !app.debug.context )
+        return true;
+    if( !GLAD_GL_VERSION_4_3 && !gladHasExtension( "GL_KHR_debug" ) ) {
+        app.debug.context = false;
+        return true;
+    }
+
+    app.debug.logger = std::thread( debug_logger, &app );
+
+    /* all messages are counted, GL_DEBUG_OUTPUT_SYNCHRONOUS is not enabled,
+     * so the driver doesn't slow down every call to report the message in place
+     */
+    glDebugMessageControl( GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, nullptr, GL_TRUE );
+    glDebugMessageCallback( gl_debug_callback, &app );
+    glEnable( GL_DEBUG_OUTPUT );
+
+    return true;
+}
+
+static void cleanup_debug_output( oglApp &app ) {
+    if( !app.debug.context )
+        return;
+
+    glDisable( GL_DEBUG_OUTPUT );
+    glDebugMessageCallback( nullptr, nullptr );
+
+    {
+        std::lock_guard< std::mutex > lock( app.debug.mutex );
+        app.debug.stop = true;
+    }
+    app.debug.cv.notify_all();
+    if( app.debug.logger.joinable() )
+        app.debug.logger.join();
+
+    /* most frequent messages first
+     */
+    std::vector< std::pair< std::tuple< GLenum, GLenum, GLuint >, uint64_t > > counters(
+        app.debug.counters.begin(),
+        app.debug.counters.end()
+    );
+    std::sort( counters.begin(),
+               counters.end(),
+               []( const auto &a, const auto &b ) { return a.second > b.second; } );
+    for( const auto &[key, count]: counters ) {
+        std::cout
+            << "OpenGL "
+                << debug_type_name( std::get< 1 >( key ) )
+                << " ("
+                << debug_source_name( std::get< 0 >( key ) )
+                << ", ID "
+                << std::get< 2 >( key )
+                << "): "
+                << count
+                << " times"
+                << std::endl;
+    }
+
+    app.debug.context = false;
+}
+
+/* state cache
+ */
+
+static void invalidate_state_cache( oglApp &app ) {
+    /* OpenGL state is unknown, the next call of every kind goes to the driver,
+     * required after deletion of bound objects or after foreign code changed the state
+     */
+    app.state.viewport.reset();
+    app.state.clear_color.reset();
+    app.state.buffers.clear();
+    app.state.textures.fill( std::nullopt );
+    app.state.program.reset();
+    app.state.vertex_array.reset();
+    app.state.enables.clear();
+}
+
+static bool skip_state( oglApp &app, bool redundant ) {
+    if( app.state.enabled && redundant ) {
+        app.state.skipped++;
+        return true;
+    }
+
+    app.state.issued++;
+    return false;
+}
+
+static void set_viewport( oglApp &app, GLint x, GLint y, GLsizei width, GLsizei height ) {
+    const std::array< GLint, 4 > viewport { x, y, width, height };
+    if( skip_state( app, app.state.viewport == viewport ) )
+        return;
+
+    app.state.viewport = viewport;
+    glViewport( x, y, width, height );
+}
+
+static void set_clear_color( oglApp &app, GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha ) {
+    const std::array< GLfloat, 4 > clear_color { red, green, blue, alpha };
+    if( skip_state( app, app.state.clear_color == clear_color ) )
+        return;
+
+    app.state.clear_color = clear_color;
+    glClearColor( red, green, blue, alpha );
+}
+
+static void bind_buffer( oglApp &app, GLenum target, GLuint buffer ) {
+    const auto it = app.state.buffers.find( target );
+    if( skip_state( app, ( it != app.state.buffers.end() ) && ( it->second == buffer ) ) )
+        return;
+
+    app.state.buffers[target] = buffer;
+    glBindBuffer( target, buffer );
+}
+
+static void bind_texture( oglApp &app, GLuint unit, GLuint texture ) {
+    /* glBindTextureUnit doesn't depend on the active texture unit
+     */
+    if( skip_state( app, app.state.textures[unit] == texture ) )
+        return;
+
+    app.state.textures[unit] = texture;
+    glBindTextureUnit( unit, texture );
+}
+
+static void use_program( oglApp &app, GLuint program ) {
+    if( skip_state( app, app.state.program == program ) )
+        return;
+
+    app.state.program = program;
+    glUseProgram( program );
+}
+
+static void bind_vertex_array( oglApp &app, GLuint vertex_array ) {
+    if( skip_state( app, app.state.vertex_array == vertex_array ) )
+        return;
+
+    app.state.vertex_array = vertex_array;
+    glBindVertexArray( vertex_array );
+}
+
+static void set_enabled( oglApp &app, GLenum capability, bool enabled ) {
+    const auto it = app.state.enables.find( capability );
+    if( skip_state( app, ( it != app.state.enables.end() ) && ( it->second == enabled ) ) )
+        return;
+
+    app.state.enables[capability] = enabled;
+    if( enabled )
+        glEnable( capability );
+    else
+        glDisable( capability );
+}
+
+/* shaders
+ */
+
+static bool create_shader( GLenum type, const char *source, GLuint &shader ) {
+    shader = glCreateShader( type );
+    glShaderSource( shader, 1, &source, nullptr );
+    glCompileShader( shader );
+
+    GLint status = GL_FALSE;
+    glGetShaderiv( shader, GL_COMPILE_STATUS, &status );
+    if( status == GL_TRUE )
+        return true;
+
+    GLint log_length = 0;
+    glGetShaderiv( shader, GL_INFO_LOG_LENGTH, &log_length );
+    std::string log( std::max( log_length, 1 ), '\0' );
+    glGetShaderInfoLog( shader, log_length, nullptr, log.data() );
+    std::cerr
+        << "Shader compilation failed: "
+            << log.c_str()
+            << std::endl;
+
+    glDeleteShader( shader );
+    shader = 0;
+    return false;
+}
+
+static bool create_program( const char *vertex_source, const char *fragment_source, GLuint &program ) {
+    GLuint vertex_shader, fragment_shader;
+    if( !create_shader( GL_VERTEX_SHADER, vertex_source, vertex_shader ) )
+        return false;
+    if( !create_shader( GL_FRAGMENT_SHADER, fragment_source, fragment_shader ) ) {
+        glDeleteShader( vertex_shader );
+        return false;
+    }
+
+    program = glCreateProgram();
+    glAttachShader( program, vertex_shader );
+    glAttachShader( program, fragment_shader );
+    glLinkProgram( program );
+
+    /* shaders are not needed after the link
+     */
+    glDetachShader( program, vertex_shader );
+    glDetachShader( program, fragment_shader );
+    glDeleteShader( vertex_shader );
+    glDeleteShader( fragment_shader );
+
+    GLint status = GL_FALSE;
+    glGetProgramiv( program, GL_LINK_STATUS, &status );
+    if( status == GL_TRUE )
+        return true;
+
+    GLint log_length = 0;
+    glGetProgramiv( program, GL_INFO_LOG_LENGTH, &log_length );
+    std::string log( std::max( log_length, 1 ), '\0' );
+    glGetProgramInfoLog( program, log_length, nullptr, log.data() );
+    std::cerr
+        << "Program link failed: "
+            << log.c_str()
+            << std::endl;
+
+    glDeleteProgram( program );
+    program = 0;
+    return false;
+}
+
+/* streaming buffers
+ */
+
+static bool create_stream( oglApp &app ) {
+    if( !create_program( particle_vertex_shader, particle_fragment_shader, app.stream.program ) )
+        return false;
+
+    /* vertex format doesn't depend on the buffer,
+     * the buffer is attached to the binding 0 before the draw
+     */
+    glCreateVertexArrays( 1, &app.stream.vao );
+    glVertexArrayAttribFormat( app.stream.vao, 0, 2, GL_FLOAT, GL_FALSE, offsetof( oglVertex, x ) );
+    glVertexArrayAttribFormat( app.stream.vao, 1, 4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof( oglVertex, r ) );
+    glVertexArrayAttribBinding( app.stream.vao, 0, 0 );
+    glVertexArrayAttribBinding( app.stream.vao, 1, 0 );
+    glEnableVertexArrayAttrib( app.stream.vao, 0 );
+    glEnableVertexArrayAttrib( app.stream.vao, 1 );
+
+    /* round sprite with soft edge, particles are blended additively
+     */
+    std::array< uint8_t, sprite_size * sprite_size > sprite_texels;
+    for( int y = 0; y < sprite_size; ++y ) {
+        for( int x = 0; x < sprite_size; ++x ) {
+            const float dx = ( x + 0.5f ) / sprite_size * 2.0f - 1.0f;
+            const float dy = ( y + 0.5f ) / sprite_size * 2.0f - 1.0f;
+            const float intensity = std::clamp( 1.0f - std::sqrt( dx * dx + dy * dy ), 0.0f, 1.0f );
+            sprite_texels[y * sprite_size + x] = static_cast< uint8_t > ( 255.0f * intensity );
+        }
+    }
+    glCreateTextures( GL_TEXTURE_2D, 1, &app.stream.sprite );
+    glTextureStorage2D( app.stream.sprite, 1, GL_R8, sprite_size, sprite_size );
+    glTextureSubImage2D( app.stream.sprite, 0, 0, 0, sprite_size, sprite_size, GL_RED, GL_UNSIGNED_BYTE, sprite_texels.data() );
+    glTextureParameteri( app.stream.sprite, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
+    glTextureParameteri( app.stream.sprite, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+    glTextureParameteri( app.stream.sprite, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+    glTextureParameteri( app.stream.sprite, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+    glBlendFunc( GL_SRC_ALPHA, GL_ONE );
+
+    app.stream.region_size = static_cast< GLsizeiptr > ( stream_vertices * sizeof( oglVertex ) );
+
+    /* immutable storage is mapped once for the whole lifetime of the buffer,
+     * coherent mapping makes CPU writes visible to GPU without explicit flush;
+     * the buffer is created with DSA functions, so OpenGL 4.5 is needed
+     * even though the storage itself is OpenGL 4.4
+     */
+    app.stream.persistent = GLAD_GL_VERSION_4_5;
+    if( app.stream.persistent ) {
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glCreateBuffers( 1, &app.stream.ring );
+        glNamedBufferStorage( app.stream.ring, app.stream.region_size * stream_regions, nullptr, flags );
+        app.stream.ring_data = static_cast< uint8_t* > (
+            glMapNamedBufferRange( app.stream.ring, 0, app.stream.region_size * stream_regions, flags )
+        );
+        if( !app.stream.ring_data ) {
+            std::cerr
+                << "Cannot map the streaming buffer"
+                    << std::endl;
+            return false;
+        }
+    }
+    else
+        app.stream.mode = oglUploadMode::subdata;
+
+    /* naive upload modes use the ordinary buffer
+     */
+    glCreateBuffers( 1, &app.stream.buffer );
+    glNamedBufferData( app.stream.buffer, app.stream.region_size, nullptr, GL_STREAM_DRAW );
+    app.stream.staging.resize( stream_vertices );
+
+    return true;
+}
+
+static void cleanup_stream( oglApp &app ) {
+    for( auto &fence: app.stream.fences ) {
+        if( fence )
+            glDeleteSync( fence );
+        fence = nullptr;
+    }
+
+    if( app.stream.ring_data )
+        glUnmapNamedBuffer( app.stream.ring );
+    app.stream.ring_data = nullptr;
+
+    glDeleteBuffers( 1, &app.stream.ring );
+    glDeleteBuffers( 1, &app.stream.buffer );
+    glDeleteTextures( 1, &app.stream.sprite );
+    glDeleteVertexArrays( 1, &app.stream.vao );
+    glDeleteProgram( app.stream.program );
+    app.stream.ring    = 0;
+    app.stream.buffer  = 0;
+    app.stream.sprite  = 0;
+    app.stream.vao     = 0;
+    app.stream.program = 0;
+
+    /* deleted objects are unbound by OpenGL
+     */
+    invalidate_state_cache( app );
+}
+
+static oglVertex* stream_map( oglApp &app, GLint &first_vertex ) {
+    /* the region is free when GPU finished the frame which read it last time,
+     * with three regions this is almost always true already
+     */
+    GLsync &fence = app.stream.fences[app.stream.region];
+    if( fence ) {
+        GLenum res = glClientWaitSync( fence, 0, 0 );
+        if( res == GL_TIMEOUT_EXPIRED ) {
+            app.stream.waits++;
+
+            /* flush once, otherwise the fence might stay in the queue of the driver forever
+             */
+            GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+            do {
+                res = glClientWaitSync( fence, flags, stream_wait_timeout );
+                flags = 0;
+            } while( res == GL_TIMEOUT_EXPIRED );
+        }
+        if( res == GL_WAIT_FAILED ) {
+            std::cerr
+                << "Fail to wait for the streaming buffer"
+                    << std::endl;
+        }
+
+        glDeleteSync( fence );
+        fence = nullptr;
+    }
+
+    first_vertex = static_cast< GLint > ( app.stream.region * stream_vertices );
+    return reinterpret_cast< oglVertex* > ( app.stream.ring_data + app.stream.region * app.stream.region_size );
+}
+
+static void stream_fence( oglApp &app ) {
+    /* GPU signals the fence when all commands of the region are done
+     */
+    app.stream.fences[app.stream.region] = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+    app.stream.region = ( app.stream.region + 1 ) % stream_regions;
+}
+
+static void write_particles( oglVertex *vertices, float time ) {
+    const float size = 0.004f;
+
+    for( uint32_t i = 0; i < stream_quads; ++i ) {
+        /* every particle has own orbit, speed and color,
+         * fractions of irrational numbers spread them evenly
+         */
+        const float index  = static_cast< float > ( i );
+        const float orbit  = index * 0.7548776662f - std::floor( index * 0.7548776662f );
+        const float speed  = index * 0.5698402910f - std::floor( index * 0.5698402910f );
+        const float phase  = index * 2.3999632297f;
+        const float radius = 0.05f + 0.9f * orbit;
+        const float angle  = phase + time * ( 0.2f + speed );
+
+        const float x = radius * std::cos( angle );
+        const float y = radius * std::sin( angle );
+        const uint8_t r = static_cast< uint8_t > ( 255.0f * orbit );
+        const uint8_t g = static_cast< uint8_t > ( 255.0f * speed );
+        const uint8_t b = 255;
+
+        oglVertex *quad = vertices + i * 6;
+        quad[0] = oglVertex { x - size, y - size, r, g, b, 255 };
+        quad[1] = oglVertex { x + size, y - size, r, g, b, 255 };
+        quad[2] = oglVertex { x + size, y + size, r, g, b, 255 };
+        quad[3] = oglVertex { x - size, y - size, r, g, b, 255 };
+        quad[4] = oglVertex { x + size, y + size, r, g, b, 255 };
+        quad[5] = oglVertex { x - size, y + size, r, g, b, 255 };
+    }
+}
+
+static double draw_particles( oglApp &app ) {
+    const float time = static_cast< float > ( glfwGetTime() );
+    const double upload_start = glfwGetTime();
+
+    GLuint buffer = app.stream.buffer;
+    GLint first_vertex = 0;
+    switch( app.stream.mode ) {
+    case oglUploadMode::persistent:
+        /* map -> write -> draw, the driver doesn't copy anything
+         */
+        write_particles( stream_map( app, first_vertex ), time );
+        buffer = app.stream.ring;
+        break;
+    case oglUploadMode::subdata:
+        /* the driver either waits until GPU finishes the previous draw
+         * or copies the data to own temporary memory
+         */
+        write_particles( app.stream.staging.data(), time );
+        bind_buffer( app, GL_ARRAY_BUFFER, app.stream.buffer );
+        glBufferSubData( GL_ARRAY_BUFFER, 0, app.stream.region_size, app.stream.staging.data() );
+        break;
+    case oglUploadMode::orphan:
+        /* the driver allocates new storage, the old one is released when GPU is done
+         */
+        write_particles( app.stream.staging.data(), time );
+        bind_buffer( app, GL_ARRAY_BUFFER, app.stream.buffer );
+        glBufferData( GL_ARRAY_BUFFER, app.stream.region_size, nullptr, GL_STREAM_DRAW );
+        glBufferSubData( GL_ARRAY_BUFFER, 0, app.stream.region_size, app.stream.staging.data() );
+        break;
+    }
+    const double upload_time = glfwGetTime() - upload_start;
+
+    glVertexArrayVertexBuffer( app.stream.vao, 0, buffer, 0, sizeof( oglVertex ) );
+
+    /* every batch sets the whole state it needs and doesn't restore anything,
+     * the cache passes to the driver only the first set of every frame
+     */
+    const uint32_t batch_vertices = stream_vertices / particle_batches;
+    for( uint32_t batch = 0; batch < particle_batches; ++batch ) {
+        use_program( app, app.stream.program );
+        bind_vertex_array( app, app.stream.vao );
+        bind_texture( app, 0, app.stream.sprite );
+        set_enabled( app, GL_BLEND, true );
+        set_enabled( app, GL_DEPTH_TEST, false );
+
+        glDrawArrays( GL_TRIANGLES, first_vertex + batch * batch_vertices, batch_vertices );
+    }
+
+    if( app.stream.mode == oglUploadMode::persistent )
+        stream_fence( app );
+
+    return upload_time;
+}
+
+/* upload benchmark
+ */
+
+static void update_benchmark( oglApp &app, double upload_time ) {
+    if( !app.benchmark.running )
+        return;
+
+    app.benchmark.upload_time_sum += upload_time;
+    if( ++app.benchmark.frames < benchmark_frames )
+        return;
+
+    const size_t mode = static_cast< size_t > ( app.stream.mode );
+    app.benchmark.results[mode] = 1000.0 * app.benchmark.upload_time_sum / app.benchmark.frames;
+    app.benchmark.frames          = 0;
+    app.benchmark.upload_time_sum = 0.0;
+
+    std::cout
+        << "Benchmark: "
+            << upload_mode_names[mode]
+            << " upload "
+            << app.benchmark.results[mode]
+            << " ms"
+            << std::endl;
+
+    /* all modes are measured, the fast path stays
+     */
+    if( mode + 1 == upload_mode_names.size() ) {
+        app.benchmark.running = false;
+        if( app.stream.persistent )
+            app.stream.mode = oglUploadMode::persistent;
+        return;
+    }
+    app.stream.mode = static_cast< oglUploadMode > ( mode + 1 );
+}
+
+static bool init_opengl( oglApp &app ) {
+    if( !app.window )
+        return false;
+
+    /* run Glad and load actual version of OpenGL
+     */
+    if( !gladLoadGL() )
+        return false;
+
+    /* Glad is generated without extensions, read the list of the context once
+     */
+    if( !gladLoadExtensions() )
+        return false;
+
+    app.gl_loaded = true;
+
+    std::cout
+        << "OpenGL renderer: "
+            << reinterpret_cast< const char* > ( glGetString( GL_RENDERER ) )
+            << std::endl;
+
+    std::cout
+        << "OpenGL driver version: "
+            << reinterpret_cast< const char* > ( glGetString( GL_VERSION ) )
+            << std::endl;
+
+    /* messages of the driver go to the counters and to the log
+     */
+    if( !create_debug_output( app ) )
+        return false;
+
+    /* GPU time of every pass is measured with timestamps
+     */
+    if( !create_gpu_timer( app ) )
+        return false;
+
+    /* geometry is written by CPU every frame
+     */
+    if( !create_stream( app ) )
+        return false;
+
+    return true;
+}
+
+static bool cleanup_opengl( oglApp &app ) {
+    if( !app.gl_loaded )
+        return false;
+
+    cleanup_stream( app );
+    cleanup_gpu_timer( app );
+    cleanup_debug_output( app );
+
+    app.gl_loaded = false;
+
+    return true;
+}
+
+static bool init( oglApp &app ) {
+    if( !init_glfw( app ) )
+        return false;
+    if( !init_window( app ) )
+        return false;
+    if( !init_opengl( app ) )
+        return false;
+
+    return true;
+}
+
+static bool cleanup( oglApp &app ) {
+    if( !cleanup_opengl( app ) )
+        return false;
+    if( !cleanup_window( app ) )
+        return false;
+    if( !cleanup_glfw( app ) )
+        return false;
+
+    return true;
+}
+
+/* frame statistics
+ */
+
+static void reset_frame_stats( oglApp &app ) {
+    app.stats.period_start    = 0.0;
+    app.stats.frames          = 0;
+    app.stats.cpu_time_sum    = 0.0;
+    app.stats.upload_time_sum = 0.0;
+    app.stats.gpu_time_sum.fill( 0.0 );
+    app.stats.gpu_samples     = 0;
+    app.timer.dropped         = 0;
+    app.stream.waits          = 0;
+    app.state.issued          = 0;
+    app.state.skipped         = 0;
+
+    app.limiter.error_sum   = 0.0;
+    app.limiter.error_max   = 0.0;
+    app.limiter.error_count = 0;
+    app.limiter.late_count  = 0;
+}
+
+static void update_frame_stats( oglApp &app, double cpu_time, double upload_time ) {
+    const double now = glfwGetTime();
+    if( app.stats.period_start == 0.0 )
+        app.stats.period_start = now;
+
+    app.stats.frames++;
+    app.stats.cpu_time_sum    += cpu_time;
+    app.stats.upload_time_sum += upload_time;
+
+    /* report once per second
+     */
+    const double period = now - app.stats.period_start;
+    if( period < 1.0 )
+        return;
+
+    std::cout
+        << "Frame stats: "
+            << app.stats.frames / period
+            << " fps, CPU "
+            << 1000.0 * app.stats.cpu_time_sum / app.stats.frames
+            << " ms, upload "
+            << upload_mode_names[static_cast< size_t > ( app.stream.mode )]
+            << ' '
+            << 1000.0 * app.stats.upload_time_sum / app.stats.frames
+            << " ms, ring waits "
+            << app.stream.waits
+            << ", state calls "
+            << static_cast< double > ( app.state.issued ) / app.stats.frames
+            << ", redundant skipped "
+            << static_cast< double > ( app.state.skipped ) / app.stats.frames;
+    if( app.stats.gpu_samples ) {
+        for( size_t pass = 0; pass < gpu_pass_names.size(); ++pass ) {
+            std::cout
+                << ", GPU "
+                    << gpu_pass_names[pass]
+                    << ' '
+                    << app.stats.gpu_time_sum[pass] / app.stats.gpu_samples
+                    << " ms";
+        }
+    }
+    std::cout
+        << ", not measured "
+            << app.timer.dropped
+            << ", debug messages "
+            << app.debug.messages.exchange( 0 )
+            << ", performance warnings "
+            << app.debug.performance.exchange( 0 )
+            << ", limiter error "
+            << ( app.limiter.error_count ? 1000000.0 * app.limiter.error_sum / app.limiter.error_count : 0.0 )
+            << " us, max "
+            << 1000000.0 * app.limiter.error_max
+            << " us, late frames "
+            << app.limiter.late_count
+            << std::endl;
+
+    reset_frame_stats( app );
+    app.stats.period_start = now;
+}
+
+/* idle scheduler
+ */
+
+static bool is_window_visible( oglApp &app ) {
+    if( app.idle.iconified )
+        return false;
+    if( glfwGetWindowAttrib( app.window, GLFW_VISIBLE ) == GLFW_FALSE )
+        return false;
+
+    /* some platforms report the minimized window only by the zero size
+     */
+    return ( app.display.frame_width != 0 ) && ( app.display.frame_height != 0 );
+}
+
+static void park( oglApp &app, bool parked ) {
+    if( app.idle.parked == parked )
+        return;
+    app.idle.parked = parked;
+
+    /* the time spent in the park is not a frame
+     */
+    reset_frame_stats( app );
+
+    std::cout
+        << "Rendering "
+            << ( parked ? "paused" : "resumed" )
+            << ", frames skipped: "
+            << app.idle.skipped
+            << std::endl;
+    app.idle.skipped = 0;
+}
+
+static bool update_idle( oglApp &app ) {
+    /* invisible window draws nothing and sleeps until any event,
+     * timeout is only a safety net for platforms without iconify events
+     */
+    if( !is_window_visible( app ) ) {
+        park( app, true );
+        app.idle.skipped++;
+        glfwWaitEventsTimeout( idle_wait_timeout );
+        return false;
+    }
+    park( app, false );
+
+    if( app.idle.focused || ( app.idle.background_fps <= 0.0 ) )
+        return true;
+
+    /* window without focus sleeps until the next frame is due,
+     * input still wakes it up earlier
+     */
+    const double now = glfwGetTime();
+    if( now < app.idle.next_frame ) {
+        app.idle.skipped++;
+        glfwWaitEventsTimeout( app.idle.next_frame - now );
+        return false;
+    }
+
+    /* keep the cadence, but don't catch up missed frames after a long sleep
+     */
+    const double period = 1.0 / app.idle.background_fps;
+    app.idle.next_frame = ( now - app.idle.next_frame > period ) ? now + period
+                                                                 : app.idle.next_frame + period;
+
+    return true;
+}
+
+/* frame limiter
+ */
+
+static void update_sleep_estimate( oglApp &app, double slept ) {
+    /* the OS wakes the thread up later than requested, how much later depends on
+     * the timer resolution and the load, so the worst case is learned at runtime
+     */
+    const double delta = slept - app.limiter.sleep_mean;
+    app.limiter.sleep_mean += limiter_sleep_smoothing * delta;
+    app.limiter.sleep_var   = ( 1.0 - limiter_sleep_smoothing ) * ( app.limiter.sleep_var + limiter_sleep_smoothing * delta * delta );
+    app.limiter.sleep_worst = app.limiter.sleep_mean + 2.0 * std::sqrt( app.limiter.sleep_var );
+}
+
+static void limit_frame_rate( oglApp &app ) {
+    const double target_fps = frame_rate_targets[app.limiter.target];
+    if( target_fps <= 0.0 ) {
+        app.limiter.deadline = 0.0;
+        return;
+    }
+
+    const double period = 1.0 / target_fps;
+    double now = glfwGetTime();
+
+    /* first frame or the frame is late for the whole period: start the new cadence,
+     * missed frames are not caught up
+     */
+    if( ( app.limiter.deadline == 0.0 ) || ( now - app.limiter.deadline > period ) ) {
+        if( app.limiter.deadline != 0.0 )
+            app.limiter.late_count++;
+        app.limiter.deadline = now + period;
+        return;
+    }
+
+    /* the frame came after the deadline by itself, the limiter has nothing to wait for,
+     * the lateness comes from the time of the frame and is not the error of the limiter
+     */
+    const bool waited = ( now < app.limiter.deadline );
+
+    /* sleep in short steps while even the worst step ends before the deadline
+     */
+    while( app.limiter.deadline - now > app.limiter.sleep_worst ) {
+        std::this_thread::sleep_for( std::chrono::duration< double >( limiter_sleep_step ) );
+        const double woke = glfwGetTime();
+        update_sleep_estimate( app, woke - now );
+        now = woke;
+    }
+
+    /* spin the rest of the time, the thread gives CPU to others but never sleeps
+     */
+    while( now < app.limiter.deadline ) {
+        std::this_thread::yield();
+        now = glfwGetTime();
+    }
+
+    /* overshoot is the error of the limiter itself
+     */
+    if( waited ) {
+        const double error = now - app.limiter.deadline;
+        app.limiter.error_sum += error;
+        app.limiter.error_max  = std::max( app.limiter.error_max, error );
+        app.limiter.error_count++;
+    }
+    else
+        app.limiter.late_count++;
+
+    app.limiter.deadline += period;
+}
+
+static void draw( oglApp &app ) {
+    const double cpu_start = glfwGetTime();
+
+    begin_gpu_frame( app );
+
+        /* Synchronize viewport with window size,
+         * the size comes from the callback and the call reaches the driver only after the resize
+         */
+        set_viewport(
+            app,
+            0, 0,
+            app.display.frame_width, app.display.frame_height
+        );
+
+        /* clean window background
+         */
+        set_clear_color( app, 0.0f, 0.3f, 0.6f, 1.0f );
+        glClear(
+            GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT
+        );
+
+    end_gpu_pass( app, 0 );
+
+        /* particles - geometry is written by CPU every frame
+         */
+        const double upload_time = draw_particles( app );
+
+    end_gpu_pass( app, 1 );
+    end_gpu_frame( app );
+
+    update_benchmark( app, upload_time );
+    update_frame_stats( app, glfwGetTime() - cpu_start, upload_time );
+
+    /* update window
+     */
+    glfwSwapBuffers( app.window );
+}
+
+int main() {
+    oglApp app;
+
+    if( !init( app ) ) {
+        std::cerr
+            << "Cannot initialize the application"
+                << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    /* render loop
+     */
+    while( glfwWindowShouldClose( app.window ) == GLFW_FALSE ) {
+        /* hidden or limited window waits for events instead of the next frame
+         */
+        if( !update_idle( app ) )
+            continue;
+
+        /* wait for the start of the next frame at the target frame rate
+         */
+        limit_frame_rate( app );
+
+        /* draw the context of the window
+         */
+        draw( app );
+
+        /* proceed keyboard and mouse
+         */
+        glfwPollEvents();
+
+        /* switch the window mode on request of the user
+         */
+        update_window_mode( app );
+    }
+
+    if( !cleanup( app ) ) {
+        std::cerr
+            << "Cleanup failed"
+                << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout
+        << "Job is done!"
+            << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,31 @@
+#version 460 core
+
+layout( location = 0 ) in vec2 position;
+
+struct DrawData {
+    vec4 placement; /* orbit radius, orbit phase, angular speed, size */
+    vec4 color;
+};
+
+layout( std430, binding = 0 ) readonly buffer DrawBuffer {
+    DrawData draws[];
+};
+
+layout( location = 0 ) uniform float time;
+
+layout( location = 0 ) out vec4 vertex_color;
+
+void main() {
+    /* multi draw indirect numbers draws by gl_DrawID,
+     * separate draws pass the index of the object as the base instance
+     */
+    DrawData draw = draws[gl_DrawID + gl_BaseInstance];
+
+    float orbit  = draw.placement.y + time * draw.placement.z;
+    float spin   = 4.0 * orbit;
+    vec2  center = draw.placement.x * vec2( cos( orbit ), sin( orbit ) );
+    mat2  rotate = mat2( cos( spin ), sin( spin ), -sin( spin ), cos( spin ) );
+
+    gl_Position  = vec4( center + rotate * position * draw.placement.w, 0.0, 1.0 );
+    vertex_color = draw.color;
+}
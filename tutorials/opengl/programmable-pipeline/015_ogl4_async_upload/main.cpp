@@ -0,0 +1,2416 @@
+/*
+    OpenGL 4.6 tutorial
+    
+    Asynchronous upload
+ */
+
+#include <cstdlib>
+#include <cstdint>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <array>
+#include <algorithm>
+#include <cmath>
+#include <chrono>
+#include <thread>
+#include <optional>
+#include <map>
+#include <tuple>
+#include <deque>
+#include <vector>
+#include <fstream>
+#include <filesystem>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+/* don't load OpenGL, will be done by Glad
+ */
+#define GLFW_INCLUDE_NONE
+#include <GLFW/glfw3.h>
+#include <glad/glad.h>
+#include <glad/glad_ext.h>
+
+/* folders of shaders and of the program cache are set by the build
+ */
+#ifndef SHADER_SOURCE_DIRECTORY
+#define SHADER_SOURCE_DIRECTORY "shaders"
+#endif
+#ifndef SHADER_BINARY_DIRECTORY
+#define SHADER_BINARY_DIRECTORY "shaders"
+#endif
+#ifndef PROGRAM_CACHE_DIRECTORY
+#define PROGRAM_CACHE_DIRECTORY "program_cache"
+#endif
+
+/* GL_KHR_parallel_shader_compile and GL_ARB_parallel_shader_compile are not part of the generated Glad,
+ * both have the same tokens, and the only function is loaded by the application
+ */
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#define GL_COMPLETION_STATUS_KHR           0x91B1
+#endif
+typedef void ( APIENTRYP PFNOGLMAXSHADERCOMPILERTHREADSPROC )( GLuint count );
+
+
+/* initial size of the window
+ */
+static const int window_width  = 1280;
+static const int window_height = 720;
+
+/* invisible window wakes up at least this often to check its state, in seconds
+ */
+static const double idle_wait_timeout = 0.5;
+
+/* frame rate of the window without focus, 0 - not limited
+ */
+static const double default_background_fps = 10.0;
+
+/* frame rates of the frame limiter switched by the key, 0 - not limited
+ */
+static const std::array< double, 5 > frame_rate_targets { 0.0, 60.0, 90.0, 120.0, 144.0 };
+static const size_t default_frame_rate_target = 2;
+
+/* frame limiter settings:
+ *  duration of one sleep step, in seconds
+ *  initial guess of the worst sleep step, in seconds
+ *  weight of the new measurement in the sleep statistics
+ */
+static const double limiter_sleep_step = 0.001;
+static const double limiter_sleep_guess = 0.005;
+static const double limiter_sleep_smoothing = 0.1;
+
+/* amount of frames which can wait for their GPU time,
+ * results are read a few frames later without stalling the pipeline
+ */
+static const uint32_t timer_frames = 4;
+
+/* measured GPU passes of the frame
+ */
+static const std::array< const char*, 2 > gpu_pass_names { "background", "scene" };
+
+/* texture units shadowed by the state cache
+ */
+static const uint32_t state_texture_units = 16;
+
+/* meshes of the scene are regular polygons with this amount of sides
+ */
+static const std::array< uint32_t, 6 > mesh_sides { 3, 4, 5, 6, 8, 32 };
+
+/* amount of objects in the scene switched by the keys, buffers are created for the maximum
+ */
+static const uint32_t scene_objects_min     = 256;
+static const uint32_t scene_objects_max     = 65536;
+static const uint32_t default_scene_objects = 4096;
+
+/* size of the background picture generated and uploaded by the upload thread, in texels
+ */
+static const int picture_size = 4096;
+
+/* signature of the program cache file
+ */
+static const uint32_t program_cache_magic = 0x50474C4F; /* "OGLP" */
+
+/* debug context is created in debug builds, release builds create the context without
+ * error checking, environment variable OGL_DEBUG=1 switches the debug context on in any build
+ */
+#ifdef NDEBUG
+static const bool default_debug_context = false;
+#else
+static const bool default_debug_context = true;
+#endif
+static const char debug_context_variable[] = "OGL_DEBUG";
+
+/* every message is counted, but only first messages with the same ID are logged
+ */
+static const uint64_t debug_log_repeats = 3;
+
+/* how the window occupies the display
+ */
+enum class oglWindowMode {
+    windowed,   /* ordinary window with decorations */
+    borderless, /* window covers the whole monitor, video mode of the desktop is kept */
+    exclusive   /* monitor is switched to the best video mode of the native resolution */
+};
+
+/* how the scene is submitted
+ */
+enum class oglSubmitMode {
+    separate, /* one draw call per object */
+    indirect  /* one multi draw indirect call for the whole scene */
+};
+
+/* vertex of the mesh
+ */
+struct oglVertex {
+    float x, y;
+};
+
+/* mesh in the shared vertex and index buffers
+ */
+struct oglMesh {
+    GLuint first_index;
+    GLuint index_count;
+    GLint  base_vertex;
+};
+
+/* header of the program cache file, the binary of the program follows
+ */
+struct oglProgramCacheHeader {
+    uint32_t magic;  /* program_cache_magic */
+    uint32_t format; /* binary format of the driver */
+    uint64_t key;    /* hash of the driver and the shader code */
+    uint64_t size;   /* size of the binary */
+};
+
+/* resources created by the upload thread
+ */
+enum class oglUploadKind {
+    picture, /* texture of the background */
+    scene    /* per draw data and indirect commands of the scene */
+};
+
+/* job of the upload thread, goes back to the render thread with the fence
+ */
+struct oglUpload {
+    oglUploadKind kind;
+    uint32_t      seed     { 0 };       /* variant of the picture */
+    GLuint        texture  { 0 };       /* picture */
+    GLuint        draws    { 0 };       /* scene */
+    GLuint        commands { 0 };
+    GLsync        fence    { nullptr }; /* GPU finished the upload */
+    double        start    { 0.0 };     /* time of the request */
+    double        cpu_time { 0.0 };     /* time of the job on the upload thread */
+};
+
+/* program in the build queue, compilation and link run on threads of the driver
+ */
+struct oglProgramBuild {
+    std::string name;                  /* name of the program and of the cache file */
+    GLuint     *target          { nullptr }; /* receives the program when it is ready */
+    GLuint      vertex_shader   { 0 };
+    GLuint      fragment_shader { 0 };
+    GLuint      program         { 0 };
+    uint64_t    key             { 0 };     /* key of the program cache */
+    bool        spirv           { false }; /* shaders are created from SPIR-V */
+    bool        linking         { false }; /* shaders are compiled, the program is linking */
+};
+
+/* per draw data in the shader storage buffer, std430 layout of DrawData
+ */
+struct oglDrawData {
+    float radius, phase, speed, size;
+    float r, g, b, a;
+};
+
+/* the same layout as DrawElementsIndirectCommand of OpenGL
+ */
+struct oglDrawCommand {
+    GLuint count;
+    GLuint instance_count;
+    GLuint first_index;
+    GLint  base_vertex;
+    GLuint base_instance;
+};
+
+/* message of the debug output waiting for the logger
+ */
+struct oglDebugMessage {
+    GLenum      source;
+    GLenum      type;
+    GLuint      id;
+    GLenum      severity;
+    std::string text;
+};
+
+/* application data
+ */
+struct oglApp {
+    bool         glfw_init { false };
+    GLFWwindow  *window    { nullptr };
+    bool         gl_loaded { false };
+    bool         vsync     { false }; /* swap waits for the vertical blank */
+
+    struct {
+        bool     iconified      { false };                  /* window is minimized */
+        bool     focused        { true };                   /* window receives the input */
+        bool     parked         { false };                  /* render loop doesn't draw anything */
+        double   background_fps { default_background_fps }; /* frame rate without focus, 0 - not limited */
+        double   next_frame     { 0.0 };                    /* earliest time of the next background frame */
+        uint32_t skipped        { 0 };                      /* frames not rendered while parked or limited */
+    } idle;
+
+    struct {
+        size_t   target       { default_frame_rate_target }; /* index in frame_rate_targets */
+        double   deadline     { 0.0 };                       /* start time of the next frame, 0 - no cadence yet */
+
+        double   sleep_mean   { limiter_sleep_step };        /* smoothed duration of one sleep step */
+        double   sleep_var    { 0.0 };                       /* smoothed variance of the sleep step */
+        double   sleep_worst  { limiter_sleep_guess };       /* sleep step which is still safe before the deadline */
+
+        double   error_sum    { 0.0 };                       /* sum of overshoots in the current period */
+        double   error_max    { 0.0 };                       /* worst overshoot in the current period */
+        uint32_t error_count  { 0 };                         /* amount of limited frames in the current period */
+        uint32_t late_count   { 0 };                         /* frames after the deadline, the limiter didn't wait */
+    } limiter;
+
+    struct {
+        oglWindowMode                  mode { oglWindowMode::windowed }; /* actual mode of the window */
+        std::optional< oglWindowMode > request;                          /* mode requested by the user */
+
+        int x      { 0 }; /* placement of the window to restore the windowed mode */
+        int y      { 0 };
+        int width  { window_width };
+        int height { window_height };
+
+        int frame_width  { 0 }; /* size of the frame buffer, updated only by the callback */
+        int frame_height { 0 };
+    } display;
+
+    /* shadow copy of OpenGL state, std::nullopt and missing keys - state is unknown
+     */
+    struct {
+        bool                                             enabled { true }; /* redundant calls are skipped */
+
+        std::optional< std::array< GLint, 4 > >          viewport;
+        std::optional< std::array< GLfloat, 4 > >        clear_color;
+        std::map< GLenum, GLuint >                       buffers;   /* per target */
+        std::array< std::optional< GLuint >, state_texture_units > textures; /* per texture unit */
+        std::optional< GLuint >                          program;
+        std::optional< GLuint >                          vertex_array;
+        std::map< GLenum, bool >                         enables;   /* per capability */
+
+        uint64_t                                         issued  { 0 }; /* calls passed to OpenGL in the current period */
+        uint64_t                                         skipped { 0 }; /* redundant calls in the current period */
+    } state;
+
+    struct {
+        bool     supported { false }; /* GL_TIMESTAMP counter has valid bits */
+        bool     active    { false }; /* current frame writes timestamps */
+
+        /* one timestamp before the first pass and one after every pass
+         */
+        std::array< std::array< GLuint, gpu_pass_names.size() + 1 >, timer_frames > queries {};
+        std::array< bool, timer_frames > pending {}; /* queries of the frame wait for the result */
+        uint32_t write   { 0 };                     /* slot of the current frame */
+        uint32_t read    { 0 };                     /* oldest slot waiting for the result */
+        uint32_t dropped { 0 };                     /* frames not measured because the ring was full */
+    } timer;
+
+    struct {
+        bool                     context  { false }; /* context is created with debug flag */
+        bool                     no_error { false }; /* context doesn't check errors */
+
+        /* messages arrive from driver threads, the callback only counts them
+         * and queues the text, the logger thread writes it
+         */
+        std::mutex                          mutex;
+        std::condition_variable             cv;
+        std::map< std::tuple< GLenum, GLenum, GLuint >, uint64_t > counters; /* per source, type and ID */
+        std::deque< oglDebugMessage >       queue;           /* messages waiting for the logger */
+        bool                                stop { false };  /* logger must finish */
+        std::thread                         logger;          /* logging thread */
+
+        std::atomic< uint32_t >             messages    { 0 }; /* messages in the current report period */
+        std::atomic< uint32_t >             performance { 0 }; /* performance warnings in the current report period */
+    } debug;
+
+    struct {
+        GLFWwindow             *window { nullptr }; /* hidden window with the context shared with the main one */
+        std::thread             worker;             /* upload thread */
+        std::mutex              mutex;
+        std::condition_variable cv;
+        bool                    stop   { false };   /* upload thread must finish */
+        std::deque< oglUpload > requests;           /* jobs waiting for the upload thread */
+        std::deque< oglUpload > finished;           /* jobs waiting for their fence on the render thread */
+    } uploads;
+
+    struct {
+        bool                    spirv        { false }; /* SPIR-V shaders, OpenGL 4.6 */
+        bool                    binary_cache { false }; /* driver supports at least one program binary format */
+        std::string             driver;                 /* renderer and version, part of the cache key */
+
+        bool                    parallel     { false }; /* GL_KHR_parallel_shader_compile or GL_ARB_parallel_shader_compile */
+        uint32_t                threads      { 1 };     /* compiler threads requested from the driver */
+        std::vector< oglProgramBuild > builds;          /* programs which are not ready yet */
+        double                  start        { 0.0 };   /* time of the first submitted program */
+    } shaders;
+
+    struct {
+        GLuint                  vao        { 0 }; /* empty, core profile needs a vertex array for any draw */
+        GLuint                  background { 0 }; /* gradient behind the scene */
+        GLuint                  picture    { 0 }; /* picture behind the scene */
+        GLuint                  texture    { 0 }; /* picture from the upload thread */
+        uint32_t                seed       { 0 }; /* variant of the last requested picture */
+        GLuint                  vignette   { 0 }; /* dark corners over the scene */
+    } fullscreen;
+
+    struct {
+        GLuint                  program  { 0 }; /* scene shaders */
+        GLuint                  vao      { 0 }; /* vertex format and index buffer of meshes */
+        GLuint                  vertices { 0 }; /* vertices of all meshes */
+        GLuint                  indices  { 0 }; /* indices of all meshes */
+        GLuint                  draws    { 0 }; /* per draw data of all objects */
+        GLuint                  commands { 0 }; /* indirect commands of all objects */
+        GLuint                  count    { 0 }; /* amount of commands, read by GPU */
+
+        bool                    indirect_count { false };  /* draw count from the buffer, OpenGL 4.6 */
+        std::vector< oglMesh >  meshes;
+        std::vector< oglDrawCommand > draw_commands;       /* CPU copy for separate draws */
+
+        oglSubmitMode           mode     { oglSubmitMode::indirect }; /* actual submission mode */
+        uint32_t                objects  { default_scene_objects };   /* objects requested by the user */
+        uint32_t                uploaded { 0 };                       /* objects in the count buffer */
+    } scene;
+
+    struct {
+        double   period_start { 0.0 }; /* start time of the current report period */
+        uint32_t frames       { 0 };   /* frames in the current report period */
+        double   cpu_time_sum { 0.0 }; /* CPU time spent in draw() without the swap */
+        double   submit_time_sum { 0.0 }; /* CPU time of the scene submission */
+
+        std::array< double, gpu_pass_names.size() > gpu_time_sum {}; /* GPU time of every pass */
+        uint32_t gpu_samples  { 0 };   /* frames with GPU time in the current period */
+    } stats;
+};
+
+/* callbacks
+ */
+
+static void glfw_error_callback( int error, const char* description ) {
+    std::cerr
+        << "GLFW error: "
+            << description
+            << std::endl;
+}
+
+static void window_iconify_callback(
+    GLFWwindow* window,
+    int iconified
+) {
+    oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+    app->idle.iconified = ( iconified == GLFW_TRUE );
+}
+
+static void window_focus_callback(
+    GLFWwindow* window,
+    int focused
+) {
+    /* first background frame is rendered without delay
+     */
+    oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+    app->idle.focused    = ( focused == GLFW_TRUE );
+    app->idle.next_frame = 0.0;
+}
+
+static void framebuffer_size_callback(
+    GLFWwindow* window,
+    int width,
+    int height
+) {
+    /* the only place which reads the size of the frame buffer,
+     * draw() doesn't query the window every frame
+     */
+    oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+    app->display.frame_width  = width;
+    app->display.frame_height = height;
+}
+
+static void key_callback(
+    GLFWwindow* window,
+    int key,
+    int scancode,
+    int action,
+    int mods
+) {
+    /* ESC - close application
+    */
+    if ( key == GLFW_KEY_ESCAPE && action == GLFW_PRESS )
+        glfwSetWindowShouldClose( window, GLFW_TRUE );
+
+    /* T - switch the target frame rate of the frame limiter
+     */
+    if ( key == GLFW_KEY_T && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        app->limiter.target   = ( app->limiter.target + 1 ) % frame_rate_targets.size();
+        app->limiter.deadline = 0.0;
+
+        const double target_fps = frame_rate_targets[app->limiter.target];
+        std::cout
+            << "Frame limiter: "
+                << ( target_fps > 0.0 ? std::to_string( target_fps ) : "off" )
+                << std::endl;
+    }
+
+    /* V - switch the vertical synchronization
+     */
+    if ( key == GLFW_KEY_V && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        app->vsync = !app->vsync;
+        glfwSwapInterval( app->vsync ? 1 : 0 );
+
+        std::cout
+            << "Vertical synchronization: "
+                << ( app->vsync ? "on" : "off" )
+                << std::endl;
+    }
+
+    /* M - switch separate draws and multi draw indirect
+     */
+    if ( key == GLFW_KEY_M && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        app->scene.mode = ( app->scene.mode == oglSubmitMode::indirect ) ? oglSubmitMode::separate : oglSubmitMode::indirect;
+
+        std::cout
+            << "Submission: "
+                << ( app->scene.mode == oglSubmitMode::indirect ? "multi draw indirect" : "separate draws" )
+                << std::endl;
+    }
+
+    /* UP/DOWN - double or halve the amount of objects
+     */
+    if ( ( key == GLFW_KEY_UP || key == GLFW_KEY_DOWN ) && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        app->scene.objects = ( key == GLFW_KEY_UP )
+            ? std::min( app->scene.objects * 2, scene_objects_max )
+            : std::max( app->scene.objects / 2, scene_objects_min );
+
+        std::cout
+            << "Objects: "
+                << app->scene.objects
+                << std::endl;
+    }
+
+    /* L - load the next background picture on the upload thread
+     */
+    if ( key == GLFW_KEY_L && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        oglUpload upload { oglUploadKind::picture };
+        upload.seed  = ++app->fullscreen.seed;
+        upload.start = glfwGetTime();
+
+        std::lock_guard< std::mutex > lock( app->uploads.mutex );
+        app->uploads.requests.push_back( upload );
+        app->uploads.cv.notify_one();
+    }
+
+    /* C - switch the state cache, without the cache every call goes to the driver
+     */
+    if ( key == GLFW_KEY_C && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        app->state.enabled = !app->state.enabled;
+
+        std::cout
+            << "State cache: "
+                << ( app->state.enabled ? "on" : "off" )
+                << std::endl;
+    }
+
+    /* B - switch the frame rate limit of the window without focus
+     */
+    if ( key == GLFW_KEY_B && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        app->idle.background_fps = ( app->idle.background_fps > 0.0 ) ? 0.0 : default_background_fps;
+
+        std::cout
+            << "Background frame rate: "
+                << ( app->idle.background_fps > 0.0 ? std::to_string( app->idle.background_fps ) : "not limited" )
+                << std::endl;
+    }
+
+    /* F11 - switch windowed, borderless and exclusive fullscreen modes,
+     * the mode is changed in the render loop
+     */
+    if ( key == GLFW_KEY_F11 && action == GLFW_PRESS ) {
+        oglApp *app = static_cast< oglApp* > ( glfwGetWindowUserPointer( window ) );
+        switch( app->display.mode ) {
+        case oglWindowMode::windowed:
+            app->display.request = oglWindowMode::borderless;
+            break;
+        case oglWindowMode::borderless:
+            app->display.request = oglWindowMode::exclusive;
+            break;
+        case oglWindowMode::exclusive:
+            app->display.request = oglWindowMode::windowed;
+            break;
+        }
+    }
+}
+
+static bool init_glfw( oglApp &app ) {
+    /* setup error callback first to catch all errors
+     */
+    (void)glfwSetErrorCallback( glfw_error_callback );
+
+    /* init the library
+     */
+    if( glfwInit() == GLFW_FALSE )
+        return false;
+
+    app.glfw_init = true;
+
+    return true;
+}
+
+static bool cleanup_glfw( oglApp &app ) {
+    if( !app.glfw_init )
+        return true;
+
+    /* cleanup GLFW resources
+     */
+    glfwTerminate();
+    app.glfw_init = false;
+
+    return true;
+}
+
+static bool init_window( oglApp &app ) {
+    if( !app.glfw_init )
+        return false;
+
+    /* request OpenGL 4.6
+     */
+    glfwWindowHint( GLFW_CONTEXT_VERSION_MAJOR, 4 );
+    glfwWindowHint( GLFW_CONTEXT_VERSION_MINOR, 6 );
+
+    /* window can be resized, minimized and covered by other windows
+     */
+    glfwWindowHint( GLFW_RESIZABLE, GLFW_TRUE );
+
+    /* debug context reports errors and warnings of the driver,
+     * otherwise the driver doesn't check errors at all
+     */
+    const char *debug_variable = std::getenv( debug_context_variable );
+    app.debug.context = default_debug_context || ( debug_variable && std::string( debug_variable ) == "1" );
+    glfwWindowHint( GLFW_OPENGL_DEBUG_CONTEXT, app.debug.context ? GLFW_TRUE : GLFW_FALSE );
+    glfwWindowHint( GLFW_CONTEXT_NO_ERROR, app.debug.context ? GLFW_FALSE : GLFW_TRUE );
+
+    app.window = glfwCreateWindow(
+        window_width,
+        window_height,
+        "OpenGL 4.6 - Tutorial - Asynchronous upload",
+        nullptr,
+        nullptr
+    );
+    if( !app.window )
+        return false;
+
+    /* setup user pointer
+     */
+    glfwSetWindowUserPointer(
+        app.window,
+       &app
+    );
+
+    /* connect OpenGL context with window
+     */
+    glfwMakeContextCurrent( app.window );
+    glfwSwapInterval( app.vsync ? 1 : 0 );  /* frame rate is limited by the application */
+
+    /* acquire the keyboard
+     */
+    glfwSetKeyCallback(
+        app.window,
+        key_callback
+    );
+
+    /* visibility and focus drive the render loop scheduler
+     */
+    glfwSetWindowIconifyCallback(
+        app.window,
+        window_iconify_callback
+    );
+    glfwSetWindowFocusCallback(
+        app.window,
+        window_focus_callback
+    );
+    app.idle.focused = ( glfwGetWindowAttrib( app.window, GLFW_FOCUSED ) == GLFW_TRUE );
+
+    /* the upload thread needs own context which shares objects with the main one,
+     * GLFW creates windows only on the main thread, so the hidden window is created here,
+     * all other hints stay the same, contexts of one share group must be compatible
+     */
+    glfwWindowHint( GLFW_VISIBLE, GLFW_FALSE );
+    app.uploads.window = glfwCreateWindow(
+        1,
+        1,
+        "Upload context",
+        nullptr,
+        app.window
+    );
+    if( !app.uploads.window )
+        return false;
+
+    /* size of the frame buffer is read once here and then updated by the callback
+     */
+    glfwSetFramebufferSizeCallback(
+        app.window,
+        framebuffer_size_callback
+    );
+    glfwGetFramebufferSize(
+        app.window,
+       &app.display.frame_width,
+       &app.display.frame_height
+    );
+
+    return true;
+}
+
+static bool cleanup_window( oglApp &app ) {
+    if( !app.window )
+        return true;
+
+    /* destroy GLFW windows
+     */
+    if( app.uploads.window )
+        glfwDestroyWindow( app.uploads.window );
+    app.uploads.window = nullptr;
+
+    glfwDestroyWindow( app.window );
+    app.window = nullptr;
+
+    return true;
+}
+
+/* window mode
+ */
+
+static GLFWmonitor* select_monitor( oglApp &app ) {
+    /* monitor under the center of the window,
+     * fullscreen window is already on its monitor
+     */
+    GLFWmonitor *window_monitor = glfwGetWindowMonitor( app.window );
+    if( window_monitor )
+        return window_monitor;
+
+    int x, y, width, height;
+    glfwGetWindowPos( app.window, &x, &y );
+    glfwGetWindowSize( app.window, &width, &height );
+    const int center_x = x + width / 2;
+    const int center_y = y + height / 2;
+
+    int monitor_count = 0;
+    GLFWmonitor **monitors = glfwGetMonitors( &monitor_count );
+    for( int i = 0; i < monitor_count; ++i ) {
+        int monitor_x, monitor_y;
+        glfwGetMonitorPos( monitors[i], &monitor_x, &monitor_y );
+        const GLFWvidmode *mode = glfwGetVideoMode( monitors[i] );
+        if( !mode )
+            continue;
+
+        if( ( center_x >= monitor_x ) && ( center_x < monitor_x + mode->width ) &&
+            ( center_y >= monitor_y ) && ( center_y < monitor_y + mode->height ) )
+            return monitors[i];
+    }
+
+    return glfwGetPrimaryMonitor();
+}
+
+static const GLFWvidmode* select_video_mode( GLFWmonitor *monitor ) {
+    int mode_count = 0;
+    const GLFWvidmode *modes = glfwGetVideoModes( monitor, &mode_count );
+    if( !modes || !mode_count )
+        return glfwGetVideoMode( monitor );
+
+    /* native resolution is the biggest one,
+     * among its modes take the highest refresh rate, then the deepest color
+     */
+    const GLFWvidmode *best = &modes[0];
+    for( int i = 1; i < mode_count; ++i ) {
+        const GLFWvidmode &mode = modes[i];
+        const int64_t mode_area = static_cast< int64_t > ( mode.width ) * mode.height;
+        const int64_t best_area = static_cast< int64_t > ( best->width ) * best->height;
+        const int mode_bits = mode.redBits + mode.greenBits + mode.blueBits;
+        const int best_bits = best->redBits + best->greenBits + best->blueBits;
+
+        if( mode_area != best_area ) {
+            if( mode_area > best_area )
+                best = &mode;
+        }
+        else if( mode.refreshRate != best->refreshRate ) {
+            if( mode.refreshRate > best->refreshRate )
+                best = &mode;
+        }
+        else if( mode_bits > best_bits )
+            best = &mode;
+    }
+
+    return best;
+}
+
+static void set_window_mode( oglApp &app, oglWindowMode mode ) {
+    if( mode == app.display.mode )
+        return;
+
+    /* remember where the window was to return it back later
+     */
+    if( app.display.mode == oglWindowMode::windowed ) {
+        glfwGetWindowPos( app.window, &app.display.x, &app.display.y );
+        glfwGetWindowSize( app.window, &app.display.width, &app.display.height );
+    }
+
+    GLFWmonitor *monitor = select_monitor( app );
+    const GLFWvidmode *video_mode = nullptr;
+    switch( mode ) {
+    case oglWindowMode::windowed:
+        glfwSetWindowMonitor( app.window,
+                              nullptr,
+                              app.display.x,
+                              app.display.y,
+                              app.display.width,
+                              app.display.height,
+                              GLFW_DONT_CARE );
+        break;
+    case oglWindowMode::borderless:
+        /* the same video mode as the desktop, the monitor doesn't switch
+         */
+        video_mode = glfwGetVideoMode( monitor );
+        break;
+    case oglWindowMode::exclusive:
+        video_mode = select_video_mode( monitor );
+        break;
+    }
+
+    if( video_mode ) {
+        glfwSetWindowMonitor( app.window,
+                              monitor,
+                              0,
+                              0,
+                              video_mode->width,
+                              video_mode->height,
+                              video_mode->refreshRate );
+    }
+
+    app.display.mode = mode;
+
+    std::cout
+        << "Window mode: "
+            << ( mode == oglWindowMode::windowed ? "windowed"
+                 : mode == oglWindowMode::borderless ? "borderless" : "exclusive" );
+    if( video_mode ) {
+        std::cout
+            << ", "
+                << glfwGetMonitorName( monitor )
+                << ' '
+                << video_mode->width
+                << 'x'
+                << video_mode->height
+                << '@'
+                << video_mode->refreshRate
+                << "Hz";
+    }
+    std::cout
+        << std::endl;
+}
+
+static void update_window_mode( oglApp &app ) {
+    if( !app.display.request )
+        return;
+
+    set_window_mode( app, *app.display.request );
+    app.display.request.reset();
+
+    /* OpenGL context stays the same,
+     * but some drivers forget the swap interval after the switch
+     */
+    glfwSwapInterval( app.vsync ? 1 : 0 );
+}
+
+/* GPU timer
+ */
+
+static bool create_gpu_timer( oglApp &app ) {
+    /* timestamps are part of OpenGL 3.3,
+     * but the counter might have no valid bits on some implementations
+     */
+    GLint counter_bits = 0;
+    glGetQueryiv( GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &counter_bits );
+    app.timer.supported = ( counter_bits > 0 );
+    if( !app.timer.supported ) {
+        std::cout
+            << "GPU timer is not supported"
+                << std::endl;
+        return true;
+    }
+
+    for( auto &frame_queries: app.timer.queries )
+        glGenQueries( static_cast< GLsizei > ( frame_queries.size() ), frame_queries.data() );
+
+    return true;
+}
+
+static void cleanup_gpu_timer( oglApp &app ) {
+    if( !app.timer.supported )
+        return;
+
+    for( auto &frame_queries: app.timer.queries )
+        glDeleteQueries( static_cast< GLsizei > ( frame_queries.size() ), frame_queries.data() );
+    app.timer.supported = false;
+}
+
+static void read_gpu_timer( oglApp &app ) {
+    /* queries finish in order, when the last timestamp of the frame is available
+     * all others are available too, the result is read without waiting
+     */
+    while( app.timer.pending[app.timer.read] ) {
+        const auto &frame_queries = app.timer.queries[app.timer.read];
+
+        GLint available = GL_FALSE;
+        glGetQueryObjectiv( frame_queries.back(), GL_QUERY_RESULT_AVAILABLE, &available );
+        if( available == GL_FALSE )
+            break;
+
+        std::array< GLuint64, gpu_pass_names.size() + 1 > timestamps;
+        for( size_t i = 0; i < frame_queries.size(); ++i )
+            glGetQueryObjectui64v( frame_queries[i], GL_QUERY_RESULT, &timestamps[i] );
+
+        for( size_t pass = 0; pass < gpu_pass_names.size(); ++pass )
+            app.stats.gpu_time_sum[pass] += ( timestamps[pass + 1] - timestamps[pass] ) / 1000000.0;
+        app.stats.gpu_samples++;
+
+        app.timer.pending[app.timer.read] = false;
+        app.timer.read = ( app.timer.read + 1 ) % timer_frames;
+    }
+}
+
+static void begin_gpu_frame( oglApp &app ) {
+    app.timer.active = false;
+    if( !app.timer.supported )
+        return;
+
+    read_gpu_timer( app );
+
+    /* the ring is full when GPU is too far behind,
+     * the frame is not measured instead of waiting for the old results
+     */
+    if( app.timer.pending[app.timer.write] ) {
+        app.timer.dropped++;
+        return;
+    }
+
+    app.timer.active = true;
+    glQueryCounter( app.timer.queries[app.timer.write][0], GL_TIMESTAMP );
+}
+
+static void end_gpu_pass( oglApp &app, size_t pass ) {
+    if( !app.timer.active )
+        return;
+
+    glQueryCounter( app.timer.queries[app.timer.write][pass + 1], GL_TIMESTAMP );
+}
+
+static void end_gpu_frame( oglApp &app ) {
+    if( !app.timer.active )
+        return;
+
+    app.timer.pending[app.timer.write] = true;
+    app.timer.write = ( app.timer.write + 1 ) % timer_frames;
+}
+
+/* debug output
+ */
+
+static const char* debug_source_name( GLenum source ) {
+    switch( source ) {
+    case GL_DEBUG_SOURCE_API:             return "API";
+    case GL_DEBUG_SOURCE_WINDOW_SYSTEM:   return "window system";
+    case GL_DEBUG_SOURCE_SHADER_COMPILER: return "shader compiler";
+    case GL_DEBUG_SOURCE_THIRD_PARTY:     return "third party";
+    case GL_DEBUG_SOURCE_APPLICATION:     return "application";
+    default:                              return "other";
+    }
+}
+
+static const char* debug_type_name( GLenum type ) {
+    switch( type ) {
+    case GL_DEBUG_TYPE_ERROR:               return "error";
+    case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "deprecated";
+    case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:  return "undefined behavior";
+    case GL_DEBUG_TYPE_PORTABILITY:         return "portability";
+    case GL_DEBUG_TYPE_PERFORMANCE:         return "performance";
+    case GL_DEBUG_TYPE_MARKER:              return "marker";
+    case GL_DEBUG_TYPE_PUSH_GROUP:          return "push group";
+    case GL_DEBUG_TYPE_POP_GROUP:           return "pop group";
+    default:                                return "other";
+    }
+}
+
+static const char* debug_severity_name( GLenum severity ) {
+    switch( severity ) {
+    case GL_DEBUG_SEVERITY_HIGH:   return "high";
+    case GL_DEBUG_SEVERITY_MEDIUM: return "medium";
+    case GL_DEBUG_SEVERITY_LOW:    return "low";
+    default:                       return "notification";
+    }
+}
+
+static void APIENTRY gl_debug_callback(
+          GLenum  source,
+          GLenum  type,
+          GLuint  id,
+          GLenum  severity,
+          GLsizei length,
+    const GLchar *message,
+    const void   *user_param
+) {
+    /* the output is asynchronous, the callback might be called by any thread
+     * of the driver, so it only counts the message and queues it for the logger
+     */
+    oglApp *app = static_cast< oglApp* > ( const_cast< void* > ( user_param ) );
+    app->debug.messages++;
+    if( type == GL_DEBUG_TYPE_PERFORMANCE )
+        app->debug.performance++;
+
+    {
+        std::lock_guard< std::mutex > lock( app->debug.mutex );
+        const uint64_t count = ++app->debug.counters[std::make_tuple( source, type, id )];
+        if( count > debug_log_repeats )
+            return;
+
+        app->debug.queue.push_back( oglDebugMessage {
+            .source   = source,
+            .type     = type,
+            .id       = id,
+            .severity = severity,
+            .text     = ( length < 0 ) ? std::string( message ) : std::string( message, length )
+        } );
+    }
+    app->debug.cv.notify_one();
+}
+
+static void debug_logger( oglApp *app ) {
+    std::unique_lock< std::mutex > lock( app->debug.mutex );
+    for( ;; ) {
+        app->debug.cv.wait( lock, [app] { return app->debug.stop || !app->debug.queue.empty(); } );
+        if( app->debug.queue.empty() )
+            return;
+
+        oglDebugMessage message = std::move( app->debug.queue.front() );
+        app->debug.queue.pop_front();
+
+        /* the output is slow, the callback must not wait for it
+         */
+        lock.unlock();
+        std::cerr
+            << "OpenGL "
+                << debug_type_name( message.type )
+                << " ("
+                << debug_source_name( message.source )
+                << ", "
+                << debug_severity_name( message.severity )
+                << ", ID "
+                << message.id
+                << "): "
+                << message.text
+                << std::endl;
+        lock.lock();
+    }
+}
+
+static bool create_debug_output( oglApp &app ) {
+    GLint context_flags = 0;
+    glGetIntegerv( GL_CONTEXT_FLAGS, &context_flags );
+    app.debug.context  = ( context_flags & GL_CONTEXT_FLAG_DEBUG_BIT ) != 0;
+    app.debug.no_error = ( context_flags & GL_CONTEXT_FLAG_NO_ERROR_BIT ) != 0;
+
+    std::cout
+        << "OpenGL context: "
+            << ( app.debug.context ? "debug" : app.debug.no_error ? "no error" : "default" )
+            << std::endl;
+
+    /* KHR_debug is part of OpenGL 4.3
+     */
+    if( !app.debug.context )
+        return true;
+    if( !GLAD_GL_VERSION_4_3 && !gladHasExtension( "GL_KHR_debug" ) ) {
+        app.debug.context = false;
+        return true;
+    }
+
+    app.debug.logger = std::thread( debug_logger, &app );
+
+    /* all messages are counted, GL_DEBUG_OUTPUT_SYNCHRONOUS is not enabled,
+     * so the driver doesn't slow down every call to report the message in place
+     */
+    glDebugMessageControl( GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, nullptr, GL_TRUE );
+    glDebugMessageCallback( gl_debug_callback, &app );
+    glEnable( GL_DEBUG_OUTPUT );
+
+    return true;
+}
+
+static void cleanup_debug_output( oglApp &app ) {
+    if( !app.debug.context )
+        return;
+
+    glDisable( GL_DEBUG_OUTPUT );
+    glDebugMessageCallback( nullptr, nullptr );
+
+    {
+        std::lock_guard< std::mutex > lock( app.debug.mutex );
+        app.debug.stop = true;
+    }
+    app.debug.cv.notify_all();
+    if( app.debug.logger.joinable() )
+        app.debug.logger.join();
+
+    /* most frequent messages first
+     */
+    std::vector< std::pair< std::tuple< GLenum, GLenum, GLuint >, uint64_t > > counters(
+        app.debug.counters.begin(),
+        app.debug.counters.end()
+    );
+    std::sort( counters.begin(),
+               counters.end(),
+               []( const auto &a, const auto &b ) { return a.second > b.second; } );
+    for( const auto &[key, count]: counters ) {
+        std::cout
+            << "OpenGL "
+                << debug_type_name( std::get< 1 >( key ) )
+                << " ("
+                << debug_source_name( std::get< 0 >( key ) )
+                << ", ID "
+                << std::get< 2 >( key )
+                << "): "
+                << count
+                << " times"
+                << std::endl;
+    }
+
+    app.debug.context = false;
+}
+
+/* state cache
+ */
+
+static void invalidate_state_cache( oglApp &app ) {
+    /* OpenGL state is unknown, the next call of every kind goes to the driver,
+     * required after deletion of bound objects or after foreign code changed the state
+     */
+    app.state.viewport.reset();
+    app.state.clear_color.reset();
+    app.state.buffers.clear();
+    app.state.textures.fill( std::nullopt );
+    app.state.program.reset();
+    app.state.vertex_array.reset();
+    app.state.enables.clear();
+}
+
+static bool skip_state( oglApp &app, bool redundant ) {
+    if( app.state.enabled && redundant ) {
+        app.state.skipped++;
+        return true;
+    }
+
+    app.state.issued++;
+    return false;
+}
+
+static void set_viewport( oglApp &app, GLint x, GLint y, GLsizei width, GLsizei height ) {
+    const std::array< GLint, 4 > viewport { x, y, width, height };
+    if( skip_state( app, app.state.viewport == viewport ) )
+        return;
+
+    app.state.viewport = viewport;
+    glViewport( x, y, width, height );
+}
+
+static void set_clear_color( oglApp &app, GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha ) {
+    const std::array< GLfloat, 4 > clear_color { red, green, blue, alpha };
+    if( skip_state( app, app.state.clear_color == clear_color ) )
+        return;
+
+    app.state.clear_color = clear_color;
+    glClearColor( red, green, blue, alpha );
+}
+
+static void bind_buffer( oglApp &app, GLenum target, GLuint buffer ) {
+    const auto it = app.state.buffers.find( target );
+    if( skip_state( app, ( it != app.state.buffers.end() ) && ( it->second == buffer ) ) )
+        return;
+
+    app.state.buffers[target] = buffer;
+    glBindBuffer( target, buffer );
+}
+
+static void bind_texture( oglApp &app, GLuint unit, GLuint texture ) {
+    /* glBindTextureUnit doesn't depend on the active texture unit
+     */
+    if( skip_state( app, app.state.textures[unit] == texture ) )
+        return;
+
+    app.state.textures[unit] = texture;
+    glBindTextureUnit( unit, texture );
+}
+
+static void use_program( oglApp &app, GLuint program ) {
+    if( skip_state( app, app.state.program == program ) )
+        return;
+
+    app.state.program = program;
+    glUseProgram( program );
+}
+
+static void bind_vertex_array( oglApp &app, GLuint vertex_array ) {
+    if( skip_state( app, app.state.vertex_array == vertex_array ) )
+        return;
+
+    app.state.vertex_array = vertex_array;
+    glBindVertexArray( vertex_array );
+}
+
+static void set_enabled( oglApp &app, GLenum capability, bool enabled ) {
+    const auto it = app.state.enables.find( capability );
+    if( skip_state( app, ( it != app.state.enables.end() ) && ( it->second == enabled ) ) )
+        return;
+
+    app.state.enables[capability] = enabled;
+    if( enabled )
+        glEnable( capability );
+    else
+        glDisable( capability );
+}
+
+/* shaders
+ */
+
+static bool read_file( const std::filesystem::path &path, std::vector< char > &data ) {
+    std::ifstream file( path, std::ios::binary | std::ios::ate );
+    if( !file )
+        return false;
+
+    data.resize( static_cast< size_t > ( file.tellg() ) );
+    file.seekg( 0 );
+    return static_cast< bool > ( file.read( data.data(), data.size() ) );
+}
+
+static uint64_t hash_data( uint64_t hash, const void *data, size_t size ) {
+    /* FNV-1a, the key only has to change together with the driver or the code
+     */
+    const uint8_t *bytes = static_cast< const uint8_t* > ( data );
+    for( size_t i = 0; i < size; ++i ) {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+static void init_shaders( oglApp &app ) {
+    /* SPIR-V shaders are part of OpenGL 4.6, GL_ARB_gl_spirv alone isn't enough:
+     * Glad loads glSpecializeShader only for 4.6
+     */
+    app.shaders.spirv = GLAD_GL_VERSION_4_6;
+
+    /* the binary of the program is valid only for the same driver
+     */
+    GLint binary_formats = 0;
+    glGetIntegerv( GL_NUM_PROGRAM_BINARY_FORMATS, &binary_formats );
+    app.shaders.binary_cache = ( binary_formats > 0 );
+    app.shaders.driver =
+        std::string( reinterpret_cast< const char* > ( glGetString( GL_RENDERER ) ) ) + '\n' +
+        std::string( reinterpret_cast< const char* > ( glGetString( GL_VERSION ) ) );
+
+    /* the driver compiles and links on own threads, one thread per core,
+     * without the extension every query of the status waits for the result
+     */
+    app.shaders.threads = std::max( std::thread::hardware_concurrency(), 1u );
+    const char *max_threads_name =
+        gladHasExtension( "GL_KHR_parallel_shader_compile" ) ? "glMaxShaderCompilerThreadsKHR" :
+        gladHasExtension( "GL_ARB_parallel_shader_compile" ) ? "glMaxShaderCompilerThreadsARB" : nullptr;
+    if( max_threads_name ) {
+        auto max_threads = reinterpret_cast< PFNOGLMAXSHADERCOMPILERTHREADSPROC > ( glfwGetProcAddress( max_threads_name ) );
+        if( max_threads ) {
+            max_threads( app.shaders.threads );
+            app.shaders.parallel = true;
+        }
+    }
+
+    std::cout
+        << "Shaders: "
+            << ( app.shaders.spirv ? "SPIR-V" : "GLSL" )
+            << ", program cache "
+            << ( app.shaders.binary_cache ? "on" : "not supported" )
+            << ", parallel compile "
+            << ( app.shaders.parallel ? std::to_string( app.shaders.threads ) + " threads" : "not supported" )
+            << std::endl;
+}
+
+static bool check_shader( GLuint &shader ) {
+    GLint status = GL_FALSE;
+    glGetShaderiv( shader, GL_COMPILE_STATUS, &status );
+    if( status == GL_TRUE )
+        return true;
+
+    GLint log_length = 0;
+    glGetShaderiv( shader, GL_INFO_LOG_LENGTH, &log_length );
+    std::string log( std::max( log_length, 1 ), '\0' );
+    glGetShaderInfoLog( shader, log_length, nullptr, log.data() );
+    std::cerr
+        << "Shader compilation failed: "
+            << log.c_str()
+            << std::endl;
+
+    glDeleteShader( shader );
+    shader = 0;
+    return false;
+}
+
+static GLuint create_shader( GLenum type, const std::vector< char > &code, bool spirv ) {
+    /* only starts the compilation, the result is checked by the build queue
+     */
+    GLuint shader = glCreateShader( type );
+    if( spirv ) {
+        /* SPIR-V module is already compiled, the driver only specializes the entry point
+         */
+        glShaderBinary( 1, &shader, GL_SHADER_BINARY_FORMAT_SPIR_V, code.data(), static_cast< GLsizei > ( code.size() ) );
+        glSpecializeShader( shader, "main", 0, nullptr, nullptr );
+    }
+    else {
+        const GLchar *text   = code.data();
+        const GLint   length = static_cast< GLint > ( code.size() );
+        glShaderSource( shader, 1, &text, &length );
+        glCompileShader( shader );
+    }
+
+    return shader;
+}
+
+static bool check_program( GLuint &program ) {
+    GLint status = GL_FALSE;
+    glGetProgramiv( program, GL_LINK_STATUS, &status );
+    if( status == GL_TRUE )
+        return true;
+
+    GLint log_length = 0;
+    glGetProgramiv( program, GL_INFO_LOG_LENGTH, &log_length );
+    std::string log( std::max( log_length, 1 ), '\0' );
+    glGetProgramInfoLog( program, log_length, nullptr, log.data() );
+    std::cerr
+        << "Program link failed: "
+            << log.c_str()
+            << std::endl;
+
+    glDeleteProgram( program );
+    program = 0;
+    return false;
+}
+
+static bool load_program_binary( const std::filesystem::path &path, uint64_t key, GLuint &program ) {
+    std::vector< char > data;
+    if( !read_file( path, data ) || data.size() < sizeof( oglProgramCacheHeader ) )
+        return false;
+
+    /* the file of another driver or another code is simply replaced later
+     */
+    oglProgramCacheHeader header;
+    std::copy_n( data.data(), sizeof( header ), reinterpret_cast< char* > ( &header ) );
+    if( header.magic != program_cache_magic ||
+        header.key != key ||
+        header.size != data.size() - sizeof( header ) )
+        return false;
+
+    program = glCreateProgram();
+    glProgramBinary(
+        program,
+        header.format,
+        data.data() + sizeof( header ),
+        static_cast< GLsizei > ( header.size )
+    );
+
+    /* the driver might reject the binary, for example after the update
+     */
+    GLint status = GL_FALSE;
+    glGetProgramiv( program, GL_LINK_STATUS, &status );
+    if( status == GL_TRUE )
+        return true;
+
+    glDeleteProgram( program );
+    program = 0;
+    return false;
+}
+
+static void save_program_binary( const std::filesystem::path &path, uint64_t key, GLuint program ) {
+    GLint length = 0;
+    glGetProgramiv( program, GL_PROGRAM_BINARY_LENGTH, &length );
+    if( length <= 0 )
+        return;
+
+    oglProgramCacheHeader header { program_cache_magic, 0, key, 0 };
+    std::vector< char > binary( length );
+    GLsizei written = 0;
+    GLenum  format  = 0;
+    glGetProgramBinary( program, length, &written, &format, binary.data() );
+    header.format = format;
+    header.size   = static_cast< uint64_t > ( written );
+
+    /* the file is written aside and renamed, so an interrupted write never leaves a broken cache
+     */
+    std::error_code error;
+    std::filesystem::create_directories( path.parent_path(), error );
+
+    std::filesystem::path temporary = path;
+    temporary += ".tmp";
+    {
+        std::ofstream file( temporary, std::ios::binary | std::ios::trunc );
+        file.write( reinterpret_cast< const char* > ( &header ), sizeof( header ) );
+        file.write( binary.data(), written );
+        if( !file )
+            return;
+    }
+    std::filesystem::rename( temporary, path, error );
+}
+
+static bool submit_program(
+    oglApp            &app,
+    const std::string &name,
+    const std::string &vertex_name,
+    const std::string &fragment_name,
+    GLuint            &target
+) {
+    const std::filesystem::path source_directory( SHADER_SOURCE_DIRECTORY );
+    const std::filesystem::path binary_directory( SHADER_BINARY_DIRECTORY );
+    if( app.shaders.builds.empty() )
+        app.shaders.start = glfwGetTime();
+
+    /* SPIR-V from the build, GLSL sources if the driver or the build has no SPIR-V
+     */
+    std::vector< char > vertex_code, fragment_code;
+    bool spirv = app.shaders.spirv &&
+                 read_file( binary_directory / ( vertex_name + ".vert.spv" ), vertex_code ) &&
+                 read_file( binary_directory / ( fragment_name + ".frag.spv" ), fragment_code );
+    if( !spirv ) {
+        if( !read_file( source_directory / ( vertex_name + ".vert" ), vertex_code ) ||
+            !read_file( source_directory / ( fragment_name + ".frag" ), fragment_code ) ) {
+            std::cerr
+                << "Cannot read shaders of the program "
+                    << name
+                    << std::endl;
+            return false;
+        }
+    }
+
+    /* the binary is valid only for the same driver and the same code
+     */
+    uint64_t key = 0xCBF29CE484222325ull;
+    key = hash_data( key, app.shaders.driver.data(), app.shaders.driver.size() );
+    key = hash_data( key, &spirv, sizeof( spirv ) );
+    key = hash_data( key, vertex_code.data(), vertex_code.size() );
+    key = hash_data( key, fragment_code.data(), fragment_code.size() );
+
+    /* warm start - no compilation and no link at all
+     */
+    const std::filesystem::path cache_path = std::filesystem::path( PROGRAM_CACHE_DIRECTORY ) / ( name + ".bin" );
+    if( app.shaders.binary_cache && load_program_binary( cache_path, key, target ) ) {
+        std::cout
+            << "Program "
+                << name
+                << ": program cache"
+                << std::endl;
+        return true;
+    }
+
+    /* cold start - compilation of both shaders starts now, the queue links them later
+     */
+    oglProgramBuild build;
+    build.name            = name;
+    build.target          = &target;
+    build.key             = key;
+    build.spirv           = spirv;
+    build.vertex_shader   = create_shader( GL_VERTEX_SHADER, vertex_code, spirv );
+    build.fragment_shader = create_shader( GL_FRAGMENT_SHADER, fragment_code, spirv );
+    app.shaders.builds.push_back( build );
+
+    return true;
+}
+
+static bool is_shader_complete( oglApp &app, GLuint shader ) {
+    if( !app.shaders.parallel )
+        return true;
+
+    GLint complete = GL_FALSE;
+    glGetShaderiv( shader, GL_COMPLETION_STATUS_KHR, &complete );
+    return ( complete == GL_TRUE );
+}
+
+static bool is_program_complete( oglApp &app, GLuint program ) {
+    if( !app.shaders.parallel )
+        return true;
+
+    GLint complete = GL_FALSE;
+    glGetProgramiv( program, GL_COMPLETION_STATUS_KHR, &complete );
+    return ( complete == GL_TRUE );
+}
+
+static void release_program_build( oglProgramBuild &build ) {
+    if( build.vertex_shader )
+        glDeleteShader( build.vertex_shader );
+    if( build.fragment_shader )
+        glDeleteShader( build.fragment_shader );
+    if( build.program )
+        glDeleteProgram( build.program );
+    build.vertex_shader   = 0;
+    build.fragment_shader = 0;
+    build.program         = 0;
+}
+
+static bool update_program_build( oglApp &app, oglProgramBuild &build ) {
+    /* the build is finished when the function returns true
+     */
+    if( !build.linking ) {
+        if( !is_shader_complete( app, build.vertex_shader ) ||
+            !is_shader_complete( app, build.fragment_shader ) )
+            return false;
+
+        if( !check_shader( build.vertex_shader ) ||
+            !check_shader( build.fragment_shader ) ) {
+            std::cerr
+                << "Program "
+                    << build.name
+                    << " is not built"
+                    << std::endl;
+            release_program_build( build );
+            return true;
+        }
+
+        build.program = glCreateProgram();
+        if( app.shaders.binary_cache )
+            glProgramParameteri( build.program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE );
+        glAttachShader( build.program, build.vertex_shader );
+        glAttachShader( build.program, build.fragment_shader );
+        glLinkProgram( build.program );
+        build.linking = true;
+        return false;
+    }
+
+    if( !is_program_complete( app, build.program ) )
+        return false;
+
+    /* shaders are not needed after the link
+     */
+    glDetachShader( build.program, build.vertex_shader );
+    glDetachShader( build.program, build.fragment_shader );
+    glDeleteShader( build.vertex_shader );
+    glDeleteShader( build.fragment_shader );
+    build.vertex_shader   = 0;
+    build.fragment_shader = 0;
+
+    if( !check_program( build.program ) ) {
+        std::cerr
+            << "Program "
+                << build.name
+                << " is not built"
+                << std::endl;
+        return true;
+    }
+
+    if( app.shaders.binary_cache ) {
+        const std::filesystem::path cache_path = std::filesystem::path( PROGRAM_CACHE_DIRECTORY ) / ( build.name + ".bin" );
+        save_program_binary( cache_path, build.key, build.program );
+    }
+
+    /* from now the program is used by rendering
+     */
+    *build.target = build.program;
+    build.program = 0;
+
+    std::cout
+        << "Program "
+            << build.name
+            << ": "
+            << ( build.spirv ? "SPIR-V" : "GLSL" )
+            << ", ready after "
+            << 1000.0 * ( glfwGetTime() - app.shaders.start )
+            << " ms"
+            << std::endl;
+
+    return true;
+}
+
+static void update_program_builds( oglApp &app ) {
+    if( app.shaders.builds.empty() )
+        return;
+
+    /* the queue never waits, every program makes the next step when the driver is ready
+     */
+    std::erase_if( app.shaders.builds, [&app]( oglProgramBuild &build ) {
+        return update_program_build( app, build );
+    } );
+
+    if( app.shaders.builds.empty() ) {
+        std::cout
+            << "All programs are ready after "
+                << 1000.0 * ( glfwGetTime() - app.shaders.start )
+                << " ms"
+                << std::endl;
+    }
+}
+
+static void cleanup_program_builds( oglApp &app ) {
+    for( auto &build: app.shaders.builds )
+        release_program_build( build );
+    app.shaders.builds.clear();
+}
+
+/* fullscreen passes
+ */
+
+static bool create_fullscreen( oglApp &app ) {
+    glCreateVertexArrays( 1, &app.fullscreen.vao );
+    glBlendFunc( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA );
+
+    if( !submit_program( app, "background", "fullscreen", "background", app.fullscreen.background ) )
+        return false;
+    if( !submit_program( app, "picture", "fullscreen", "picture", app.fullscreen.picture ) )
+        return false;
+    if( !submit_program( app, "vignette", "fullscreen", "vignette", app.fullscreen.vignette ) )
+        return false;
+
+    return true;
+}
+
+static void cleanup_fullscreen( oglApp &app ) {
+    glDeleteVertexArrays( 1, &app.fullscreen.vao );
+    glDeleteProgram( app.fullscreen.background );
+    glDeleteProgram( app.fullscreen.picture );
+    glDeleteProgram( app.fullscreen.vignette );
+    glDeleteTextures( 1, &app.fullscreen.texture );
+    app.fullscreen.vao        = 0;
+    app.fullscreen.background = 0;
+    app.fullscreen.picture    = 0;
+    app.fullscreen.vignette   = 0;
+    app.fullscreen.texture    = 0;
+
+    invalidate_state_cache( app );
+}
+
+static void draw_fullscreen( oglApp &app, GLuint program, bool blend ) {
+    /* the pass is skipped until its program is ready
+     */
+    if( !program )
+        return;
+
+    use_program( app, program );
+    bind_vertex_array( app, app.fullscreen.vao );
+    set_enabled( app, GL_BLEND, blend );
+    set_enabled( app, GL_DEPTH_TEST, false );
+    glDrawArrays( GL_TRIANGLES, 0, 3 );
+}
+
+/* scene
+ */
+
+static void create_meshes(
+    std::vector< oglVertex > &vertices,
+    std::vector< GLuint >    &indices,
+    std::vector< oglMesh >   &meshes
+) {
+    /* every polygon is a fan of triangles around the center,
+     * indices are local to the mesh and shifted by the base vertex
+     */
+    for( const uint32_t sides: mesh_sides ) {
+        oglMesh mesh;
+        mesh.first_index = static_cast< GLuint > ( indices.size() );
+        mesh.index_count = sides * 3;
+        mesh.base_vertex = static_cast< GLint > ( vertices.size() );
+        meshes.push_back( mesh );
+
+        vertices.push_back( oglVertex { 0.0f, 0.0f } );
+        for( uint32_t side = 0; side < sides; ++side ) {
+            const float angle = 6.2831853f * side / sides;
+            vertices.push_back( oglVertex { std::cos( angle ), std::sin( angle ) } );
+
+            indices.push_back( 0 );
+            indices.push_back( 1 + side );
+            indices.push_back( 1 + ( side + 1 ) % sides );
+        }
+    }
+}
+
+static oglDrawData create_draw_data( uint32_t object ) {
+    /* fractions of irrational numbers spread objects evenly
+     */
+    const float index = static_cast< float > ( object );
+    const float orbit = index * 0.7548776662f - std::floor( index * 0.7548776662f );
+    const float speed = index * 0.5698402910f - std::floor( index * 0.5698402910f );
+    const float tint  = index * 0.6180339887f - std::floor( index * 0.6180339887f );
+
+    oglDrawData draw;
+    draw.radius = 0.05f + 0.9f * orbit;
+    draw.phase  = index * 2.3999632297f;
+    draw.speed  = ( object % 2 ? 1.0f : -1.0f ) * ( 0.1f + 0.5f * speed );
+    draw.size   = 0.005f + 0.015f * tint;
+    draw.r      = 0.3f + 0.7f * orbit;
+    draw.g      = 0.3f + 0.7f * tint;
+    draw.b      = 0.3f + 0.7f * speed;
+    draw.a      = 1.0f;
+    return draw;
+}
+
+static bool create_scene( oglApp &app ) {
+    if( !submit_program( app, "scene", "scene", "scene", app.scene.program ) )
+        return false;
+
+    /* all meshes share one vertex and one index buffer,
+     * so the whole scene is drawn without switching buffers
+     */
+    std::vector< oglVertex > vertices;
+    std::vector< GLuint >    indices;
+    create_meshes( vertices, indices, app.scene.meshes );
+
+    glCreateBuffers( 1, &app.scene.vertices );
+    glNamedBufferStorage( app.scene.vertices, vertices.size() * sizeof( oglVertex ), vertices.data(), 0 );
+    glCreateBuffers( 1, &app.scene.indices );
+    glNamedBufferStorage( app.scene.indices, indices.size() * sizeof( GLuint ), indices.data(), 0 );
+
+    glCreateVertexArrays( 1, &app.scene.vao );
+    glVertexArrayAttribFormat( app.scene.vao, 0, 2, GL_FLOAT, GL_FALSE, offsetof( oglVertex, x ) );
+    glVertexArrayAttribBinding( app.scene.vao, 0, 0 );
+    glEnableVertexArrayAttrib( app.scene.vao, 0 );
+    glVertexArrayVertexBuffer( app.scene.vao, 0, app.scene.vertices, 0, sizeof( oglVertex ) );
+    glVertexArrayElementBuffer( app.scene.vao, app.scene.indices );
+
+    /* objects and their commands are created once for the maximum,
+     * the scene changes only the amount of executed commands,
+     * the CPU copy of commands doesn't change after this point and is read by the upload thread
+     */
+    app.scene.draw_commands.resize( scene_objects_max );
+    for( uint32_t object = 0; object < scene_objects_max; ++object ) {
+        const oglMesh &mesh = app.scene.meshes[object % app.scene.meshes.size()];
+        app.scene.draw_commands[object] = oglDrawCommand {
+            mesh.index_count,
+            1,
+            mesh.first_index,
+            mesh.base_vertex,
+            0  /* the shader uses gl_DrawID */
+        };
+    }
+
+    glCreateBuffers( 1, &app.scene.count );
+    glNamedBufferStorage( app.scene.count, sizeof( GLuint ), nullptr, GL_DYNAMIC_STORAGE_BIT );
+
+    /* per draw data and commands of all objects are uploaded by the upload thread
+     */
+    oglUpload upload { oglUploadKind::scene };
+    upload.start = glfwGetTime();
+    app.uploads.requests.push_back( upload );
+
+    /* the amount of draws from the buffer is part of OpenGL 4.6,
+     * otherwise the amount is passed by CPU; GL_ARB_indirect_parameters
+     * isn't enough, Glad loads glMultiDrawElementsIndirectCount only for 4.6
+     */
+    app.scene.indirect_count = GLAD_GL_VERSION_4_6;
+    if( !app.scene.indirect_count ) {
+        std::cout
+            << "Draw count from the buffer is not supported, glMultiDrawElementsIndirect is used"
+                << std::endl;
+    }
+
+    return true;
+}
+
+static void cleanup_scene( oglApp &app ) {
+    glDeleteBuffers( 1, &app.scene.vertices );
+    glDeleteBuffers( 1, &app.scene.indices );
+    glDeleteBuffers( 1, &app.scene.draws );
+    glDeleteBuffers( 1, &app.scene.commands );
+    glDeleteBuffers( 1, &app.scene.count );
+    glDeleteVertexArrays( 1, &app.scene.vao );
+    glDeleteProgram( app.scene.program );
+    app.scene.vertices = 0;
+    app.scene.indices  = 0;
+    app.scene.draws    = 0;
+    app.scene.commands = 0;
+    app.scene.count    = 0;
+    app.scene.vao      = 0;
+    app.scene.program  = 0;
+
+    /* deleted objects are unbound by OpenGL
+     */
+    invalidate_state_cache( app );
+}
+
+static double draw_scene( oglApp &app ) {
+    /* the scene is skipped until its program and its buffers are ready
+     */
+    if( !app.scene.program || !app.scene.commands )
+        return 0.0;
+
+    const double submit_start = glfwGetTime();
+
+    /* GPU reads the amount of draws from the buffer, CPU updates it only on change
+     */
+    if( app.scene.uploaded != app.scene.objects ) {
+        app.scene.uploaded = app.scene.objects;
+        glNamedBufferSubData( app.scene.count, 0, sizeof( GLuint ), &app.scene.uploaded );
+    }
+
+    use_program( app, app.scene.program );
+    bind_vertex_array( app, app.scene.vao );
+    set_enabled( app, GL_BLEND, false );
+    set_enabled( app, GL_DEPTH_TEST, false );
+    glUniform1f( 0, static_cast< float > ( glfwGetTime() ) );
+
+    switch( app.scene.mode ) {
+    case oglSubmitMode::separate:
+        /* the cost of CPU grows with every object
+         */
+        for( uint32_t object = 0; object < app.scene.objects; ++object ) {
+            const oglDrawCommand &command = app.scene.draw_commands[object];
+            glDrawElementsInstancedBaseVertexBaseInstance(
+                GL_TRIANGLES,
+                command.count,
+                GL_UNSIGNED_INT,
+                reinterpret_cast< const void* > ( command.first_index * sizeof( GLuint ) ),
+                1,
+                command.base_vertex,
+                object
+            );
+        }
+        break;
+    case oglSubmitMode::indirect:
+        /* one call for the whole scene, commands stay in GPU memory
+         */
+        bind_buffer( app, GL_DRAW_INDIRECT_BUFFER, app.scene.commands );
+        if( app.scene.indirect_count ) {
+            bind_buffer( app, GL_PARAMETER_BUFFER, app.scene.count );
+            glMultiDrawElementsIndirectCount(
+                GL_TRIANGLES,
+                GL_UNSIGNED_INT,
+                nullptr,
+                0,
+                scene_objects_max,
+                sizeof( oglDrawCommand )
+            );
+        }
+        else {
+            glMultiDrawElementsIndirect(
+                GL_TRIANGLES,
+                GL_UNSIGNED_INT,
+                nullptr,
+                app.scene.objects,
+                sizeof( oglDrawCommand )
+            );
+        }
+        break;
+    }
+
+    return glfwGetTime() - submit_start;
+}
+
+/* upload thread
+ */
+
+static void create_picture( oglUpload &upload ) {
+    /* interference of two waves, the seed moves the sources
+     */
+    std::vector< uint8_t > texels( static_cast< size_t > ( picture_size ) * picture_size * 4 );
+    const float shift = 0.37f * static_cast< float > ( upload.seed );
+    const float ax = 0.5f + 0.3f * std::cos( shift ), ay = 0.5f + 0.3f * std::sin( shift );
+    const float bx = 1.0f - ax,                       by = 1.0f - ay;
+    for( int y = 0; y < picture_size; ++y ) {
+        for( int x = 0; x < picture_size; ++x ) {
+            const float u = ( x + 0.5f ) / picture_size;
+            const float v = ( y + 0.5f ) / picture_size;
+            const float a = std::sin( 120.0f * std::hypot( u - ax, v - ay ) );
+            const float b = std::sin( 120.0f * std::hypot( u - bx, v - by ) );
+            const float wave = 0.25f * ( a + b ) + 0.5f;
+
+            uint8_t *texel = texels.data() + ( static_cast< size_t > ( y ) * picture_size + x ) * 4;
+            texel[0] = static_cast< uint8_t > ( 40.0f * wave );
+            texel[1] = static_cast< uint8_t > ( 60.0f * wave + 20.0f * v );
+            texel[2] = static_cast< uint8_t > ( 120.0f * wave + 40.0f * v );
+            texel[3] = 255;
+        }
+    }
+
+    GLsizei levels = 1;
+    while( ( picture_size >> levels ) > 0 )
+        levels++;
+
+    glCreateTextures( GL_TEXTURE_2D, 1, &upload.texture );
+    glTextureStorage2D( upload.texture, levels, GL_RGBA8, picture_size, picture_size );
+    glTextureSubImage2D( upload.texture, 0, 0, 0, picture_size, picture_size, GL_RGBA, GL_UNSIGNED_BYTE, texels.data() );
+    glGenerateTextureMipmap( upload.texture );
+    glTextureParameteri( upload.texture, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR );
+    glTextureParameteri( upload.texture, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+    glTextureParameteri( upload.texture, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+    glTextureParameteri( upload.texture, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+}
+
+static void create_scene_buffers( oglApp &app, oglUpload &upload ) {
+    std::vector< oglDrawData > draws( scene_objects_max );
+    for( uint32_t object = 0; object < scene_objects_max; ++object )
+        draws[object] = create_draw_data( object );
+
+    glCreateBuffers( 1, &upload.draws );
+    glNamedBufferStorage( upload.draws, draws.size() * sizeof( oglDrawData ), draws.data(), 0 );
+    glCreateBuffers( 1, &upload.commands );
+    glNamedBufferStorage( upload.commands, app.scene.draw_commands.size() * sizeof( oglDrawCommand ), app.scene.draw_commands.data(), 0 );
+}
+
+static void upload_worker( oglApp *app ) {
+    /* the context of the upload thread is current only here,
+     * Glad pointers are global and valid for every context of the share group
+     */
+    glfwMakeContextCurrent( app->uploads.window );
+    if( app->debug.context ) {
+        glDebugMessageControl( GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, nullptr, GL_TRUE );
+        glDebugMessageCallback( gl_debug_callback, app );
+        glEnable( GL_DEBUG_OUTPUT );
+    }
+
+    for( ;; ) {
+        oglUpload upload;
+        {
+            std::unique_lock< std::mutex > lock( app->uploads.mutex );
+            app->uploads.cv.wait( lock, [app] { return app->uploads.stop || !app->uploads.requests.empty(); } );
+            if( app->uploads.stop )
+                break;
+
+            upload = app->uploads.requests.front();
+            app->uploads.requests.pop_front();
+        }
+
+        const double start = glfwGetTime();
+        switch( upload.kind ) {
+        case oglUploadKind::picture:
+            create_picture( upload );
+            break;
+        case oglUploadKind::scene:
+            create_scene_buffers( *app, upload );
+            break;
+        }
+
+        /* the fence is shared by both contexts,
+         * the flush guarantees that the render thread doesn't wait for a fence which GPU never sees
+         */
+        upload.fence = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+        glFlush();
+        upload.cpu_time = glfwGetTime() - start;
+
+        std::lock_guard< std::mutex > lock( app->uploads.mutex );
+        app->uploads.finished.push_back( upload );
+    }
+
+    if( app->debug.context )
+        glDebugMessageCallback( nullptr, nullptr );
+    glfwMakeContextCurrent( nullptr );
+}
+
+static void release_upload( oglUpload &upload ) {
+    /* objects are shared, the render thread might delete them
+     */
+    if( upload.fence )
+        glDeleteSync( upload.fence );
+    glDeleteTextures( 1, &upload.texture );
+    glDeleteBuffers( 1, &upload.draws );
+    glDeleteBuffers( 1, &upload.commands );
+    upload.fence = nullptr;
+}
+
+static void complete_upload( oglApp &app, oglUpload &upload ) {
+    /* the new objects are bound for the first time on the render thread after the fence,
+     * so the render context sees their whole content
+     */
+    switch( upload.kind ) {
+    case oglUploadKind::picture:
+        /* the old picture is replaced, a later request might finish before an older one
+         */
+        if( upload.seed < app.fullscreen.seed && app.fullscreen.texture ) {
+            release_upload( upload );
+            return;
+        }
+        std::swap( app.fullscreen.texture, upload.texture );
+        bind_texture( app, 0, app.fullscreen.texture );
+        break;
+    case oglUploadKind::scene:
+        std::swap( app.scene.draws, upload.draws );
+        std::swap( app.scene.commands, upload.commands );
+        glBindBufferBase( GL_SHADER_STORAGE_BUFFER, 0, app.scene.draws );
+        break;
+    }
+
+    std::cout
+        << "Upload "
+            << ( upload.kind == oglUploadKind::picture ? "picture" : "scene" )
+            << ": "
+            << 1000.0 * upload.cpu_time
+            << " ms on the upload thread, ready after "
+            << 1000.0 * ( glfwGetTime() - upload.start )
+            << " ms"
+            << std::endl;
+
+    /* old objects of the swap are deleted with the fence
+     */
+    release_upload( upload );
+}
+
+static void update_uploads( oglApp &app ) {
+    std::deque< oglUpload > finished;
+    {
+        std::lock_guard< std::mutex > lock( app.uploads.mutex );
+        finished.swap( app.uploads.finished );
+    }
+
+    /* the render thread never waits: the fence is only tested,
+     * uploads not finished by GPU yet stay in the queue until the next frame
+     */
+    std::deque< oglUpload > pending;
+    for( auto &upload: finished ) {
+        const GLenum res = glClientWaitSync( upload.fence, 0, 0 );
+        if( res == GL_TIMEOUT_EXPIRED )
+            pending.push_back( upload );
+        else
+            complete_upload( app, upload );
+    }
+
+    if( !pending.empty() ) {
+        std::lock_guard< std::mutex > lock( app.uploads.mutex );
+        app.uploads.finished.insert( app.uploads.finished.begin(), pending.begin(), pending.end() );
+    }
+}
+
+static void start_upload_thread( oglApp &app ) {
+    /* the context of the main window can't be current on two threads,
+     * the upload thread uses the hidden window
+     */
+    app.uploads.worker = std::thread( upload_worker, &app );
+}
+
+static void stop_upload_thread( oglApp &app ) {
+    if( app.uploads.worker.joinable() ) {
+        {
+            std::lock_guard< std::mutex > lock( app.uploads.mutex );
+            app.uploads.stop = true;
+        }
+        app.uploads.cv.notify_one();
+        app.uploads.worker.join();
+    }
+
+    /* jobs which never reached the render thread
+     */
+    for( auto &upload: app.uploads.requests )
+        release_upload( upload );
+    for( auto &upload: app.uploads.finished )
+        release_upload( upload );
+    app.uploads.requests.clear();
+    app.uploads.finished.clear();
+}
+
+static bool init_opengl( oglApp &app ) {
+    if( !app.window )
+        return false;
+
+    /* run Glad and load actual version of OpenGL
+     */
+    if( !gladLoadGL() )
+        return false;
+
+    /* Glad is generated without extensions, read the list of the context once
+     */
+    if( !gladLoadExtensions() )
+        return false;
+
+    app.gl_loaded = true;
+
+    std::cout
+        << "OpenGL renderer: "
+            << reinterpret_cast< const char* > ( glGetString( GL_RENDERER ) )
+            << std::endl;
+
+    std::cout
+        << "OpenGL driver version: "
+            << reinterpret_cast< const char* > ( glGetString( GL_VERSION ) )
+            << std::endl;
+
+    /* messages of the driver go to the counters and to the log
+     */
+    if( !create_debug_output( app ) )
+        return false;
+
+    /* SPIR-V support and the key of the program cache
+     */
+    init_shaders( app );
+
+    /* GPU time of every pass is measured with timestamps
+     */
+    if( !create_gpu_timer( app ) )
+        return false;
+
+    /* all programs are submitted at once and built in parallel
+     */
+    if( !create_fullscreen( app ) )
+        return false;
+
+    /* the whole scene is in GPU memory, including draw commands
+     */
+    if( !create_scene( app ) )
+        return false;
+
+    /* the first picture and the scene buffers are created by the upload thread,
+     * the render loop starts immediately
+     */
+    oglUpload upload { oglUploadKind::picture };
+    upload.start = glfwGetTime();
+    app.uploads.requests.push_back( upload );
+    start_upload_thread( app );
+
+    return true;
+}
+
+static bool cleanup_opengl( oglApp &app ) {
+    if( !app.gl_loaded )
+        return false;
+
+    stop_upload_thread( app );
+    cleanup_program_builds( app );
+    cleanup_scene( app );
+    cleanup_fullscreen( app );
+    cleanup_gpu_timer( app );
+    cleanup_debug_output( app );
+
+    app.gl_loaded = false;
+
+    return true;
+}
+
+static bool init( oglApp &app ) {
+    if( !init_glfw( app ) )
+        return false;
+    if( !init_window( app ) )
+        return false;
+    if( !init_opengl( app ) )
+        return false;
+
+    return true;
+}
+
+static bool cleanup( oglApp &app ) {
+    if( !cleanup_opengl( app ) )
+        return false;
+    if( !cleanup_window( app ) )
+        return false;
+    if( !cleanup_glfw( app ) )
+        return false;
+
+    return true;
+}
+
+/* frame statistics
+ */
+
+static void reset_frame_stats( oglApp &app ) {
+    app.stats.period_start    = 0.0;
+    app.stats.frames          = 0;
+    app.stats.cpu_time_sum    = 0.0;
+    app.stats.submit_time_sum = 0.0;
+    app.stats.gpu_time_sum.fill( 0.0 );
+    app.stats.gpu_samples     = 0;
+    app.timer.dropped         = 0;
+    app.state.issued          = 0;
+    app.state.skipped         = 0;
+
+    app.limiter.error_sum   = 0.0;
+    app.limiter.error_max   = 0.0;
+    app.limiter.error_count = 0;
+    app.limiter.late_count  = 0;
+}
+
+static void update_frame_stats( oglApp &app, double cpu_time, double submit_time ) {
+    const double now = glfwGetTime();
+    if( app.stats.period_start == 0.0 )
+        app.stats.period_start = now;
+
+    app.stats.frames++;
+    app.stats.cpu_time_sum    += cpu_time;
+    app.stats.submit_time_sum += submit_time;
+
+    /* report once per second
+     */
+    const double period = now - app.stats.period_start;
+    if( period < 1.0 )
+        return;
+
+    std::cout
+        << "Frame stats: "
+            << app.stats.frames / period
+            << " fps, CPU "
+            << 1000.0 * app.stats.cpu_time_sum / app.stats.frames
+            << " ms, objects "
+            << app.scene.objects
+            << ", submission "
+            << ( app.scene.mode == oglSubmitMode::indirect ? "indirect " : "separate " )
+            << 1000.0 * app.stats.submit_time_sum / app.stats.frames
+            << " ms, state calls "
+            << static_cast< double > ( app.state.issued ) / app.stats.frames
+            << ", redundant skipped "
+            << static_cast< double > ( app.state.skipped ) / app.stats.frames;
+    if( app.stats.gpu_samples ) {
+        for( size_t pass = 0; pass < gpu_pass_names.size(); ++pass ) {
+            std::cout
+                << ", GPU "
+                    << gpu_pass_names[pass]
+                    << ' '
+                    << app.stats.gpu_time_sum[pass] / app.stats.gpu_samples
+                    << " ms";
+        }
+    }
+    std::cout
+        << ", not measured "
+            << app.timer.dropped
+            << ", debug messages "
+            << app.debug.messages.exchange( 0 )
+            << ", performance warnings "
+            << app.debug.performance.exchange( 0 )
+            << ", limiter error "
+            << ( app.limiter.error_count ? 1000000.0 * app.limiter.error_sum / app.limiter.error_count : 0.0 )
+            << " us, max "
+            << 1000000.0 * app.limiter.error_max
+            << " us, late frames "
+            << app.limiter.late_count
+            << std::endl;
+
+    reset_frame_stats( app );
+    app.stats.period_start = now;
+}
+
+/* idle scheduler
+ */
+
+static bool is_window_visible( oglApp &app ) {
+    if( app.idle.iconified )
+        return false;
+    if( glfwGetWindowAttrib( app.window, GLFW_VISIBLE ) == GLFW_FALSE )
+        return false;
+
+    /* some platforms report the minimized window only by the zero size
+     */
+    return ( app.display.frame_width != 0 ) && ( app.display.frame_height != 0 );
+}
+
+static void park( oglApp &app, bool parked ) {
+    if( app.idle.parked == parked )
+        return;
+    app.idle.parked = parked;
+
+    /* the time spent in the park is not a frame
+     */
+    reset_frame_stats( app );
+
+    std::cout
+        << "Rendering "
+            << ( parked ? "paused" : "resumed" )
+            << ", frames skipped: "
+            << app.idle.skipped
+            << std::endl;
+    app.idle.skipped = 0;
+}
+
+static bool update_idle( oglApp &app ) {
+    /* invisible window draws nothing and sleeps until any event,
+     * timeout is only a safety net for platforms without iconify events
+     */
+    if( !is_window_visible( app ) ) {
+        park( app, true );
+        app.idle.skipped++;
+        glfwWaitEventsTimeout( idle_wait_timeout );
+        return false;
+    }
+    park( app, false );
+
+    if( app.idle.focused || ( app.idle.background_fps <= 0.0 ) )
+        return true;
+
+    /* window without focus sleeps until the next frame is due,
+     * input still wakes it up earlier
+     */
+    const double now = glfwGetTime();
+    if( now < app.idle.next_frame ) {
+        app.idle.skipped++;
+        glfwWaitEventsTimeout( app.idle.next_frame - now );
+        return false;
+    }
+
+    /* keep the cadence, but don't catch up missed frames after a long sleep
+     */
+    const double period = 1.0 / app.idle.background_fps;
+    app.idle.next_frame = ( now - app.idle.next_frame > period ) ? now + period
+                                                                 : app.idle.next_frame + period;
+
+    return true;
+}
+
+/* frame limiter
+ */
+
+static void update_sleep_estimate( oglApp &app, double slept ) {
+    /* the OS wakes the thread up later than requested, how much later depends on
+     * the timer resolution and the load, so the worst case is learned at runtime
+     */
+    const double delta = slept - app.limiter.sleep_mean;
+    app.limiter.sleep_mean += limiter_sleep_smoothing * delta;
+    app.limiter.sleep_var   = ( 1.0 - limiter_sleep_smoothing ) * ( app.limiter.sleep_var + limiter_sleep_smoothing * delta * delta );
+    app.limiter.sleep_worst = app.limiter.sleep_mean + 2.0 * std::sqrt( app.limiter.sleep_var );
+}
+
+static void limit_frame_rate( oglApp &app ) {
+    const double target_fps = frame_rate_targets[app.limiter.target];
+    if( target_fps <= 0.0 ) {
+        app.limiter.deadline = 0.0;
+        return;
+    }
+
+    const double period = 1.0 / target_fps;
+    double now = glfwGetTime();
+
+    /* first frame or the frame is late for the whole period: start the new cadence,
+     * missed frames are not caught up
+     */
+    if( ( app.limiter.deadline == 0.0 ) || ( now - app.limiter.deadline > period ) ) {
+        if( app.limiter.deadline != 0.0 )
+            app.limiter.late_count++;
+        app.limiter.deadline = now + period;
+        return;
+    }
+
+    /* the frame came after the deadline by itself, the limiter has nothing to wait for,
+     * the lateness comes from the time of the frame and is not the error of the limiter
+     */
+    const bool waited = ( now < app.limiter.deadline );
+
+    /* sleep in short steps while even the worst step ends before the deadline
+     */
+    while( app.limiter.deadline - now > app.limiter.sleep_worst ) {
+        std::this_thread::sleep_for( std::chrono::duration< double >( limiter_sleep_step ) );
+        const double woke = glfwGetTime();
+        update_sleep_estimate( app, woke - now );
+        now = woke;
+    }
+
+    /* spin the rest of the time, the thread gives CPU to others but never sleeps
+     */
+    while( now < app.limiter.deadline ) {
+        std::this_thread::yield();
+        now = glfwGetTime();
+    }
+
+    /* overshoot is the error of the limiter itself
+     */
+    if( waited ) {
+        const double error = now - app.limiter.deadline;
+        app.limiter.error_sum += error;
+        app.limiter.error_max  = std::max( app.limiter.error_max, error );
+        app.limiter.error_count++;
+    }
+    else
+        app.limiter.late_count++;
+
+    app.limiter.deadline += period;
+}
+
+static void draw( oglApp &app ) {
+    const double cpu_start = glfwGetTime();
+
+    /* programs which became ready since the last frame join the rendering
+     */
+    update_program_builds( app );
+
+    /* resources from the upload thread join the rendering when GPU finished them
+     */
+    update_uploads( app );
+
+    begin_gpu_frame( app );
+
+        /* Synchronize viewport with window size,
+         * the size comes from the callback and the call reaches the driver only after the resize
+         */
+        set_viewport(
+            app,
+            0, 0,
+            app.display.frame_width, app.display.frame_height
+        );
+
+        /* clean window background
+         */
+        set_clear_color( app, 0.0f, 0.3f, 0.6f, 1.0f );
+        glClear(
+            GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT
+        );
+
+        /* picture from the upload thread or the gradient while the picture is not ready
+         */
+        if( app.fullscreen.texture && app.fullscreen.picture ) {
+            bind_texture( app, 0, app.fullscreen.texture );
+            draw_fullscreen( app, app.fullscreen.picture, false );
+        }
+        else
+            draw_fullscreen( app, app.fullscreen.background, false );
+
+    end_gpu_pass( app, 0 );
+
+        /* scene - all objects with one multi draw indirect call
+         */
+        const double submit_time = draw_scene( app );
+
+        /* dark corners over the scene
+         */
+        draw_fullscreen( app, app.fullscreen.vignette, true );
+
+    end_gpu_pass( app, 1 );
+    end_gpu_frame( app );
+
+    update_frame_stats( app, glfwGetTime() - cpu_start, submit_time );
+
+    /* update window
+     */
+    glfwSwapBuffers( app.window );
+}
+
+int main() {
+    oglApp app;
+
+    if( !init( app ) ) {
+        std::cerr
+            << "Cannot initialize the application"
+                << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    /* render loop
+     */
+    while( glfwWindowShouldClose( app.window ) == GLFW_FALSE ) {
+        /* hidden or limited window waits for events instead of the next frame
+         */
+        if( !update_idle( app ) )
+            continue;
+
+        /* wait for the start of the next frame at the target frame rate
+         */
+        limit_frame_rate( app );
+
+        /* draw the context of the window
+         */
+        draw( app );
+
+        /* proceed keyboard and mouse
+         */
+        glfwPollEvents();
+
+        /* switch the window mode on request of the user
+         */
+        update_window_mode( app );
+    }
+
+    if( !cleanup( app ) ) {
+        std::cerr
+            << "Cleanup failed"
+                << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout
+        << "Job is done!"
+            << std::endl;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,11 @@
+#version 460 core
+
+layout( location = 0 ) out vec2 screen_coord;
+
+void main() {
+    /* one triangle covers the whole screen, no vertex buffer is needed
+     */
+    vec2 corner  = vec2( ( gl_VertexID << 1 ) & 2, gl_VertexID & 2 );
+    screen_coord = corner;
+    gl_Position  = vec4( corner * 2.0 - 1.0, 0.0, 1.0 );
+}
@@ -0,0 +1,11 @@
+#version 460 core
+
+layout( location = 0 ) in  vec2 screen_coord;
+layout( location = 0 ) out vec4 fragment_color;
+
+void main() {
+    /* darkens corners of the screen, blended over the scene
+     */
+    float distance = length( screen_coord - 0.5 ) * 1.4142;
+    fragment_color = vec4( 0.0, 0.0, 0.0, smoothstep( 0.6, 1.0, distance ) * 0.8 );
+}
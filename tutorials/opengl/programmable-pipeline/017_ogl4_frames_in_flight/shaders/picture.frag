@@ -0,0 +1,10 @@
+#version 460 core
+
+layout( binding = 0 ) uniform sampler2D picture;
+
+layout( location = 0 ) in  vec2 screen_coord;
+layout( location = 0 ) out vec4 fragment_color;
+
+void main() {
+    fragment_color = vec4( texture( picture, screen_coord ).rgb, 1.0 );
+}
@@ -0,0 +1,8 @@
+#version 460 core
+
+layout( location = 0 ) in  vec2 screen_coord;
+layout( location = 0 ) out vec4 fragment_color;
+
+void main() {
+    fragment_color = vec4( mix( vec3( 0.0, 0.05, 0.15 ), vec3( 0.0, 0.3, 0.6 ), screen_coord.y ), 1.0 );
+}
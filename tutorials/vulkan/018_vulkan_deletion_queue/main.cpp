@@ -0,0 +1,1630 @@
+/*
+    Vulkan 1.3 tutorial
+    
+    Deferred deletion of Vulkan objects
+ */
+
+#include <cstdlib>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <set>
+#include <optional>
+#include <algorithm>
+#include <limits>
+#include <array>
+#include <deque>
+#include <functional>
+
+
+/* don't load Vulkan, will be done by volk
+ */
+#define GLFW_INCLUDE_VULKAN
+#define VK_NO_PROTOTYPES
+#include <GLFW/glfw3.h>
+#include <volk.h>
+
+
+/* Vulkan error check
+ */
+#define VK_CALL( func, err_msg ) { \
+    if( VK_SUCCESS != func ) {     \
+        std::cerr                  \
+            << "VK_CALL error: "   \
+                << err_msg         \
+                << std::endl;      \
+        return false;              \
+    }                              \
+}
+
+/* Tutorial vulkan function call
+ */
+#define TUTORIAL_CALL( func ) { \
+    if( !func )                 \
+        return false;           \
+}
+
+static const char khronos_validation_layer_name[] = "VK_LAYER_KHRONOS_validation";
+
+/* amount of frames which CPU may prepare while GPU is still busy with previous ones
+ */
+static const uint32_t max_frames_in_flight = 2;
+
+/* Owner of one Vulkan object
+ *
+ * Wrapper keeps the handle together with its parent (instance or device)
+ * and destroys the object when goes out of scope or reset() is called.
+ * Wrapper can be only moved, so every object has exactly one owner.
+ */
+template< typename Parent, typename Handle, typename Deleter >
+class vkUnique {
+public:
+    vkUnique() = default;
+    vkUnique( Parent parent, Handle handle )
+        : parent_( parent ), handle_( handle ) {}
+    ~vkUnique() { reset(); }
+
+    vkUnique( const vkUnique& ) = delete;
+    vkUnique& operator=( const vkUnique& ) = delete;
+
+    vkUnique( vkUnique &&other ) noexcept
+        : parent_( other.parent_ ), handle_( other.release() ) {}
+    vkUnique& operator=( vkUnique &&other ) noexcept {
+        if( this != &other ) {
+            reset();
+            parent_ = other.parent_;
+            handle_ = other.release();
+        }
+        return *this;
+    }
+
+    Handle        get()    const { return handle_; }
+    const Handle* ptr()    const { return &handle_; }
+    Parent        parent() const { return parent_; }
+
+    explicit operator bool() const { return handle_ != VK_NULL_HANDLE; }
+
+    /* give up the ownership without destroying the object
+     */
+    Handle release() {
+        Handle handle = handle_;
+        handle_ = VK_NULL_HANDLE;
+        return handle;
+    }
+
+    /* destroy the object right now
+     */
+    void reset() {
+        if( handle_ != VK_NULL_HANDLE )
+            Deleter{}( parent_, handle_ );
+        handle_ = VK_NULL_HANDLE;
+    }
+
+private:
+    Parent parent_ { VK_NULL_HANDLE };
+    Handle handle_ { VK_NULL_HANDLE };
+};
+
+/* volk stores Vulkan functions in global pointers, so every deleter
+ * calls the pointer in the moment of destruction
+ */
+#define VK_DELETER( parent_type, handle_type, destroy_func )         \
+struct handle_type##Deleter {                                         \
+    void operator()( parent_type parent, handle_type handle ) const { \
+        destroy_func( parent, handle, nullptr );                      \
+    }                                                                 \
+};
+
+VK_DELETER( VkInstance, VkDebugUtilsMessengerEXT, vkDestroyDebugUtilsMessengerEXT )
+VK_DELETER( VkInstance, VkSurfaceKHR,             vkDestroySurfaceKHR )
+VK_DELETER( VkDevice,   VkSwapchainKHR,           vkDestroySwapchainKHR )
+VK_DELETER( VkDevice,   VkImageView,              vkDestroyImageView )
+VK_DELETER( VkDevice,   VkRenderPass,             vkDestroyRenderPass )
+VK_DELETER( VkDevice,   VkFramebuffer,            vkDestroyFramebuffer )
+VK_DELETER( VkDevice,   VkSemaphore,              vkDestroySemaphore )
+VK_DELETER( VkDevice,   VkFence,                  vkDestroyFence )
+VK_DELETER( VkDevice,   VkCommandPool,            vkDestroyCommandPool )
+
+using vkUniqueDebugMessenger = vkUnique< VkInstance, VkDebugUtilsMessengerEXT, VkDebugUtilsMessengerEXTDeleter >;
+using vkUniqueSurface        = vkUnique< VkInstance, VkSurfaceKHR,             VkSurfaceKHRDeleter >;
+using vkUniqueSwapchain      = vkUnique< VkDevice,   VkSwapchainKHR,           VkSwapchainKHRDeleter >;
+using vkUniqueImageView      = vkUnique< VkDevice,   VkImageView,              VkImageViewDeleter >;
+using vkUniqueRenderPass     = vkUnique< VkDevice,   VkRenderPass,             VkRenderPassDeleter >;
+using vkUniqueFramebuffer    = vkUnique< VkDevice,   VkFramebuffer,            VkFramebufferDeleter >;
+using vkUniqueSemaphore      = vkUnique< VkDevice,   VkSemaphore,              VkSemaphoreDeleter >;
+using vkUniqueFence          = vkUnique< VkDevice,   VkFence,                  VkFenceDeleter >;
+using vkUniqueCommandPool    = vkUnique< VkDevice,   VkCommandPool,            VkCommandPoolDeleter >;
+
+/* object which waits in the deletion queue
+ */
+struct vkRetiredObject {
+    uint64_t                frame;   /* last submitted frame which might use the object */
+    std::function< void() > destroy; /* destroy the object */
+};
+
+/* application data
+ */
+struct vkApp {
+    struct {
+        bool         init   { false };
+        GLFWwindow  *window { nullptr }; /* pointer to GLFW window */
+    } glfw;
+    struct {
+        struct {
+            bool                   enable    { false }; /* flag that DebugUtils extension is supported by driver */
+            vkUniqueDebugMessenger messenger;           /* DebugUtils messenger */
+        } debug;
+        struct {
+            VkInstance object { VK_NULL_HANDLE }; /* pointer to Vulkan instance */
+
+            std::vector< const char* > required_extensions; /* list of required extensions */
+            std::vector< const char* > require_layers;      /* list of require layers */
+        } instance;
+        struct {
+            vkUniqueSurface object; /* Vulkan surface */
+        } surface;
+        struct {
+            VkPhysicalDevice gpu           { VK_NULL_HANDLE }; /* pointer to the physical device, in this case - GPU */
+            VkDevice         object        { VK_NULL_HANDLE }; /* pointer to the Vulkan device */
+            VkQueue          graph_queue   { VK_NULL_HANDLE }; /* graphical queue of the Vulkan device */
+            VkQueue          present_queue { VK_NULL_HANDLE }; /* presentation queue of the Vulkan device */
+
+            uint32_t         graph_family_idx;   /* index in the graphical queue of the physical device */
+            uint32_t         present_family_idx; /* index of the presentation queue of the physical device */
+
+            std::vector< const char* > require_extensions {
+                VK_KHR_SWAPCHAIN_EXTENSION_NAME
+            }; /* list of required extensions */
+        } device;
+        struct {
+            bool               recreate           { false };                       /* flag to trigger the swapchain recreation */
+            vkUniqueSwapchain  object;                                             /* Vulkan swapchain */
+            VkExtent2D         display_size;                                       /* actual display size */
+            VkFormat           display_format     { VK_FORMAT_UNDEFINED };         /* actual format of display pixels */
+            VkColorSpaceKHR    display_colorspace { VK_COLOR_SPACE_MAX_ENUM_KHR };
+            VkPresentModeKHR   present_mode       { VK_PRESENT_MODE_MAX_ENUM_KHR };
+            vkUniqueRenderPass render_pass;
+
+            std::vector< VkImage >             images; /* images where the graphics will render, owned by the swapchain */
+            std::vector< vkUniqueImageView >   views;  /* views for the images to present on the screen */
+            std::vector< vkUniqueFramebuffer > frames; /* frame buffers for every image view */
+        } swapchain;
+        struct {
+            std::vector< vkUniqueSemaphore > image_available;    /* indicator that next image in the swapchain is available, per frame slot */
+            std::vector< vkUniqueSemaphore > rendering_finished; /* indicator that the render pass is over, per frame slot */
+            std::vector< vkUniqueFence >     gpu_fence;          /* GPU mutex, per frame slot */
+        } sync;
+        struct {
+            vkUniqueCommandPool pool; /* pool of command buffers */
+
+            std::vector< VkCommandBuffer > cmds; /* command buffer for every frame slot */
+        } render;
+        struct {
+            uint32_t slot      { 0 }; /* frame slot which is recording right now */
+            uint64_t submitted { 0 }; /* amount of frames submitted to GPU */
+            uint64_t completed { 0 }; /* amount of frames which GPU has finished for sure */
+
+            std::array< uint64_t, max_frames_in_flight > slot_frame {}; /* number of the last frame submitted in every slot */
+
+            std::deque< vkRetiredObject > deletion_queue; /* objects waiting for the end of frames which use them */
+        } frame;
+    } vulkan;
+};
+
+/* callbacks
+ */
+
+static void glfw_error_callback( int error,
+                                 const char* description ) {
+    std::cerr
+        << "GLFW error: "
+            << description
+            << std::endl;
+}
+
+static VKAPI_ATTR VkBool32 VKAPI_CALL vk_error_callback(
+          VkDebugUtilsMessageSeverityFlagBitsEXT severity,
+          VkDebugUtilsMessageTypeFlagsEXT        type,
+    const VkDebugUtilsMessengerCallbackDataEXT  *data,
+          void                                  *user_data
+) {
+    std::cerr
+        << "Vulkan error: "
+            << data->pMessage
+                << std::endl;
+
+    /* should always return VK_FALSE
+     */
+    return VK_FALSE;
+}
+
+static void key_callback(
+    GLFWwindow* window,
+    int key,
+    int scancode,
+    int action,
+    int mods
+) {
+    /* ESC - close application
+    */
+    if ( key == GLFW_KEY_ESCAPE && action == GLFW_PRESS )
+        glfwSetWindowShouldClose( window, GLFW_TRUE );
+}
+
+/* GLFW library
+ */
+
+static bool init_glfw( vkApp &app ) {
+    /* setup error callback first to catch all errors
+     */
+    (void)glfwSetErrorCallback( glfw_error_callback );
+
+    /* init the library
+     */
+    if( glfwInit() == GLFW_FALSE )
+        return false;
+
+    /* Prepare the list of require extensions
+     */
+    uint32_t glfw_require_extension_count = 0;
+    const char **glfw_require_extensions =
+        glfwGetRequiredInstanceExtensions( &glfw_require_extension_count );
+    for( uint32_t i = 0; i < glfw_require_extension_count; ++i )
+        app.vulkan.instance.required_extensions.push_back( glfw_require_extensions[i] );
+
+    app.glfw.init = true;
+
+    return true;
+}
+
+static bool cleanup_glfw( vkApp &app ) {
+    if( !app.glfw.init )
+        return true;
+
+    /* cleanup GLFW resources
+     */
+    glfwTerminate();
+    app.glfw.init = false;
+
+    return true;
+}
+
+/* GLFW window
+ */
+
+static bool init_window( vkApp &app ) {
+    if( !app.glfw.init )
+        return false;
+
+    /* don't create any graphical context
+     */
+    glfwWindowHint( GLFW_CLIENT_API, GLFW_NO_API );
+
+    /* read actual screen resolution
+     */
+    GLFWmonitor *primary_monitor = glfwGetPrimaryMonitor();
+    const GLFWvidmode *primary_monitor_mode = glfwGetVideoMode( primary_monitor );
+    int window_width = primary_monitor_mode->width;
+    int window_height = primary_monitor_mode->height;
+
+    app.glfw.window = glfwCreateWindow(
+        window_width,
+        window_height,
+        "Vulkan 1.3 - Tutorial - Fullscreen",
+        glfwGetPrimaryMonitor(), /* actual monitor is needed to switch on full screen */
+        nullptr
+    );
+    if( !app.glfw.window )
+        return false;
+
+    /* setup user pointer
+     */
+    glfwSetWindowUserPointer(
+        app.glfw.window,
+       &app
+    );
+
+    /* acquire the keyboard
+     */
+    glfwSetKeyCallback(
+        app.glfw.window,
+        key_callback
+    );
+
+    return true;
+}
+
+static bool cleanup_window( vkApp &app ) {
+    if( !app.glfw.window )
+        return true;
+
+    /* destroy GLFW window
+     */
+    glfwDestroyWindow( app.glfw.window );
+    app.glfw.window = nullptr;
+
+    return true;
+}
+
+/* Vulkan deletion queue
+ */
+
+template< typename Parent, typename Handle, typename Deleter >
+static void vk_retire( vkApp &app, vkUnique< Parent, Handle, Deleter > &object ) {
+    if( !object )
+        return;
+
+    /* object might be still in use by frames which are already submitted,
+     * so it will be destroyed only after GPU finishes all of them
+     */
+    Parent parent = object.parent();
+    Handle handle = object.release();
+
+    app.vulkan.frame.deletion_queue.push_back( vkRetiredObject {
+        .frame   = app.vulkan.frame.submitted,
+        .destroy = [parent, handle]() { Deleter{}( parent, handle ); }
+    } );
+}
+
+static void vk_collect_retired( vkApp &app, uint64_t completed_frame ) {
+    /* objects are retired in order, so the queue is sorted by the frame number
+     */
+    while( !app.vulkan.frame.deletion_queue.empty() ) {
+        vkRetiredObject &retired = app.vulkan.frame.deletion_queue.front();
+        if( retired.frame > completed_frame )
+            break;
+
+        retired.destroy();
+        app.vulkan.frame.deletion_queue.pop_front();
+    }
+}
+
+/* Vulkan instance
+ */
+
+static bool vk_create_instance( vkApp &app ) {
+    if( !app.glfw.window )
+        return false;
+
+    /* read the actual supported version
+     */
+    uint32_t actual_version = 0;
+    VK_CALL( vkEnumerateInstanceVersion( &actual_version ),
+             "Cannot get the actual supported version of Vulkan" );
+    std::cout
+        << "Actual Vulkan version: "
+            << VK_API_VERSION_MAJOR( actual_version )
+            << '.'
+            << VK_API_VERSION_MINOR( actual_version )
+            << '.'
+            << VK_API_VERSION_PATCH( actual_version )
+            << std::endl;
+
+    /* fullfil application information
+     */
+    VkApplicationInfo vk_app_info {
+        .sType              = VK_STRUCTURE_TYPE_APPLICATION_INFO, /* sType MUST be always set */
+        .pApplicationName   = "Vulkan tutorial application",
+        .applicationVersion = VK_MAKE_API_VERSION( 0, 1, 0, 0 ),
+        .pEngineName        = "Vulkan tutorials",
+        .engineVersion      = VK_MAKE_API_VERSION( 0, 1, 0, 0 ),
+        .apiVersion         = VK_API_VERSION_1_3  /* require Vulkan 1.3 */
+    };
+
+    /* Request debug layer support if needed
+     */
+    if( app.vulkan.debug.enable )
+        app.vulkan.instance.require_layers.push_back( khronos_validation_layer_name );
+
+    /* Prepare debug callback to accept only errors
+     */
+    VkDebugUtilsMessengerCreateInfoEXT vk_debug_utils_info {
+        .sType           = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT,
+        .messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT,
+        .messageType     = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT       \
+                            | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT \
+                            | VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT,
+        .pfnUserCallback = &vk_error_callback
+    };
+
+    VkInstanceCreateInfo vk_instance_create_info {
+        .sType                   = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO,
+        .pApplicationInfo        = &vk_app_info,
+        .enabledLayerCount       = static_cast< uint32_t > ( app.vulkan.instance.require_layers.size() ),
+        .ppEnabledLayerNames     = app.vulkan.instance.require_layers.data(),
+        .enabledExtensionCount   = static_cast< uint32_t > ( app.vulkan.instance.required_extensions.size() ),
+        .ppEnabledExtensionNames = app.vulkan.instance.required_extensions.data()
+    };
+
+    /* link DebugUtilsMessenger extension to VkInstanceCreateInfo if needed
+     */
+    if( app.vulkan.debug.enable )
+        vk_instance_create_info.pNext = static_cast< void* > ( &vk_debug_utils_info );
+
+    /* Create Vulkan instance
+     */
+    VK_CALL( vkCreateInstance( &vk_instance_create_info, nullptr, &app.vulkan.instance.object ),
+             "Cannot create Vulkan instance" );
+
+    /* Initialize all pointer to Vulkan functions
+     */
+    volkLoadInstanceOnly( app.vulkan.instance.object );
+
+    /* Instance object has information about debug messenger,
+     * but messenger itself must be created
+     */
+    if( app.vulkan.debug.enable ) {
+        VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+        VK_CALL( vkCreateDebugUtilsMessengerEXT( app.vulkan.instance.object,
+                                                &vk_debug_utils_info,
+                                                 nullptr,
+                                                &messenger ),
+                 "Cannot create Vulkan debug messenger" );
+        app.vulkan.debug.messenger = vkUniqueDebugMessenger( app.vulkan.instance.object, messenger );
+    }
+
+    return true;
+}
+
+static bool vk_cleanup_instance( vkApp &app ) {
+    app.vulkan.debug.messenger.reset();
+
+    if( app.vulkan.instance.object != VK_NULL_HANDLE ) {
+        vkDestroyInstance( app.vulkan.instance.object,
+                           nullptr );
+        app.vulkan.instance.object = VK_NULL_HANDLE;
+    }
+
+    return true;
+}
+
+/* Vulkan Surface
+ */
+
+static bool vk_create_surface( vkApp &app ) {
+    if( !app.glfw.window )
+        return false;
+    if( app.vulkan.instance.object == VK_NULL_HANDLE )
+        return false;
+
+    /* Vulkan surface is independent from device or window system
+     */
+    VkSurfaceKHR surface = VK_NULL_HANDLE;
+    VK_CALL( glfwCreateWindowSurface( app.vulkan.instance.object,
+                                      app.glfw.window,
+                                      nullptr,
+                                     &surface ),
+             "Cannot create window surface" );
+    app.vulkan.surface.object = vkUniqueSurface( app.vulkan.instance.object, surface );
+
+    return true;
+}
+
+static bool vk_cleanup_surface( vkApp &app ) {
+    app.vulkan.surface.object.reset();
+
+    return true;
+}
+
+/* Vulkan Physical device
+ */
+
+inline bool vk_test_dev_extensions( vkApp &app, VkPhysicalDevice dev ) {
+    if( app.vulkan.instance.object == VK_NULL_HANDLE )
+        return false;
+    if( dev == VK_NULL_HANDLE )
+        return false;
+
+    uint32_t extensions_cout = 0;
+    VK_CALL( vkEnumerateDeviceExtensionProperties( dev,
+                                                   nullptr,
+                                                  &extensions_cout,
+                                                   nullptr ),
+             "Fail to read amount of extensions supported by the physical device" );
+
+    /* Read all available extensions for the chosen device
+     */
+    std::vector< VkExtensionProperties > available_extensions( extensions_cout );
+    VK_CALL( vkEnumerateDeviceExtensionProperties( dev,
+                                                   nullptr,
+                                                  &extensions_cout,
+                                                   available_extensions.data() ),
+             "Cannot enumerate extensions supported by the physical device" );
+
+    /* Easiest way is to fill a set with required extensions
+     * and remove supported by device from it
+     */
+    std::set< std::string > required_extensions (
+        app.vulkan.device.require_extensions.begin(),
+        app.vulkan.device.require_extensions.end()
+    );
+    for( const auto &extension: available_extensions )
+        required_extensions.erase( std::string( extension.extensionName ) );
+
+    /* all require extensions are supported 
+     */
+    if( required_extensions.empty() )
+        return true;
+
+    return false;
+}
+
+inline bool vk_test_dev_families( vkApp &app,
+                                  VkPhysicalDevice dev,
+                                  uint32_t &graph_family_idx,
+                                  uint32_t &present_family_idx ) {
+    if( app.vulkan.instance.object == VK_NULL_HANDLE )
+        return false;
+    if( dev == VK_NULL_HANDLE )
+        return false;
+
+    uint32_t queue_families_count = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties( dev,
+                                             &queue_families_count,
+                                              nullptr );
+    if( !queue_families_count )
+        return false;
+
+    /* Read all properties
+     */
+    std::vector< VkQueueFamilyProperties > queue_family_properties( queue_families_count );
+    vkGetPhysicalDeviceQueueFamilyProperties( dev,
+                                             &queue_families_count,
+                                              queue_family_properties.data() );
+
+    std::optional< uint32_t > graph_family;
+    std::optional< uint32_t > present_family;
+    for( size_t idx = 0; idx < queue_families_count; ++idx ) {
+        /* detect GPU by testing VK_QUEUE_GRAPHICS_BIT
+         */
+        if( queue_family_properties[idx].queueFlags & VK_QUEUE_GRAPHICS_BIT )
+            graph_family = static_cast< uint32_t > ( idx );
+
+        /* detect graphical output by requesting the presentation support from the surface
+         */
+        VkBool32 presentation_support = VK_FALSE;
+        VK_CALL( vkGetPhysicalDeviceSurfaceSupportKHR( dev,
+                                                       static_cast< uint32_t > ( idx ),
+                                                       app.vulkan.surface.object.get(),
+                                                      &presentation_support ),
+                 "Fail to read the presentation support for the physical device from the surface" );
+
+        if( presentation_support == VK_TRUE )
+            present_family = static_cast< uint32_t > ( idx );
+
+        /* here is a tricky part - in common case this two indexes might be different
+         */
+        if( graph_family.has_value() && present_family.has_value() )
+            break;
+    }
+
+    /* nothing was found
+     */
+    if( !graph_family.has_value() || !present_family.has_value() )
+        return false;
+
+    /* save family indexes
+     */
+    graph_family_idx   = graph_family.value();
+    present_family_idx = present_family.value();
+
+    return true;
+}
+
+static bool vk_select_phy_device( vkApp &app ) {
+    if( app.vulkan.instance.object == VK_NULL_HANDLE )
+        return false;
+
+    uint32_t device_count = 0;
+    VK_CALL( vkEnumeratePhysicalDevices( app.vulkan.instance.object,
+                                        &device_count,
+                                         nullptr ),
+             "Failed to read amount of physical devices" );
+
+    /* read information about all physical devices in the system
+     */
+    std::vector< VkPhysicalDevice > available_devices( device_count );
+    VK_CALL( vkEnumeratePhysicalDevices( app.vulkan.instance.object,
+                                        &device_count,
+                                         available_devices.data() ),
+             "Cannot enumerate physical devices" );
+
+    /* search for the suitable physical device
+     */
+    for( const auto &device: available_devices ) {
+        /* device name
+         */
+        VkPhysicalDeviceProperties dev_props;
+        vkGetPhysicalDeviceProperties( device, &dev_props );
+        std::cout
+            << "Vulkan physical device: "
+                << dev_props.deviceName
+                << std::endl;
+        std::cout
+            << "Vulkan driver version: "
+                << VK_API_VERSION_MAJOR( dev_props.apiVersion )
+                << '.'
+                << VK_API_VERSION_MINOR( dev_props.apiVersion )
+                << '.'
+                << VK_API_VERSION_PATCH( dev_props.apiVersion )
+                << std::endl;
+
+        /* first check:
+         *  confirm that physical device support all required extensions
+         */
+        if( !vk_test_dev_extensions( app, device ) )
+            continue;
+
+        /* second check:
+         *  confirm that physical device is GPU and has graphical output
+         */
+        uint32_t graph_family_idx, present_family_idx;
+        if( !vk_test_dev_families( app, device, graph_family_idx, present_family_idx ) )
+            continue;
+
+        /* suitable device found
+         */
+        app.vulkan.device.gpu = device;
+        app.vulkan.device.graph_family_idx   = graph_family_idx;
+        app.vulkan.device.present_family_idx = present_family_idx;
+
+        break;
+    }
+
+    if( app.vulkan.device.gpu == VK_NULL_HANDLE )
+        return false;
+
+    return true;
+}
+
+/* Vulkan device
+ */
+
+static bool vk_create_device( vkApp &app ) {
+    if( app.vulkan.device.gpu == VK_NULL_HANDLE )
+        return false;
+
+    /* store only unique family indexes
+     */
+    std::set< uint32_t > queue_families {
+        app.vulkan.device.graph_family_idx,
+        app.vulkan.device.present_family_idx
+    };
+
+    /* create queues for each family
+     */
+    float queue_prio = 1.0f;
+
+    std::vector< VkDeviceQueueCreateInfo > device_queue_create_infos;
+    for( uint32_t queue_family: queue_families ) {
+        VkDeviceQueueCreateInfo device_queue_create_info {
+            .sType            = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+            .queueFamilyIndex = queue_family,
+            .queueCount       = 1,
+            .pQueuePriorities = &queue_prio
+        };
+
+        device_queue_create_infos.push_back( device_queue_create_info );
+    }
+
+    VkDeviceCreateInfo device_create_info {
+        .sType                   = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
+        .queueCreateInfoCount    = static_cast< uint32_t > ( device_queue_create_infos.size() ),
+        .pQueueCreateInfos       = device_queue_create_infos.data(),
+        .enabledLayerCount       = static_cast< uint32_t > ( app.vulkan.instance.require_layers.size() ),
+        .ppEnabledLayerNames     = app.vulkan.instance.require_layers.data(),
+        .enabledExtensionCount   = static_cast< uint32_t > ( app.vulkan.device.require_extensions.size() ),
+        .ppEnabledExtensionNames = app.vulkan.device.require_extensions.data()
+    };
+
+    VK_CALL( vkCreateDevice( app.vulkan.device.gpu,
+                            &device_create_info,
+                             nullptr,
+                            &app.vulkan.device.object ),
+             "Cannot create Vulkan device" );
+
+    /* call volk to correct pointers to Vulkan functions
+     */
+    volkLoadDevice( app.vulkan.device.object );
+
+    /* store Vulkan queues
+     */
+    vkGetDeviceQueue( app.vulkan.device.object,
+                      app.vulkan.device.graph_family_idx,
+                      0,
+                     &app.vulkan.device.graph_queue );
+    vkGetDeviceQueue( app.vulkan.device.object,
+                      app.vulkan.device.present_family_idx,
+                      0,
+                     &app.vulkan.device.present_queue );
+
+    return true;
+}
+
+static bool vk_cleanup_device( vkApp &app ) {
+    if( app.vulkan.device.object != VK_NULL_HANDLE ) {
+        app.vulkan.device.graph_queue   = VK_NULL_HANDLE;
+        app.vulkan.device.present_queue = VK_NULL_HANDLE;
+
+        vkDestroyDevice( app.vulkan.device.object, nullptr );
+        app.vulkan.device.object = VK_NULL_HANDLE;
+    }
+
+    return true;
+}
+
+/* Vulkan swapchain
+ */
+
+inline VkExtent2D vk_calculate_display_extent( vkApp &app,
+                                               VkSurfaceCapabilitiesKHR surf_caps ) {
+    VkExtent2D result;
+    int frame_width, frame_height;
+
+    /* read the framebuffer size and calculate display width and height for it
+     */
+
+    glfwGetFramebufferSize( app.glfw.window, &frame_width, &frame_height );
+
+    result.width  = std::clamp( static_cast< uint32_t > ( frame_width ),
+                                surf_caps.minImageExtent.width,
+                                surf_caps.maxImageExtent.width );
+    result.height = std::clamp( static_cast< uint32_t > ( frame_height ),
+                                surf_caps.minImageExtent.height,
+                                surf_caps.maxImageExtent.height );
+
+    return result;
+}
+
+inline uint32_t vk_calculate_number_swapchain_images( VkSurfaceCapabilitiesKHR surf_caps ) {
+    uint32_t result = surf_caps.minImageCount + 1;
+    if( surf_caps.maxImageCount && ( result > surf_caps.maxImageCount ) )
+        result = surf_caps.maxImageCount;
+
+    return result;
+}
+
+inline VkSurfaceFormatKHR vk_select_display_format( vkApp &app,
+                                                    VkFormat format ) {
+    VkSurfaceFormatKHR wrong_result {
+        .format     = VK_FORMAT_UNDEFINED,
+        .colorSpace = VK_COLOR_SPACE_MAX_ENUM_KHR
+    };
+
+    /* get amount of display format
+     */
+    uint32_t surf_format_count = 0;
+    if( vkGetPhysicalDeviceSurfaceFormatsKHR( app.vulkan.device.gpu,
+                                              app.vulkan.surface.object.get(),
+                                             &surf_format_count,
+                                              nullptr ) != VK_SUCCESS ) {
+        std::cerr
+            << "VK_CALL error: "
+                << "Fail to read amount of surface formats"
+                << std::endl;
+    }
+    if( !surf_format_count ) {
+        std::cerr
+            << "Surface doesn't support any graphical formats"
+                << std::endl;
+        return wrong_result;
+    }
+
+    /* read display formats and find the index of requested format
+     */
+    std::vector< VkSurfaceFormatKHR > surf_formats( surf_format_count );
+    if( vkGetPhysicalDeviceSurfaceFormatsKHR( app.vulkan.device.gpu,
+                                                   app.vulkan.surface.object.get(),
+                                                  &surf_format_count,
+                                                   surf_formats.data() ) != VK_SUCCESS ) {
+        std::cerr
+            << "VK_CALL error: "
+                << "Cannot read formats of the surface"
+                << std::endl;
+        return wrong_result;
+    }
+
+    uint32_t surf_format_idx;
+    for( surf_format_idx = 0; surf_format_idx < surf_format_count; ++surf_format_idx ) {
+        if( surf_formats[surf_format_idx].format == format )
+            return surf_formats[surf_format_idx];
+    }
+
+    std::cerr
+        << "VK_CALL error: "
+            << "Surface doesn't support desirable format "
+            << format
+            << std::endl;
+    return wrong_result;
+}
+
+inline VkPresentModeKHR vk_select_presentation_mode( vkApp &app,
+                                                     VkPresentModeKHR mode ) {
+    /* get amount of presentation modes
+     */
+    uint32_t present_mode_count = 0;
+    if( vkGetPhysicalDeviceSurfacePresentModesKHR( app.vulkan.device.gpu,
+                                                   app.vulkan.surface.object.get(),
+                                                  &present_mode_count,
+                                                   nullptr ) != VK_SUCCESS ) {
+        std::cerr
+            << "VK_CALL error: "
+                << "Fail to read amount of presentation modes for the physical device"
+                << std::endl;
+        return VK_PRESENT_MODE_MAX_ENUM_KHR;
+    }
+    if( !present_mode_count )
+        return VK_PRESENT_MODE_MAX_ENUM_KHR;
+
+    /* read presentation modes
+     */
+    std::vector< VkPresentModeKHR > present_modes( present_mode_count );
+    if( vkGetPhysicalDeviceSurfacePresentModesKHR( app.vulkan.device.gpu,
+                                                   app.vulkan.surface.object.get(),
+                                                  &present_mode_count,
+                                                   present_modes.data() ) != VK_SUCCESS ) {
+        std::cerr
+            << "VK_CALL error: "
+                << "Cannot read presentation modes for the physical device"
+                << std::endl;
+        return VK_PRESENT_MODE_MAX_ENUM_KHR;
+    }
+
+    for( const auto &available_mode: present_modes ) {
+        if( available_mode == mode )
+            return available_mode;
+    }
+
+    return VK_PRESENT_MODE_MAX_ENUM_KHR;
+}
+
+static bool vk_create_swapchain( vkApp &app ) {
+    if( !app.vulkan.surface.object )
+        return false;
+    if( app.vulkan.device.object == VK_NULL_HANDLE )
+        return false;
+
+    VkSurfaceCapabilitiesKHR surf_caps;
+    VK_CALL( vkGetPhysicalDeviceSurfaceCapabilitiesKHR( app.vulkan.device.gpu,
+                                                        app.vulkan.surface.object.get(),
+                                                       &surf_caps ),
+             "Cannot read surface capabilities for the physical device" );
+
+    /* calculate display extent
+     */
+    VkExtent2D display_extent = vk_calculate_display_extent( app, surf_caps );
+    app.vulkan.swapchain.display_size = display_extent;
+
+    /* calculate amount of images in the swapchain
+     */
+    uint32_t image_count = vk_calculate_number_swapchain_images( surf_caps );
+
+    /* check for the support of VK_FORMAT_B8G8R8A8_UNORM display format
+     */
+    if( app.vulkan.swapchain.display_format == VK_FORMAT_UNDEFINED ) {
+        VkSurfaceFormatKHR display_format = vk_select_display_format( app, VK_FORMAT_B8G8R8A8_UNORM );
+        if( display_format.format == VK_FORMAT_UNDEFINED )
+            return false;
+
+        app.vulkan.swapchain.display_format     = display_format.format;
+        app.vulkan.swapchain.display_colorspace = display_format.colorSpace;
+    }
+
+    /* check for support of VK_PRESENT_MODE_FIFO_KHR display presentation mode
+     */
+    if( app.vulkan.swapchain.present_mode == VK_PRESENT_MODE_MAX_ENUM_KHR ) {
+        VkPresentModeKHR display_present_mode = vk_select_presentation_mode( app, VK_PRESENT_MODE_FIFO_KHR );
+        if( display_present_mode == VK_PRESENT_MODE_MAX_ENUM_KHR )
+            return false;
+
+        app.vulkan.swapchain.present_mode = display_present_mode;
+    }
+
+    /* Create Swapchain
+     */
+    VkSwapchainCreateInfoKHR swapchain_create_info {
+        .sType            = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR,
+        .surface          = app.vulkan.surface.object.get(),
+        .minImageCount    = image_count,
+        .imageFormat      = app.vulkan.swapchain.display_format,
+        .imageColorSpace  = app.vulkan.swapchain.display_colorspace,
+        .imageExtent      = display_extent,
+        .imageArrayLayers = 1,
+        .imageUsage       = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT,
+        .preTransform     = surf_caps.currentTransform,
+        .compositeAlpha   = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR,
+        .presentMode      = app.vulkan.swapchain.present_mode,
+        .clipped          = VK_TRUE,
+        .oldSwapchain     = app.vulkan.swapchain.object.get() /* let the driver reuse resources of the previous swapchain */
+    };
+    if( app.vulkan.device.graph_family_idx != app.vulkan.device.present_family_idx ) {
+        uint32_t family_idxs[] = { app.vulkan.device.graph_family_idx,
+                                   app.vulkan.device.present_family_idx };
+
+        swapchain_create_info.imageSharingMode      = VK_SHARING_MODE_CONCURRENT;
+        swapchain_create_info.queueFamilyIndexCount = 2;
+        swapchain_create_info.pQueueFamilyIndices   = family_idxs;
+    }
+    else {
+        uint32_t family_idxs[] = { app.vulkan.device.graph_family_idx };
+
+        swapchain_create_info.imageSharingMode      = VK_SHARING_MODE_EXCLUSIVE;
+        swapchain_create_info.queueFamilyIndexCount = 1;
+        swapchain_create_info.pQueueFamilyIndices   = family_idxs;
+    }
+
+    VkSwapchainKHR swapchain = VK_NULL_HANDLE;
+    VK_CALL( vkCreateSwapchainKHR( app.vulkan.device.object,
+                                  &swapchain_create_info,
+                                   nullptr,
+                                  &swapchain ),
+             "Cannot create swapchain" );
+
+    /* previous swapchain might be still presenting images of frames in flight
+     */
+    vk_retire( app, app.vulkan.swapchain.object );
+    app.vulkan.swapchain.object = vkUniqueSwapchain( app.vulkan.device.object, swapchain );
+
+    return true;
+}
+
+static bool vk_cleanup_swapchain( vkApp &app ) {
+    app.vulkan.swapchain.object.reset();
+
+    return true;
+}
+
+/* Vulkan swapchain images
+ */
+static bool vk_get_swapchain_images( vkApp &app ) {
+    if( !app.vulkan.swapchain.object )
+        return false;
+
+    uint32_t image_count = 0;
+    VK_CALL( vkGetSwapchainImagesKHR( app.vulkan.device.object,
+                                      app.vulkan.swapchain.object.get(),
+                                     &image_count,
+                                      nullptr ),
+             "Fail to read amount of images in the swapchain" );
+
+    app.vulkan.swapchain.images.resize( image_count );
+    VK_CALL( vkGetSwapchainImagesKHR( app.vulkan.device.object,
+                                      app.vulkan.swapchain.object.get(),
+                                     &image_count,
+                                      app.vulkan.swapchain.images.data() ),
+             "Cannot read pointers to images from the swapchain" );
+
+    return true;
+}
+
+static bool vk_cleanup_swapchain_images( vkApp &app ) {
+    app.vulkan.swapchain.images.clear();
+
+    return true;
+}
+
+/* Vulkan image views
+ */
+static bool vk_create_image_views( vkApp & app ) {
+    if( app.vulkan.swapchain.images.empty() )
+        return false;
+
+    for( const auto &image: app.vulkan.swapchain.images ) {
+        VkImageViewCreateInfo view_create_info {
+            .sType      = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+            .image      = image,
+            .viewType   = VK_IMAGE_VIEW_TYPE_2D,
+            .format     = app.vulkan.swapchain.display_format,
+            .components = { .r = VK_COMPONENT_SWIZZLE_IDENTITY,
+                            .g = VK_COMPONENT_SWIZZLE_IDENTITY,
+                            .b = VK_COMPONENT_SWIZZLE_IDENTITY,
+                            .a = VK_COMPONENT_SWIZZLE_IDENTITY },
+            .subresourceRange = { .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                                  .baseMipLevel   = 0,
+                                  .levelCount     = 1,
+                                  .baseArrayLayer = 0,
+                                  .layerCount     = 1 }
+        };
+
+        VkImageView view = VK_NULL_HANDLE;
+        VK_CALL( vkCreateImageView( app.vulkan.device.object,
+                                   &view_create_info,
+                                    nullptr,
+                                   &view ),
+                 "Cannot create the view for the image in the swapchain" );
+
+        app.vulkan.swapchain.views.emplace_back( app.vulkan.device.object, view );
+    }
+
+    return true;
+}
+
+static bool vk_cleanup_image_views( vkApp &app ) {
+    /* every wrapper destroys own image view
+     */
+    app.vulkan.swapchain.views.clear();
+
+    return true;
+}
+
+/* Vulkan Render Pass
+ */
+
+static bool vk_create_render_pass( vkApp &app ) {
+    if( app.vulkan.device.object == VK_NULL_HANDLE )
+        return false;
+
+    VkAttachmentDescription color_attachment {
+        .format         = app.vulkan.swapchain.display_format,
+        .samples        = VK_SAMPLE_COUNT_1_BIT,
+        .loadOp         = VK_ATTACHMENT_LOAD_OP_CLEAR,
+        .storeOp        = VK_ATTACHMENT_STORE_OP_STORE,
+        .stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+        .stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
+        .initialLayout  = VK_IMAGE_LAYOUT_UNDEFINED,
+        .finalLayout    = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR
+    };
+    VkAttachmentReference color_attachment_ref {
+        .attachment = 0,
+        .layout     = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
+    };
+    VkSubpassDescription subpass {
+        .pipelineBindPoint    = VK_PIPELINE_BIND_POINT_GRAPHICS,
+        .colorAttachmentCount = 1,
+        .pColorAttachments    = &color_attachment_ref
+    };
+    VkSubpassDependency subpass_dep {
+        .srcSubpass    = VK_SUBPASS_EXTERNAL,
+        .dstSubpass    = VK_FALSE,
+        .srcStageMask  = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+        .dstStageMask  = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+        .srcAccessMask = VK_FALSE,
+        .dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT
+    };
+    VkRenderPassCreateInfo render_pass_create_info {
+        .sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO,
+        .attachmentCount = 1,
+        .pAttachments    = &color_attachment,
+        .subpassCount    = 1,
+        .pSubpasses      = &subpass,
+        .dependencyCount = 1,
+        .pDependencies   = &subpass_dep
+    };
+    VkRenderPass render_pass = VK_NULL_HANDLE;
+    VK_CALL( vkCreateRenderPass( app.vulkan.device.object,
+                                &render_pass_create_info,
+                                 nullptr,
+                                &render_pass ),
+        "Cannot create Vulkan render pass" );
+    app.vulkan.swapchain.render_pass = vkUniqueRenderPass( app.vulkan.device.object, render_pass );
+
+    return true;
+}
+
+static bool vk_cleanup_render_pass( vkApp &app ) {
+    app.vulkan.swapchain.render_pass.reset();
+
+    return true;
+}
+
+/* Vulkan Frame Buffers
+ */
+
+static bool vk_create_frame_buffers( vkApp &app ) {
+    if( app.vulkan.device.object == VK_NULL_HANDLE )
+        return false;
+
+    for( const auto &image_view: app.vulkan.swapchain.views ) {
+        VkImageView attachments[] = { image_view.get() };
+        VkFramebufferCreateInfo fbuffer_create_info {
+            .sType           = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO,
+            .renderPass      = app.vulkan.swapchain.render_pass.get(),
+            .attachmentCount = 1,
+            .pAttachments    = attachments,
+            .width           = app.vulkan.swapchain.display_size.width,
+            .height          = app.vulkan.swapchain.display_size.height,
+            .layers          = 1
+        };
+        VkFramebuffer fbuffer = VK_NULL_HANDLE;
+
+        VK_CALL( vkCreateFramebuffer( app.vulkan.device.object,
+                                     &fbuffer_create_info,
+                                      nullptr,
+                                     &fbuffer ),
+           "Cannot create frame buffer for the image view" );
+        app.vulkan.swapchain.frames.emplace_back( app.vulkan.device.object, fbuffer );
+    }
+
+    return true;
+}
+
+static bool vk_cleanup_frame_buffers( vkApp &app ) {
+    app.vulkan.swapchain.frames.clear();
+    return true;
+}
+
+/* Vulkan Sync. objects
+ */
+
+static bool vk_create_sync_objects( vkApp &app ) {
+    if( app.vulkan.device.object == VK_NULL_HANDLE )
+        return false;
+
+    VkSemaphoreCreateInfo semaphore_create_info {
+        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO
+    };
+
+    /* fence is created signaled, so the first wait for every frame slot will not block
+     */
+    VkFenceCreateInfo fence_create_info {
+        .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+        .flags = VK_FENCE_CREATE_SIGNALED_BIT
+    };
+
+    for( uint32_t slot = 0; slot < max_frames_in_flight; ++slot ) {
+        VkSemaphore image_available    = VK_NULL_HANDLE;
+        VkSemaphore rendering_finished = VK_NULL_HANDLE;
+        VkFence     gpu_fence          = VK_NULL_HANDLE;
+
+        VK_CALL( vkCreateSemaphore( app.vulkan.device.object,
+                                   &semaphore_create_info,
+                                    nullptr,
+                                   &image_available ),
+                 "Cannot create the semaphore of surface image availability" );
+        app.vulkan.sync.image_available.emplace_back( app.vulkan.device.object, image_available );
+
+        VK_CALL( vkCreateSemaphore( app.vulkan.device.object,
+                                   &semaphore_create_info,
+                                    nullptr,
+                                   &rendering_finished ),
+                 "Cannot create the semaphore of frame rendering end" );
+        app.vulkan.sync.rendering_finished.emplace_back( app.vulkan.device.object, rendering_finished );
+
+        VK_CALL( vkCreateFence( app.vulkan.device.object,
+                               &fence_create_info,
+                                nullptr,
+                               &gpu_fence ),
+                 "Cannot create fence object for the physical device" );
+        app.vulkan.sync.gpu_fence.emplace_back( app.vulkan.device.object, gpu_fence );
+    }
+
+    return true;
+}
+
+static bool vk_cleanup_sync_objects( vkApp &app ) {
+    app.vulkan.sync.gpu_fence.clear();
+    app.vulkan.sync.rendering_finished.clear();
+    app.vulkan.sync.image_available.clear();
+
+    return true;
+}
+
+/* Vulkan Command Buffers
+ */
+
+static bool vk_create_command_buffers( vkApp &app ) {
+    if( app.vulkan.device.object == VK_NULL_HANDLE )
+        return false;
+
+    VkCommandPoolCreateInfo pool_create_info {
+        .sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+        .flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
+        .queueFamilyIndex = app.vulkan.device.graph_family_idx
+    };
+    VkCommandPool pool = VK_NULL_HANDLE;
+    VK_CALL( vkCreateCommandPool( app.vulkan.device.object,
+                                 &pool_create_info,
+                                  nullptr,
+                                 &pool ),
+             "Cannot create Vulkan Command Pool" );
+    app.vulkan.render.pool = vkUniqueCommandPool( app.vulkan.device.object, pool );
+
+    /* command buffer belongs to the frame slot and not to the swapchain image,
+     * this way the swapchain can be recreated without touching command buffers
+     */
+    VkCommandBufferAllocateInfo buffer_alloc_info {
+        .sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+        .commandPool        = app.vulkan.render.pool.get(),
+        .level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+        .commandBufferCount = max_frames_in_flight
+    };
+    app.vulkan.render.cmds.resize( max_frames_in_flight );
+    VK_CALL( vkAllocateCommandBuffers( app.vulkan.device.object,
+                                      &buffer_alloc_info,
+                                       app.vulkan.render.cmds.data() ),
+             "Cannot allocate memory for Vulkan command buffers" );
+
+    return true;
+}
+
+static bool vk_cleanup_command_buffer( vkApp &app ) {
+    if( !app.vulkan.render.cmds.empty() )
+        vkFreeCommandBuffers( app.vulkan.device.object,
+            app.vulkan.render.pool.get(),
+            static_cast< uint32_t > ( app.vulkan.render.cmds.size() ),
+            app.vulkan.render.cmds.data() );
+    app.vulkan.render.cmds.clear();
+
+    app.vulkan.render.pool.reset();
+
+    return true;
+}
+
+static bool vk_record_command_buffer( vkApp &app, const uint32_t slot, const uint32_t image_idx ) {
+    VkCommandBuffer cmd = app.vulkan.render.cmds[slot];
+
+    VkClearColorValue clear_color {
+        { 0.0f, 0.3f, 0.6f, 1.0f}
+    };
+    VkImageSubresourceRange subres_range {
+        .aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT,
+        .baseMipLevel   = 0,
+        .levelCount     = 1,
+        .baseArrayLayer = 0,
+        .layerCount     = 1
+    };
+
+    /* command buffer is recorded again for every frame
+     */
+    VkCommandBufferBeginInfo cmd_begin_info {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+        .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+    };
+
+    VkImageMemoryBarrier presentation_to_clear_barrier {
+        .sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .srcAccessMask       = VK_ACCESS_MEMORY_READ_BIT,
+        .dstAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .oldLayout           = VK_IMAGE_LAYOUT_UNDEFINED,
+        .newLayout           = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        .srcQueueFamilyIndex = app.vulkan.device.present_family_idx,
+        .dstQueueFamilyIndex = app.vulkan.device.present_family_idx,
+        .image               = app.vulkan.swapchain.images[image_idx],
+        .subresourceRange    = subres_range
+    };
+    VkImageMemoryBarrier clear_to_presentation_barrier {
+        .sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .srcAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .dstAccessMask       = VK_ACCESS_MEMORY_READ_BIT,
+        .oldLayout           = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        .newLayout           = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
+        .srcQueueFamilyIndex = app.vulkan.device.present_family_idx,
+        .dstQueueFamilyIndex = app.vulkan.device.present_family_idx,
+        .image               = app.vulkan.swapchain.images[image_idx],
+        .subresourceRange    = subres_range
+    };
+    VkViewport viewport {
+        .x        = 0.0f,
+        .y        = 0.0f,
+        .width    = static_cast< float > ( app.vulkan.swapchain.display_size.width ),
+        .height   = static_cast< float > ( app.vulkan.swapchain.display_size.height ),
+        .minDepth = 0.0f,
+        .maxDepth = 1.0f
+    };
+    VkRect2D scissor {
+        .offset {
+            .x = 0,
+            .y = 0
+        },
+        .extent = app.vulkan.swapchain.display_size
+    };
+
+    VK_CALL( vkBeginCommandBuffer( cmd,
+                                  &cmd_begin_info ),
+             "Cannot start recording the command buffer" );
+
+        vkCmdSetViewport( cmd,
+                          0,
+                          1,
+                         &viewport );
+        vkCmdSetScissor( cmd,
+                         0,
+                         1,
+                        &scissor );
+        vkCmdPipelineBarrier( cmd,
+                              VK_PIPELINE_STAGE_TRANSFER_BIT,
+                              VK_PIPELINE_STAGE_TRANSFER_BIT,
+                              0,
+                              0,
+                              nullptr,
+                              0,
+                              nullptr,
+                              1,
+                             &presentation_to_clear_barrier );
+        vkCmdClearColorImage( cmd,
+                              app.vulkan.swapchain.images[image_idx],
+                              VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                             &clear_color,
+                             1,
+                            &subres_range );
+        vkCmdPipelineBarrier( cmd,
+                              VK_PIPELINE_STAGE_TRANSFER_BIT,
+                              VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                              0,
+                              0,
+                              nullptr,
+                              0,
+                              nullptr,
+                              1,
+                             &clear_to_presentation_barrier );
+
+    VK_CALL( vkEndCommandBuffer( cmd ),
+             "Cannot finish recording the command buffer" );
+
+    return true;
+}
+
+/* Recreate Swapchain
+ */
+
+static bool vk_recreate_swapchain( vkApp &app ) {
+    int window_width, window_height;
+
+    do {
+        glfwGetFramebufferSize( app.glfw.window,
+                               &window_width,
+                               &window_height );
+        glfwWaitEvents();
+    } while( window_width == 0 || window_height == 0  );
+
+    /* GPU is not drained here: all previous objects might be still in use
+     * by frames in flight, so they go to the deletion queue
+     */
+    for( auto &fbuffer: app.vulkan.swapchain.frames )
+        vk_retire( app, fbuffer );
+    app.vulkan.swapchain.frames.clear();
+
+    vk_retire( app, app.vulkan.swapchain.render_pass );
+
+    for( auto &view: app.vulkan.swapchain.views )
+        vk_retire( app, view );
+    app.vulkan.swapchain.views.clear();
+
+    TUTORIAL_CALL( vk_cleanup_swapchain_images( app ) );
+
+    /* create new objects,
+     * old swapchain will be retired by vk_create_swapchain()
+     */
+    TUTORIAL_CALL( vk_create_swapchain( app ) );
+    TUTORIAL_CALL( vk_get_swapchain_images( app ) );
+    TUTORIAL_CALL( vk_create_image_views( app ) );
+    TUTORIAL_CALL( vk_create_render_pass( app ) );
+    TUTORIAL_CALL( vk_create_frame_buffers( app ) );
+
+    app.vulkan.swapchain.recreate = false;
+
+    return true;
+}
+
+/* common Vulkan functions
+ */
+
+static bool init_vulkan( vkApp &app ) {
+    if( !app.glfw.window )
+        return false;
+
+    /* Call volk to load Vulkan
+     */
+    VK_CALL( volkInitialize(),
+             "Cannot initialize Vulkan loader" );
+
+    /* Check VK_EXT_debug_utils support
+     */
+    uint32_t property_count = 0;
+    VK_CALL( vkEnumerateInstanceLayerProperties( &property_count, nullptr ),
+             "Fail to read count of layer properties of the vulkan instance" );
+
+    std::vector< VkLayerProperties > available_properties( property_count );
+    VK_CALL( vkEnumerateInstanceLayerProperties( &property_count, available_properties.data() ),
+             "Cannot enumerate layer properties of the vulkan instance" );
+
+    bool layer_found { false };
+    const std::string validation_layer_name( khronos_validation_layer_name );
+    for( const auto &layer_property: available_properties ) {
+        const std::string layer_name( layer_property.layerName );
+        if( validation_layer_name == layer_name ) {
+            layer_found = true;
+            break;
+        }
+    }
+
+    /* VK_EXT_debug_utils is supported -> enable debug messages
+     */
+    if( layer_found ) {
+        app.vulkan.debug.enable = true;
+        app.vulkan.instance.required_extensions.push_back( VK_EXT_DEBUG_UTILS_EXTENSION_NAME );
+    }
+
+    TUTORIAL_CALL( vk_create_instance( app ) );
+    TUTORIAL_CALL( vk_create_surface( app ) );
+
+    TUTORIAL_CALL( vk_select_phy_device( app ) );
+
+    TUTORIAL_CALL( vk_create_device( app ) );
+    TUTORIAL_CALL( vk_create_swapchain( app ) );
+
+    TUTORIAL_CALL( vk_get_swapchain_images( app ) );
+
+    TUTORIAL_CALL( vk_create_image_views( app ) );
+    TUTORIAL_CALL( vk_create_render_pass( app ) );
+    TUTORIAL_CALL( vk_create_frame_buffers( app ) );
+
+    TUTORIAL_CALL( vk_create_sync_objects( app ) );
+    TUTORIAL_CALL( vk_create_command_buffers( app ) );
+
+    app.vulkan.swapchain.recreate = false;
+
+    return true;
+}
+
+static bool cleanup_vulkan( vkApp &app ) {
+    VK_CALL( vkDeviceWaitIdle( app.vulkan.device.object ),
+             "Vulkan device wait fail" );
+
+    /* GPU is idle, everything in the deletion queue can go away
+     */
+    vk_collect_retired( app, std::numeric_limits< uint64_t >::max() );
+
+    TUTORIAL_CALL( vk_cleanup_command_buffer( app ) );
+    TUTORIAL_CALL( vk_cleanup_sync_objects( app ) );
+    TUTORIAL_CALL( vk_cleanup_frame_buffers( app ) );
+    TUTORIAL_CALL( vk_cleanup_render_pass( app ) );
+    TUTORIAL_CALL( vk_cleanup_image_views( app ) );
+    TUTORIAL_CALL( vk_cleanup_swapchain_images( app ) );
+    TUTORIAL_CALL( vk_cleanup_swapchain( app ) );
+    TUTORIAL_CALL( vk_cleanup_device( app ) );
+    TUTORIAL_CALL( vk_cleanup_surface( app ) );
+    TUTORIAL_CALL( vk_cleanup_instance( app ) );
+
+    return true;
+}
+
+static bool init( vkApp &app ) {
+    TUTORIAL_CALL( init_glfw( app ) );
+    TUTORIAL_CALL( init_window( app ) );
+    TUTORIAL_CALL( init_vulkan( app ) );
+
+    return true;
+}
+
+static bool cleanup( vkApp &app ) {
+    TUTORIAL_CALL( cleanup_vulkan( app ) );
+    TUTORIAL_CALL( cleanup_window( app ) );
+    TUTORIAL_CALL( cleanup_glfw( app ) );
+
+    return true;
+}
+
+
+static bool draw( vkApp &app ) {
+    const uint32_t slot = app.vulkan.frame.slot;
+    VkFence gpu_fence = app.vulkan.sync.gpu_fence[slot].get();
+
+    /* wait only for the frame which used this slot last time,
+     * other frames in flight continue to run on GPU
+     */
+    VK_CALL( vkWaitForFences( app.vulkan.device.object,
+                              1,
+                             &gpu_fence,
+                              VK_TRUE,
+                              std::numeric_limits< uint64_t >::max() ),
+             "Fail to synchronize with GPU fence" );
+
+    /* all frames submitted up to the last frame of this slot are over,
+     * objects retired before them can be destroyed
+     */
+    app.vulkan.frame.completed = std::max( app.vulkan.frame.completed,
+                                           app.vulkan.frame.slot_frame[slot] );
+    vk_collect_retired( app, app.vulkan.frame.completed );
+
+    uint32_t image_idx;
+    VkResult res = vkAcquireNextImageKHR( app.vulkan.device.object,
+                                          app.vulkan.swapchain.object.get(),
+                                          std::numeric_limits< uint64_t >::max(),
+                                          app.vulkan.sync.image_available[slot].get(),
+                                          VK_NULL_HANDLE,
+                                         &image_idx );
+    if( res == VK_ERROR_OUT_OF_DATE_KHR ) {
+        /* nothing was submitted, fence of the slot is still signaled
+         */
+        TUTORIAL_CALL( vk_recreate_swapchain( app ) );
+        return true;
+    }
+    else if( ( res != VK_SUCCESS ) && ( res != VK_SUBOPTIMAL_KHR ) )
+        return false;
+
+    /* reset the fence only when the work will be submitted for sure
+     */
+    VK_CALL( vkResetFences( app.vulkan.device.object,
+                            1,
+                           &gpu_fence ),
+             "Fail to reset GPU Fence" );
+
+    TUTORIAL_CALL( vk_record_command_buffer( app, slot, image_idx ) );
+
+    VkPipelineStageFlags wait_dst_stage_mask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    VkSubmitInfo submit_info {
+        .sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .waitSemaphoreCount   = 1,
+        .pWaitSemaphores      = app.vulkan.sync.image_available[slot].ptr(),
+        .pWaitDstStageMask    = &wait_dst_stage_mask,
+        .commandBufferCount   = 1,
+        .pCommandBuffers      = &app.vulkan.render.cmds[slot],
+        .signalSemaphoreCount = 1,
+        .pSignalSemaphores    = app.vulkan.sync.rendering_finished[slot].ptr()
+    };
+    VK_CALL( vkQueueSubmit( app.vulkan.device.present_queue,
+                            1,
+                           &submit_info,
+                            gpu_fence ),
+             "Fail to submit command buffer" );
+
+    /* remember which frame is running in this slot
+     */
+    app.vulkan.frame.submitted++;
+    app.vulkan.frame.slot_frame[slot] = app.vulkan.frame.submitted;
+
+    VkPresentInfoKHR present_info {
+        .sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
+        .waitSemaphoreCount = 1,
+        .pWaitSemaphores    = app.vulkan.sync.rendering_finished[slot].ptr(),
+        .swapchainCount     = 1,
+        .pSwapchains        = app.vulkan.swapchain.object.ptr(),
+        .pImageIndices      = &image_idx
+    };
+
+    /* next frame will use the next slot
+     */
+    app.vulkan.frame.slot = ( slot + 1 ) % max_frames_in_flight;
+
+    res = vkQueuePresentKHR( app.vulkan.device.present_queue,
+                             &present_info );
+    if( ( res == VK_ERROR_OUT_OF_DATE_KHR)  || ( res == VK_SUBOPTIMAL_KHR ) || ( app.vulkan.swapchain.recreate ) ) {
+        TUTORIAL_CALL( vk_recreate_swapchain( app ) );
+    }
+    else if( res != VK_SUCCESS ) {
+        std::cerr
+            << "VK_CALL error: "
+                << "Fail to submit present command buffer"
+                << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+int main() {
+    vkApp app;
+
+    if( !init( app ) ) {
+        std::cerr
+            << "Cannot initialize the application"
+                << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    /* render loop
+     */
+    while( glfwWindowShouldClose( app.glfw.window ) == GLFW_FALSE ) {
+        /* draw the context of the window
+         */
+        draw( app );
+
+        /* proceed keyboard and mouse
+         */
+        glfwPollEvents();
+    }
+
+    if( !cleanup( app ) ) {
+        std::cerr
+            << "Cleanup failed"
+                << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout
+        << "Job is done!"
+            << std::endl;
+    return EXIT_SUCCESS;
+}
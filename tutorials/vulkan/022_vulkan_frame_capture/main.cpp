@@ -0,0 +1,3123 @@
+/*
+    Vulkan 1.3 tutorial
+    
+    Frame capture
+ */
+
+#include <cstdlib>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <set>
+#include <optional>
+#include <algorithm>
+#include <limits>
+#include <array>
+#include <deque>
+#include <functional>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#if defined( __SSSE3__ ) || defined( __AVX__ )
+#include <tmmintrin.h>
+#elif defined( __ARM_NEON )
+#include <arm_neon.h>
+#endif
+
+
+/* don't load Vulkan, will be done by volk
+ */
+#define GLFW_INCLUDE_VULKAN
+#define VK_NO_PROTOTYPES
+#include <GLFW/glfw3.h>
+#include <volk.h>
+
+
+/* Vulkan error check
+ */
+#define VK_CALL( func, err_msg ) { \
+    if( VK_SUCCESS != func ) {     \
+        std::cerr                  \
+            << "VK_CALL error: "   \
+                << err_msg         \
+                << std::endl;      \
+        return false;              \
+    }                              \
+}
+
+/* Tutorial vulkan function call
+ */
+#define TUTORIAL_CALL( func ) { \
+    if( !func )                 \
+        return false;           \
+}
+
+static const char khronos_validation_layer_name[] = "VK_LAYER_KHRONOS_validation";
+
+/* amount of frames which CPU may prepare while GPU is still busy with previous ones
+ */
+static const uint32_t max_frames_in_flight = 2;
+
+/* amount of frames which may wait for the display when latency mode is active,
+ * must be in range [1, max_frames_in_flight]
+ */
+static const uint32_t max_queued_frames = 1;
+
+/* how long the application waits for the present before it gives up, in nanoseconds
+ */
+static const uint64_t present_wait_timeout = 100000000;
+
+/* GPU time of one frame which the resolution controller tries to keep, in milliseconds,
+ * can be changed at runtime with UP and DOWN keys
+ */
+static const double default_target_frame_time = 16.6;
+
+/* limits of the internal resolution relative to the display size
+ */
+static const float min_render_scale = 0.25f;
+static const float max_render_scale = 1.0f;
+
+/* controller settings:
+ *  weight of the new measurement in the smoothed GPU time
+ *  relative difference of the scale which is too small to change anything
+ */
+static const double gpu_time_smoothing = 0.1;
+static const float  render_scale_threshold = 0.05f;
+
+/* maximal amount of samples of the scene, the device might support less
+ */
+static const VkSampleCountFlagBits max_msaa_samples = VK_SAMPLE_COUNT_4_BIT;
+
+/* maximal amount of threads which encode captured frames
+ */
+static const uint32_t max_capture_workers = 4;
+
+/* frame rate written to the header of the video file
+ */
+static const uint32_t capture_frame_rate = 60;
+
+/* Owner of one Vulkan object
+ *
+ * Wrapper keeps the handle together with its parent (instance or device)
+ * and destroys the object when goes out of scope or reset() is called.
+ * Wrapper can be only moved, so every object has exactly one owner.
+ */
+template< typename Parent, typename Handle, typename Deleter >
+class vkUnique {
+public:
+    vkUnique() = default;
+    vkUnique( Parent parent, Handle handle )
+        : parent_( parent ), handle_( handle ) {}
+    ~vkUnique() { reset(); }
+
+    vkUnique( const vkUnique& ) = delete;
+    vkUnique& operator=( const vkUnique& ) = delete;
+
+    vkUnique( vkUnique &&other ) noexcept
+        : parent_( other.parent_ ), handle_( other.release() ) {}
+    vkUnique& operator=( vkUnique &&other ) noexcept {
+        if( this != &other ) {
+            reset();
+            parent_ = other.parent_;
+            handle_ = other.release();
+        }
+        return *this;
+    }
+
+    Handle        get()    const { return handle_; }
+    const Handle* ptr()    const { return &handle_; }
+    Parent        parent() const { return parent_; }
+
+    explicit operator bool() const { return handle_ != VK_NULL_HANDLE; }
+
+    /* give up the ownership without destroying the object
+     */
+    Handle release() {
+        Handle handle = handle_;
+        handle_ = VK_NULL_HANDLE;
+        return handle;
+    }
+
+    /* destroy the object right now
+     */
+    void reset() {
+        if( handle_ != VK_NULL_HANDLE )
+            Deleter{}( parent_, handle_ );
+        handle_ = VK_NULL_HANDLE;
+    }
+
+private:
+    Parent parent_ { VK_NULL_HANDLE };
+    Handle handle_ { VK_NULL_HANDLE };
+};
+
+/* volk stores Vulkan functions in global pointers, so every deleter
+ * calls the pointer in the moment of destruction
+ */
+#define VK_DELETER( parent_type, handle_type, destroy_func )         \
+struct handle_type##Deleter {                                         \
+    void operator()( parent_type parent, handle_type handle ) const { \
+        destroy_func( parent, handle, nullptr );                      \
+    }                                                                 \
+};
+
+VK_DELETER( VkInstance, VkDebugUtilsMessengerEXT, vkDestroyDebugUtilsMessengerEXT )
+VK_DELETER( VkInstance, VkSurfaceKHR,             vkDestroySurfaceKHR )
+VK_DELETER( VkDevice,   VkSwapchainKHR,           vkDestroySwapchainKHR )
+VK_DELETER( VkDevice,   VkImageView,              vkDestroyImageView )
+VK_DELETER( VkDevice,   VkRenderPass,             vkDestroyRenderPass )
+VK_DELETER( VkDevice,   VkFramebuffer,            vkDestroyFramebuffer )
+VK_DELETER( VkDevice,   VkSemaphore,              vkDestroySemaphore )
+VK_DELETER( VkDevice,   VkFence,                  vkDestroyFence )
+VK_DELETER( VkDevice,   VkCommandPool,            vkDestroyCommandPool )
+VK_DELETER( VkDevice,   VkImage,                  vkDestroyImage )
+VK_DELETER( VkDevice,   VkDeviceMemory,           vkFreeMemory )
+VK_DELETER( VkDevice,   VkQueryPool,              vkDestroyQueryPool )
+VK_DELETER( VkDevice,   VkBuffer,                 vkDestroyBuffer )
+
+using vkUniqueDebugMessenger = vkUnique< VkInstance, VkDebugUtilsMessengerEXT, VkDebugUtilsMessengerEXTDeleter >;
+using vkUniqueSurface        = vkUnique< VkInstance, VkSurfaceKHR,             VkSurfaceKHRDeleter >;
+using vkUniqueSwapchain      = vkUnique< VkDevice,   VkSwapchainKHR,           VkSwapchainKHRDeleter >;
+using vkUniqueImageView      = vkUnique< VkDevice,   VkImageView,              VkImageViewDeleter >;
+using vkUniqueRenderPass     = vkUnique< VkDevice,   VkRenderPass,             VkRenderPassDeleter >;
+using vkUniqueFramebuffer    = vkUnique< VkDevice,   VkFramebuffer,            VkFramebufferDeleter >;
+using vkUniqueSemaphore      = vkUnique< VkDevice,   VkSemaphore,              VkSemaphoreDeleter >;
+using vkUniqueFence          = vkUnique< VkDevice,   VkFence,                  VkFenceDeleter >;
+using vkUniqueCommandPool    = vkUnique< VkDevice,   VkCommandPool,            VkCommandPoolDeleter >;
+using vkUniqueImage          = vkUnique< VkDevice,   VkImage,                  VkImageDeleter >;
+using vkUniqueDeviceMemory   = vkUnique< VkDevice,   VkDeviceMemory,           VkDeviceMemoryDeleter >;
+using vkUniqueQueryPool      = vkUnique< VkDevice,   VkQueryPool,              VkQueryPoolDeleter >;
+using vkUniqueBuffer         = vkUnique< VkDevice,   VkBuffer,                 VkBufferDeleter >;
+
+/* image with own memory and view
+ */
+struct vkImageAttachment {
+    vkUniqueImage        image;          /* Vulkan image */
+    vkUniqueDeviceMemory memory;         /* memory of the image */
+    vkUniqueImageView    view;           /* view of the image */
+    bool                 lazy { false }; /* memory is lazily allocated */
+};
+
+/* image formats of screenshots
+ */
+enum class vkCaptureFormat {
+    ppm,
+    png
+};
+
+/* Y4M video file, workers append frames strictly in the order of capture
+ */
+struct vkVideoStream {
+    std::ofstream           file;          /* output file */
+    uint32_t                width;         /* size of all frames in the file */
+    uint32_t                height;
+    uint64_t                queued  { 0 }; /* amount of frames given to workers, written by the main thread only */
+    uint64_t                written { 0 }; /* amount of frames already in the file */
+    std::mutex              mutex;         /* protects written */
+    std::condition_variable cv;            /* signals the change of written */
+};
+
+/* host visible buffer which receives pixels of the swapchain image
+ */
+struct vkReadbackBuffer {
+    vkUniqueBuffer       buffer;               /* Vulkan buffer */
+    vkUniqueDeviceMemory memory;               /* host visible memory of the buffer */
+    VkDeviceSize         size     { 0 };       /* size of the buffer */
+    const uint8_t       *data     { nullptr }; /* memory is mapped for the whole lifetime of the buffer */
+    bool                 coherent { false };   /* memory doesn't need to be invalidated */
+};
+
+/* one captured frame
+ */
+struct vkCaptureJob {
+    uint32_t                         buffer;   /* index of the readback buffer */
+    uint64_t                         frame;    /* number of the frame */
+    VkExtent2D                       size;     /* size of the image */
+    std::optional< vkCaptureFormat > screenshot;
+    std::shared_ptr< vkVideoStream > stream;   /* video file, if the frame is recorded */
+    uint64_t                         sequence; /* position of the frame in the video file */
+};
+
+/* object which waits in the deletion queue
+ */
+struct vkRetiredObject {
+    uint64_t                frame;   /* last submitted frame which might use the object */
+    std::function< void() > destroy; /* destroy the object */
+};
+
+/* application data
+ */
+struct vkApp {
+    struct {
+        bool         init   { false };
+        GLFWwindow  *window { nullptr }; /* pointer to GLFW window */
+    } glfw;
+    struct {
+        struct {
+            bool                   enable    { false }; /* flag that DebugUtils extension is supported by driver */
+            vkUniqueDebugMessenger messenger;           /* DebugUtils messenger */
+        } debug;
+        struct {
+            VkInstance object { VK_NULL_HANDLE }; /* pointer to Vulkan instance */
+
+            std::vector< const char* > required_extensions; /* list of required extensions */
+            std::vector< const char* > require_layers;      /* list of require layers */
+        } instance;
+        struct {
+            vkUniqueSurface object; /* Vulkan surface */
+        } surface;
+        struct {
+            VkPhysicalDevice gpu           { VK_NULL_HANDLE }; /* pointer to the physical device, in this case - GPU */
+            VkDevice         object        { VK_NULL_HANDLE }; /* pointer to the Vulkan device */
+            VkQueue          graph_queue   { VK_NULL_HANDLE }; /* graphical queue of the Vulkan device */
+            VkQueue          present_queue { VK_NULL_HANDLE }; /* presentation queue of the Vulkan device */
+
+            uint32_t         graph_family_idx;   /* index in the graphical queue of the physical device */
+            uint32_t         present_family_idx; /* index of the presentation queue of the physical device */
+
+            std::vector< const char* > require_extensions {
+                VK_KHR_SWAPCHAIN_EXTENSION_NAME
+            }; /* list of required extensions */
+        } device;
+        struct {
+            bool               recreate           { false };                       /* flag to trigger the swapchain recreation */
+            vkUniqueSwapchain  object;                                             /* Vulkan swapchain */
+            VkExtent2D         display_size;                                       /* actual display size */
+            VkFormat           display_format     { VK_FORMAT_UNDEFINED };         /* actual format of display pixels */
+            VkColorSpaceKHR    display_colorspace { VK_COLOR_SPACE_MAX_ENUM_KHR };
+            VkPresentModeKHR   present_mode       { VK_PRESENT_MODE_MAX_ENUM_KHR };
+
+            std::vector< VkImage >           images; /* images where the graphics will render, owned by the swapchain */
+            std::vector< vkUniqueImageView > views;  /* views for the images to present on the screen */
+        } swapchain;
+        struct {
+            bool                  msaa         { true };                  /* MSAA is switched on */
+            VkSampleCountFlagBits samples      { VK_SAMPLE_COUNT_1_BIT }; /* actual amount of samples of the scene */
+            VkFormat              depth_format { VK_FORMAT_UNDEFINED };   /* format of the depth attachment */
+
+            vkImageAttachment     color;                                  /* resolved color image of the display size */
+            vkImageAttachment     msaa_color;                             /* transient multisampled color, only with MSAA */
+            vkImageAttachment     depth;                                  /* transient depth */
+            vkUniqueRenderPass    render_pass;                            /* scene render pass, leaves the image ready for the upscale */
+            vkUniqueFramebuffer   frame;                                  /* frame buffer of the scene */
+            VkFilter              filter       { VK_FILTER_NEAREST };     /* filter of the upscale, linear if the format supports it */
+        } offscreen;
+        struct {
+            bool              timestamps     { false };   /* graphical queue supports timestamps */
+            double            tick_period    { 1.0 };     /* nanoseconds in one timestamp tick */
+            uint64_t          tick_mask      { 0 };       /* valid bits of the timestamp */
+            vkUniqueQueryPool queries;                    /* begin and end timestamps for every frame slot */
+            uint64_t          measured_frame { 0 };       /* last frame which GPU time is already taken into account */
+
+            double            target_frame_time { default_target_frame_time }; /* desirable GPU time of the frame, in ms */
+            double            gpu_frame_time    { 0.0 };                       /* smoothed GPU time of the frame, in ms */
+            float             scale             { max_render_scale };          /* internal resolution relative to the display size */
+            VkExtent2D        render_size;                                     /* actual internal resolution */
+        } scaling;
+        struct {
+            std::vector< vkUniqueSemaphore > image_available;    /* indicator that next image in the swapchain is available, per frame slot */
+            std::vector< vkUniqueSemaphore > rendering_finished; /* indicator that the render pass is over, per frame slot */
+            std::vector< vkUniqueFence >     gpu_fence;          /* GPU mutex, per frame slot */
+        } sync;
+        struct {
+            vkUniqueCommandPool pool; /* pool of command buffers */
+
+            std::vector< VkCommandBuffer > cmds; /* command buffer for every frame slot */
+        } render;
+        struct {
+            uint32_t slot      { 0 }; /* frame slot which is recording right now */
+            uint64_t submitted { 0 }; /* amount of frames submitted to GPU */
+            uint64_t completed { 0 }; /* amount of frames which GPU has finished for sure */
+
+            std::array< uint64_t, max_frames_in_flight > slot_frame {}; /* number of the last frame submitted in every slot */
+
+            std::deque< vkRetiredObject > deletion_queue; /* objects waiting for the end of frames which use them */
+        } frame;
+        struct {
+            bool     enable          { false }; /* latency mode is switched on */
+            bool     present_wait    { false }; /* VK_KHR_present_id and VK_KHR_present_wait are supported */
+            uint64_t present_id      { 0 };     /* ID of the last present */
+            uint64_t first_id        { 1 };     /* ID of the first present to the actual swapchain */
+        } latency;
+        struct {
+            bool                             supported { false }; /* swapchain images can be copied */
+            std::optional< vkCaptureFormat > screenshot;          /* screenshot of the next frame is requested */
+            bool                             recording { false }; /* every frame goes to the video file */
+            std::shared_ptr< vkVideoStream > stream;              /* actual video file */
+            uint32_t                         streams   { 0 };     /* amount of video files created */
+            uint64_t                         dropped   { 0 };     /* frames not captured because all buffers were busy */
+
+            std::vector< vkReadbackBuffer >  buffers;             /* ring of readback buffers */
+            std::array< std::optional< vkCaptureJob >, max_frames_in_flight > pending; /* copy recorded in every frame slot */
+
+            std::mutex                       mutex;               /* protects data shared with workers */
+            std::condition_variable          cv;                  /* signals new jobs or the end of work */
+            std::vector< uint32_t >          free;                /* readback buffers used neither by GPU nor by workers */
+            std::deque< vkCaptureJob >       jobs;                /* frames waiting for workers */
+            bool                             stop { false };      /* workers must finish */
+            std::vector< std::thread >       workers;             /* encoding threads */
+        } capture;
+    } vulkan;
+    struct {
+        double   period_start      { 0.0 }; /* time when the current period was started */
+        double   last_present      { 0.0 }; /* time of the last present */
+        double   interval_sum      { 0.0 }; /* sum of present-to-present intervals in the current period */
+        uint32_t interval_count    { 0 };   /* amount of intervals in the current period */
+
+        double   present_interval  { 0.0 }; /* average present-to-present interval of the last period, in ms */
+        double   fps               { 0.0 }; /* frames per second of the last period */
+    } stats;
+};
+
+/* callbacks
+ */
+
+static void glfw_error_callback( int error,
+                                 const char* description ) {
+    std::cerr
+        << "GLFW error: "
+            << description
+            << std::endl;
+}
+
+static VKAPI_ATTR VkBool32 VKAPI_CALL vk_error_callback(
+          VkDebugUtilsMessageSeverityFlagBitsEXT severity,
+          VkDebugUtilsMessageTypeFlagsEXT        type,
+    const VkDebugUtilsMessengerCallbackDataEXT  *data,
+          void                                  *user_data
+) {
+    std::cerr
+        << "Vulkan error: "
+            << data->pMessage
+                << std::endl;
+
+    /* should always return VK_FALSE
+     */
+    return VK_FALSE;
+}
+
+static void key_callback(
+    GLFWwindow* window,
+    int key,
+    int scancode,
+    int action,
+    int mods
+) {
+    /* ESC - close application
+    */
+    if ( key == GLFW_KEY_ESCAPE && action == GLFW_PRESS )
+        glfwSetWindowShouldClose( window, GLFW_TRUE );
+
+    /* L - switch latency mode on and off
+     */
+    if ( key == GLFW_KEY_L && action == GLFW_PRESS ) {
+        vkApp *app = static_cast< vkApp* > ( glfwGetWindowUserPointer( window ) );
+        app->vulkan.latency.enable = !app->vulkan.latency.enable;
+
+        std::cout
+            << "Latency mode: "
+                << ( app->vulkan.latency.enable ? "on" : "off" )
+                << std::endl;
+    }
+
+    /* UP/DOWN - change the target GPU time of the frame
+     */
+    if ( ( key == GLFW_KEY_UP || key == GLFW_KEY_DOWN ) && ( action == GLFW_PRESS || action == GLFW_REPEAT ) ) {
+        vkApp *app = static_cast< vkApp* > ( glfwGetWindowUserPointer( window ) );
+        const double step = ( key == GLFW_KEY_UP ) ? 1.0 : -1.0;
+        app->vulkan.scaling.target_frame_time = std::max( 1.0, app->vulkan.scaling.target_frame_time + step );
+
+        std::cout
+            << "Target frame time: "
+                << app->vulkan.scaling.target_frame_time
+                << " ms"
+                << std::endl;
+    }
+
+    /* M - switch MSAA on and off, attachments are recreated together with the swapchain
+     */
+    if ( key == GLFW_KEY_M && action == GLFW_PRESS ) {
+        vkApp *app = static_cast< vkApp* > ( glfwGetWindowUserPointer( window ) );
+        app->vulkan.offscreen.msaa     = !app->vulkan.offscreen.msaa;
+        app->vulkan.swapchain.recreate = true;
+
+        std::cout
+            << "MSAA: "
+                << ( app->vulkan.offscreen.msaa ? "on" : "off" )
+                << std::endl;
+    }
+
+    /* P - screenshot in PNG format, SHIFT + P - in PPM format
+     */
+    if ( key == GLFW_KEY_P && action == GLFW_PRESS ) {
+        vkApp *app = static_cast< vkApp* > ( glfwGetWindowUserPointer( window ) );
+        app->vulkan.capture.screenshot = ( mods & GLFW_MOD_SHIFT ) ? vkCaptureFormat::ppm
+                                                                   : vkCaptureFormat::png;
+    }
+
+    /* R - start and stop recording of the video
+     */
+    if ( key == GLFW_KEY_R && action == GLFW_PRESS ) {
+        vkApp *app = static_cast< vkApp* > ( glfwGetWindowUserPointer( window ) );
+        app->vulkan.capture.recording = !app->vulkan.capture.recording;
+        if( !app->vulkan.capture.recording ) {
+            /* file is closed when workers write the last frame
+             */
+            app->vulkan.capture.stream.reset();
+        }
+
+        std::cout
+            << "Recording: "
+                << ( app->vulkan.capture.recording ? "on" : "off" )
+                << ", frames dropped: "
+                << app->vulkan.capture.dropped
+                << std::endl;
+    }
+}
+
+/* GLFW library
+ */
+
+static bool init_glfw( vkApp &app ) {
+    /* setup error callback first to catch all errors
+     */
+    (void)glfwSetErrorCallback( glfw_error_callback );
+
+    /* init the library
+     */
+    if( glfwInit() == GLFW_FALSE )
+        return false;
+
+    /* Prepare the list of require extensions
+     */
+    uint32_t glfw_require_extension_count = 0;
+    const char **glfw_require_extensions =
+        glfwGetRequiredInstanceExtensions( &glfw_require_extension_count );
+    for( uint32_t i = 0; i < glfw_require_extension_count; ++i )
+        app.vulkan.instance.required_extensions.push_back( glfw_require_extensions[i] );
+
+    app.glfw.init = true;
+
+    return true;
+}
+
+static bool cleanup_glfw( vkApp &app ) {
+    if( !app.glfw.init )
+        return true;
+
+    /* cleanup GLFW resources
+     */
+    glfwTerminate();
+    app.glfw.init = false;
+
+    return true;
+}
+
+/* GLFW window
+ */
+
+static bool init_window( vkApp &app ) {
+    if( !app.glfw.init )
+        return false;
+
+    /* don't create any graphical context
+     */
+    glfwWindowHint( GLFW_CLIENT_API, GLFW_NO_API );
+
+    /* read actual screen resolution
+     */
+    GLFWmonitor *primary_monitor = glfwGetPrimaryMonitor();
+    const GLFWvidmode *primary_monitor_mode = glfwGetVideoMode( primary_monitor );
+    int window_width = primary_monitor_mode->width;
+    int window_height = primary_monitor_mode->height;
+
+    app.glfw.window = glfwCreateWindow(
+        window_width,
+        window_height,
+        "Vulkan 1.3 - Tutorial - Fullscreen",
+        glfwGetPrimaryMonitor(), /* actual monitor is needed to switch on full screen */
+        nullptr
+    );
+    if( !app.glfw.window )
+        return false;
+
+    /* setup user pointer
+     */
+    glfwSetWindowUserPointer(
+        app.glfw.window,
+       &app
+    );
+
+    /* acquire the keyboard
+     */
+    glfwSetKeyCallback(
+        app.glfw.window,
+        key_callback
+    );
+
+    return true;
+}
+
+static bool cleanup_window( vkApp &app ) {
+    if( !app.glfw.window )
+        return true;
+
+    /* destroy GLFW window
+     */
+    glfwDestroyWindow( app.glfw.window );
+    app.glfw.window = nullptr;
+
+    return true;
+}
+
+/* Vulkan deletion queue
+ */
+
+template< typename Parent, typename Handle, typename Deleter >
+static void vk_retire( vkApp &app, vkUnique< Parent, Handle, Deleter > &object ) {
+    if( !object )
+        return;
+
+    /* object might be still in use by frames which are already submitted,
+     * so it will be destroyed only after GPU finishes all of them
+     */
+    Parent parent = object.parent();
+    Handle handle = object.release();
+
+    app.vulkan.frame.deletion_queue.push_back( vkRetiredObject {
+        .frame   = app.vulkan.frame.submitted,
+        .destroy = [parent, handle]() { Deleter{}( parent, handle ); }
+    } );
+}
+
+static void vk_collect_retired( vkApp &app, uint64_t completed_frame ) {
+    /* objects are retired in order, so the queue is sorted by the frame number
+     */
+    while( !app.vulkan.frame.deletion_queue.empty() ) {
+        vkRetiredObject &retired = app.vulkan.frame.deletion_queue.front();
+        if( retired.frame > completed_frame )
+            break;
+
+        retired.destroy();
+        app.vulkan.frame.deletion_queue.pop_front();
+    }
+}
+
+/* Vulkan instance
+ */
+
+static bool vk_create_instance( vkApp &app ) {
+    if( !app.glfw.window )
+        return false;
+
+    /* read the actual supported version
+     */
+    uint32_t actual_version = 0;
+    VK_CALL( vkEnumerateInstanceVersion( &actual_version ),
+             "Cannot get the actual supported version of Vulkan" );
+    std::cout
+        << "Actual Vulkan version: "
+            << VK_API_VERSION_MAJOR( actual_version )
+            << '.'
+            << VK_API_VERSION_MINOR( actual_version )
+            << '.'
+            << VK_API_VERSION_PATCH( actual_version )
+            << std::endl;
+
+    /* fullfil application information
+     */
+    VkApplicationInfo vk_app_info {
+        .sType              = VK_STRUCTURE_TYPE_APPLICATION_INFO, /* sType MUST be always set */
+        .pApplicationName   = "Vulkan tutorial application",
+        .applicationVersion = VK_MAKE_API_VERSION( 0, 1, 0, 0 ),
+        .pEngineName        = "Vulkan tutorials",
+        .engineVersion      = VK_MAKE_API_VERSION( 0, 1, 0, 0 ),
+        .apiVersion         = VK_API_VERSION_1_3  /* require Vulkan 1.3 */
+    };
+
+    /* Request debug layer support if needed
+     */
+    if( app.vulkan.debug.enable )
+        app.vulkan.instance.require_layers.push_back( khronos_validation_layer_name );
+
+    /* Prepare debug callback to accept only errors
+     */
+    VkDebugUtilsMessengerCreateInfoEXT vk_debug_utils_info {
+        .sType           = VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT,
+        .messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT,
+        .messageType     = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT       \
+                            | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT \
+                            | VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT,
+        .pfnUserCallback = &vk_error_callback
+    };
+
+    VkInstanceCreateInfo vk_instance_create_info {
+        .sType                   = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO,
+        .pApplicationInfo        = &vk_app_info,
+        .enabledLayerCount       = static_cast< uint32_t > ( app.vulkan.instance.require_layers.size() ),
+        .ppEnabledLayerNames     = app.vulkan.instance.require_layers.data(),
+        .enabledExtensionCount   = static_cast< uint32_t > ( app.vulkan.instance.required_extensions.size() ),
+        .ppEnabledExtensionNames = app.vulkan.instance.required_extensions.data()
+    };
+
+    /* link DebugUtilsMessenger extension to VkInstanceCreateInfo if needed
+     */
+    if( app.vulkan.debug.enable )
+        vk_instance_create_info.pNext = static_cast< void* > ( &vk_debug_utils_info );
+
+    /* Create Vulkan instance
+     */
+    VK_CALL( vkCreateInstance( &vk_instance_create_info, nullptr, &app.vulkan.instance.object ),
+             "Cannot create Vulkan instance" );
+
+    /* Initialize all pointer to Vulkan functions
+     */
+    volkLoadInstanceOnly( app.vulkan.instance.object );
+
+    /* Instance object has information about debug messenger,
+     * but messenger itself must be created
+     */
+    if( app.vulkan.debug.enable ) {
+        VkDebugUtilsMessengerEXT messenger = VK_NULL_HANDLE;
+        VK_CALL( vkCreateDebugUtilsMessengerEXT( app.vulkan.instance.object,
+                                                &vk_debug_utils_info,
+                                                 nullptr,
+                                                &messenger ),
+                 "Cannot create Vulkan debug messenger" );
+        app.vulkan.debug.messenger = vkUniqueDebugMessenger( app.vulkan.instance.object, messenger );
+    }
+
+    return true;
+}
+
+static bool vk_cleanup_instance( vkApp &app ) {
+    app.vulkan.debug.messenger.reset();
+
+    if( app.vulkan.instance.object != VK_NULL_HANDLE ) {
+        vkDestroyInstance( app.vulkan.instance.object,
+                           nullptr );
+        app.vulkan.instance.object = VK_NULL_HANDLE;
+    }
+
+    return true;
+}
+
+/* Vulkan Surface
+ */
+
+static bool vk_create_surface( vkApp &app ) {
+    if( !app.glfw.window )
+        return false;
+    if( app.vulkan.instance.object == VK_NULL_HANDLE )
+        return false;
+
+    /* Vulkan surface is independent from device or window system
+     */
+    VkSurfaceKHR surface = VK_NULL_HANDLE;
+    VK_CALL( glfwCreateWindowSurface( app.vulkan.instance.object,
+                                      app.glfw.window,
+                                      nullptr,
+                                     &surface ),
+             "Cannot create window surface" );
+    app.vulkan.surface.object = vkUniqueSurface( app.vulkan.instance.object, surface );
+
+    return true;
+}
+
+static bool vk_cleanup_surface( vkApp &app ) {
+    app.vulkan.surface.object.reset();
+
+    return true;
+}
+
+/* Vulkan Physical device
+ */
+
+inline bool vk_test_dev_extensions( vkApp &app, VkPhysicalDevice dev ) {
+    if( app.vulkan.instance.object == VK_NULL_HANDLE )
+        return false;
+    if( dev == VK_NULL_HANDLE )
+        return false;
+
+    uint32_t extensions_cout = 0;
+    VK_CALL( vkEnumerateDeviceExtensionProperties( dev,
+                                                   nullptr,
+                                                  &extensions_cout,
+                                                   nullptr ),
+             "Fail to read amount of extensions supported by the physical device" );
+
+    /* Read all available extensions for the chosen device
+     */
+    std::vector< VkExtensionProperties > available_extensions( extensions_cout );
+    VK_CALL( vkEnumerateDeviceExtensionProperties( dev,
+                                                   nullptr,
+                                                  &extensions_cout,
+                                                   available_extensions.data() ),
+             "Cannot enumerate extensions supported by the physical device" );
+
+    /* Easiest way is to fill a set with required extensions
+     * and remove supported by device from it
+     */
+    std::set< std::string > required_extensions (
+        app.vulkan.device.require_extensions.begin(),
+        app.vulkan.device.require_extensions.end()
+    );
+    for( const auto &extension: available_extensions )
+        required_extensions.erase( std::string( extension.extensionName ) );
+
+    /* all require extensions are supported 
+     */
+    if( required_extensions.empty() )
+        return true;
+
+    return false;
+}
+
+inline bool vk_test_dev_families( vkApp &app,
+                                  VkPhysicalDevice dev,
+                                  uint32_t &graph_family_idx,
+                                  uint32_t &present_family_idx ) {
+    if( app.vulkan.instance.object == VK_NULL_HANDLE )
+        return false;
+    if( dev == VK_NULL_HANDLE )
+        return false;
+
+    uint32_t queue_families_count = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties( dev,
+                                             &queue_families_count,
+                                              nullptr );
+    if( !queue_families_count )
+        return false;
+
+    /* Read all properties
+     */
+    std::vector< VkQueueFamilyProperties > queue_family_properties( queue_families_count );
+    vkGetPhysicalDeviceQueueFamilyProperties( dev,
+                                             &queue_families_count,
+                                              queue_family_properties.data() );
+
+    std::optional< uint32_t > graph_family;
+    std::optional< uint32_t > present_family;
+    for( size_t idx = 0; idx < queue_families_count; ++idx ) {
+        /* detect GPU by testing VK_QUEUE_GRAPHICS_BIT
+         */
+        if( queue_family_properties[idx].queueFlags & VK_QUEUE_GRAPHICS_BIT )
+            graph_family = static_cast< uint32_t > ( idx );
+
+        /* detect graphical output by requesting the presentation support from the surface
+         */
+        VkBool32 presentation_support = VK_FALSE;
+        VK_CALL( vkGetPhysicalDeviceSurfaceSupportKHR( dev,
+                                                       static_cast< uint32_t > ( idx ),
+                                                       app.vulkan.surface.object.get(),
+                                                      &presentation_support ),
+                 "Fail to read the presentation support for the physical device from the surface" );
+
+        if( presentation_support == VK_TRUE )
+            present_family = static_cast< uint32_t > ( idx );
+
+        /* here is a tricky part - in common case this two indexes might be different
+         */
+        if( graph_family.has_value() && present_family.has_value() )
+            break;
+    }
+
+    /* nothing was found
+     */
+    if( !graph_family.has_value() || !present_family.has_value() )
+        return false;
+
+    /* save family indexes
+     */
+    graph_family_idx   = graph_family.value();
+    present_family_idx = present_family.value();
+
+    return true;
+}
+
+static bool vk_select_phy_device( vkApp &app ) {
+    if( app.vulkan.instance.object == VK_NULL_HANDLE )
+        return false;
+
+    uint32_t device_count = 0;
+    VK_CALL( vkEnumeratePhysicalDevices( app.vulkan.instance.object,
+                                        &device_count,
+                                         nullptr ),
+             "Failed to read amount of physical devices" );
+
+    /* read information about all physical devices in the system
+     */
+    std::vector< VkPhysicalDevice > available_devices( device_count );
+    VK_CALL( vkEnumeratePhysicalDevices( app.vulkan.instance.object,
+                                        &device_count,
+                                         available_devices.data() ),
+             "Cannot enumerate physical devices" );
+
+    /* search for the suitable physical device
+     */
+    for( const auto &device: available_devices ) {
+        /* device name
+         */
+        VkPhysicalDeviceProperties dev_props;
+        vkGetPhysicalDeviceProperties( device, &dev_props );
+        std::cout
+            << "Vulkan physical device: "
+                << dev_props.deviceName
+                << std::endl;
+        std::cout
+            << "Vulkan driver version: "
+                << VK_API_VERSION_MAJOR( dev_props.apiVersion )
+                << '.'
+                << VK_API_VERSION_MINOR( dev_props.apiVersion )
+                << '.'
+                << VK_API_VERSION_PATCH( dev_props.apiVersion )
+                << std::endl;
+
+        /* first check:
+         *  confirm that physical device support all required extensions
+         */
+        if( !vk_test_dev_extensions( app, device ) )
+            continue;
+
+        /* second check:
+         *  confirm that physical device is GPU and has graphical output
+         */
+        uint32_t graph_family_idx, present_family_idx;
+        if( !vk_test_dev_families( app, device, graph_family_idx, present_family_idx ) )
+            continue;
+
+        /* suitable device found
+         */
+        app.vulkan.device.gpu = device;
+        app.vulkan.device.graph_family_idx   = graph_family_idx;
+        app.vulkan.device.present_family_idx = present_family_idx;
+
+        break;
+    }
+
+    if( app.vulkan.device.gpu == VK_NULL_HANDLE )
+        return false;
+
+    return true;
+}
+
+/* Vulkan device
+ */
+
+inline bool vk_test_present_wait( vkApp &app ) {
+    uint32_t extensions_cout = 0;
+    VK_CALL( vkEnumerateDeviceExtensionProperties( app.vulkan.device.gpu,
+                                                   nullptr,
+                                                  &extensions_cout,
+                                                   nullptr ),
+             "Fail to read amount of extensions supported by the physical device" );
+
+    std::vector< VkExtensionProperties > available_extensions( extensions_cout );
+    VK_CALL( vkEnumerateDeviceExtensionProperties( app.vulkan.device.gpu,
+                                                   nullptr,
+                                                  &extensions_cout,
+                                                   available_extensions.data() ),
+             "Cannot enumerate extensions supported by the physical device" );
+
+    /* both extensions are optional and needed together
+     */
+    std::set< std::string > optional_extensions {
+        VK_KHR_PRESENT_ID_EXTENSION_NAME,
+        VK_KHR_PRESENT_WAIT_EXTENSION_NAME
+    };
+    for( const auto &extension: available_extensions )
+        optional_extensions.erase( std::string( extension.extensionName ) );
+    if( !optional_extensions.empty() )
+        return false;
+
+    /* extension might be exposed, but the feature itself is disabled
+     */
+    VkPhysicalDevicePresentWaitFeaturesKHR present_wait_features {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR
+    };
+    VkPhysicalDevicePresentIdFeaturesKHR present_id_features {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR,
+        .pNext = &present_wait_features
+    };
+    VkPhysicalDeviceFeatures2 features {
+        .sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2,
+        .pNext = &present_id_features
+    };
+    vkGetPhysicalDeviceFeatures2( app.vulkan.device.gpu, &features );
+
+    return ( present_id_features.presentId == VK_TRUE ) && ( present_wait_features.presentWait == VK_TRUE );
+}
+
+static bool vk_create_device( vkApp &app ) {
+    if( app.vulkan.device.gpu == VK_NULL_HANDLE )
+        return false;
+
+    /* enable present wait if the device supports it,
+     * otherwise the latency mode will use fences
+     */
+    app.vulkan.latency.present_wait = vk_test_present_wait( app );
+    if( app.vulkan.latency.present_wait ) {
+        app.vulkan.device.require_extensions.push_back( VK_KHR_PRESENT_ID_EXTENSION_NAME );
+        app.vulkan.device.require_extensions.push_back( VK_KHR_PRESENT_WAIT_EXTENSION_NAME );
+    }
+    std::cout
+        << "Latency limiter: "
+            << ( app.vulkan.latency.present_wait ? "present wait" : "fences" )
+            << std::endl;
+
+    VkPhysicalDevicePresentWaitFeaturesKHR present_wait_features {
+        .sType       = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR,
+        .presentWait = VK_TRUE
+    };
+    VkPhysicalDevicePresentIdFeaturesKHR present_id_features {
+        .sType     = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR,
+        .pNext     = &present_wait_features,
+        .presentId = VK_TRUE
+    };
+
+    /* store only unique family indexes
+     */
+    std::set< uint32_t > queue_families {
+        app.vulkan.device.graph_family_idx,
+        app.vulkan.device.present_family_idx
+    };
+
+    /* create queues for each family
+     */
+    float queue_prio = 1.0f;
+
+    std::vector< VkDeviceQueueCreateInfo > device_queue_create_infos;
+    for( uint32_t queue_family: queue_families ) {
+        VkDeviceQueueCreateInfo device_queue_create_info {
+            .sType            = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO,
+            .queueFamilyIndex = queue_family,
+            .queueCount       = 1,
+            .pQueuePriorities = &queue_prio
+        };
+
+        device_queue_create_infos.push_back( device_queue_create_info );
+    }
+
+    VkDeviceCreateInfo device_create_info {
+        .sType                   = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO,
+        .queueCreateInfoCount    = static_cast< uint32_t > ( device_queue_create_infos.size() ),
+        .pQueueCreateInfos       = device_queue_create_infos.data(),
+        .enabledLayerCount       = static_cast< uint32_t > ( app.vulkan.instance.require_layers.size() ),
+        .ppEnabledLayerNames     = app.vulkan.instance.require_layers.data(),
+        .enabledExtensionCount   = static_cast< uint32_t > ( app.vulkan.device.require_extensions.size() ),
+        .ppEnabledExtensionNames = app.vulkan.device.require_extensions.data()
+    };
+    if( app.vulkan.latency.present_wait )
+        device_create_info.pNext = &present_id_features;
+
+    VK_CALL( vkCreateDevice( app.vulkan.device.gpu,
+                            &device_create_info,
+                             nullptr,
+                            &app.vulkan.device.object ),
+             "Cannot create Vulkan device" );
+
+    /* call volk to correct pointers to Vulkan functions
+     */
+    volkLoadDevice( app.vulkan.device.object );
+
+    /* store Vulkan queues
+     */
+    vkGetDeviceQueue( app.vulkan.device.object,
+                      app.vulkan.device.graph_family_idx,
+                      0,
+                     &app.vulkan.device.graph_queue );
+    vkGetDeviceQueue( app.vulkan.device.object,
+                      app.vulkan.device.present_family_idx,
+                      0,
+                     &app.vulkan.device.present_queue );
+
+    return true;
+}
+
+static bool vk_cleanup_device( vkApp &app ) {
+    if( app.vulkan.device.object != VK_NULL_HANDLE ) {
+        app.vulkan.device.graph_queue   = VK_NULL_HANDLE;
+        app.vulkan.device.present_queue = VK_NULL_HANDLE;
+
+        vkDestroyDevice( app.vulkan.device.object, nullptr );
+        app.vulkan.device.object = VK_NULL_HANDLE;
+    }
+
+    return true;
+}
+
+/* Vulkan swapchain
+ */
+
+inline VkExtent2D vk_calculate_display_extent( vkApp &app,
+                                               VkSurfaceCapabilitiesKHR surf_caps ) {
+    VkExtent2D result;
+    int frame_width, frame_height;
+
+    /* read the framebuffer size and calculate display width and height for it
+     */
+
+    glfwGetFramebufferSize( app.glfw.window, &frame_width, &frame_height );
+
+    result.width  = std::clamp( static_cast< uint32_t > ( frame_width ),
+                                surf_caps.minImageExtent.width,
+                                surf_caps.maxImageExtent.width );
+    result.height = std::clamp( static_cast< uint32_t > ( frame_height ),
+                                surf_caps.minImageExtent.height,
+                                surf_caps.maxImageExtent.height );
+
+    return result;
+}
+
+inline uint32_t vk_calculate_number_swapchain_images( VkSurfaceCapabilitiesKHR surf_caps ) {
+    uint32_t result = surf_caps.minImageCount + 1;
+    if( surf_caps.maxImageCount && ( result > surf_caps.maxImageCount ) )
+        result = surf_caps.maxImageCount;
+
+    return result;
+}
+
+inline VkSurfaceFormatKHR vk_select_display_format( vkApp &app,
+                                                    VkFormat format ) {
+    VkSurfaceFormatKHR wrong_result {
+        .format     = VK_FORMAT_UNDEFINED,
+        .colorSpace = VK_COLOR_SPACE_MAX_ENUM_KHR
+    };
+
+    /* get amount of display format
+     */
+    uint32_t surf_format_count = 0;
+    if( vkGetPhysicalDeviceSurfaceFormatsKHR( app.vulkan.device.gpu,
+                                              app.vulkan.surface.object.get(),
+                                             &surf_format_count,
+                                              nullptr ) != VK_SUCCESS ) {
+        std::cerr
+            << "VK_CALL error: "
+                << "Fail to read amount of surface formats"
+                << std::endl;
+    }
+    if( !surf_format_count ) {
+        std::cerr
+            << "Surface doesn't support any graphical formats"
+                << std::endl;
+        return wrong_result;
+    }
+
+    /* read display formats and find the index of requested format
+     */
+    std::vector< VkSurfaceFormatKHR > surf_formats( surf_format_count );
+    if( vkGetPhysicalDeviceSurfaceFormatsKHR( app.vulkan.device.gpu,
+                                                   app.vulkan.surface.object.get(),
+                                                  &surf_format_count,
+                                                   surf_formats.data() ) != VK_SUCCESS ) {
+        std::cerr
+            << "VK_CALL error: "
+                << "Cannot read formats of the surface"
+                << std::endl;
+        return wrong_result;
+    }
+
+    uint32_t surf_format_idx;
+    for( surf_format_idx = 0; surf_format_idx < surf_format_count; ++surf_format_idx ) {
+        if( surf_formats[surf_format_idx].format == format )
+            return surf_formats[surf_format_idx];
+    }
+
+    std::cerr
+        << "VK_CALL error: "
+            << "Surface doesn't support desirable format "
+            << format
+            << std::endl;
+    return wrong_result;
+}
+
+inline VkPresentModeKHR vk_select_presentation_mode( vkApp &app,
+                                                     VkPresentModeKHR mode ) {
+    /* get amount of presentation modes
+     */
+    uint32_t present_mode_count = 0;
+    if( vkGetPhysicalDeviceSurfacePresentModesKHR( app.vulkan.device.gpu,
+                                                   app.vulkan.surface.object.get(),
+                                                  &present_mode_count,
+                                                   nullptr ) != VK_SUCCESS ) {
+        std::cerr
+            << "VK_CALL error: "
+                << "Fail to read amount of presentation modes for the physical device"
+                << std::endl;
+        return VK_PRESENT_MODE_MAX_ENUM_KHR;
+    }
+    if( !present_mode_count )
+        return VK_PRESENT_MODE_MAX_ENUM_KHR;
+
+    /* read presentation modes
+     */
+    std::vector< VkPresentModeKHR > present_modes( present_mode_count );
+    if( vkGetPhysicalDeviceSurfacePresentModesKHR( app.vulkan.device.gpu,
+                                                   app.vulkan.surface.object.get(),
+                                                  &present_mode_count,
+                                                   present_modes.data() ) != VK_SUCCESS ) {
+        std::cerr
+            << "VK_CALL error: "
+                << "Cannot read presentation modes for the physical device"
+                << std::endl;
+        return VK_PRESENT_MODE_MAX_ENUM_KHR;
+    }
+
+    for( const auto &available_mode: present_modes ) {
+        if( available_mode == mode )
+            return available_mode;
+    }
+
+    return VK_PRESENT_MODE_MAX_ENUM_KHR;
+}
+
+static bool vk_create_swapchain( vkApp &app ) {
+    if( !app.vulkan.surface.object )
+        return false;
+    if( app.vulkan.device.object == VK_NULL_HANDLE )
+        return false;
+
+    VkSurfaceCapabilitiesKHR surf_caps;
+    VK_CALL( vkGetPhysicalDeviceSurfaceCapabilitiesKHR( app.vulkan.device.gpu,
+                                                        app.vulkan.surface.object.get(),
+                                                       &surf_caps ),
+             "Cannot read surface capabilities for the physical device" );
+
+    /* calculate display extent
+     */
+    VkExtent2D display_extent = vk_calculate_display_extent( app, surf_caps );
+    app.vulkan.swapchain.display_size = display_extent;
+
+    /* calculate amount of images in the swapchain
+     */
+    uint32_t image_count = vk_calculate_number_swapchain_images( surf_caps );
+
+    /* check for the support of VK_FORMAT_B8G8R8A8_UNORM display format
+     */
+    if( app.vulkan.swapchain.display_format == VK_FORMAT_UNDEFINED ) {
+        VkSurfaceFormatKHR display_format = vk_select_display_format( app, VK_FORMAT_B8G8R8A8_UNORM );
+        if( display_format.format == VK_FORMAT_UNDEFINED )
+            return false;
+
+        app.vulkan.swapchain.display_format     = display_format.format;
+        app.vulkan.swapchain.display_colorspace = display_format.colorSpace;
+    }
+
+    /* check for support of VK_PRESENT_MODE_FIFO_KHR display presentation mode
+     */
+    if( app.vulkan.swapchain.present_mode == VK_PRESENT_MODE_MAX_ENUM_KHR ) {
+        VkPresentModeKHR display_present_mode = vk_select_presentation_mode( app, VK_PRESENT_MODE_FIFO_KHR );
+        if( display_present_mode == VK_PRESENT_MODE_MAX_ENUM_KHR )
+            return false;
+
+        app.vulkan.swapchain.present_mode = display_present_mode;
+    }
+
+    /* swapchain images must be a source of the copy to read pixels back
+     */
+    app.vulkan.capture.supported = ( surf_caps.supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_SRC_BIT ) != 0;
+
+    VkImageUsageFlags image_usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+    if( app.vulkan.capture.supported )
+        image_usage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+
+    /* Create Swapchain
+     */
+    VkSwapchainCreateInfoKHR swapchain_create_info {
+        .sType            = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR,
+        .surface          = app.vulkan.surface.object.get(),
+        .minImageCount    = image_count,
+        .imageFormat      = app.vulkan.swapchain.display_format,
+        .imageColorSpace  = app.vulkan.swapchain.display_colorspace,
+        .imageExtent      = display_extent,
+        .imageArrayLayers = 1,
+        .imageUsage       = image_usage,
+        .preTransform     = surf_caps.currentTransform,
+        .compositeAlpha   = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR,
+        .presentMode      = app.vulkan.swapchain.present_mode,
+        .clipped          = VK_TRUE,
+        .oldSwapchain     = app.vulkan.swapchain.object.get() /* let the driver reuse resources of the previous swapchain */
+    };
+    if( app.vulkan.device.graph_family_idx != app.vulkan.device.present_family_idx ) {
+        uint32_t family_idxs[] = { app.vulkan.device.graph_family_idx,
+                                   app.vulkan.device.present_family_idx };
+
+        swapchain_create_info.imageSharingMode      = VK_SHARING_MODE_CONCURRENT;
+        swapchain_create_info.queueFamilyIndexCount = 2;
+        swapchain_create_info.pQueueFamilyIndices   = family_idxs;
+    }
+    else {
+        uint32_t family_idxs[] = { app.vulkan.device.graph_family_idx };
+
+        swapchain_create_info.imageSharingMode      = VK_SHARING_MODE_EXCLUSIVE;
+        swapchain_create_info.queueFamilyIndexCount = 1;
+        swapchain_create_info.pQueueFamilyIndices   = family_idxs;
+    }
+
+    VkSwapchainKHR swapchain = VK_NULL_HANDLE;
+    VK_CALL( vkCreateSwapchainKHR( app.vulkan.device.object,
+                                  &swapchain_create_info,
+                                   nullptr,
+                                  &swapchain ),
+             "Cannot create swapchain" );
+
+    /* previous swapchain might be still presenting images of frames in flight
+     */
+    vk_retire( app, app.vulkan.swapchain.object );
+    app.vulkan.swapchain.object = vkUniqueSwapchain( app.vulkan.device.object, swapchain );
+
+    /* present IDs of the old swapchain are meaningless for the new one
+     */
+    app.vulkan.latency.first_id = app.vulkan.latency.present_id + 1;
+
+    return true;
+}
+
+static bool vk_cleanup_swapchain( vkApp &app ) {
+    app.vulkan.swapchain.object.reset();
+
+    return true;
+}
+
+/* Vulkan swapchain images
+ */
+static bool vk_get_swapchain_images( vkApp &app ) {
+    if( !app.vulkan.swapchain.object )
+        return false;
+
+    uint32_t image_count = 0;
+    VK_CALL( vkGetSwapchainImagesKHR( app.vulkan.device.object,
+                                      app.vulkan.swapchain.object.get(),
+                                     &image_count,
+                                      nullptr ),
+             "Fail to read amount of images in the swapchain" );
+
+    app.vulkan.swapchain.images.resize( image_count );
+    VK_CALL( vkGetSwapchainImagesKHR( app.vulkan.device.object,
+                                      app.vulkan.swapchain.object.get(),
+                                     &image_count,
+                                      app.vulkan.swapchain.images.data() ),
+             "Cannot read pointers to images from the swapchain" );
+
+    return true;
+}
+
+static bool vk_cleanup_swapchain_images( vkApp &app ) {
+    app.vulkan.swapchain.images.clear();
+
+    return true;
+}
+
+/* Vulkan image views
+ */
+static bool vk_create_image_views( vkApp & app ) {
+    if( app.vulkan.swapchain.images.empty() )
+        return false;
+
+    for( const auto &image: app.vulkan.swapchain.images ) {
+        VkImageViewCreateInfo view_create_info {
+            .sType      = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+            .image      = image,
+            .viewType   = VK_IMAGE_VIEW_TYPE_2D,
+            .format     = app.vulkan.swapchain.display_format,
+            .components = { .r = VK_COMPONENT_SWIZZLE_IDENTITY,
+                            .g = VK_COMPONENT_SWIZZLE_IDENTITY,
+                            .b = VK_COMPONENT_SWIZZLE_IDENTITY,
+                            .a = VK_COMPONENT_SWIZZLE_IDENTITY },
+            .subresourceRange = { .aspectMask = VK_IMAGE_ASPECT_COLOR_BIT,
+                                  .baseMipLevel   = 0,
+                                  .levelCount     = 1,
+                                  .baseArrayLayer = 0,
+                                  .layerCount     = 1 }
+        };
+
+        VkImageView view = VK_NULL_HANDLE;
+        VK_CALL( vkCreateImageView( app.vulkan.device.object,
+                                   &view_create_info,
+                                    nullptr,
+                                   &view ),
+                 "Cannot create the view for the image in the swapchain" );
+
+        app.vulkan.swapchain.views.emplace_back( app.vulkan.device.object, view );
+    }
+
+    return true;
+}
+
+static bool vk_cleanup_image_views( vkApp &app ) {
+    /* every wrapper destroys own image view
+     */
+    app.vulkan.swapchain.views.clear();
+
+    return true;
+}
+
+/* Vulkan offscreen render target
+ */
+
+inline bool vk_find_memory_type( vkApp &app,
+                                 uint32_t type_bits,
+                                 VkMemoryPropertyFlags properties,
+                                 uint32_t &type_idx ) {
+    VkPhysicalDeviceMemoryProperties mem_props;
+    vkGetPhysicalDeviceMemoryProperties( app.vulkan.device.gpu, &mem_props );
+
+    for( uint32_t idx = 0; idx < mem_props.memoryTypeCount; ++idx ) {
+        if( !( type_bits & ( 1u << idx ) ) )
+            continue;
+        if( ( mem_props.memoryTypes[idx].propertyFlags & properties ) != properties )
+            continue;
+
+        type_idx = idx;
+        return true;
+    }
+
+    return false;
+}
+
+inline void vk_calculate_render_size( vkApp &app ) {
+    /* internal resolution never goes out of the offscreen image
+     */
+    const VkExtent2D display_size = app.vulkan.swapchain.display_size;
+    const float      scale        = app.vulkan.scaling.scale;
+
+    app.vulkan.scaling.render_size = {
+        .width  = std::clamp( static_cast< uint32_t > ( std::lround( display_size.width * scale ) ), 1u, display_size.width ),
+        .height = std::clamp( static_cast< uint32_t > ( std::lround( display_size.height * scale ) ), 1u, display_size.height )
+    };
+}
+
+inline VkSampleCountFlagBits vk_select_sample_count( vkApp &app ) {
+    VkPhysicalDeviceProperties dev_props;
+    vkGetPhysicalDeviceProperties( app.vulkan.device.gpu, &dev_props );
+
+    /* both color and depth attachments must support the amount of samples
+     */
+    const VkSampleCountFlags supported = dev_props.limits.framebufferColorSampleCounts
+                                       & dev_props.limits.framebufferDepthSampleCounts;
+
+    uint32_t samples = max_msaa_samples;
+    while( ( samples > VK_SAMPLE_COUNT_1_BIT ) && !( supported & samples ) )
+        samples >>= 1;
+
+    return static_cast< VkSampleCountFlagBits > ( samples );
+}
+
+inline VkFormat vk_select_depth_format( vkApp &app ) {
+    const VkFormat candidates[] = {
+        VK_FORMAT_D32_SFLOAT,
+        VK_FORMAT_D24_UNORM_S8_UINT,
+        VK_FORMAT_D16_UNORM
+    };
+
+    for( const auto format: candidates ) {
+        VkFormatProperties format_props;
+        vkGetPhysicalDeviceFormatProperties( app.vulkan.device.gpu,
+                                             format,
+                                            &format_props );
+        if( format_props.optimalTilingFeatures & VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT )
+            return format;
+    }
+
+    return VK_FORMAT_UNDEFINED;
+}
+
+static bool vk_create_image( vkApp &app,
+                             VkFormat format,
+                             VkSampleCountFlagBits samples,
+                             VkImageUsageFlags usage,
+                             VkImageAspectFlags aspect,
+                             vkImageAttachment &attachment ) {
+    VkImageCreateInfo image_create_info {
+        .sType         = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO,
+        .imageType     = VK_IMAGE_TYPE_2D,
+        .format        = format,
+        .extent        = { .width  = app.vulkan.swapchain.display_size.width,
+                           .height = app.vulkan.swapchain.display_size.height,
+                           .depth  = 1 },
+        .mipLevels     = 1,
+        .arrayLayers   = 1,
+        .samples       = samples,
+        .tiling        = VK_IMAGE_TILING_OPTIMAL,
+        .usage         = usage,
+        .sharingMode   = VK_SHARING_MODE_EXCLUSIVE,
+        .initialLayout = VK_IMAGE_LAYOUT_UNDEFINED
+    };
+    VkImage image = VK_NULL_HANDLE;
+    VK_CALL( vkCreateImage( app.vulkan.device.object,
+                           &image_create_info,
+                            nullptr,
+                           &image ),
+             "Cannot create offscreen image" );
+    attachment.image = vkUniqueImage( app.vulkan.device.object, image );
+
+    VkMemoryRequirements mem_reqs;
+    vkGetImageMemoryRequirements( app.vulkan.device.object,
+                                  image,
+                                 &mem_reqs );
+
+    /* content of transient attachments never leaves the render pass,
+     * on tile based GPUs lazily allocated memory lets them live only in the tile memory
+     */
+    uint32_t mem_type_idx = 0;
+    attachment.lazy = ( usage & VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT )
+                   && vk_find_memory_type( app,
+                                           mem_reqs.memoryTypeBits,
+                                           VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT,
+                                           mem_type_idx );
+    if( !attachment.lazy
+        && !vk_find_memory_type( app, mem_reqs.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mem_type_idx ) ) {
+        std::cerr
+            << "Cannot find device local memory for the offscreen image"
+                << std::endl;
+        return false;
+    }
+
+    VkMemoryAllocateInfo mem_alloc_info {
+        .sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+        .allocationSize  = mem_reqs.size,
+        .memoryTypeIndex = mem_type_idx
+    };
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VK_CALL( vkAllocateMemory( app.vulkan.device.object,
+                              &mem_alloc_info,
+                               nullptr,
+                              &memory ),
+             "Cannot allocate memory for the offscreen image" );
+    attachment.memory = vkUniqueDeviceMemory( app.vulkan.device.object, memory );
+
+    VK_CALL( vkBindImageMemory( app.vulkan.device.object,
+                                image,
+                                memory,
+                                0 ),
+             "Cannot bind memory to the offscreen image" );
+
+    VkImageViewCreateInfo view_create_info {
+        .sType      = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO,
+        .image      = image,
+        .viewType   = VK_IMAGE_VIEW_TYPE_2D,
+        .format     = format,
+        .components = { .r = VK_COMPONENT_SWIZZLE_IDENTITY,
+                        .g = VK_COMPONENT_SWIZZLE_IDENTITY,
+                        .b = VK_COMPONENT_SWIZZLE_IDENTITY,
+                        .a = VK_COMPONENT_SWIZZLE_IDENTITY },
+        .subresourceRange = { .aspectMask = aspect,
+                              .baseMipLevel   = 0,
+                              .levelCount     = 1,
+                              .baseArrayLayer = 0,
+                              .layerCount     = 1 }
+    };
+    VkImageView view = VK_NULL_HANDLE;
+    VK_CALL( vkCreateImageView( app.vulkan.device.object,
+                               &view_create_info,
+                                nullptr,
+                               &view ),
+             "Cannot create the view for the offscreen image" );
+    attachment.view = vkUniqueImageView( app.vulkan.device.object, view );
+
+    return true;
+}
+
+static bool vk_create_offscreen( vkApp &app ) {
+    if( app.vulkan.device.object == VK_NULL_HANDLE )
+        return false;
+
+    /* select the amount of samples and the depth format
+     */
+    app.vulkan.offscreen.samples = app.vulkan.offscreen.msaa ? vk_select_sample_count( app )
+                                                             : VK_SAMPLE_COUNT_1_BIT;
+    if( app.vulkan.offscreen.depth_format == VK_FORMAT_UNDEFINED ) {
+        app.vulkan.offscreen.depth_format = vk_select_depth_format( app );
+        if( app.vulkan.offscreen.depth_format == VK_FORMAT_UNDEFINED ) {
+            std::cerr
+                << "Device doesn't support any depth format"
+                    << std::endl;
+            return false;
+        }
+    }
+    const bool multisampled = ( app.vulkan.offscreen.samples != VK_SAMPLE_COUNT_1_BIT );
+
+    /* resolved image has the size of the display, so the change of the scale does not
+     * require new objects, the scene just uses smaller part of the image
+     */
+    TUTORIAL_CALL( vk_create_image( app,
+                                    app.vulkan.swapchain.display_format,
+                                    VK_SAMPLE_COUNT_1_BIT,
+                                    VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT,
+                                    VK_IMAGE_ASPECT_COLOR_BIT,
+                                    app.vulkan.offscreen.color ) );
+
+    /* multisampled color and depth are needed only inside the render pass
+     */
+    if( multisampled )
+        TUTORIAL_CALL( vk_create_image( app,
+                                        app.vulkan.swapchain.display_format,
+                                        app.vulkan.offscreen.samples,
+                                        VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT,
+                                        VK_IMAGE_ASPECT_COLOR_BIT,
+                                        app.vulkan.offscreen.msaa_color ) );
+    TUTORIAL_CALL( vk_create_image( app,
+                                    app.vulkan.offscreen.depth_format,
+                                    app.vulkan.offscreen.samples,
+                                    VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT,
+                                    VK_IMAGE_ASPECT_DEPTH_BIT,
+                                    app.vulkan.offscreen.depth ) );
+
+    std::cout
+        << "Scene attachments: "
+            << app.vulkan.offscreen.samples
+            << "x MSAA, depth format "
+            << app.vulkan.offscreen.depth_format
+            << ", "
+            << ( app.vulkan.offscreen.depth.lazy ? "lazily allocated" : "device local" )
+            << " memory"
+            << std::endl;
+
+    /* attachments:
+     *  0 - color, multisampled or the resolved image itself
+     *  1 - depth
+     *  2 - resolved image, only with MSAA
+     * transient attachments are cleared and never stored
+     */
+    VkAttachmentDescription attachments[] = {
+        {
+            .format         = app.vulkan.swapchain.display_format,
+            .samples        = app.vulkan.offscreen.samples,
+            .loadOp         = VK_ATTACHMENT_LOAD_OP_CLEAR,
+            .storeOp        = multisampled ? VK_ATTACHMENT_STORE_OP_DONT_CARE : VK_ATTACHMENT_STORE_OP_STORE,
+            .stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+            .stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
+            .initialLayout  = VK_IMAGE_LAYOUT_UNDEFINED,
+            .finalLayout    = multisampled ? VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL : VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
+        },
+        {
+            .format         = app.vulkan.offscreen.depth_format,
+            .samples        = app.vulkan.offscreen.samples,
+            .loadOp         = VK_ATTACHMENT_LOAD_OP_CLEAR,
+            .storeOp        = VK_ATTACHMENT_STORE_OP_DONT_CARE,
+            .stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+            .stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
+            .initialLayout  = VK_IMAGE_LAYOUT_UNDEFINED,
+            .finalLayout    = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
+        },
+        {
+            .format         = app.vulkan.swapchain.display_format,
+            .samples        = VK_SAMPLE_COUNT_1_BIT,
+            .loadOp         = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+            .storeOp        = VK_ATTACHMENT_STORE_OP_STORE,
+            .stencilLoadOp  = VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+            .stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE,
+            .initialLayout  = VK_IMAGE_LAYOUT_UNDEFINED,
+            .finalLayout    = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL
+        }
+    };
+    VkAttachmentReference color_attachment_ref {
+        .attachment = 0,
+        .layout     = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
+    };
+    VkAttachmentReference depth_attachment_ref {
+        .attachment = 1,
+        .layout     = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL
+    };
+    VkAttachmentReference resolve_attachment_ref {
+        .attachment = 2,
+        .layout     = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL
+    };
+
+    /* resolve is done by the render pass at the end of the subpass,
+     * on tile based GPUs it happens right in the tile memory
+     */
+    VkSubpassDescription subpass {
+        .pipelineBindPoint       = VK_PIPELINE_BIND_POINT_GRAPHICS,
+        .colorAttachmentCount    = 1,
+        .pColorAttachments       = &color_attachment_ref,
+        .pResolveAttachments     = multisampled ? &resolve_attachment_ref : nullptr,
+        .pDepthStencilAttachment = &depth_attachment_ref
+    };
+
+    /* all offscreen images are shared by all frames in flight:
+     *  the scene must wait until the previous frame has finished with the attachments
+     *  and the blit of the previous frame has read the resolved image
+     *  the blit must wait until the scene is written
+     */
+    VkSubpassDependency subpass_deps[] = {
+        {
+            .srcSubpass    = VK_SUBPASS_EXTERNAL,
+            .dstSubpass    = 0,
+            .srcStageMask  = VK_PIPELINE_STAGE_TRANSFER_BIT
+                             | VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT
+                             | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT,
+            .dstStageMask  = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT
+                             | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT,
+            .srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT
+                             | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT
+                             | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT
+                             | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT
+        },
+        {
+            .srcSubpass    = 0,
+            .dstSubpass    = VK_SUBPASS_EXTERNAL,
+            .srcStageMask  = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+            .dstStageMask  = VK_PIPELINE_STAGE_TRANSFER_BIT,
+            .srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT,
+            .dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT
+        }
+    };
+    VkRenderPassCreateInfo render_pass_create_info {
+        .sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO,
+        .attachmentCount = multisampled ? 3u : 2u,
+        .pAttachments    = attachments,
+        .subpassCount    = 1,
+        .pSubpasses      = &subpass,
+        .dependencyCount = 2,
+        .pDependencies   = subpass_deps
+    };
+    VkRenderPass render_pass = VK_NULL_HANDLE;
+    VK_CALL( vkCreateRenderPass( app.vulkan.device.object,
+                                &render_pass_create_info,
+                                 nullptr,
+                                &render_pass ),
+        "Cannot create offscreen render pass" );
+    app.vulkan.offscreen.render_pass = vkUniqueRenderPass( app.vulkan.device.object, render_pass );
+
+    VkImageView views[] = {
+        multisampled ? app.vulkan.offscreen.msaa_color.view.get() : app.vulkan.offscreen.color.view.get(),
+        app.vulkan.offscreen.depth.view.get(),
+        app.vulkan.offscreen.color.view.get()
+    };
+    VkFramebufferCreateInfo fbuffer_create_info {
+        .sType           = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO,
+        .renderPass      = render_pass,
+        .attachmentCount = render_pass_create_info.attachmentCount,
+        .pAttachments    = views,
+        .width           = app.vulkan.swapchain.display_size.width,
+        .height          = app.vulkan.swapchain.display_size.height,
+        .layers          = 1
+    };
+    VkFramebuffer fbuffer = VK_NULL_HANDLE;
+    VK_CALL( vkCreateFramebuffer( app.vulkan.device.object,
+                                 &fbuffer_create_info,
+                                  nullptr,
+                                 &fbuffer ),
+       "Cannot create frame buffer for the offscreen image" );
+    app.vulkan.offscreen.frame = vkUniqueFramebuffer( app.vulkan.device.object, fbuffer );
+
+    /* linear filter gives smoother upscale, but it is optional for the blit
+     */
+    VkFormatProperties format_props;
+    vkGetPhysicalDeviceFormatProperties( app.vulkan.device.gpu,
+                                         app.vulkan.swapchain.display_format,
+                                        &format_props );
+    app.vulkan.offscreen.filter = ( format_props.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT )
+                                      ? VK_FILTER_LINEAR
+                                      : VK_FILTER_NEAREST;
+
+    vk_calculate_render_size( app );
+
+    return true;
+}
+
+static void vk_retire_image( vkApp &app, vkImageAttachment &attachment ) {
+    vk_retire( app, attachment.view );
+    vk_retire( app, attachment.image );
+    vk_retire( app, attachment.memory );
+}
+
+static void vk_retire_offscreen( vkApp &app ) {
+    /* frames in flight might still render to the images or read from them
+     */
+    vk_retire( app, app.vulkan.offscreen.frame );
+    vk_retire( app, app.vulkan.offscreen.render_pass );
+    vk_retire_image( app, app.vulkan.offscreen.depth );
+    vk_retire_image( app, app.vulkan.offscreen.msaa_color );
+    vk_retire_image( app, app.vulkan.offscreen.color );
+}
+
+static void vk_cleanup_image( vkImageAttachment &attachment ) {
+    attachment.view.reset();
+    attachment.image.reset();
+    attachment.memory.reset();
+}
+
+static bool vk_cleanup_offscreen( vkApp &app ) {
+    app.vulkan.offscreen.frame.reset();
+    app.vulkan.offscreen.render_pass.reset();
+    vk_cleanup_image( app.vulkan.offscreen.depth );
+    vk_cleanup_image( app.vulkan.offscreen.msaa_color );
+    vk_cleanup_image( app.vulkan.offscreen.color );
+
+    return true;
+}
+
+/* GPU timestamps and resolution controller
+ */
+
+static bool vk_create_timestamps( vkApp &app ) {
+    if( app.vulkan.device.object == VK_NULL_HANDLE )
+        return false;
+
+    /* not every queue can write timestamps
+     */
+    uint32_t queue_families_count = 0;
+    vkGetPhysicalDeviceQueueFamilyProperties( app.vulkan.device.gpu,
+                                             &queue_families_count,
+                                              nullptr );
+    std::vector< VkQueueFamilyProperties > queue_family_properties( queue_families_count );
+    vkGetPhysicalDeviceQueueFamilyProperties( app.vulkan.device.gpu,
+                                             &queue_families_count,
+                                              queue_family_properties.data() );
+
+    const uint32_t valid_bits = queue_family_properties[app.vulkan.device.graph_family_idx].timestampValidBits;
+    if( !valid_bits ) {
+        std::cout
+            << "Timestamps are not supported, resolution scale is fixed"
+                << std::endl;
+        return true;
+    }
+
+    VkPhysicalDeviceProperties dev_props;
+    vkGetPhysicalDeviceProperties( app.vulkan.device.gpu, &dev_props );
+
+    app.vulkan.scaling.tick_period = dev_props.limits.timestampPeriod;
+    app.vulkan.scaling.tick_mask   = ( valid_bits >= 64 ) ? std::numeric_limits< uint64_t >::max()
+                                                          : ( ( 1ull << valid_bits ) - 1 );
+
+    /* two timestamps for every frame slot,
+     * results of the slot are read only after its fence, so they never stall the CPU
+     */
+    VkQueryPoolCreateInfo query_pool_create_info {
+        .sType      = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO,
+        .queryType  = VK_QUERY_TYPE_TIMESTAMP,
+        .queryCount = 2 * max_frames_in_flight
+    };
+    VkQueryPool query_pool = VK_NULL_HANDLE;
+    VK_CALL( vkCreateQueryPool( app.vulkan.device.object,
+                               &query_pool_create_info,
+                                nullptr,
+                               &query_pool ),
+             "Cannot create timestamp query pool" );
+    app.vulkan.scaling.queries    = vkUniqueQueryPool( app.vulkan.device.object, query_pool );
+    app.vulkan.scaling.timestamps = true;
+
+    return true;
+}
+
+static bool vk_cleanup_timestamps( vkApp &app ) {
+    app.vulkan.scaling.queries.reset();
+    app.vulkan.scaling.timestamps = false;
+
+    return true;
+}
+
+static void vk_update_render_scale( vkApp &app, double gpu_time ) {
+    /* single frames might be slow for many reasons,
+     * controller looks at the smoothed value
+     */
+    double &smoothed = app.vulkan.scaling.gpu_frame_time;
+    if( smoothed <= 0.0 )
+        smoothed = gpu_time;
+    else
+        smoothed += gpu_time_smoothing * ( gpu_time - smoothed );
+    if( smoothed <= 0.0 )
+        return;
+
+    /* GPU time grows with the amount of pixels, i.e. with the square of the scale
+     */
+    const float scale   = app.vulkan.scaling.scale;
+    const float desired = std::clamp( static_cast< float > ( scale * std::sqrt( app.vulkan.scaling.target_frame_time / smoothed ) ),
+                                      min_render_scale,
+                                      max_render_scale );
+
+    /* don't react to the noise, and go only half way to avoid oscillation
+     */
+    if( std::fabs( desired - scale ) < render_scale_threshold * scale )
+        return;
+
+    app.vulkan.scaling.scale = scale + 0.5f * ( desired - scale );
+    vk_calculate_render_size( app );
+}
+
+static bool vk_read_gpu_time( vkApp &app, const uint32_t slot ) {
+    if( !app.vulkan.scaling.timestamps )
+        return true;
+
+    /* fence of the slot is signaled, results of the last frame in this slot are ready,
+     * but every frame must be taken into account only once
+     */
+    const uint64_t frame = app.vulkan.frame.slot_frame[slot];
+    if( frame <= app.vulkan.scaling.measured_frame )
+        return true;
+    app.vulkan.scaling.measured_frame = frame;
+
+    uint64_t timestamps[2];
+    VkResult res = vkGetQueryPoolResults( app.vulkan.device.object,
+                                          app.vulkan.scaling.queries.get(),
+                                          2 * slot,
+                                          2,
+                                          sizeof( timestamps ),
+                                          timestamps,
+                                          sizeof( uint64_t ),
+                                          VK_QUERY_RESULT_64_BIT );
+    if( res == VK_NOT_READY )
+        return true;
+    VK_CALL( res, "Cannot read GPU timestamps" );
+
+    const uint64_t ticks = ( timestamps[1] - timestamps[0] ) & app.vulkan.scaling.tick_mask;
+    vk_update_render_scale( app, ticks * app.vulkan.scaling.tick_period / 1000000.0 );
+
+    return true;
+}
+
+/* Frame encoders
+ *
+ * encoders run on worker threads and never call Vulkan
+ */
+
+static void swizzle_bgra_to_rgb( const uint8_t *src, uint8_t *dst, size_t pixels ) {
+    size_t idx = 0;
+
+#if defined( __SSSE3__ ) || defined( __AVX__ )
+    /* 4 pixels per iteration, every store writes 16 bytes but only 12 are valid,
+     * so the loop stops while the rest of the destination still has the room for them
+     */
+    const __m128i shuffle = _mm_setr_epi8( 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1 );
+    for( ; idx + 6 <= pixels; idx += 4 ) {
+        __m128i bgra = _mm_loadu_si128( reinterpret_cast< const __m128i* > ( src + 4 * idx ) );
+        _mm_storeu_si128( reinterpret_cast< __m128i* > ( dst + 3 * idx ), _mm_shuffle_epi8( bgra, shuffle ) );
+    }
+#elif defined( __ARM_NEON )
+    /* 16 pixels per iteration, load splits channels and store interleaves them back
+     */
+    for( ; idx + 16 <= pixels; idx += 16 ) {
+        uint8x16x4_t bgra = vld4q_u8( src + 4 * idx );
+        uint8x16x3_t rgb;
+        rgb.val[0] = bgra.val[2];
+        rgb.val[1] = bgra.val[1];
+        rgb.val[2] = bgra.val[0];
+        vst3q_u8( dst + 3 * idx, rgb );
+    }
+#endif
+
+    /* the rest of pixels, or all of them without SIMD
+     */
+    for( ; idx < pixels; ++idx ) {
+        dst[3 * idx + 0] = src[4 * idx + 2];
+        dst[3 * idx + 1] = src[4 * idx + 1];
+        dst[3 * idx + 2] = src[4 * idx + 0];
+    }
+}
+
+static bool write_ppm( const std::string &name, const uint8_t *rgb, uint32_t width, uint32_t height ) {
+    std::ofstream file( name, std::ios::binary );
+    if( !file )
+        return false;
+
+    file << "P6\n" << width << ' ' << height << "\n255\n";
+    file.write( reinterpret_cast< const char* > ( rgb ), static_cast< std::streamsize > ( 3ull * width * height ) );
+
+    return static_cast< bool > ( file );
+}
+
+inline void put_be32( std::vector< uint8_t > &out, uint32_t value ) {
+    out.push_back( static_cast< uint8_t > ( value >> 24 ) );
+    out.push_back( static_cast< uint8_t > ( value >> 16 ) );
+    out.push_back( static_cast< uint8_t > ( value >> 8 ) );
+    out.push_back( static_cast< uint8_t > ( value ) );
+}
+
+static uint32_t png_crc32( const uint8_t *data, size_t size ) {
+    static const std::array< uint32_t, 256 > table = [] {
+        std::array< uint32_t, 256 > result;
+        for( uint32_t n = 0; n < 256; ++n ) {
+            uint32_t c = n;
+            for( int k = 0; k < 8; ++k )
+                c = ( c & 1 ) ? ( 0xEDB88320u ^ ( c >> 1 ) ) : ( c >> 1 );
+            result[n] = c;
+        }
+        return result;
+    }();
+
+    uint32_t crc = 0xFFFFFFFFu;
+    for( size_t idx = 0; idx < size; ++idx )
+        crc = table[( crc ^ data[idx] ) & 0xFF] ^ ( crc >> 8 );
+
+    return crc ^ 0xFFFFFFFFu;
+}
+
+static void png_write_chunk( std::ofstream &file, const std::vector< uint8_t > &chunk ) {
+    /* chunk starts with its type, type is not included into the length
+     */
+    std::vector< uint8_t > header;
+    put_be32( header, static_cast< uint32_t > ( chunk.size() - 4 ) );
+
+    std::vector< uint8_t > crc;
+    put_be32( crc, png_crc32( chunk.data(), chunk.size() ) );
+
+    file.write( reinterpret_cast< const char* > ( header.data() ), 4 );
+    file.write( reinterpret_cast< const char* > ( chunk.data() ), static_cast< std::streamsize > ( chunk.size() ) );
+    file.write( reinterpret_cast< const char* > ( crc.data() ), 4 );
+}
+
+static bool write_png( const std::string &name, const uint8_t *rgb, uint32_t width, uint32_t height ) {
+    std::ofstream file( name, std::ios::binary );
+    if( !file )
+        return false;
+
+    static const uint8_t signature[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    file.write( reinterpret_cast< const char* > ( signature ), sizeof( signature ) );
+
+    std::vector< uint8_t > ihdr { 'I', 'H', 'D', 'R' };
+    put_be32( ihdr, width );
+    put_be32( ihdr, height );
+    ihdr.insert( ihdr.end(), {
+        8, /* bits per channel */
+        2, /* RGB */
+        0, /* deflate */
+        0, /* adaptive filtering */
+        0  /* no interlace */
+    } );
+    png_write_chunk( file, ihdr );
+
+    /* every row starts with the filter type, 0 - no filter
+     */
+    const size_t row_size = 3ull * width;
+    std::vector< uint8_t > raw;
+    raw.reserve( height * ( row_size + 1 ) );
+    for( uint32_t y = 0; y < height; ++y ) {
+        raw.push_back( 0 );
+        raw.insert( raw.end(), rgb + y * row_size, rgb + ( y + 1 ) * row_size );
+    }
+
+    /* zlib stream made of stored deflate blocks: the file is bigger,
+     * but the encoder is fast and doesn't need any library
+     */
+    std::vector< uint8_t > idat { 'I', 'D', 'A', 'T', 0x78, 0x01 };
+    idat.reserve( raw.size() + raw.size() / 65535 * 5 + 16 );
+    size_t offset = 0;
+    do {
+        const uint16_t length = static_cast< uint16_t > ( std::min< size_t > ( 65535, raw.size() - offset ) );
+        const bool     last   = ( offset + length == raw.size() );
+        idat.insert( idat.end(), {
+            static_cast< uint8_t > ( last ? 1 : 0 ),
+            static_cast< uint8_t > ( length & 0xFF ),
+            static_cast< uint8_t > ( length >> 8 ),
+            static_cast< uint8_t > ( ~length & 0xFF ),
+            static_cast< uint8_t > ( ( ~length >> 8 ) & 0xFF )
+        } );
+        idat.insert( idat.end(), raw.begin() + offset, raw.begin() + offset + length );
+        offset += length;
+    } while( offset < raw.size() );
+
+    /* Adler-32 of the uncompressed data, modulo is taken once per 5552 bytes
+     */
+    uint32_t a = 1, b = 0;
+    for( offset = 0; offset < raw.size(); ) {
+        const size_t end = std::min< size_t > ( raw.size(), offset + 5552 );
+        for( ; offset < end; ++offset ) {
+            a += raw[offset];
+            b += a;
+        }
+        a %= 65521;
+        b %= 65521;
+    }
+    put_be32( idat, ( b << 16 ) | a );
+    png_write_chunk( file, idat );
+
+    png_write_chunk( file, { 'I', 'E', 'N', 'D' } );
+
+    return static_cast< bool > ( file );
+}
+
+static void write_y4m_frame( vkVideoStream &stream,
+                             uint64_t sequence,
+                             const uint8_t *rgb,
+                             uint32_t width,
+                             uint32_t height ) {
+    /* planar YCbCr 4:4:4, BT.601 limited range
+     */
+    const size_t pixels = static_cast< size_t > ( width ) * height;
+    std::vector< uint8_t > planes( 3 * pixels );
+    for( size_t idx = 0; idx < pixels; ++idx ) {
+        const int r = rgb[3 * idx + 0];
+        const int g = rgb[3 * idx + 1];
+        const int b = rgb[3 * idx + 2];
+
+        planes[idx]              = static_cast< uint8_t > ( ( (  66 * r + 129 * g +  25 * b + 128 ) >> 8 ) + 16 );
+        planes[pixels + idx]     = static_cast< uint8_t > ( ( ( -38 * r -  74 * g + 112 * b + 128 ) >> 8 ) + 128 );
+        planes[2 * pixels + idx] = static_cast< uint8_t > ( ( ( 112 * r -  94 * g -  18 * b + 128 ) >> 8 ) + 128 );
+    }
+
+    /* frames are converted in parallel, but written in the order of capture
+     */
+    std::unique_lock< std::mutex > lock( stream.mutex );
+    stream.cv.wait( lock, [&stream, sequence] { return stream.written == sequence; } );
+
+    stream.file << "FRAME\n";
+    stream.file.write( reinterpret_cast< const char* > ( planes.data() ), static_cast< std::streamsize > ( planes.size() ) );
+
+    stream.written++;
+    stream.cv.notify_all();
+}
+
+static void capture_worker( vkApp *app ) {
+    auto &capture = app->vulkan.capture;
+    std::vector< uint8_t > rgb;
+
+    for( ;; ) {
+        vkCaptureJob job;
+        {
+            std::unique_lock< std::mutex > lock( capture.mutex );
+            capture.cv.wait( lock, [&capture] { return capture.stop || !capture.jobs.empty(); } );
+
+            /* all jobs are done before the worker stops
+             */
+            if( capture.jobs.empty() )
+                return;
+
+            job = std::move( capture.jobs.front() );
+            capture.jobs.pop_front();
+        }
+
+        /* readback buffer goes back to the ring right after the swizzle,
+         * slow encoding and disk don't hold it
+         */
+        const uint32_t width  = job.size.width;
+        const uint32_t height = job.size.height;
+        const size_t   pixels = static_cast< size_t > ( width ) * height;
+        rgb.resize( 3 * pixels );
+        swizzle_bgra_to_rgb( capture.buffers[job.buffer].data, rgb.data(), pixels );
+        {
+            std::lock_guard< std::mutex > lock( capture.mutex );
+            capture.free.push_back( job.buffer );
+        }
+
+        if( job.screenshot.has_value() ) {
+            const bool png = ( job.screenshot.value() == vkCaptureFormat::png );
+            const std::string name = "screenshot_" + std::to_string( job.frame ) + ( png ? ".png" : ".ppm" );
+            const bool done = png ? write_png( name, rgb.data(), width, height )
+                                  : write_ppm( name, rgb.data(), width, height );
+            std::cout
+                << ( done ? "Screenshot: " : "Cannot write screenshot: " )
+                    << name
+                    << std::endl;
+        }
+
+        if( job.stream )
+            write_y4m_frame( *job.stream, job.sequence, rgb.data(), width, height );
+    }
+}
+
+/* Vulkan frame capture
+ */
+
+static bool vk_create_readback_buffer( vkApp &app, vkReadbackBuffer &readback, VkDeviceSize size ) {
+    /* buffer in the free list is not used by GPU or workers,
+     * so it can be destroyed right now
+     */
+    readback.buffer.reset();
+    readback.memory.reset();
+    readback.size = 0;
+    readback.data = nullptr;
+
+    VkBufferCreateInfo buffer_create_info {
+        .sType       = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,
+        .size        = size,
+        .usage       = VK_BUFFER_USAGE_TRANSFER_DST_BIT,
+        .sharingMode = VK_SHARING_MODE_EXCLUSIVE
+    };
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VK_CALL( vkCreateBuffer( app.vulkan.device.object,
+                            &buffer_create_info,
+                             nullptr,
+                            &buffer ),
+             "Cannot create readback buffer" );
+    readback.buffer = vkUniqueBuffer( app.vulkan.device.object, buffer );
+
+    VkMemoryRequirements mem_reqs;
+    vkGetBufferMemoryRequirements( app.vulkan.device.object,
+                                   buffer,
+                                  &mem_reqs );
+
+    /* CPU reads every byte of the buffer, cached memory is much faster for that
+     */
+    uint32_t mem_type_idx = 0;
+    if( vk_find_memory_type( app,
+                             mem_reqs.memoryTypeBits,
+                             VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                             mem_type_idx ) )
+        readback.coherent = true;
+    else if( vk_find_memory_type( app,
+                                  mem_reqs.memoryTypeBits,
+                                  VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT,
+                                  mem_type_idx ) )
+        readback.coherent = false;
+    else if( vk_find_memory_type( app,
+                                  mem_reqs.memoryTypeBits,
+                                  VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                                  mem_type_idx ) )
+        readback.coherent = true;
+    else {
+        std::cerr
+            << "Cannot find host visible memory for the readback buffer"
+                << std::endl;
+        return false;
+    }
+
+    VkMemoryAllocateInfo mem_alloc_info {
+        .sType           = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,
+        .allocationSize  = mem_reqs.size,
+        .memoryTypeIndex = mem_type_idx
+    };
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    VK_CALL( vkAllocateMemory( app.vulkan.device.object,
+                              &mem_alloc_info,
+                               nullptr,
+                              &memory ),
+             "Cannot allocate memory for the readback buffer" );
+    readback.memory = vkUniqueDeviceMemory( app.vulkan.device.object, memory );
+
+    VK_CALL( vkBindBufferMemory( app.vulkan.device.object,
+                                 buffer,
+                                 memory,
+                                 0 ),
+             "Cannot bind memory to the readback buffer" );
+
+    /* memory stays mapped, vkFreeMemory unmaps it
+     */
+    void *data = nullptr;
+    VK_CALL( vkMapMemory( app.vulkan.device.object,
+                          memory,
+                          0,
+                          VK_WHOLE_SIZE,
+                          0,
+                         &data ),
+             "Cannot map memory of the readback buffer" );
+    readback.data = static_cast< const uint8_t* > ( data );
+    readback.size = size;
+
+    return true;
+}
+
+static bool vk_create_capture( vkApp &app ) {
+    auto &capture = app.vulkan.capture;
+
+    /* GPU may fill one buffer in every frame slot while workers encode others,
+     * buffers are allocated on the first use
+     */
+    const uint32_t worker_count = std::clamp( std::thread::hardware_concurrency() / 2, 1u, max_capture_workers );
+    capture.buffers.resize( max_frames_in_flight + worker_count );
+    for( uint32_t idx = 0; idx < capture.buffers.size(); ++idx )
+        capture.free.push_back( idx );
+
+    for( uint32_t idx = 0; idx < worker_count; ++idx )
+        capture.workers.emplace_back( capture_worker, &app );
+
+    return true;
+}
+
+static bool vk_capture_prepare( vkApp &app, const uint32_t slot ) {
+    auto &capture = app.vulkan.capture;
+
+    if( !capture.supported ) {
+        capture.screenshot.reset();
+        capture.recording = false;
+        return true;
+    }
+    if( !capture.screenshot.has_value() && !capture.recording )
+        return true;
+
+    /* never wait for workers, it is better to lose the frame
+     * than to break the frame rate
+     */
+    uint32_t buffer_idx;
+    {
+        std::lock_guard< std::mutex > lock( capture.mutex );
+        if( capture.free.empty() ) {
+            capture.dropped++;
+            return true;
+        }
+        buffer_idx = capture.free.back();
+        capture.free.pop_back();
+    }
+
+    const VkExtent2D   size        = app.vulkan.swapchain.display_size;
+    const VkDeviceSize buffer_size = 4ull * size.width * size.height;
+    if( capture.buffers[buffer_idx].size < buffer_size )
+        TUTORIAL_CALL( vk_create_readback_buffer( app, capture.buffers[buffer_idx], buffer_size ) );
+
+    vkCaptureJob job {
+        .buffer     = buffer_idx,
+        .frame      = app.vulkan.frame.submitted + 1,
+        .size       = size,
+        .screenshot = capture.screenshot
+    };
+    capture.screenshot.reset();
+
+    if( capture.recording ) {
+        /* all frames in Y4M file have the same size,
+         * new file is started when the swapchain is resized
+         */
+        if( !capture.stream || ( capture.stream->width != size.width ) || ( capture.stream->height != size.height ) ) {
+            const std::string name = "capture_" + std::to_string( ++capture.streams ) + ".y4m";
+
+            auto stream = std::make_shared< vkVideoStream > ();
+            stream->width  = size.width;
+            stream->height = size.height;
+            stream->file.open( name, std::ios::binary );
+            if( !stream->file ) {
+                std::cerr
+                    << "Cannot create video file "
+                        << name
+                        << std::endl;
+                capture.recording = false;
+                capture.stream.reset();
+            }
+            else {
+                stream->file
+                    << "YUV4MPEG2 W" << size.width
+                    << " H" << size.height
+                    << " F" << capture_frame_rate << ":1 Ip A1:1 C444\n";
+                capture.stream = stream;
+
+                std::cout
+                    << "Recording to "
+                        << name
+                        << std::endl;
+            }
+        }
+
+        if( capture.stream ) {
+            job.stream   = capture.stream;
+            job.sequence = capture.stream->queued++;
+        }
+    }
+
+    capture.pending[slot] = std::move( job );
+
+    return true;
+}
+
+static bool vk_capture_collect( vkApp &app, const uint32_t slot ) {
+    auto &capture = app.vulkan.capture;
+    if( !capture.pending[slot].has_value() )
+        return true;
+
+    /* fence of the slot is signaled, the copy is over
+     */
+    const vkReadbackBuffer &readback = capture.buffers[capture.pending[slot]->buffer];
+    if( !readback.coherent ) {
+        VkMappedMemoryRange range {
+            .sType  = VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE,
+            .memory = readback.memory.get(),
+            .offset = 0,
+            .size   = VK_WHOLE_SIZE
+        };
+        VK_CALL( vkInvalidateMappedMemoryRanges( app.vulkan.device.object,
+                                                 1,
+                                                &range ),
+                 "Cannot invalidate memory of the readback buffer" );
+    }
+
+    {
+        std::lock_guard< std::mutex > lock( capture.mutex );
+        capture.jobs.push_back( std::move( capture.pending[slot].value() ) );
+    }
+    capture.cv.notify_one();
+    capture.pending[slot].reset();
+
+    return true;
+}
+
+static bool vk_cleanup_capture( vkApp &app ) {
+    auto &capture = app.vulkan.capture;
+
+    /* GPU is idle, frames which are still in slots go to workers too
+     */
+    for( uint32_t slot = 0; slot < max_frames_in_flight; ++slot )
+        TUTORIAL_CALL( vk_capture_collect( app, slot ) );
+
+    {
+        std::lock_guard< std::mutex > lock( capture.mutex );
+        capture.stop = true;
+    }
+    capture.cv.notify_all();
+    for( auto &worker: capture.workers )
+        worker.join();
+    capture.workers.clear();
+    capture.stream.reset();
+
+    for( auto &readback: capture.buffers ) {
+        readback.buffer.reset();
+        readback.memory.reset();
+    }
+    capture.buffers.clear();
+    capture.free.clear();
+
+    return true;
+}
+
+/* Vulkan Sync. objects
+ */
+
+static bool vk_create_sync_objects( vkApp &app ) {
+    if( app.vulkan.device.object == VK_NULL_HANDLE )
+        return false;
+
+    VkSemaphoreCreateInfo semaphore_create_info {
+        .sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO
+    };
+
+    /* fence is created signaled, so the first wait for every frame slot will not block
+     */
+    VkFenceCreateInfo fence_create_info {
+        .sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,
+        .flags = VK_FENCE_CREATE_SIGNALED_BIT
+    };
+
+    for( uint32_t slot = 0; slot < max_frames_in_flight; ++slot ) {
+        VkSemaphore image_available    = VK_NULL_HANDLE;
+        VkSemaphore rendering_finished = VK_NULL_HANDLE;
+        VkFence     gpu_fence          = VK_NULL_HANDLE;
+
+        VK_CALL( vkCreateSemaphore( app.vulkan.device.object,
+                                   &semaphore_create_info,
+                                    nullptr,
+                                   &image_available ),
+                 "Cannot create the semaphore of surface image availability" );
+        app.vulkan.sync.image_available.emplace_back( app.vulkan.device.object, image_available );
+
+        VK_CALL( vkCreateSemaphore( app.vulkan.device.object,
+                                   &semaphore_create_info,
+                                    nullptr,
+                                   &rendering_finished ),
+                 "Cannot create the semaphore of frame rendering end" );
+        app.vulkan.sync.rendering_finished.emplace_back( app.vulkan.device.object, rendering_finished );
+
+        VK_CALL( vkCreateFence( app.vulkan.device.object,
+                               &fence_create_info,
+                                nullptr,
+                               &gpu_fence ),
+                 "Cannot create fence object for the physical device" );
+        app.vulkan.sync.gpu_fence.emplace_back( app.vulkan.device.object, gpu_fence );
+    }
+
+    return true;
+}
+
+static bool vk_cleanup_sync_objects( vkApp &app ) {
+    app.vulkan.sync.gpu_fence.clear();
+    app.vulkan.sync.rendering_finished.clear();
+    app.vulkan.sync.image_available.clear();
+
+    return true;
+}
+
+/* Vulkan Command Buffers
+ */
+
+static bool vk_create_command_buffers( vkApp &app ) {
+    if( app.vulkan.device.object == VK_NULL_HANDLE )
+        return false;
+
+    VkCommandPoolCreateInfo pool_create_info {
+        .sType            = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO,
+        .flags            = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT,
+        .queueFamilyIndex = app.vulkan.device.graph_family_idx
+    };
+    VkCommandPool pool = VK_NULL_HANDLE;
+    VK_CALL( vkCreateCommandPool( app.vulkan.device.object,
+                                 &pool_create_info,
+                                  nullptr,
+                                 &pool ),
+             "Cannot create Vulkan Command Pool" );
+    app.vulkan.render.pool = vkUniqueCommandPool( app.vulkan.device.object, pool );
+
+    /* command buffer belongs to the frame slot and not to the swapchain image,
+     * this way the swapchain can be recreated without touching command buffers
+     */
+    VkCommandBufferAllocateInfo buffer_alloc_info {
+        .sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO,
+        .commandPool        = app.vulkan.render.pool.get(),
+        .level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY,
+        .commandBufferCount = max_frames_in_flight
+    };
+    app.vulkan.render.cmds.resize( max_frames_in_flight );
+    VK_CALL( vkAllocateCommandBuffers( app.vulkan.device.object,
+                                      &buffer_alloc_info,
+                                       app.vulkan.render.cmds.data() ),
+             "Cannot allocate memory for Vulkan command buffers" );
+
+    return true;
+}
+
+static bool vk_cleanup_command_buffer( vkApp &app ) {
+    if( !app.vulkan.render.cmds.empty() )
+        vkFreeCommandBuffers( app.vulkan.device.object,
+            app.vulkan.render.pool.get(),
+            static_cast< uint32_t > ( app.vulkan.render.cmds.size() ),
+            app.vulkan.render.cmds.data() );
+    app.vulkan.render.cmds.clear();
+
+    app.vulkan.render.pool.reset();
+
+    return true;
+}
+
+static bool vk_record_command_buffer( vkApp &app, const uint32_t slot, const uint32_t image_idx ) {
+    VkCommandBuffer cmd = app.vulkan.render.cmds[slot];
+    const VkExtent2D render_size  = app.vulkan.scaling.render_size;
+    const VkExtent2D display_size = app.vulkan.swapchain.display_size;
+
+    VkClearValue clear_values[] = {
+        { .color        = { { 0.0f, 0.3f, 0.6f, 1.0f } } },
+        { .depthStencil = { .depth = 1.0f, .stencil = 0 } }
+    };
+    VkImageSubresourceRange subres_range {
+        .aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT,
+        .baseMipLevel   = 0,
+        .levelCount     = 1,
+        .baseArrayLayer = 0,
+        .layerCount     = 1
+    };
+    VkImageSubresourceLayers subres_layers {
+        .aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT,
+        .mipLevel       = 0,
+        .baseArrayLayer = 0,
+        .layerCount     = 1
+    };
+
+    /* command buffer is recorded again for every frame
+     */
+    VkCommandBufferBeginInfo cmd_begin_info {
+        .sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
+        .flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT
+    };
+
+    /* scene is rendered only to the part of the offscreen image
+     * which corresponds to the actual internal resolution
+     */
+    VkRenderPassBeginInfo render_pass_begin_info {
+        .sType           = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO,
+        .renderPass      = app.vulkan.offscreen.render_pass.get(),
+        .framebuffer     = app.vulkan.offscreen.frame.get(),
+        .renderArea      = { .offset = { .x = 0, .y = 0 },
+                             .extent = render_size },
+        .clearValueCount = 2,
+        .pClearValues    = clear_values
+    };
+
+    /* checkerboard in internal pixels, the upscale makes its edges soft
+     * when the scale goes down
+     */
+    const uint32_t cells_x = 16;
+    const uint32_t cells_y = 9;
+    VkClearAttachment cell_attachment {
+        .aspectMask      = VK_IMAGE_ASPECT_COLOR_BIT,
+        .colorAttachment = 0,
+        .clearValue      = { .color = { { 0.9f, 0.6f, 0.1f, 1.0f } } }
+    };
+    std::vector< VkClearRect > cells;
+    for( uint32_t y = 0; y < cells_y; ++y ) {
+        for( uint32_t x = ( y & 1 ); x < cells_x; x += 2 ) {
+            const uint32_t x0 = render_size.width  * x / cells_x;
+            const uint32_t y0 = render_size.height * y / cells_y;
+            const uint32_t x1 = render_size.width  * ( x + 1 ) / cells_x;
+            const uint32_t y1 = render_size.height * ( y + 1 ) / cells_y;
+            if( ( x1 == x0 ) || ( y1 == y0 ) )
+                continue;
+
+            cells.push_back( VkClearRect {
+                .rect           = { .offset = { .x = static_cast< int32_t > ( x0 ), .y = static_cast< int32_t > ( y0 ) },
+                                    .extent = { .width = x1 - x0, .height = y1 - y0 } },
+                .baseArrayLayer = 0,
+                .layerCount     = 1
+            } );
+        }
+    }
+
+    VkImageMemoryBarrier presentation_to_blit_barrier {
+        .sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .srcAccessMask       = VK_ACCESS_MEMORY_READ_BIT,
+        .dstAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .oldLayout           = VK_IMAGE_LAYOUT_UNDEFINED,
+        .newLayout           = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        .srcQueueFamilyIndex = app.vulkan.device.present_family_idx,
+        .dstQueueFamilyIndex = app.vulkan.device.present_family_idx,
+        .image               = app.vulkan.swapchain.images[image_idx],
+        .subresourceRange    = subres_range
+    };
+    VkImageMemoryBarrier blit_to_presentation_barrier {
+        .sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .srcAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .dstAccessMask       = VK_ACCESS_MEMORY_READ_BIT,
+        .oldLayout           = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        .newLayout           = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
+        .srcQueueFamilyIndex = app.vulkan.device.present_family_idx,
+        .dstQueueFamilyIndex = app.vulkan.device.present_family_idx,
+        .image               = app.vulkan.swapchain.images[image_idx],
+        .subresourceRange    = subres_range
+    };
+
+    /* captured frame is copied from the swapchain image to the readback buffer
+     * after the upscale, so the copy has exactly the pixels of the display
+     */
+    const std::optional< vkCaptureJob > &capture_job = app.vulkan.capture.pending[slot];
+    VkImageMemoryBarrier blit_to_copy_barrier {
+        .sType               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER,
+        .srcAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .dstAccessMask       = VK_ACCESS_TRANSFER_READ_BIT,
+        .oldLayout           = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+        .newLayout           = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+        .srcQueueFamilyIndex = app.vulkan.device.present_family_idx,
+        .dstQueueFamilyIndex = app.vulkan.device.present_family_idx,
+        .image               = app.vulkan.swapchain.images[image_idx],
+        .subresourceRange    = subres_range
+    };
+    if( capture_job.has_value() ) {
+        blit_to_presentation_barrier.srcAccessMask = VK_FALSE;
+        blit_to_presentation_barrier.oldLayout     = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    }
+    VkBufferImageCopy copy_region {
+        .bufferOffset      = 0,
+        .bufferRowLength   = 0, /* tightly packed */
+        .bufferImageHeight = 0,
+        .imageSubresource  = subres_layers,
+        .imageOffset       = { 0, 0, 0 },
+        .imageExtent       = { display_size.width, display_size.height, 1 }
+    };
+
+    /* pixels must be visible for the host after the fence
+     */
+    VkBufferMemoryBarrier copy_to_host_barrier {
+        .sType               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+        .srcAccessMask       = VK_ACCESS_TRANSFER_WRITE_BIT,
+        .dstAccessMask       = VK_ACCESS_HOST_READ_BIT,
+        .srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED,
+        .buffer              = capture_job.has_value() ? app.vulkan.capture.buffers[capture_job->buffer].buffer.get()
+                                                       : VK_NULL_HANDLE,
+        .offset              = 0,
+        .size                = VK_WHOLE_SIZE
+    };
+
+    /* upscale the internal resolution to the whole swapchain image
+     */
+    VkImageBlit upscale {
+        .srcSubresource = subres_layers,
+        .srcOffsets     = { { 0, 0, 0 },
+                            { static_cast< int32_t > ( render_size.width ),
+                              static_cast< int32_t > ( render_size.height ),
+                              1 } },
+        .dstSubresource = subres_layers,
+        .dstOffsets     = { { 0, 0, 0 },
+                            { static_cast< int32_t > ( display_size.width ),
+                              static_cast< int32_t > ( display_size.height ),
+                              1 } }
+    };
+
+    VK_CALL( vkBeginCommandBuffer( cmd,
+                                  &cmd_begin_info ),
+             "Cannot start recording the command buffer" );
+
+        /* GPU time of the scene is measured between two timestamps around the scene render pass,
+         * the blit waits for the acquired image, so it stays outside: otherwise the wait
+         * for the display would look like GPU load to the resolution controller
+         */
+        if( app.vulkan.scaling.timestamps ) {
+            vkCmdResetQueryPool( cmd,
+                                 app.vulkan.scaling.queries.get(),
+                                 2 * slot,
+                                 2 );
+            vkCmdWriteTimestamp( cmd,
+                                 VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                                 app.vulkan.scaling.queries.get(),
+                                 2 * slot );
+        }
+
+        vkCmdBeginRenderPass( cmd,
+                             &render_pass_begin_info,
+                              VK_SUBPASS_CONTENTS_INLINE );
+            if( !cells.empty() )
+                vkCmdClearAttachments( cmd,
+                                       1,
+                                      &cell_attachment,
+                                       static_cast< uint32_t > ( cells.size() ),
+                                       cells.data() );
+        vkCmdEndRenderPass( cmd );
+
+        if( app.vulkan.scaling.timestamps )
+            vkCmdWriteTimestamp( cmd,
+                                 VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                                 app.vulkan.scaling.queries.get(),
+                                 2 * slot + 1 );
+
+        vkCmdPipelineBarrier( cmd,
+                              VK_PIPELINE_STAGE_TRANSFER_BIT,
+                              VK_PIPELINE_STAGE_TRANSFER_BIT,
+                              0,
+                              0,
+                              nullptr,
+                              0,
+                              nullptr,
+                              1,
+                             &presentation_to_blit_barrier );
+        vkCmdBlitImage( cmd,
+                        app.vulkan.offscreen.color.image.get(),
+                        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                        app.vulkan.swapchain.images[image_idx],
+                        VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                        1,
+                       &upscale,
+                        app.vulkan.offscreen.filter );
+
+        if( capture_job.has_value() ) {
+            vkCmdPipelineBarrier( cmd,
+                                  VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                  VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                  0,
+                                  0,
+                                  nullptr,
+                                  0,
+                                  nullptr,
+                                  1,
+                                 &blit_to_copy_barrier );
+            vkCmdCopyImageToBuffer( cmd,
+                                    app.vulkan.swapchain.images[image_idx],
+                                    VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                                    app.vulkan.capture.buffers[capture_job->buffer].buffer.get(),
+                                    1,
+                                   &copy_region );
+            vkCmdPipelineBarrier( cmd,
+                                  VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                  VK_PIPELINE_STAGE_HOST_BIT,
+                                  0,
+                                  0,
+                                  nullptr,
+                                  1,
+                                 &copy_to_host_barrier,
+                                  0,
+                                  nullptr );
+        }
+        vkCmdPipelineBarrier( cmd,
+                              VK_PIPELINE_STAGE_TRANSFER_BIT,
+                              VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+                              0,
+                              0,
+                              nullptr,
+                              0,
+                              nullptr,
+                              1,
+                             &blit_to_presentation_barrier );
+
+    VK_CALL( vkEndCommandBuffer( cmd ),
+             "Cannot finish recording the command buffer" );
+
+    return true;
+}
+
+/* Recreate Swapchain
+ */
+
+static bool vk_recreate_swapchain( vkApp &app ) {
+    int window_width, window_height;
+
+    do {
+        glfwGetFramebufferSize( app.glfw.window,
+                               &window_width,
+                               &window_height );
+        glfwWaitEvents();
+    } while( window_width == 0 || window_height == 0  );
+
+    /* GPU is not drained here: all previous objects might be still in use
+     * by frames in flight, so they go to the deletion queue
+     */
+    vk_retire_offscreen( app );
+
+    for( auto &view: app.vulkan.swapchain.views )
+        vk_retire( app, view );
+    app.vulkan.swapchain.views.clear();
+
+    TUTORIAL_CALL( vk_cleanup_swapchain_images( app ) );
+
+    /* create new objects,
+     * old swapchain will be retired by vk_create_swapchain()
+     */
+    TUTORIAL_CALL( vk_create_swapchain( app ) );
+    TUTORIAL_CALL( vk_get_swapchain_images( app ) );
+    TUTORIAL_CALL( vk_create_image_views( app ) );
+    TUTORIAL_CALL( vk_create_offscreen( app ) );
+
+    app.vulkan.swapchain.recreate = false;
+
+    return true;
+}
+
+/* common Vulkan functions
+ */
+
+static bool init_vulkan( vkApp &app ) {
+    if( !app.glfw.window )
+        return false;
+
+    /* Call volk to load Vulkan
+     */
+    VK_CALL( volkInitialize(),
+             "Cannot initialize Vulkan loader" );
+
+    /* Check VK_EXT_debug_utils support
+     */
+    uint32_t property_count = 0;
+    VK_CALL( vkEnumerateInstanceLayerProperties( &property_count, nullptr ),
+             "Fail to read count of layer properties of the vulkan instance" );
+
+    std::vector< VkLayerProperties > available_properties( property_count );
+    VK_CALL( vkEnumerateInstanceLayerProperties( &property_count, available_properties.data() ),
+             "Cannot enumerate layer properties of the vulkan instance" );
+
+    bool layer_found { false };
+    const std::string validation_layer_name( khronos_validation_layer_name );
+    for( const auto &layer_property: available_properties ) {
+        const std::string layer_name( layer_property.layerName );
+        if( validation_layer_name == layer_name ) {
+            layer_found = true;
+            break;
+        }
+    }
+
+    /* VK_EXT_debug_utils is supported -> enable debug messages
+     */
+    if( layer_found ) {
+        app.vulkan.debug.enable = true;
+        app.vulkan.instance.required_extensions.push_back( VK_EXT_DEBUG_UTILS_EXTENSION_NAME );
+    }
+
+    TUTORIAL_CALL( vk_create_instance( app ) );
+    TUTORIAL_CALL( vk_create_surface( app ) );
+
+    TUTORIAL_CALL( vk_select_phy_device( app ) );
+
+    TUTORIAL_CALL( vk_create_device( app ) );
+    TUTORIAL_CALL( vk_create_swapchain( app ) );
+
+    TUTORIAL_CALL( vk_get_swapchain_images( app ) );
+
+    TUTORIAL_CALL( vk_create_image_views( app ) );
+    TUTORIAL_CALL( vk_create_offscreen( app ) );
+
+    TUTORIAL_CALL( vk_create_sync_objects( app ) );
+    TUTORIAL_CALL( vk_create_command_buffers( app ) );
+    TUTORIAL_CALL( vk_create_timestamps( app ) );
+    TUTORIAL_CALL( vk_create_capture( app ) );
+
+    app.vulkan.swapchain.recreate = false;
+
+    return true;
+}
+
+static bool cleanup_vulkan( vkApp &app ) {
+    VK_CALL( vkDeviceWaitIdle( app.vulkan.device.object ),
+             "Vulkan device wait fail" );
+
+    /* GPU is idle, everything in the deletion queue can go away
+     */
+    vk_collect_retired( app, std::numeric_limits< uint64_t >::max() );
+
+    TUTORIAL_CALL( vk_cleanup_capture( app ) );
+    TUTORIAL_CALL( vk_cleanup_timestamps( app ) );
+    TUTORIAL_CALL( vk_cleanup_command_buffer( app ) );
+    TUTORIAL_CALL( vk_cleanup_sync_objects( app ) );
+    TUTORIAL_CALL( vk_cleanup_offscreen( app ) );
+    TUTORIAL_CALL( vk_cleanup_image_views( app ) );
+    TUTORIAL_CALL( vk_cleanup_swapchain_images( app ) );
+    TUTORIAL_CALL( vk_cleanup_swapchain( app ) );
+    TUTORIAL_CALL( vk_cleanup_device( app ) );
+    TUTORIAL_CALL( vk_cleanup_surface( app ) );
+    TUTORIAL_CALL( vk_cleanup_instance( app ) );
+
+    return true;
+}
+
+static bool init( vkApp &app ) {
+    TUTORIAL_CALL( init_glfw( app ) );
+    TUTORIAL_CALL( init_window( app ) );
+    TUTORIAL_CALL( init_vulkan( app ) );
+
+    return true;
+}
+
+static bool cleanup( vkApp &app ) {
+    TUTORIAL_CALL( cleanup_vulkan( app ) );
+    TUTORIAL_CALL( cleanup_window( app ) );
+    TUTORIAL_CALL( cleanup_glfw( app ) );
+
+    return true;
+}
+
+
+/* Latency limiter
+ */
+
+static bool vk_limit_latency( vkApp &app ) {
+    if( !app.vulkan.latency.enable )
+        return true;
+
+    /* the oldest frame which is allowed to stay in the queue
+     */
+    const uint64_t frames_behind = std::clamp( max_queued_frames, 1u, max_frames_in_flight ) - 1;
+
+    if( app.vulkan.latency.present_wait ) {
+        if( app.vulkan.latency.present_id < app.vulkan.latency.first_id + frames_behind )
+            return true;
+
+        /* wait until the frame is actually on the screen
+         */
+        VkResult res = vkWaitForPresentKHR( app.vulkan.device.object,
+                                            app.vulkan.swapchain.object.get(),
+                                            app.vulkan.latency.present_id - frames_behind,
+                                            present_wait_timeout );
+        if( ( res == VK_ERROR_OUT_OF_DATE_KHR ) || ( res == VK_SUBOPTIMAL_KHR ) )
+            app.vulkan.swapchain.recreate = true;
+        else if( ( res != VK_SUCCESS ) && ( res != VK_TIMEOUT ) ) {
+            std::cerr
+                << "VK_CALL error: "
+                    << "Fail to wait for the present"
+                    << std::endl;
+            return false;
+        }
+
+        return true;
+    }
+
+    /* fallback: wait until GPU finishes the frame,
+     * frame number N was submitted in the slot (N - 1) % max_frames_in_flight
+     */
+    if( app.vulkan.frame.submitted <= frames_behind )
+        return true;
+
+    const uint64_t frame = app.vulkan.frame.submitted - frames_behind;
+    const uint32_t slot  = static_cast< uint32_t > ( ( frame - 1 ) % max_frames_in_flight );
+    if( app.vulkan.frame.slot_frame[slot] != frame )
+        return true;
+
+    VkFence gpu_fence = app.vulkan.sync.gpu_fence[slot].get();
+    VK_CALL( vkWaitForFences( app.vulkan.device.object,
+                              1,
+                             &gpu_fence,
+                              VK_TRUE,
+                              std::numeric_limits< uint64_t >::max() ),
+             "Fail to synchronize with GPU fence" );
+
+    return true;
+}
+
+/* Frame statistics
+ */
+
+static void update_frame_stats( vkApp &app ) {
+    const double now = glfwGetTime();
+
+    /* present-to-present interval
+     */
+    if( app.stats.last_present > 0.0 ) {
+        app.stats.interval_sum += now - app.stats.last_present;
+        app.stats.interval_count++;
+    }
+    else
+        app.stats.period_start = now;
+    app.stats.last_present = now;
+
+    /* report once per second
+     */
+    const double period = now - app.stats.period_start;
+    if( period < 1.0 )
+        return;
+
+    app.stats.fps              = app.stats.interval_count / period;
+    app.stats.present_interval = app.stats.interval_count
+                                     ? 1000.0 * app.stats.interval_sum / app.stats.interval_count
+                                     : 0.0;
+    std::cout
+        << "Frame stats: "
+            << app.stats.fps
+            << " fps, present interval "
+            << app.stats.present_interval
+            << " ms, GPU time "
+            << app.vulkan.scaling.gpu_frame_time
+            << " ms, render size "
+            << app.vulkan.scaling.render_size.width
+            << 'x'
+            << app.vulkan.scaling.render_size.height
+            << ", latency mode "
+            << ( app.vulkan.latency.enable ? "on" : "off" )
+            << std::endl;
+
+    app.stats.period_start   = now;
+    app.stats.interval_sum   = 0.0;
+    app.stats.interval_count = 0;
+}
+
+static bool draw( vkApp &app ) {
+    const uint32_t slot = app.vulkan.frame.slot;
+    VkFence gpu_fence = app.vulkan.sync.gpu_fence[slot].get();
+
+    /* wait only for the frame which used this slot last time,
+     * other frames in flight continue to run on GPU
+     */
+    VK_CALL( vkWaitForFences( app.vulkan.device.object,
+                              1,
+                             &gpu_fence,
+                              VK_TRUE,
+                              std::numeric_limits< uint64_t >::max() ),
+             "Fail to synchronize with GPU fence" );
+
+    /* all frames submitted up to the last frame of this slot are over,
+     * objects retired before them can be destroyed
+     */
+    app.vulkan.frame.completed = std::max( app.vulkan.frame.completed,
+                                           app.vulkan.frame.slot_frame[slot] );
+    vk_collect_retired( app, app.vulkan.frame.completed );
+
+    /* GPU time of the finished frame drives the internal resolution of the next one
+     */
+    TUTORIAL_CALL( vk_read_gpu_time( app, slot ) );
+
+    /* captured pixels of the finished frame go to workers
+     */
+    TUTORIAL_CALL( vk_capture_collect( app, slot ) );
+
+    uint32_t image_idx;
+    VkResult res = vkAcquireNextImageKHR( app.vulkan.device.object,
+                                          app.vulkan.swapchain.object.get(),
+                                          std::numeric_limits< uint64_t >::max(),
+                                          app.vulkan.sync.image_available[slot].get(),
+                                          VK_NULL_HANDLE,
+                                         &image_idx );
+    if( res == VK_ERROR_OUT_OF_DATE_KHR ) {
+        /* nothing was submitted, fence of the slot is still signaled
+         */
+        TUTORIAL_CALL( vk_recreate_swapchain( app ) );
+        return true;
+    }
+    else if( ( res != VK_SUCCESS ) && ( res != VK_SUBOPTIMAL_KHR ) )
+        return false;
+
+    /* reset the fence only when the work will be submitted for sure
+     */
+    VK_CALL( vkResetFences( app.vulkan.device.object,
+                            1,
+                           &gpu_fence ),
+             "Fail to reset GPU Fence" );
+
+    TUTORIAL_CALL( vk_capture_prepare( app, slot ) );
+    TUTORIAL_CALL( vk_record_command_buffer( app, slot, image_idx ) );
+
+    VkPipelineStageFlags wait_dst_stage_mask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    VkSubmitInfo submit_info {
+        .sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO,
+        .waitSemaphoreCount   = 1,
+        .pWaitSemaphores      = app.vulkan.sync.image_available[slot].ptr(),
+        .pWaitDstStageMask    = &wait_dst_stage_mask,
+        .commandBufferCount   = 1,
+        .pCommandBuffers      = &app.vulkan.render.cmds[slot],
+        .signalSemaphoreCount = 1,
+        .pSignalSemaphores    = app.vulkan.sync.rendering_finished[slot].ptr()
+    };
+    VK_CALL( vkQueueSubmit( app.vulkan.device.present_queue,
+                            1,
+                           &submit_info,
+                            gpu_fence ),
+             "Fail to submit command buffer" );
+
+    /* remember which frame is running in this slot
+     */
+    app.vulkan.frame.submitted++;
+    app.vulkan.frame.slot_frame[slot] = app.vulkan.frame.submitted;
+
+    /* every present gets own ID, the latency limiter will wait for it later
+     */
+    const uint64_t present_id = app.vulkan.latency.present_id + 1;
+    VkPresentIdKHR present_id_info {
+        .sType          = VK_STRUCTURE_TYPE_PRESENT_ID_KHR,
+        .swapchainCount = 1,
+        .pPresentIds    = &present_id
+    };
+
+    VkPresentInfoKHR present_info {
+        .sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR,
+        .pNext              = app.vulkan.latency.present_wait ? &present_id_info : nullptr,
+        .waitSemaphoreCount = 1,
+        .pWaitSemaphores    = app.vulkan.sync.rendering_finished[slot].ptr(),
+        .swapchainCount     = 1,
+        .pSwapchains        = app.vulkan.swapchain.object.ptr(),
+        .pImageIndices      = &image_idx
+    };
+
+    /* next frame will use the next slot
+     */
+    app.vulkan.frame.slot = ( slot + 1 ) % max_frames_in_flight;
+
+    res = vkQueuePresentKHR( app.vulkan.device.present_queue,
+                             &present_info );
+    app.vulkan.latency.present_id = present_id;
+    update_frame_stats( app );
+
+    if( ( res == VK_ERROR_OUT_OF_DATE_KHR)  || ( res == VK_SUBOPTIMAL_KHR ) || ( app.vulkan.swapchain.recreate ) ) {
+        TUTORIAL_CALL( vk_recreate_swapchain( app ) );
+    }
+    else if( res != VK_SUCCESS ) {
+        std::cerr
+            << "VK_CALL error: "
+                << "Fail to submit present command buffer"
+                << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+int main() {
+    vkApp app;
+
+    if( !init( app ) ) {
+        std::cerr
+            << "Cannot initialize the application"
+                << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    /* render loop
+     */
+    while( glfwWindowShouldClose( app.glfw.window ) == GLFW_FALSE ) {
+        /* don't run too far ahead of the display,
+         * input must be read as late as possible
+         */
+        vk_limit_latency( app );
+
+        /* proceed keyboard and mouse
+         */
+        glfwPollEvents();
+
+        /* draw the context of the window
+         */
+        draw( app );
+    }
+
+    if( !cleanup( app ) ) {
+        std::cerr
+            << "Cleanup failed"
+                << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout
+        << "Job is done!"
+            << std::endl;
+    return EXIT_SUCCESS;
+}